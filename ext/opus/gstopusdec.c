@@ -98,6 +98,8 @@ static gboolean gst_opus_dec_start (GstAudioDecoder * dec);
 static gboolean gst_opus_dec_stop (GstAudioDecoder * dec);
 static GstFlowReturn gst_opus_dec_handle_frame (GstAudioDecoder * dec,
     GstBuffer * buffer);
+static GstFlowReturn gst_opus_dec_handle_frames (GstAudioDecoder * dec,
+    GstBuffer ** buffers, guint n_buffers);
 static gboolean gst_opus_dec_set_format (GstAudioDecoder * bdec,
     GstCaps * caps);
 static void gst_opus_dec_get_property (GObject * object, guint prop_id,
@@ -124,6 +126,7 @@ gst_opus_dec_class_init (GstOpusDecClass * klass)
   adclass->start = GST_DEBUG_FUNCPTR (gst_opus_dec_start);
   adclass->stop = GST_DEBUG_FUNCPTR (gst_opus_dec_stop);
   adclass->handle_frame = GST_DEBUG_FUNCPTR (gst_opus_dec_handle_frame);
+  adclass->handle_frames = GST_DEBUG_FUNCPTR (gst_opus_dec_handle_frames);
   adclass->set_format = GST_DEBUG_FUNCPTR (gst_opus_dec_set_format);
   adclass->getcaps = GST_DEBUG_FUNCPTR (gst_opus_dec_getcaps);
 
@@ -170,6 +173,9 @@ gst_opus_dec_reset (GstOpusDec * dec)
   dec->last_known_buffer_duration = GST_CLOCK_TIME_NONE;
 }
 
+/* number of packets decoded at once in non-live pipelines */
+#define GST_OPUS_DEC_MAX_BATCH 8
+
 static void
 gst_opus_dec_init (GstOpusDec * dec)
 {
@@ -177,6 +183,8 @@ gst_opus_dec_init (GstOpusDec * dec)
   dec->apply_gain = DEFAULT_APPLY_GAIN;
 
   gst_audio_decoder_set_needs_format (GST_AUDIO_DECODER (dec), TRUE);
+  gst_audio_decoder_set_max_batch (GST_AUDIO_DECODER (dec),
+      GST_OPUS_DEC_MAX_BATCH);
   gst_audio_decoder_set_use_default_pad_acceptcaps (GST_AUDIO_DECODER_CAST
       (dec), TRUE);
   GST_PAD_SET_ACCEPT_TEMPLATE (GST_AUDIO_DECODER_SINK_PAD (dec));
@@ -445,6 +453,35 @@ packet_duration_opus (const unsigned char *data, size_t bytes)
   return duration / 48.f * 1000000;
 }
 
+/* Would be better off leaving this to a volume element, as this is
+   a naive conversion that does too many int/float conversions.
+   However, we don't have control over the pipeline...
+   So make it optional if the user program wants to use a volume,
+   but do it by default so the correct volume goes out by default */
+static void
+gst_opus_dec_apply_gain (GstOpusDec * dec, GstBuffer * outbuf)
+{
+  GstMapInfo omap;
+  gsize rsize;
+  unsigned int i, nsamples;
+  double volume = dec->r128_gain_volume;
+  gint16 *samples;
+
+  if (!dec->apply_gain || !dec->r128_gain)
+    return;
+
+  gst_buffer_map (outbuf, &omap, GST_MAP_READWRITE);
+  samples = (gint16 *) omap.data;
+  rsize = omap.size;
+  GST_DEBUG_OBJECT (dec, "Applying gain: volume %f", volume);
+  nsamples = rsize / 2;
+  for (i = 0; i < nsamples; ++i) {
+    int sample = (int) (samples[i] * volume + 0.5);
+    samples[i] = sample < -32768 ? -32768 : sample > 32767 ? 32767 : sample;
+  }
+  gst_buffer_unmap (outbuf, &omap);
+}
+
 static GstFlowReturn
 opus_dec_chain_parse_data (GstOpusDec * dec, GstBuffer * buffer)
 {
@@ -712,28 +749,8 @@ opus_dec_chain_parse_data (GstOpusDec * dec, GstBuffer * buffer)
   }
 
   /* Apply gain */
-  /* Would be better off leaving this to a volume element, as this is
-     a naive conversion that does too many int/float conversions.
-     However, we don't have control over the pipeline...
-     So make it optional if the user program wants to use a volume,
-     but do it by default so the correct volume goes out by default */
-  if (dec->apply_gain && outbuf && dec->r128_gain) {
-    gsize rsize;
-    unsigned int i, nsamples;
-    double volume = dec->r128_gain_volume;
-    gint16 *samples;
-
-    gst_buffer_map (outbuf, &omap, GST_MAP_READWRITE);
-    samples = (gint16 *) omap.data;
-    rsize = omap.size;
-    GST_DEBUG_OBJECT (dec, "Applying gain: volume %f", volume);
-    nsamples = rsize / 2;
-    for (i = 0; i < nsamples; ++i) {
-      int sample = (int) (samples[i] * volume + 0.5);
-      samples[i] = sample < -32768 ? -32768 : sample > 32767 ? 32767 : sample;
-    }
-    gst_buffer_unmap (outbuf, &omap);
-  }
+  if (outbuf)
+    gst_opus_dec_apply_gain (dec, outbuf);
 
   if (dec->use_inband_fec) {
     gst_buffer_replace (&dec->last_buffer, buffer);
@@ -916,6 +933,137 @@ gst_opus_dec_handle_frame (GstAudioDecoder * adec, GstBuffer * buf)
   return res;
 }
 
+/* check whether the packets can be decoded into one output buffer: they
+ * need to be plain data packets without clipping, loss or FEC delay */
+static gboolean
+gst_opus_dec_can_batch (GstOpusDec * dec, GstBuffer ** buffers,
+    guint n_buffers)
+{
+  guint i;
+
+  if (dec->state == NULL || dec->use_inband_fec || dec->packetno < 2)
+    return FALSE;
+
+  for (i = 0; i < n_buffers; i++) {
+    GstBuffer *buf = buffers[i];
+
+    if (gst_buffer_get_size (buf) == 0)
+      return FALSE;
+    if (gst_buffer_get_audio_clipping_meta (buf))
+      return FALSE;
+    if (dec->streamheader && dec->vorbiscomment &&
+        (memcmp_buffers (dec->streamheader, buf) ||
+            memcmp_buffers (dec->vorbiscomment, buf)))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_opus_dec_handle_frames (GstAudioDecoder * adec, GstBuffer ** buffers,
+    guint n_buffers)
+{
+  GstOpusDec *dec = GST_OPUS_DEC (adec);
+  GstFlowReturn res = GST_FLOW_OK;
+  GstBuffer *outbuf;
+  GstMapInfo map, omap;
+  GstClockTime duration;
+  gint16 *out_data;
+  gint total, offset, samples, n = 0;
+  guint i;
+
+  if (!gst_opus_dec_can_batch (dec, buffers, n_buffers))
+    goto one_by_one;
+
+  /* the packet headers tell how many samples they decode to */
+  total = 0;
+  for (i = 0; i < n_buffers; i++) {
+    gst_buffer_map (buffers[i], &map, GST_MAP_READ);
+    duration = packet_duration_opus (map.data, map.size);
+    gst_buffer_unmap (buffers[i], &map);
+    if (duration == 0)
+      goto one_by_one;
+    total += gst_util_uint64_scale_int_round (duration, dec->sample_rate,
+        GST_SECOND);
+  }
+
+  GST_LOG_OBJECT (dec, "decoding %u packets, %d samples", n_buffers, total);
+
+  outbuf = gst_audio_decoder_allocate_output_buffer (adec,
+      total * dec->n_channels * 2);
+  if (!outbuf)
+    goto buffer_failed;
+
+  gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
+  out_data = (gint16 *) omap.data;
+
+  offset = 0;
+  for (i = 0; i < n_buffers; i++) {
+    gst_buffer_map (buffers[i], &map, GST_MAP_READ);
+    samples = total - offset;
+    n = opus_multistream_decode (dec->state, map.data, map.size,
+        out_data + offset * dec->n_channels, samples, 0);
+    if (n >= 0)
+      dec->last_known_buffer_duration =
+          packet_duration_opus (map.data, map.size);
+    gst_buffer_unmap (buffers[i], &map);
+
+    /* output what was decoded so far, the failed packet stays pending */
+    if (n < 0)
+      break;
+    offset += n;
+  }
+  gst_buffer_unmap (outbuf, &omap);
+  dec->packetno += i;
+
+  GST_DEBUG_OBJECT (dec, "decoded %d samples", offset);
+
+  if (offset == 0) {
+    gst_buffer_unref (outbuf);
+    outbuf = NULL;
+  } else {
+    gst_buffer_set_size (outbuf, offset * 2 * dec->n_channels);
+    if (dec->opus_pos[0] != GST_AUDIO_CHANNEL_POSITION_INVALID)
+      gst_audio_buffer_reorder_channels (outbuf, GST_AUDIO_FORMAT_S16,
+          dec->n_channels, dec->opus_pos, dec->info.position);
+    gst_opus_dec_apply_gain (dec, outbuf);
+  }
+
+  if (i > 0) {
+    res = gst_audio_decoder_finish_frame (adec, outbuf, i);
+    if (res != GST_FLOW_OK)
+      GST_DEBUG_OBJECT (dec, "flow: %s", gst_flow_get_name (res));
+  } else if (outbuf) {
+    gst_buffer_unref (outbuf);
+  }
+
+  if (n < 0) {
+    dec->packetno++;
+    res = GST_FLOW_ERROR;
+    GST_AUDIO_DECODER_ERROR (dec, 1, STREAM, DECODE, (NULL),
+        ("Decoding error (%d): %s", n, opus_strerror (n)), res);
+    /* carry on with the remaining packets if the error was not fatal */
+    for (i++; i < n_buffers && res == GST_FLOW_OK; i++)
+      res = gst_opus_dec_handle_frame (adec, buffers[i]);
+  }
+
+  return res;
+
+one_by_one:
+  {
+    for (i = 0; i < n_buffers && res == GST_FLOW_OK; i++)
+      res = gst_opus_dec_handle_frame (adec, buffers[i]);
+    return res;
+  }
+buffer_failed:
+  {
+    GST_ELEMENT_ERROR (dec, STREAM, DECODE, (NULL),
+        ("Failed to create %u byte buffer", total * dec->n_channels * 2));
+    return GST_FLOW_ERROR;
+  }
+}
+
 static void
 gst_opus_dec_get_property (GObject * object, guint prop_id, GValue * value,
     GParamSpec * pspec)
@@ -77,6 +77,10 @@ static gboolean vorbis_dec_start (GstAudioDecoder * dec);
 static gboolean vorbis_dec_stop (GstAudioDecoder * dec);
 static GstFlowReturn vorbis_dec_handle_frame (GstAudioDecoder * dec,
     GstBuffer * buffer);
+#ifndef USE_TREMOLO
+static GstFlowReturn vorbis_dec_handle_frames (GstAudioDecoder * dec,
+    GstBuffer ** buffers, guint n_buffers);
+#endif
 static void vorbis_dec_flush (GstAudioDecoder * dec, gboolean hard);
 static gboolean vorbis_dec_set_format (GstAudioDecoder * dec, GstCaps * caps);
 static void vorbis_dec_reset (GstAudioDecoder * dec);
@@ -104,12 +108,22 @@ gst_vorbis_dec_class_init (GstVorbisDecClass * klass)
   base_class->stop = GST_DEBUG_FUNCPTR (vorbis_dec_stop);
   base_class->set_format = GST_DEBUG_FUNCPTR (vorbis_dec_set_format);
   base_class->handle_frame = GST_DEBUG_FUNCPTR (vorbis_dec_handle_frame);
+#ifndef USE_TREMOLO
+  base_class->handle_frames = GST_DEBUG_FUNCPTR (vorbis_dec_handle_frames);
+#endif
   base_class->flush = GST_DEBUG_FUNCPTR (vorbis_dec_flush);
 }
 
+/* number of packets decoded at once in non-live pipelines */
+#define GST_VORBIS_DEC_MAX_BATCH 8
+
 static void
 gst_vorbis_dec_init (GstVorbisDec * dec)
 {
+#ifndef USE_TREMOLO
+  gst_audio_decoder_set_max_batch (GST_AUDIO_DECODER_CAST (dec),
+      GST_VORBIS_DEC_MAX_BATCH);
+#endif
   gst_audio_decoder_set_use_default_pad_acceptcaps (GST_AUDIO_DECODER_CAST
       (dec), TRUE);
   GST_PAD_SET_ACCEPT_TEMPLATE (GST_AUDIO_DECODER_SINK_PAD (dec));
@@ -628,6 +642,116 @@ empty_header:
   }
 }
 
+#ifndef USE_TREMOLO
+/* decode a batch of data packets into one output buffer, header packets
+ * and empty packets are handled one by one */
+static GstFlowReturn
+vorbis_dec_handle_frames (GstAudioDecoder * dec, GstBuffer ** buffers,
+    guint n_buffers)
+{
+  GstVorbisDec *vd = GST_VORBIS_DEC (dec);
+  GstFlowReturn result = GST_FLOW_OK;
+  ogg_packet *packet;
+  ogg_packet_wrapper packet_wrapper;
+  vorbis_sample_t **pcm;
+  GstBuffer *out;
+  GstMapInfo map, omap;
+  gsize max_samples, offset;
+  guint i, sample_count;
+  guint8 type;
+
+  if (G_UNLIKELY (!vd->initialized))
+    goto one_by_one;
+
+  for (i = 0; i < n_buffers; i++) {
+    if (gst_buffer_extract (buffers[i], 0, &type, 1) != 1 || (type & 1))
+      goto one_by_one;
+  }
+
+  /* every packet yields at most half a long block of samples */
+  max_samples = n_buffers * vorbis_info_blocksize (&vd->vi, 1) / 2;
+  out = gst_audio_decoder_allocate_output_buffer (dec,
+      max_samples * vd->info.bpf);
+
+  gst_buffer_map (out, &omap, GST_MAP_WRITE);
+  offset = 0;
+  for (i = 0; i < n_buffers; i++) {
+    gst_ogg_packet_wrapper_map (&packet_wrapper, buffers[i], &map);
+    packet = gst_ogg_packet_from_wrapper (&packet_wrapper);
+    packet->granulepos = -1;
+    packet->packetno = 0;
+    packet->e_o_s = 0;
+
+    if (G_UNLIKELY (vorbis_synthesis (&vd->vb, packet))) {
+      gst_ogg_packet_wrapper_unmap (&packet_wrapper, buffers[i], &map);
+      goto could_not_read;
+    }
+    gst_ogg_packet_wrapper_unmap (&packet_wrapper, buffers[i], &map);
+
+    if (G_UNLIKELY (vorbis_synthesis_blockin (&vd->vd, &vd->vb) < 0))
+      goto not_accepted;
+
+    sample_count = vorbis_synthesis_pcmout (&vd->vd, &pcm);
+    if (sample_count == 0)
+      continue;
+    if (G_UNLIKELY (offset + sample_count > max_samples))
+      goto wrong_samples;
+
+    vd->copy_samples ((vorbis_sample_t *) (omap.data + offset * vd->info.bpf),
+        pcm, sample_count, vd->info.channels);
+    offset += sample_count;
+
+    vorbis_synthesis_read (&vd->vd, sample_count);
+  }
+  gst_buffer_unmap (out, &omap);
+
+  GST_LOG_OBJECT (vd, "decoded %u packets into %" G_GSIZE_FORMAT " samples",
+      n_buffers, offset);
+
+  if (offset == 0) {
+    gst_buffer_unref (out);
+    out = NULL;
+  } else {
+    gst_buffer_set_size (out, offset * vd->info.bpf);
+  }
+
+  return gst_audio_decoder_finish_frame (dec, out, n_buffers);
+
+one_by_one:
+  {
+    for (i = 0; i < n_buffers && result == GST_FLOW_OK; i++)
+      result = vorbis_dec_handle_frame (dec, buffers[i]);
+    return result;
+  }
+
+  /* ERRORS */
+could_not_read:
+  {
+    gst_buffer_unmap (out, &omap);
+    gst_buffer_unref (out);
+    GST_ELEMENT_ERROR (GST_ELEMENT (vd), STREAM, DECODE,
+        (NULL), ("couldn't read data packet"));
+    return GST_FLOW_ERROR;
+  }
+not_accepted:
+  {
+    gst_buffer_unmap (out, &omap);
+    gst_buffer_unref (out);
+    GST_ELEMENT_ERROR (GST_ELEMENT (vd), STREAM, DECODE,
+        (NULL), ("vorbis decoder did not accept data packet"));
+    return GST_FLOW_ERROR;
+  }
+wrong_samples:
+  {
+    gst_buffer_unmap (out, &omap);
+    gst_buffer_unref (out);
+    GST_ELEMENT_ERROR (GST_ELEMENT (vd), STREAM, DECODE,
+        (NULL), ("vorbis decoder reported wrong number of samples"));
+    return GST_FLOW_ERROR;
+  }
+}
+#endif
+
 static void
 vorbis_dec_flush (GstAudioDecoder * dec, gboolean hard)
 {
@@ -56,6 +56,8 @@ ensure_debug_category (void)
 
 typedef void (*MixerFunc) (GstAudioChannelMixer * mix, const gpointer src,
     gpointer dst, gint samples);
+typedef void (*MixerPlanarFunc) (GstAudioChannelMixer * mix,
+    const gpointer src[], gpointer dst[], gint samples);
 
 struct _GstAudioChannelMixer
 {
@@ -76,7 +78,17 @@ struct _GstAudioChannelMixer
    * this is matrix * (2^10) as integers */
   gint **matrix_int;
 
+  /* sparse form of the matrix. The input channels and coefficients for
+   * output channel out are at [plan_offset[out], plan_offset[out + 1]) in
+   * plan_in, plan_coeff and plan_coeff_int */
+  gint *plan_offset;
+  gint *plan_in;
+  gfloat *plan_coeff;
+  gint *plan_coeff_int;
+
   MixerFunc func;
+  /* used when the input or output is not interleaved */
+  MixerPlanarFunc planar_func;
 
   gpointer tmp;
 };
@@ -103,6 +115,11 @@ gst_audio_channel_mixer_free (GstAudioChannelMixer * mix)
   g_free (mix->matrix_int);
   mix->matrix_int = NULL;
 
+  g_free (mix->plan_offset);
+  g_free (mix->plan_in);
+  g_free (mix->plan_coeff);
+  g_free (mix->plan_coeff_int);
+
   g_free (mix->tmp);
   mix->tmp = NULL;
 
@@ -664,11 +681,52 @@ gst_audio_channel_mixer_setup_matrix_int (GstAudioChannelMixer * mix)
   }
 }
 
+/* Most matrices are largely zeros, e.g. 5.1 to stereo only uses 5 of the
+ * 12 coefficients. Only keep the contributing input channels for every
+ * output channel. Returns %TRUE when every output channel is a plain copy of
+ * an input channel or silent. */
+static gboolean
+gst_audio_channel_mixer_setup_plan (GstAudioChannelMixer * mix)
+{
+  gint i, j, n = 0;
+  gboolean copy = TRUE;
+
+  mix->plan_offset = g_new (gint, mix->out_channels + 1);
+  mix->plan_in = g_new (gint, mix->in_channels * mix->out_channels);
+  mix->plan_coeff = g_new (gfloat, mix->in_channels * mix->out_channels);
+  mix->plan_coeff_int = g_new (gint, mix->in_channels * mix->out_channels);
+
+  for (j = 0; j < mix->out_channels; j++) {
+    mix->plan_offset[j] = n;
+    for (i = 0; i < mix->in_channels; i++) {
+      if (mix->matrix[i][j] == 0.0)
+        continue;
+
+      mix->plan_in[n] = i;
+      mix->plan_coeff[n] = mix->matrix[i][j];
+      mix->plan_coeff_int[n] = mix->matrix_int[i][j];
+      n++;
+    }
+    if (n - mix->plan_offset[j] > 1 || (n > mix->plan_offset[j]
+            && (mix->plan_coeff[n - 1] != 1.0
+                || mix->plan_coeff_int[n - 1] != (1 << PRECISION_INT))))
+      copy = FALSE;
+  }
+  mix->plan_offset[j] = n;
+
+  GST_DEBUG ("%d of %d coefficients used, copy %d", n,
+      mix->in_channels * mix->out_channels, copy);
+
+  return copy;
+}
+
 static void
 gst_audio_channel_mixer_setup_matrix (GstAudioChannelMixer * mix)
 {
   gint i, j;
 
+  /* one frame of output, the interleaved functions stage each frame in here
+   * when mixing in place so that no input is overwritten before it's read */
   mix->tmp = (gpointer) g_new (gdouble, mix->out_channels);
 
   /* allocate */
@@ -714,24 +772,34 @@ static void
 gst_audio_channel_mixer_mix_int16 (GstAudioChannelMixer * mix,
     const gint16 * in_data, gint16 * out_data, gint samples)
 {
-  gint in, out, n;
+  gint out, n, k;
   gint32 res;
   gint inchannels, outchannels;
+  gboolean in_place;
+  gint16 *d;
+  const gint *offset = mix->plan_offset, *in = mix->plan_in;
+  const gint *coeff = mix->plan_coeff_int;
 
   inchannels = mix->in_channels;
   outchannels = mix->out_channels;
+  in_place = in_data == out_data;
 
   for (n = 0; n < samples; n++) {
+    d = in_place ? mix->tmp : out_data;
     for (out = 0; out < outchannels; out++) {
       /* convert */
       res = 0;
-      for (in = 0; in < inchannels; in++)
-        res += in_data[n * inchannels + in] * mix->matrix_int[in][out];
+      for (k = offset[out]; k < offset[out + 1]; k++)
+        res += in_data[in[k]] * coeff[k];
 
       /* remove factor from int matrix */
       res = (res + (1 << (PRECISION_INT - 1))) >> PRECISION_INT;
-      out_data[n * outchannels + out] = CLAMP (res, G_MININT16, G_MAXINT16);
+      d[out] = CLAMP (res, G_MININT16, G_MAXINT16);
     }
+    if (in_place)
+      memcpy (out_data, d, outchannels * sizeof (gint16));
+    in_data += inchannels;
+    out_data += outchannels;
   }
 }
 
@@ -739,24 +807,34 @@ static void
 gst_audio_channel_mixer_mix_int32 (GstAudioChannelMixer * mix,
     const gint32 * in_data, gint32 * out_data, gint samples)
 {
-  gint in, out, n;
+  gint out, n, k;
   gint64 res;
   gint inchannels, outchannels;
+  gboolean in_place;
+  gint32 *d;
+  const gint *offset = mix->plan_offset, *in = mix->plan_in;
+  const gint *coeff = mix->plan_coeff_int;
 
   inchannels = mix->in_channels;
   outchannels = mix->out_channels;
+  in_place = in_data == out_data;
 
   for (n = 0; n < samples; n++) {
+    d = in_place ? mix->tmp : out_data;
     for (out = 0; out < outchannels; out++) {
       /* convert */
       res = 0;
-      for (in = 0; in < inchannels; in++)
-        res += in_data[n * inchannels + in] * (gint64) mix->matrix_int[in][out];
+      for (k = offset[out]; k < offset[out + 1]; k++)
+        res += in_data[in[k]] * (gint64) coeff[k];
 
       /* remove factor from int matrix */
       res = (res + (1 << (PRECISION_INT - 1))) >> PRECISION_INT;
-      out_data[n * outchannels + out] = CLAMP (res, G_MININT32, G_MAXINT32);
+      d[out] = CLAMP (res, G_MININT32, G_MAXINT32);
     }
+    if (in_place)
+      memcpy (out_data, d, outchannels * sizeof (gint32));
+    in_data += inchannels;
+    out_data += outchannels;
   }
 }
 
@@ -764,22 +842,32 @@ static void
 gst_audio_channel_mixer_mix_float (GstAudioChannelMixer * mix,
     const gfloat * in_data, gfloat * out_data, gint samples)
 {
-  gint in, out, n;
+  gint out, n, k;
   gfloat res;
   gint inchannels, outchannels;
+  gboolean in_place;
+  gfloat *d;
+  const gint *offset = mix->plan_offset, *in = mix->plan_in;
+  const gfloat *coeff = mix->plan_coeff;
 
   inchannels = mix->in_channels;
   outchannels = mix->out_channels;
+  in_place = in_data == out_data;
 
   for (n = 0; n < samples; n++) {
+    d = in_place ? mix->tmp : out_data;
     for (out = 0; out < outchannels; out++) {
       /* convert */
       res = 0.0;
-      for (in = 0; in < inchannels; in++)
-        res += in_data[n * inchannels + in] * mix->matrix[in][out];
+      for (k = offset[out]; k < offset[out + 1]; k++)
+        res += in_data[in[k]] * coeff[k];
 
-      out_data[n * outchannels + out] = res;
+      d[out] = res;
     }
+    if (in_place)
+      memcpy (out_data, d, outchannels * sizeof (gfloat));
+    in_data += inchannels;
+    out_data += outchannels;
   }
 }
 
@@ -787,25 +875,183 @@ static void
 gst_audio_channel_mixer_mix_double (GstAudioChannelMixer * mix,
     const gdouble * in_data, gdouble * out_data, gint samples)
 {
-  gint in, out, n;
+  gint out, n, k;
   gdouble res;
   gint inchannels, outchannels;
+  gboolean in_place;
+  gdouble *d;
+  const gint *offset = mix->plan_offset, *in = mix->plan_in;
+  const gfloat *coeff = mix->plan_coeff;
 
   inchannels = mix->in_channels;
   outchannels = mix->out_channels;
+  in_place = in_data == out_data;
 
   for (n = 0; n < samples; n++) {
+    d = in_place ? mix->tmp : out_data;
     for (out = 0; out < outchannels; out++) {
       /* convert */
       res = 0.0;
-      for (in = 0; in < inchannels; in++)
-        res += in_data[n * inchannels + in] * mix->matrix[in][out];
+      for (k = offset[out]; k < offset[out + 1]; k++)
+        res += in_data[in[k]] * coeff[k];
 
-      out_data[n * outchannels + out] = res;
+      d[out] = res;
     }
+    if (in_place)
+      memcpy (out_data, d, outchannels * sizeof (gdouble));
+    in_data += inchannels;
+    out_data += outchannels;
+  }
+}
+
+/* for matrices that only select and reorder channels */
+#define DEFINE_COPY_FUNC(name,type)                                     \
+static void                                                             \
+gst_audio_channel_mixer_copy_##name (GstAudioChannelMixer * mix,        \
+    const type * in_data, type * out_data, gint samples)                \
+{                                                                       \
+  gint out, n;                                                          \
+  gint inchannels, outchannels;                                         \
+  const gint *offset = mix->plan_offset, *in = mix->plan_in;            \
+  gboolean in_place;                                                    \
+  type *d;                                                              \
+                                                                        \
+  inchannels = mix->in_channels;                                        \
+  outchannels = mix->out_channels;                                      \
+  in_place = in_data == out_data;                                       \
+                                                                        \
+  for (n = 0; n < samples; n++) {                                       \
+    d = in_place ? mix->tmp : out_data;                                 \
+    for (out = 0; out < outchannels; out++) {                           \
+      if (offset[out] < offset[out + 1])                                \
+        d[out] = in_data[in[offset[out]]];                              \
+      else                                                              \
+        d[out] = 0;                                                     \
+    }                                                                   \
+    if (in_place)                                                       \
+      memcpy (out_data, d, outchannels * sizeof (type));                \
+    in_data += inchannels;                                              \
+    out_data += outchannels;                                            \
+  }                                                                     \
+}
+
+DEFINE_COPY_FUNC (int16, gint16);
+DEFINE_COPY_FUNC (int32, gint32);
+DEFINE_COPY_FUNC (float, gfloat);
+DEFINE_COPY_FUNC (double, gdouble);
+
+/* For non-interleaved input or output, every output channel is computed
+ * separately. Each channel is read and written with its own pointer and
+ * stride, so that non-interleaved channels are accessed contiguously. */
+#define SETUP_PLANAR_POINTERS(type)                                     \
+  const type *ip[64];                                                   \
+  type *op[64];                                                         \
+  gint is, os, c;                                                       \
+                                                                        \
+  if (mix->flags & GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_IN) {  \
+    is = 1;                                                             \
+    for (c = 0; c < mix->in_channels; c++)                              \
+      ip[c] = in[c];                                                    \
+  } else {                                                              \
+    is = mix->in_channels;                                              \
+    for (c = 0; c < mix->in_channels; c++)                              \
+      ip[c] = (const type *) in[0] + c;                                 \
+  }                                                                     \
+  if (mix->flags & GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_OUT) { \
+    os = 1;                                                             \
+    for (c = 0; c < mix->out_channels; c++)                             \
+      op[c] = out[c];                                                   \
+  } else {                                                              \
+    os = mix->out_channels;                                             \
+    for (c = 0; c < mix->out_channels; c++)                             \
+      op[c] = (type *) out[0] + c;                                      \
   }
+
+#define DEFINE_PLANAR_INT_FUNC(name,type,restype,min,max)               \
+static void                                                             \
+gst_audio_channel_mixer_mix_##name##_planar (GstAudioChannelMixer * mix, \
+    const gpointer in[], gpointer out[], gint samples)                  \
+{                                                                       \
+  gint o, n, k;                                                         \
+  restype res;                                                          \
+  const gint *offset = mix->plan_offset, *pin = mix->plan_in;           \
+  const gint *coeff = mix->plan_coeff_int;                              \
+  SETUP_PLANAR_POINTERS (type);                                         \
+                                                                        \
+  for (o = 0; o < mix->out_channels; o++) {                             \
+    type *d = op[o];                                                    \
+                                                                        \
+    for (n = 0; n < samples; n++) {                                     \
+      res = 0;                                                          \
+      for (k = offset[o]; k < offset[o + 1]; k++)                       \
+        res += ip[pin[k]][n * is] * (restype) coeff[k];                 \
+                                                                        \
+      /* remove factor from int matrix */                               \
+      res = (res + (1 << (PRECISION_INT - 1))) >> PRECISION_INT;        \
+      d[n * os] = CLAMP (res, min, max);                                \
+    }                                                                   \
+  }                                                                     \
+}
+
+#define DEFINE_PLANAR_FLOAT_FUNC(name,type)                             \
+static void                                                             \
+gst_audio_channel_mixer_mix_##name##_planar (GstAudioChannelMixer * mix, \
+    const gpointer in[], gpointer out[], gint samples)                  \
+{                                                                       \
+  gint o, n, k;                                                         \
+  type res;                                                             \
+  const gint *offset = mix->plan_offset, *pin = mix->plan_in;           \
+  const gfloat *coeff = mix->plan_coeff;                                \
+  SETUP_PLANAR_POINTERS (type);                                         \
+                                                                        \
+  for (o = 0; o < mix->out_channels; o++) {                             \
+    type *d = op[o];                                                    \
+                                                                        \
+    for (n = 0; n < samples; n++) {                                     \
+      res = 0.0;                                                        \
+      for (k = offset[o]; k < offset[o + 1]; k++)                       \
+        res += ip[pin[k]][n * is] * coeff[k];                           \
+                                                                        \
+      d[n * os] = res;                                                  \
+    }                                                                   \
+  }                                                                     \
 }
 
+#define DEFINE_PLANAR_COPY_FUNC(name,type)                              \
+static void                                                             \
+gst_audio_channel_mixer_copy_##name##_planar (GstAudioChannelMixer * mix, \
+    const gpointer in[], gpointer out[], gint samples)                  \
+{                                                                       \
+  gint o, n;                                                            \
+  const gint *offset = mix->plan_offset, *pin = mix->plan_in;           \
+  SETUP_PLANAR_POINTERS (type);                                         \
+                                                                        \
+  for (o = 0; o < mix->out_channels; o++) {                             \
+    type *d = op[o];                                                    \
+                                                                        \
+    if (offset[o] == offset[o + 1]) {                                   \
+      for (n = 0; n < samples; n++)                                     \
+        d[n * os] = 0;                                                  \
+    } else if (is == 1 && os == 1) {                                    \
+      memcpy (d, ip[pin[offset[o]]], samples * sizeof (type));          \
+    } else {                                                            \
+      const type *s = ip[pin[offset[o]]];                               \
+                                                                        \
+      for (n = 0; n < samples; n++)                                     \
+        d[n * os] = s[n * is];                                          \
+    }                                                                   \
+  }                                                                     \
+}
+
+DEFINE_PLANAR_INT_FUNC (int16, gint16, gint32, G_MININT16, G_MAXINT16);
+DEFINE_PLANAR_INT_FUNC (int32, gint32, gint64, G_MININT32, G_MAXINT32);
+DEFINE_PLANAR_FLOAT_FUNC (float, gfloat);
+DEFINE_PLANAR_FLOAT_FUNC (double, gdouble);
+DEFINE_PLANAR_COPY_FUNC (int16, gint16);
+DEFINE_PLANAR_COPY_FUNC (int32, gint32);
+DEFINE_PLANAR_COPY_FUNC (float, gfloat);
+DEFINE_PLANAR_COPY_FUNC (double, gdouble);
+
 /**
  * gst_audio_channel_mixer_new: (skip):
  * @flags: #GstAudioChannelMixerFlags
@@ -827,6 +1073,7 @@ gst_audio_channel_mixer_new (GstAudioChannelMixerFlags flags,
     gint out_channels, GstAudioChannelPosition * out_position)
 {
   GstAudioChannelMixer *mix;
+  gboolean copy;
   gint i;
 
   g_return_val_if_fail (format == GST_AUDIO_FORMAT_S16
@@ -848,24 +1095,70 @@ gst_audio_channel_mixer_new (GstAudioChannelMixerFlags flags,
     mix->out_position[i] = out_position[i];
 
   gst_audio_channel_mixer_setup_matrix (mix);
+  copy = gst_audio_channel_mixer_setup_plan (mix);
 
   switch (mix->format) {
     case GST_AUDIO_FORMAT_S16:
-      mix->func = (MixerFunc) gst_audio_channel_mixer_mix_int16;
+      if (copy)
+        mix->func = (MixerFunc) gst_audio_channel_mixer_copy_int16;
+      else
+        mix->func = (MixerFunc) gst_audio_channel_mixer_mix_int16;
       break;
     case GST_AUDIO_FORMAT_S32:
-      mix->func = (MixerFunc) gst_audio_channel_mixer_mix_int32;
+      if (copy)
+        mix->func = (MixerFunc) gst_audio_channel_mixer_copy_int32;
+      else
+        mix->func = (MixerFunc) gst_audio_channel_mixer_mix_int32;
       break;
     case GST_AUDIO_FORMAT_F32:
-      mix->func = (MixerFunc) gst_audio_channel_mixer_mix_float;
+      if (copy)
+        mix->func = (MixerFunc) gst_audio_channel_mixer_copy_float;
+      else
+        mix->func = (MixerFunc) gst_audio_channel_mixer_mix_float;
       break;
     case GST_AUDIO_FORMAT_F64:
-      mix->func = (MixerFunc) gst_audio_channel_mixer_mix_double;
+      if (copy)
+        mix->func = (MixerFunc) gst_audio_channel_mixer_copy_double;
+      else
+        mix->func = (MixerFunc) gst_audio_channel_mixer_mix_double;
       break;
     default:
       g_assert_not_reached ();
       break;
   }
+
+  if (flags & (GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_IN |
+          GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_OUT)) {
+    switch (mix->format) {
+      case GST_AUDIO_FORMAT_S16:
+        if (copy)
+          mix->planar_func = gst_audio_channel_mixer_copy_int16_planar;
+        else
+          mix->planar_func = gst_audio_channel_mixer_mix_int16_planar;
+        break;
+      case GST_AUDIO_FORMAT_S32:
+        if (copy)
+          mix->planar_func = gst_audio_channel_mixer_copy_int32_planar;
+        else
+          mix->planar_func = gst_audio_channel_mixer_mix_int32_planar;
+        break;
+      case GST_AUDIO_FORMAT_F32:
+        if (copy)
+          mix->planar_func = gst_audio_channel_mixer_copy_float_planar;
+        else
+          mix->planar_func = gst_audio_channel_mixer_mix_float_planar;
+        break;
+      case GST_AUDIO_FORMAT_F64:
+        if (copy)
+          mix->planar_func = gst_audio_channel_mixer_copy_double_planar;
+        else
+          mix->planar_func = gst_audio_channel_mixer_mix_double_planar;
+        break;
+      default:
+        g_assert_not_reached ();
+        break;
+    }
+  }
   return mix;
 }
 
@@ -915,6 +1208,10 @@ gst_audio_channel_mixer_is_passthrough (GstAudioChannelMixer * mix)
  *
  * Perform channel mixing on @in_data and write the result to @out_data.
  * @in_data and @out_data need to be in @format and @layout.
+ *
+ * Since 1.12, @in and @out can point to the same block of interleaved
+ * samples when the number of output channels is not larger than the number
+ * of input channels. Non-interleaved samples can't be mixed in place.
  */
 void
 gst_audio_channel_mixer_samples (GstAudioChannelMixer * mix,
@@ -923,5 +1220,8 @@ gst_audio_channel_mixer_samples (GstAudioChannelMixer * mix,
   g_return_if_fail (mix != NULL);
   g_return_if_fail (mix->matrix != NULL);
 
-  mix->func (mix, in[0], out[0], samples);
+  if (mix->planar_func)
+    mix->planar_func (mix, in, out, samples);
+  else
+    mix->func (mix, in[0], out[0], samples);
 }
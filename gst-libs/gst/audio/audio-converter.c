@@ -90,6 +90,12 @@ typedef void (*AudioConvertEndianFunc) (gpointer dst, const gpointer src,
  *  interleave
  *  deinterleave
  *  resample
+ *
+ * The layout is changed by the channel mixer or the resampler when there is
+ * one, they can read and write both layouts. When resampling, the samples
+ * between the mixer and the resampler are kept non-interleaved so that the
+ * resampler doesn't need to deinterleave them again. Only when neither is
+ * used, a separate step before the pack changes the layout.
  */
 struct _GstAudioConverter
 {
@@ -128,6 +134,9 @@ struct _GstAudioConverter
   /* convert out */
   AudioConvertFunc convert_out;
 
+  /* change layout */
+  gboolean change_layout;
+
   /* quant */
   GstAudioQuantize *quant;
 
@@ -559,6 +568,69 @@ do_quantize (AudioChain * chain, gpointer user_data)
   return TRUE;
 }
 
+#define MAKE_INTERLEAVE_FUNC(type)                                      \
+static void                                                             \
+interleave_ ##type (gpointer out[], gpointer in[], gint channels,       \
+    gsize frames, gboolean to_planar)                                   \
+{                                                                       \
+  gint c;                                                               \
+  gsize i;                                                              \
+  for (c = 0; c < channels; c++) {                                      \
+    if (to_planar) {                                                    \
+      const type *ip = (const type *) in[0] + c;                        \
+      type *op = out[c];                                                \
+      for (i = 0; i < frames; i++, ip += channels)                      \
+        op[i] = *ip;                                                    \
+    } else {                                                            \
+      const type *ip = in[c];                                           \
+      type *op = (type *) out[0] + c;                                   \
+      for (i = 0; i < frames; i++, op += channels)                      \
+        *op = ip[i];                                                    \
+    }                                                                   \
+  }                                                                     \
+}
+
+MAKE_INTERLEAVE_FUNC (guint16);
+MAKE_INTERLEAVE_FUNC (guint32);
+MAKE_INTERLEAVE_FUNC (guint64);
+
+static gboolean
+do_change_layout (AudioChain * chain, gpointer user_data)
+{
+  GstAudioConverter *convert = user_data;
+  gsize num_samples;
+  gpointer *in, *out;
+  gboolean to_planar;
+
+  in = audio_chain_get_samples (chain->prev, &num_samples);
+  out = audio_chain_alloc_samples (chain, num_samples);
+  to_planar = chain->blocks > 1;
+  GST_LOG ("change layout %p, %p %" G_GSIZE_FORMAT ", to planar %d", in, out,
+      num_samples, to_planar);
+
+  switch (chain->finfo->width) {
+    case 16:
+      interleave_guint16 (out, in, convert->current_channels, num_samples,
+          to_planar);
+      break;
+    case 32:
+      interleave_guint32 (out, in, convert->current_channels, num_samples,
+          to_planar);
+      break;
+    case 64:
+      interleave_guint64 (out, in, convert->current_channels, num_samples,
+          to_planar);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  audio_chain_set_samples (chain, out, num_samples);
+
+  return TRUE;
+}
+
 static gboolean
 is_intermediate_format (GstAudioFormat format)
 {
@@ -624,6 +696,13 @@ chain_convert_in (GstAudioConverter * convert, AudioChain * prev)
   return prev;
 }
 
+static gboolean
+needs_resample (GstAudioConverter * convert)
+{
+  return convert->in.rate != convert->out.rate ||
+      (convert->flags & GST_AUDIO_CONVERTER_FLAG_VARIABLE_RATE);
+}
+
 static AudioChain *
 chain_mix (GstAudioConverter * convert, AudioChain * prev)
 {
@@ -631,6 +710,7 @@ chain_mix (GstAudioConverter * convert, AudioChain * prev)
   GstAudioInfo *in = &convert->in;
   GstAudioInfo *out = &convert->out;
   GstAudioFormat format = convert->current_format;
+  gboolean resample = needs_resample (convert);
 
   flags =
       GST_AUDIO_INFO_IS_UNPOSITIONED (in) ?
@@ -639,7 +719,13 @@ chain_mix (GstAudioConverter * convert, AudioChain * prev)
       GST_AUDIO_INFO_IS_UNPOSITIONED (out) ?
       GST_AUDIO_CHANNEL_MIXER_FLAGS_UNPOSITIONED_OUT : 0;
 
-  convert->current_channels = out->channels;
+  /* the mixer produces the output layout, or non-interleaved samples for
+   * the resampler */
+  if (convert->current_layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+    flags |= GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_IN;
+  if (out->layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED
+      || (resample && out->channels > 1))
+    flags |= GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_OUT;
 
   convert->mix =
       gst_audio_channel_mixer_new (flags, format, in->channels, in->position,
@@ -650,7 +736,13 @@ chain_mix (GstAudioConverter * convert, AudioChain * prev)
       gst_audio_format_to_string (format), convert->mix_passthrough,
       in->channels, out->channels);
 
+  convert->current_channels = out->channels;
+
   if (!convert->mix_passthrough) {
+    convert->current_layout =
+        (flags & GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_OUT) ?
+        GST_AUDIO_LAYOUT_NON_INTERLEAVED : GST_AUDIO_LAYOUT_INTERLEAVED;
+
     prev = audio_chain_new (prev, convert);
     prev->allow_ip = FALSE;
     prev->pass_alloc = FALSE;
@@ -672,20 +764,22 @@ chain_resample (GstAudioConverter * convert, AudioChain * prev)
 
   variable_rate = convert->flags & GST_AUDIO_CONVERTER_FLAG_VARIABLE_RATE;
 
-  if (in->rate != out->rate || variable_rate) {
+  if (needs_resample (convert)) {
     method = GET_OPT_RESAMPLER_METHOD (convert);
 
+    /* the resampler writes the output layout */
     flags = 0;
-    if (convert->current_layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED) {
+    if (convert->current_layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
       flags |= GST_AUDIO_RESAMPLER_FLAG_NON_INTERLEAVED_IN;
+    if (out->layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
       flags |= GST_AUDIO_RESAMPLER_FLAG_NON_INTERLEAVED_OUT;
-    }
     if (variable_rate)
       flags |= GST_AUDIO_RESAMPLER_FLAG_VARIABLE_RATE;
 
     convert->resampler =
         gst_audio_resampler_new (method, flags, format, channels, in->rate,
         out->rate, convert->config);
+    convert->current_layout = out->layout;
 
     prev = audio_chain_new (prev, convert);
     prev->allow_ip = FALSE;
@@ -761,7 +855,9 @@ chain_quantize (GstAudioConverter * convert, AudioChain * prev)
       && convert->current_format == GST_AUDIO_FORMAT_S32) {
     GST_INFO ("quantize to %d bits, dither %d, ns %d", out_depth, dither, ns);
     convert->quant =
-        gst_audio_quantize_new (dither, ns, 0, convert->current_format,
+        gst_audio_quantize_new (dither, ns,
+        convert->current_layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED ?
+        GST_AUDIO_QUANTIZE_FLAG_NON_INTERLEAVED : 0, convert->current_format,
         out->channels, 1U << (32 - out_depth));
 
     prev = audio_chain_new (prev, convert);
@@ -772,6 +868,29 @@ chain_quantize (GstAudioConverter * convert, AudioChain * prev)
   return prev;
 }
 
+static AudioChain *
+chain_change_layout (GstAudioConverter * convert, AudioChain * prev)
+{
+  GstAudioInfo *out = &convert->out;
+
+  /* mono samples are the same in both layouts */
+  if (convert->current_layout != out->layout && out->channels > 1) {
+    GST_INFO ("change layout to %s",
+        out->layout == GST_AUDIO_LAYOUT_INTERLEAVED ? "interleaved" :
+        "non-interleaved");
+    convert->current_layout = out->layout;
+    convert->change_layout = TRUE;
+
+    prev = audio_chain_new (prev, convert);
+    prev->allow_ip = FALSE;
+    prev->pass_alloc = FALSE;
+    audio_chain_set_make_func (prev, do_change_layout, convert, NULL);
+  }
+  convert->current_layout = out->layout;
+
+  return prev;
+}
+
 static AudioChain *
 chain_pack (GstAudioConverter * convert, AudioChain * prev)
 {
@@ -1018,7 +1137,9 @@ converter_generic (GstAudioConverter * convert,
 
   chain = convert->chain_end;
 
-  convert->in_writable = flags & GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE;
+  /* when converting in place, the input is the output and thus writable */
+  convert->in_writable = (flags & GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE)
+      || in == out;
   convert->in_data = in;
   convert->in_frames = in_frames;
   convert->out_data = out;
@@ -1048,6 +1169,33 @@ converter_resample (GstAudioConverter * convert,
   return TRUE;
 }
 
+/* Check if the generic chain can run with the same memory for input and
+ * output. Each step consumes all samples of its input before the next step
+ * runs and only the unpack step reads the input, so this is safe when the
+ * samples keep their size and position through the chain and every step
+ * writing into the output memory reads each sample before overwriting it. */
+static gboolean
+converter_generic_supports_inplace (GstAudioConverter * convert)
+{
+  GstAudioInfo *in = &convert->in;
+  GstAudioInfo *out = &convert->out;
+
+  /* the resampler produces a different number of samples and keeps history */
+  if (convert->resampler != NULL || convert->change_layout)
+    return FALSE;
+
+  if (in->layout != out->layout || in->channels != out->channels
+      || in->bpf != out->bpf)
+    return FALSE;
+
+  /* the mixer stages interleaved frames, but non-interleaved channels would
+   * be overwritten before all output channels are computed from them */
+  if (!convert->mix_passthrough && in->layout != GST_AUDIO_LAYOUT_INTERLEAVED)
+    return FALSE;
+
+  return TRUE;
+}
+
 #define GST_AUDIO_FORMAT_IS_ENDIAN_CONVERSION(info1, info2) \
 		( \
 			!(((info1)->flags ^ (info2)->flags) & (~GST_AUDIO_FORMAT_FLAG_UNPACK)) && \
@@ -1069,6 +1217,9 @@ converter_resample (GstAudioConverter * convert,
  * @config contains extra configuration options, see #GST_VIDEO_CONVERTER_OPT_*
  * parameters for details about the options and values.
  *
+ * Since 1.12, @in_info and @out_info can use any #GstAudioLayout and the
+ * layouts don't need to match.
+ *
  * Returns: a #GstAudioConverter or %NULL if conversion is not possible.
  */
 GstAudioConverter *
@@ -1080,8 +1231,6 @@ gst_audio_converter_new (GstAudioConverterFlags flags, GstAudioInfo * in_info,
 
   g_return_val_if_fail (in_info != NULL, FALSE);
   g_return_val_if_fail (out_info != NULL, FALSE);
-  g_return_val_if_fail (in_info->layout == GST_AUDIO_LAYOUT_INTERLEAVED, FALSE);
-  g_return_val_if_fail (in_info->layout == out_info->layout, FALSE);
 
   if ((GST_AUDIO_INFO_CHANNELS (in_info) != GST_AUDIO_INFO_CHANNELS (out_info))
       && (GST_AUDIO_INFO_IS_UNPOSITIONED (in_info)
@@ -1113,7 +1262,9 @@ gst_audio_converter_new (GstAudioConverterFlags flags, GstAudioInfo * in_info,
   prev = chain_convert_out (convert, prev);
   /* step 6, optional quantize */
   prev = chain_quantize (convert, prev);
-  /* step 7, pack */
+  /* step 7, change layout */
+  prev = chain_change_layout (convert, prev);
+  /* step 8, pack */
   convert->chain_end = chain_pack (convert, prev);
 
   convert->convert = converter_generic;
@@ -1122,7 +1273,7 @@ gst_audio_converter_new (GstAudioConverterFlags flags, GstAudioInfo * in_info,
   /* optimize */
   if (convert->mix_passthrough) {
     if (out_info->finfo->format == in_info->finfo->format) {
-      if (convert->resampler == NULL) {
+      if (convert->resampler == NULL && !convert->change_layout) {
         GST_INFO
             ("same formats, no resampler and passthrough mixing -> passthrough");
         convert->convert = converter_passthrough;
@@ -1135,7 +1286,7 @@ gst_audio_converter_new (GstAudioConverterFlags flags, GstAudioInfo * in_info,
       }
     } else if (GST_AUDIO_FORMAT_IS_ENDIAN_CONVERSION (out_info->finfo,
             in_info->finfo)) {
-      if (convert->resampler == NULL) {
+      if (convert->resampler == NULL && !convert->change_layout) {
         GST_INFO ("no resampler, passthrough mixing -> only endian conversion");
         convert->convert = converter_endian;
         convert->in_place = TRUE;
@@ -1165,6 +1316,11 @@ gst_audio_converter_new (GstAudioConverterFlags flags, GstAudioInfo * in_info,
     }
   }
 
+  if (convert->convert == converter_generic) {
+    convert->in_place = converter_generic_supports_inplace (convert);
+    GST_INFO ("generic conversion, in place %d", convert->in_place);
+  }
+
   setup_allocators (convert);
 
   return convert;
@@ -1307,6 +1463,9 @@ gst_audio_converter_reset (GstAudioConverter * convert)
  * @in may be %NULL, in which case @in_frames of silence samples are processed
  * by the converter.
  *
+ * @in and @out can be the same when gst_audio_converter_supports_inplace()
+ * returns %TRUE, the input samples are then implicitly writable.
+ *
  * This function always produces @out_frames of output and consumes @in_frames of
  * input. Use gst_audio_converter_get_out_frames() and
  * gst_audio_converter_get_in_frames() to make sure @in_frames and @out_frames
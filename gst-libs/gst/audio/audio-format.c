@@ -158,15 +158,55 @@ MAKE_ORC_PACK_UNPACK (s8, s8_trunc)
 #define WRITE24_TO_BE(p,v) p[2] = v & 0xff; p[1] = (v >> 8) & 0xff; p[0] = (v >> 16) & 0xff
 #define READ24_FROM_LE(p) (p[0] | (p[1] << 8) | (p[2] << 16))
 #define READ24_FROM_BE(p) (p[2] | (p[1] << 8) | (p[0] << 16))
-#define MAKE_PACK_UNPACK(name, stride, sign, scale, READ_FUNC, WRITE_FUNC)     \
+/* ORC can't load 3 byte samples, so 4 samples are moved with 3 words
+ * at a time instead. t0-t3 hold the samples in their upper 24 bits. */
+#define READ24x4_FROM_LE(p,t0,t1,t2,t3) G_STMT_START {          \
+  guint32 w0 = GST_READ_UINT32_LE (p);                          \
+  guint32 w1 = GST_READ_UINT32_LE (p + 4);                      \
+  guint32 w2 = GST_READ_UINT32_LE (p + 8);                      \
+  t0 = w0 << 8;                                                 \
+  t1 = ((w0 >> 16) & 0xff00) | (w1 << 16);                      \
+  t2 = ((w1 >> 8) & 0xffff00) | (w2 << 24);                     \
+  t3 = w2 & 0xffffff00;                                         \
+} G_STMT_END
+#define READ24x4_FROM_BE(p,t0,t1,t2,t3) G_STMT_START {          \
+  guint32 w0 = GST_READ_UINT32_BE (p);                          \
+  guint32 w1 = GST_READ_UINT32_BE (p + 4);                      \
+  guint32 w2 = GST_READ_UINT32_BE (p + 8);                      \
+  t0 = w0 & 0xffffff00;                                         \
+  t1 = (w0 << 24) | ((w1 >> 8) & 0xffff00);                     \
+  t2 = (w1 << 16) | ((w2 >> 16) & 0xff00);                      \
+  t3 = w2 << 8;                                                 \
+} G_STMT_END
+#define WRITE24x4_TO_LE(p,t0,t1,t2,t3) G_STMT_START {           \
+  GST_WRITE_UINT32_LE (p, (t0 >> 8) | (t1 << 16));              \
+  GST_WRITE_UINT32_LE (p + 4, (t1 >> 16) | (t2 << 8));          \
+  GST_WRITE_UINT32_LE (p + 8, (t2 >> 24) | t3);                 \
+} G_STMT_END
+#define WRITE24x4_TO_BE(p,t0,t1,t2,t3) G_STMT_START {           \
+  GST_WRITE_UINT32_BE (p, t0 | (t1 >> 24));                     \
+  GST_WRITE_UINT32_BE (p + 4, (t1 << 8) | (t2 >> 16));          \
+  GST_WRITE_UINT32_BE (p + 8, (t2 << 16) | (t3 >> 8));          \
+} G_STMT_END
+#define MAKE_PACK_UNPACK(name, stride, sign, scale, endian)             \
 static void unpack_ ##name (const GstAudioFormatInfo *info,             \
     GstAudioPackFlags flags, gpointer dest,                             \
     const gpointer data, gint length)                                   \
 {                                                                       \
   guint32 *d = dest;                                                    \
   guint8 *s = data;                                                     \
+  guint32 t0, t1, t2, t3;                                               \
+  for (; length >= 4; length -= 4) {                                    \
+    READ24x4_FROM_ ##endian (s, t0, t1, t2, t3);                        \
+    d[0] = (t0 << (scale - 8)) ^ (sign);                                \
+    d[1] = (t1 << (scale - 8)) ^ (sign);                                \
+    d[2] = (t2 << (scale - 8)) ^ (sign);                                \
+    d[3] = (t3 << (scale - 8)) ^ (sign);                                \
+    d += 4;                                                             \
+    s += 4 * stride;                                                    \
+  }                                                                     \
   for (;length; length--) {                                             \
-    *d++ = (((gint32) READ_FUNC (s)) << scale) ^ (sign);                \
+    *d++ = (((gint32) READ24_FROM_ ##endian (s)) << scale) ^ (sign);    \
     s += stride;                                                        \
   }                                                                     \
 }                                                                       \
@@ -177,36 +217,46 @@ static void pack_ ##name (const GstAudioFormatInfo *info,               \
   gint32 tmp;                                                           \
   guint32 *s = src;                                                     \
   guint8 *d = data;                                                     \
+  guint32 t0, t1, t2, t3;                                               \
+  for (; length >= 4; length -= 4) {                                    \
+    t0 = ((s[0] ^ (sign)) >> scale) << 8;                               \
+    t1 = ((s[1] ^ (sign)) >> scale) << 8;                               \
+    t2 = ((s[2] ^ (sign)) >> scale) << 8;                               \
+    t3 = ((s[3] ^ (sign)) >> scale) << 8;                               \
+    WRITE24x4_TO_ ##endian (d, t0, t1, t2, t3);                         \
+    s += 4;                                                             \
+    d += 4 * stride;                                                    \
+  }                                                                     \
   for (;length; length--) {                                             \
     tmp = (*s++ ^ (sign)) >> scale;                                     \
-    WRITE_FUNC (d, tmp);                                                \
+    WRITE24_TO_ ##endian (d, tmp);                                      \
     d += stride;                                                        \
   }                                                                     \
 }
 #define PACK_S24LE GST_AUDIO_FORMAT_S32, unpack_s24le, pack_s24le
-    MAKE_PACK_UNPACK (s24le, 3, 0, 8, READ24_FROM_LE, WRITE24_TO_LE)
+    MAKE_PACK_UNPACK (s24le, 3, 0, 8, LE)
 #define PACK_U24LE GST_AUDIO_FORMAT_S32, unpack_u24le, pack_u24le
-    MAKE_PACK_UNPACK (u24le, 3, SIGNED, 8, READ24_FROM_LE, WRITE24_TO_LE)
+    MAKE_PACK_UNPACK (u24le, 3, SIGNED, 8, LE)
 #define PACK_S24BE GST_AUDIO_FORMAT_S32, unpack_s24be, pack_s24be
-    MAKE_PACK_UNPACK (s24be, 3, 0, 8, READ24_FROM_BE, WRITE24_TO_BE)
+    MAKE_PACK_UNPACK (s24be, 3, 0, 8, BE)
 #define PACK_U24BE GST_AUDIO_FORMAT_S32, unpack_u24be, pack_u24be
-    MAKE_PACK_UNPACK (u24be, 3, SIGNED, 8, READ24_FROM_BE, WRITE24_TO_BE)
+    MAKE_PACK_UNPACK (u24be, 3, SIGNED, 8, BE)
 #define PACK_S20LE GST_AUDIO_FORMAT_S32, unpack_s20le, pack_s20le
-    MAKE_PACK_UNPACK (s20le, 3, 0, 12, READ24_FROM_LE, WRITE24_TO_LE)
+    MAKE_PACK_UNPACK (s20le, 3, 0, 12, LE)
 #define PACK_U20LE GST_AUDIO_FORMAT_S32, unpack_u20le, pack_u20le
-    MAKE_PACK_UNPACK (u20le, 3, SIGNED, 12, READ24_FROM_LE, WRITE24_TO_LE)
+    MAKE_PACK_UNPACK (u20le, 3, SIGNED, 12, LE)
 #define PACK_S20BE GST_AUDIO_FORMAT_S32, unpack_s20be, pack_s20be
-    MAKE_PACK_UNPACK (s20be, 3, 0, 12, READ24_FROM_BE, WRITE24_TO_BE)
+    MAKE_PACK_UNPACK (s20be, 3, 0, 12, BE)
 #define PACK_U20BE GST_AUDIO_FORMAT_S32, unpack_u20be, pack_u20be
-    MAKE_PACK_UNPACK (u20be, 3, SIGNED, 12, READ24_FROM_BE, WRITE24_TO_BE)
+    MAKE_PACK_UNPACK (u20be, 3, SIGNED, 12, BE)
 #define PACK_S18LE GST_AUDIO_FORMAT_S32, unpack_s18le, pack_s18le
-    MAKE_PACK_UNPACK (s18le, 3, 0, 14, READ24_FROM_LE, WRITE24_TO_LE)
+    MAKE_PACK_UNPACK (s18le, 3, 0, 14, LE)
 #define PACK_U18LE GST_AUDIO_FORMAT_S32, unpack_u18le, pack_u18le
-    MAKE_PACK_UNPACK (u18le, 3, SIGNED, 14, READ24_FROM_LE, WRITE24_TO_LE)
+    MAKE_PACK_UNPACK (u18le, 3, SIGNED, 14, LE)
 #define PACK_S18BE GST_AUDIO_FORMAT_S32, unpack_s18be, pack_s18be
-    MAKE_PACK_UNPACK (s18be, 3, 0, 14, READ24_FROM_BE, WRITE24_TO_BE)
+    MAKE_PACK_UNPACK (s18be, 3, 0, 14, BE)
 #define PACK_U18BE GST_AUDIO_FORMAT_S32, unpack_u18be, pack_u18be
-    MAKE_PACK_UNPACK (u18be, 3, SIGNED, 14, READ24_FROM_BE, WRITE24_TO_BE)
+    MAKE_PACK_UNPACK (u18be, 3, SIGNED, 14, BE)
 #define PACK_F32LE GST_AUDIO_FORMAT_F64, unpack_f32le, pack_f32le
     MAKE_ORC_PACK_UNPACK (f32le, f32le)
 #define PACK_F32BE GST_AUDIO_FORMAT_F64, unpack_f32be, pack_f32be
@@ -45,32 +45,37 @@ struct _GstAudioQuantize
   guint quantizer;
   guint stride;
   guint blocks;
+  /* the block being quantized, selects its error and dither history */
+  guint block;
 
   guint shift;
   guint32 mask, bias;
 
-  /* last random number generated per channel for hifreq TPDF dither */
+  /* last random number generated per channel for hifreq TPDF dither, for
+   * all blocks */
   gpointer last_random;
+  /* state of the random number generator lanes, one or two per sample */
+  guint random_size;
+  guint32 *random_buf;
   /* contains the past quantization errors, error[channels][count] */
   guint error_size;
   gpointer error_buf;
+  /* errors of the last frames of each block, carried over to the next call */
+  gint32 *error_hist;
   /* buffer with dither values */
   guint dither_size;
   gpointer dither_buf;
   /* noise shaping coefficients */
   gpointer coeffs;
   gint n_coeffs;
+  /* filtered error of all channels of a frame */
+  gint32 *ns_acc;
 
   QuantizeFunc quantize;
 };
 
 #define ADDSS(res,val) \
-        if (val > 0 && res > 0 && G_MAXINT32 - res <= val){             \
-          res = G_MAXINT32;                                             \
-        } else if (val < 0 && res < 0 && G_MININT32 - res >= val){      \
-          res = G_MININT32;                                             \
-        } else                                                          \
-          res += val;
+        res = CLAMP ((gint64) res + val, G_MININT32, G_MAXINT32);
 
 static void
 gst_audio_quantize_quantize_memcpy (GstAudioQuantize * quant,
@@ -99,26 +104,43 @@ gst_fast_random_uint32 (void)
   return (state = state * 1103515245 + 12345);
 }
 
-static inline gint32
-gst_fast_random_int32 (void)
+/* The dither is generated with one linear congruential generator per
+ * sample, all lanes are advanced at once with audio_orc_update_rand(). Only
+ * the high bits of the lanes are used as they have the longest period. */
+static guint32 *
+setup_random_buf (GstAudioQuantize * quant, gint lanes)
 {
-  return (gint32) gst_fast_random_uint32 ();
-}
+  guint32 *r, v;
+  gint i;
+
+  if (quant->random_size < lanes) {
+    quant->random_buf =
+        g_realloc (quant->random_buf, lanes * sizeof (guint32));
+    r = quant->random_buf;
+
+    /* all lanes run through the same sequence, scramble the start of the new
+     * lanes so that they are not shifted copies of each other */
+    for (i = quant->random_size; i < lanes; i++) {
+      v = gst_fast_random_uint32 ();
+      v = (v ^ (v >> 16)) * 0x85ebca6b;
+      v = (v ^ (v >> 13)) * 0xc2b2ae35;
+      r[i] = v ^ (v >> 16);
+    }
+    quant->random_size = lanes;
+  }
+  audio_orc_update_rand (quant->random_buf, lanes);
 
-/* Assuming dither == 2^n,
- * returns one of 2^(n+1) possible random values:
- * -dither <= retval < dither */
-#define RANDOM_INT_DITHER(dither)                                       \
-  (- dither + (gst_fast_random_int32 () & ((dither << 1) - 1)))
+  return quant->random_buf;
+}
 
 static void
 setup_dither_buf (GstAudioQuantize * quant, gint samples)
 {
   gboolean need_init = FALSE;
   gint stride = quant->stride;
-  gint i, len = samples * stride;
+  gint i, c, len = samples * stride;
   guint shift = quant->shift;
-  guint32 bias;
+  guint32 bias, *r;
   gint32 dither, *d;
 
   if (quant->dither_size < len) {
@@ -130,6 +152,8 @@ setup_dither_buf (GstAudioQuantize * quant, gint samples)
   bias = quant->bias;
   d = quant->dither_buf;
 
+  /* a random value between -dither and dither - 1, with dither == 2^n, is
+   * made from the n + 1 high bits of a lane */
   switch (quant->dither) {
     case GST_AUDIO_DITHER_NONE:
       if (need_init) {
@@ -140,25 +164,32 @@ setup_dither_buf (GstAudioQuantize * quant, gint samples)
 
     case GST_AUDIO_DITHER_RPDF:
       dither = 1 << (shift);
-      for (i = 0; i < len; i++)
-        d[i] = bias + RANDOM_INT_DITHER (dither);
+      r = setup_random_buf (quant, len);
+      audio_orc_dither_rpdf (d, r, 31 - shift, bias - dither, len);
       break;
 
     case GST_AUDIO_DITHER_TPDF:
       dither = 1 << (shift - 1);
-      for (i = 0; i < len; i++)
-        d[i] = bias + RANDOM_INT_DITHER (dither) + RANDOM_INT_DITHER (dither);
+      r = setup_random_buf (quant, 2 * len);
+      audio_orc_dither_tpdf (d, r, r + len, 32 - shift, bias - 2 * dither,
+          len);
       break;
 
     case GST_AUDIO_DITHER_TPDF_HF:
     {
-      gint32 tmp, *last_random = quant->last_random;
+      gint32 tmp, *last_random;
+
+      last_random = (gint32 *) quant->last_random + quant->block * stride;
 
       dither = 1 << (shift - 1);
-      for (i = 0; i < len; i++) {
-        tmp = RANDOM_INT_DITHER (dither);
-        d[i] = bias + tmp - last_random[i % stride];
-        last_random[i % stride] = tmp;
+      r = setup_random_buf (quant, len);
+      audio_orc_dither_rpdf (d, r, 32 - shift, -dither, len);
+      for (i = 0; i < len; i += stride) {
+        for (c = 0; c < stride; c++) {
+          tmp = d[i + c];
+          d[i + c] = bias + tmp - last_random[c];
+          last_random[c] = tmp;
+        }
       }
       break;
     }
@@ -175,6 +206,8 @@ gst_audio_quantize_quantize_int_dither_none (GstAudioQuantize * quant,
       samples * quant->stride);
 }
 
+/* the errors of the last @extra frames of the current block are placed in
+ * front of the buffer */
 static void
 setup_error_buf (GstAudioQuantize * quant, gint samples, gint extra)
 {
@@ -183,10 +216,23 @@ setup_error_buf (GstAudioQuantize * quant, gint samples, gint extra)
 
   if (quant->error_size < len) {
     quant->error_buf = g_realloc (quant->error_buf, len * sizeof (gint32));
-    if (quant->error_size == 0)
-      memset ((gint32 *) quant->error_buf, 0, stride * extra * sizeof (gint32));
     quant->error_size = len;
   }
+  if (quant->error_hist == NULL)
+    quant->error_hist = g_new0 (gint32, quant->blocks * stride * extra);
+
+  memcpy (quant->error_buf, quant->error_hist + quant->block * stride * extra,
+      stride * extra * sizeof (gint32));
+}
+
+/* keep the errors of the last @extra frames of the current block, they
+ * start at @e */
+static void
+store_error_hist (GstAudioQuantize * quant, const gint32 * e, gint extra)
+{
+  gint n = quant->stride * extra;
+
+  memcpy (quant->error_hist + quant->block * n, e, n * sizeof (gint32));
 }
 
 static void
@@ -194,7 +240,7 @@ gst_audio_quantize_quantize_int_dither_feedback (GstAudioQuantize * quant,
     const gpointer src, gpointer dst, gint samples)
 {
   guint32 mask;
-  gint i, len, stride;
+  gint i, c, len, stride;
   const gint32 *s = src;
   gint32 *dith, *d = dst, v, o, *e, err;
 
@@ -207,20 +253,24 @@ gst_audio_quantize_quantize_int_dither_feedback (GstAudioQuantize * quant,
   e = quant->error_buf;
   mask = ~quant->mask;
 
-  for (i = 0; i < len; i++) {
-    o = v = s[i];
-    /* add dither */
-    err = dith[i];
-    /* remove error */
-    err -= e[i];
-    ADDSS (v, err);
-    v &= mask;
-    /* store new error */
-    e[i + stride] = e[i] + (v - o);
-    /* store result */
-    d[i] = v;
+  /* the error of a channel only depends on the previous frame, process all
+   * channels of a frame together */
+  for (i = 0; i < len; i += stride) {
+    for (c = i; c < i + stride; c++) {
+      o = v = s[c];
+      /* add dither */
+      err = dith[c];
+      /* remove error */
+      err -= e[c];
+      ADDSS (v, err);
+      v &= mask;
+      /* store new error */
+      e[c + stride] = e[c] + (v - o);
+      /* store result */
+      d[c] = v;
+    }
   }
-  memmove (e, &e[len], sizeof (gint32) * stride);
+  store_error_hist (quant, &e[len], 1);
 }
 
 #define SHIFT 10
@@ -236,7 +286,7 @@ gst_audio_quantize_quantize_int_dither_noise_shape (GstAudioQuantize * quant,
   guint32 mask;
   gint i, j, k, len, stride, nc;
   const gint32 *s = src;
-  gint32 *c, *dith, *d = dst, v, o, *e, err;
+  gint32 *c, *dith, *d = dst, v, o, *e, *ep, *acc, err;
 
   nc = quant->n_coeffs;
 
@@ -248,28 +298,36 @@ gst_audio_quantize_quantize_int_dither_noise_shape (GstAudioQuantize * quant,
   dith = quant->dither_buf;
   e = quant->error_buf;
   c = quant->coeffs;
+  acc = quant->ns_acc;
   mask = ~quant->mask;
 
-  for (i = 0; i < len; i++) {
-    v = s[i];
-    /* combine and remove error */
-    err = 0;
-    for (j = 0, k = i; j < nc; j++, k += stride)
-      err -= e[k] * c[j];
-    err = (err + SROUND) >> (SREDUCE);
-    ADDSS (v, err);
-    o = v;
-    /* add dither */
-    err = dith[i];
-    ADDSS (v, err);
-    /* quantize */
-    v &= mask;
-    /* store new error with reduced precision */
-    e[k] = (v - o + RROUND) >> REDUCE;
-    /* store result */
-    d[i] = v;
+  for (i = 0; i < len; i += stride) {
+    /* filter the past errors of all channels of the frame at once */
+    for (k = 0; k < stride; k++)
+      acc[k] = 0;
+    for (j = 0, ep = &e[i]; j < nc; j++, ep += stride) {
+      for (k = 0; k < stride; k++)
+        acc[k] -= ep[k] * c[j];
+    }
+
+    for (k = 0; k < stride; k++) {
+      v = s[i + k];
+      /* combine and remove error */
+      err = (acc[k] + SROUND) >> (SREDUCE);
+      ADDSS (v, err);
+      o = v;
+      /* add dither */
+      err = dith[i + k];
+      ADDSS (v, err);
+      /* quantize */
+      v &= mask;
+      /* store new error with reduced precision */
+      ep[k] = (v - o + RROUND) >> REDUCE;
+      /* store result */
+      d[i + k] = v;
+    }
   }
-  memmove (e, &e[len], sizeof (gint32) * stride * nc);
+  store_error_hist (quant, &e[len], nc);
 }
 
 #define MAKE_QUANTIZE_FUNC_NAME(name)                                   \
@@ -359,6 +417,7 @@ gst_audio_quantize_setup_noise_shaping (GstAudioQuantize * quant)
     q = quant->coeffs = g_new0 (gint32, n_coeffs);
     for (i = 0; i < n_coeffs; i++)
       q[i] = floor (coeffs[i] * (1 << SHIFT) + 0.5);
+    quant->ns_acc = g_new (gint32, quant->stride);
   }
   return;
 }
@@ -368,7 +427,7 @@ gst_audio_quantize_setup_dither (GstAudioQuantize * quant)
 {
   switch (quant->dither) {
     case GST_AUDIO_DITHER_TPDF_HF:
-      quant->last_random = g_new0 (gint32, quant->stride);
+      quant->last_random = g_new0 (gint32, quant->stride * quant->blocks);
       break;
     case GST_AUDIO_DITHER_RPDF:
     case GST_AUDIO_DITHER_TPDF:
@@ -476,8 +535,11 @@ gst_audio_quantize_free (GstAudioQuantize * quant)
   g_return_if_fail (quant != NULL);
 
   g_free (quant->error_buf);
+  g_free (quant->error_hist);
   g_free (quant->coeffs);
+  g_free (quant->ns_acc);
   g_free (quant->last_random);
+  g_free (quant->random_buf);
   g_free (quant->dither_buf);
 
   g_slice_free (GstAudioQuantize, quant);
@@ -496,6 +558,11 @@ gst_audio_quantize_reset (GstAudioQuantize * quant)
   g_free (quant->error_buf);
   quant->error_buf = NULL;
   quant->error_size = 0;
+  g_free (quant->error_hist);
+  quant->error_hist = NULL;
+  if (quant->last_random)
+    memset (quant->last_random, 0,
+        quant->stride * quant->blocks * sizeof (gint32));
 }
 
 /**
@@ -526,6 +593,8 @@ gst_audio_quantize_samples (GstAudioQuantize * quant,
   g_return_if_fail (out != NULL || samples == 0);
   g_return_if_fail (in != NULL || samples == 0);
 
-  for (i = 0; i < quant->blocks; i++)
+  for (i = 0; i < quant->blocks; i++) {
+    quant->block = i;
     quant->quantize (quant, in[i], out[i], samples);
+  }
 }
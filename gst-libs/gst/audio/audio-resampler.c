@@ -911,6 +911,35 @@ static DeinterleaveFunc deinterleave_funcs[] = {
   deinterleave_gdouble
 };
 
+/* non-interleaved input only needs to be appended to our buffers */
+#define MAKE_COPY_FUNC(type)                                            \
+static void                                                             \
+copy_ ##type (GstAudioResampler * resampler, gpointer sbuf[],           \
+    gpointer in[], gsize in_frames)                                     \
+{                                                                       \
+  gint c, channels = resampler->channels;                               \
+  gsize samples_avail = resampler->samples_avail;                       \
+  for (c = 0; c < channels; c++) {                                      \
+    type *s = (type *) sbuf[c] + samples_avail;                         \
+    if (G_UNLIKELY (in == NULL))                                        \
+      memset (s, 0, in_frames * sizeof (type));                         \
+    else                                                                \
+      memcpy (s, in[c], in_frames * sizeof (type));                     \
+  }                                                                     \
+}
+
+MAKE_COPY_FUNC (gint16);
+MAKE_COPY_FUNC (gint32);
+MAKE_COPY_FUNC (gfloat);
+MAKE_COPY_FUNC (gdouble);
+
+static DeinterleaveFunc copy_funcs[] = {
+  copy_gint16,
+  copy_gint32,
+  copy_gfloat,
+  copy_gdouble
+};
+
 static void
 calculate_kaiser_params (GstAudioResampler * resampler)
 {
@@ -1383,7 +1412,10 @@ gst_audio_resampler_new (GstAudioResamplerMethod method,
   resampler->blocks = resampler->channels;
   resampler->inc = 1;
   resampler->ostride = non_interleaved ? 1 : resampler->channels;
-  resampler->deinterleave = deinterleave_funcs[resampler->format_index];
+  if (resampler->flags & GST_AUDIO_RESAMPLER_FLAG_NON_INTERLEAVED_IN)
+    resampler->deinterleave = copy_funcs[resampler->format_index];
+  else
+    resampler->deinterleave = deinterleave_funcs[resampler->format_index];
   resampler->convert_taps = convert_taps_funcs[resampler->format_index];
 
   GST_DEBUG ("method %d, bps %d, channels %d", method, resampler->bps,
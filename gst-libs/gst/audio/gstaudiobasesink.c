@@ -75,6 +75,14 @@ struct _GstAudioBaseSinkPrivate
   GstAudioBaseSinkCustomSlavingCallback custom_slaving_callback;
   gpointer custom_slaving_cb_data;
   GDestroyNotify custom_slaving_cb_notify;
+
+  /* statistics, protected by the object lock */
+  guint64 resyncs;
+  guint64 skew_corrections;
+
+  /* the next buffer follows a flush, a new segment or a new stream. Its
+   * resync is expected and not counted in the statistics */
+  gboolean expect_resync;
 };
 
 /* BaseAudioSink signals and args */
@@ -117,6 +125,7 @@ enum
   PROP_ALIGNMENT_THRESHOLD,
   PROP_DRIFT_TOLERANCE,
   PROP_DISCONT_WAIT,
+  PROP_STATS,
 
   PROP_LAST
 };
@@ -167,6 +176,7 @@ static gboolean gst_audio_base_sink_query (GstElement * element, GstQuery *
 
 static GstClock *gst_audio_base_sink_provide_clock (GstElement * elem);
 static inline void gst_audio_base_sink_reset_sync (GstAudioBaseSink * sink);
+static GstStructure *gst_audio_base_sink_get_stats (GstAudioBaseSink * sink);
 static GstClockTime gst_audio_base_sink_get_time (GstClock * clock,
     GstAudioBaseSink * sink);
 static void gst_audio_base_sink_callback (GstAudioRingBuffer * rbuf,
@@ -273,6 +283,36 @@ gst_audio_base_sink_class_init (GstAudioBaseSinkClass * klass)
           G_MAXUINT64 - 1, DEFAULT_DISCONT_WAIT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioBaseSink:stats:
+   *
+   * Various statistics about the playback. This property returns a
+   * #GstStructure named "GstAudioBaseSinkStats" with the following fields:
+   *
+   * - "resyncs" (#guint64): the number of times the sink could not align a
+   *   buffer with the previous one and had to resynchronise. The expected
+   *   resync of the first buffer after a flush, a new segment or a new
+   *   stream is not counted
+   * - "skew-corrections" (#guint64): the number of times the clock slaving
+   *   algorithm corrected the drift between the clocks
+   * - "latency" (#guint64): the current end-to-end latency in nanoseconds,
+   *   the upstream latency plus the data queued in the ringbuffer and in the
+   *   device
+   *
+   * When a ringbuffer was created, the fields of
+   * gst_audio_ring_buffer_get_stats() are added as well. The "xruns" field
+   * then counts the underruns of the sink and "fill-level" is a histogram
+   * of the ringbuffer fill level.
+   *
+   * The statistics are cheap to maintain and always collected.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Sink Statistics", GST_TYPE_STRUCTURE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_audio_base_sink_change_state);
   gstelement_class->provide_clock =
@@ -846,6 +886,57 @@ gst_audio_base_sink_get_discont_wait (GstAudioBaseSink * sink)
   return result;
 }
 
+static gboolean
+copy_stats_field (GQuark field_id, const GValue * value, gpointer user_data)
+{
+  gst_structure_id_set_value (user_data, field_id, value);
+  return TRUE;
+}
+
+static GstStructure *
+gst_audio_base_sink_get_stats (GstAudioBaseSink * sink)
+{
+  GstAudioRingBuffer *ringbuf = NULL;
+  GstClockTime latency;
+  GstStructure *s;
+
+  GST_OBJECT_LOCK (sink);
+  s = gst_structure_new ("GstAudioBaseSinkStats",
+      "resyncs", G_TYPE_UINT64, sink->priv->resyncs,
+      "skew-corrections", G_TYPE_UINT64, sink->priv->skew_corrections, NULL);
+  latency = sink->priv->us_latency;
+  if (!GST_CLOCK_TIME_IS_VALID (latency))
+    latency = 0;
+  if (sink->ringbuffer)
+    ringbuf = gst_object_ref (sink->ringbuffer);
+  GST_OBJECT_UNLOCK (sink);
+
+  if (ringbuf) {
+    GstStructure *rs;
+    gint fill = 0, rate;
+
+    rs = gst_audio_ring_buffer_get_stats (ringbuf);
+    gst_structure_get_int (rs, "fill", &fill);
+    gst_structure_foreach (rs, copy_stats_field, s);
+    gst_structure_free (rs);
+
+    /* add the data queued in the ringbuffer and in the device */
+    rate = GST_AUDIO_INFO_RATE (&ringbuf->spec.info);
+    if (gst_audio_ring_buffer_is_acquired (ringbuf) && rate > 0) {
+      guint64 queued;
+
+      queued = (guint64) fill * ringbuf->samples_per_seg +
+          gst_audio_ring_buffer_delay (ringbuf);
+      latency += gst_util_uint64_scale_int (queued, GST_SECOND, rate);
+    }
+    gst_object_unref (ringbuf);
+  }
+
+  gst_structure_set (s, "latency", G_TYPE_UINT64, latency, NULL);
+
+  return s;
+}
+
 static void
 gst_audio_base_sink_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
@@ -920,6 +1011,9 @@ gst_audio_base_sink_get_property (GObject * object, guint prop_id,
     case PROP_DISCONT_WAIT:
       g_value_set_uint64 (value, gst_audio_base_sink_get_discont_wait (sink));
       break;
+    case PROP_STATS:
+      g_value_take_boxed (value, gst_audio_base_sink_get_stats (sink));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1185,6 +1279,7 @@ gst_audio_base_sink_event (GstBaseSink * bsink, GstEvent * event)
     case GST_EVENT_FLUSH_STOP:
       /* always resync on sample after a flush */
       gst_audio_base_sink_reset_sync (sink);
+      sink->priv->expect_resync = TRUE;
 
       gst_audio_base_sink_custom_cb_report_discont (sink,
           GST_AUDIO_BASE_SINK_DISCONT_REASON_FLUSH);
@@ -1192,6 +1287,10 @@ gst_audio_base_sink_event (GstBaseSink * bsink, GstEvent * event)
       if (sink->ringbuffer)
         gst_audio_ring_buffer_set_flushing (sink->ringbuffer, FALSE);
       break;
+    case GST_EVENT_STREAM_START:
+    case GST_EVENT_SEGMENT:
+      sink->priv->expect_resync = TRUE;
+      break;
     default:
       break;
   }
@@ -1323,6 +1422,12 @@ gst_audio_base_sink_custom_slaving (GstAudioBaseSink * sink,
         "no custom slaving callback set - clock drift will not be compensated");
   }
 
+  if (requested_skew != 0) {
+    GST_OBJECT_LOCK (sink);
+    sink->priv->skew_corrections++;
+    GST_OBJECT_UNLOCK (sink);
+  }
+
   if (requested_skew > 0) {
     cexternal = (cexternal > requested_skew) ? (cexternal - requested_skew) : 0;
 
@@ -1479,6 +1584,12 @@ gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
   mdrift = sink->priv->drift_tolerance * 1000;
   mdrift2 = mdrift / 2;
 
+  if (sink->priv->avg_skew > mdrift2 || sink->priv->avg_skew < -mdrift2) {
+    GST_OBJECT_LOCK (sink);
+    sink->priv->skew_corrections++;
+    GST_OBJECT_UNLOCK (sink);
+  }
+
   /* adjust playout pointer based on skew */
   if (sink->priv->avg_skew > mdrift2) {
     /* master is running slower, move internal time forward */
@@ -1811,6 +1922,12 @@ gst_audio_base_sink_get_alignment (GstAudioBaseSink * sink,
         sample_offset > sink->next_sample ? "+" : "-", GST_TIME_ARGS (diff_s));
     align = 0;
 
+    if (!sink->priv->expect_resync) {
+      GST_OBJECT_LOCK (sink);
+      sink->priv->resyncs++;
+      GST_OBJECT_UNLOCK (sink);
+    }
+
     gst_audio_base_sink_custom_cb_report_discont (sink,
         GST_AUDIO_BASE_SINK_DISCONT_REASON_ALIGNMENT);
   }
@@ -2121,14 +2238,14 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   if (G_UNLIKELY (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_DISCONT) ||
           GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_RESYNC))) {
     GST_DEBUG_OBJECT (sink, "resync after discont/resync");
-    goto no_align;
+    goto resync;
   }
 
   /* resync when we don't know what to align the sample with */
   if (G_UNLIKELY (sink->next_sample == -1)) {
     GST_DEBUG_OBJECT (sink,
         "no align possible: no previous sample position known");
-    goto no_align;
+    goto resync;
   }
 
   align = gst_audio_base_sink_get_alignment (sink, sample_offset);
@@ -2144,8 +2261,18 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
     goto no_align;
   }
   render_stop += align;
+  goto no_align;
+
+resync:
+  if (!sink->priv->expect_resync) {
+    GST_OBJECT_LOCK (sink);
+    sink->priv->resyncs++;
+    GST_OBJECT_UNLOCK (sink);
+  }
 
 no_align:
+  sink->priv->expect_resync = FALSE;
+
   /* number of target samples is difference between start and stop */
   out_samples = render_stop - render_start;
 
@@ -2442,6 +2569,7 @@ gst_audio_base_sink_change_state (GstElement * element,
     }
     case GST_STATE_CHANGE_READY_TO_PAUSED:
       gst_audio_base_sink_reset_sync (sink);
+      sink->priv->expect_resync = TRUE;
       gst_audio_ring_buffer_set_flushing (sink->ringbuffer, FALSE);
       gst_audio_ring_buffer_may_start (sink->ringbuffer, FALSE);
 
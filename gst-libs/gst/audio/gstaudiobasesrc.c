@@ -75,6 +75,10 @@ struct _GstAudioBaseSrcPrivate
 {
   /* the clock slaving algorithm in use */
   GstAudioBaseSrcSlaveMethod slave_method;
+
+  /* statistics, protected by the object lock */
+  guint64 resyncs;
+  guint64 discontinuities;
 };
 
 /* BaseAudioSrc signals and args */
@@ -101,6 +105,7 @@ enum
   PROP_ACTUAL_LATENCY_TIME,
   PROP_PROVIDE_CLOCK,
   PROP_SLAVE_METHOD,
+  PROP_STATS,
   PROP_LAST
 };
 
@@ -216,6 +221,31 @@ gst_audio_base_src_class_init (GstAudioBaseSrcClass * klass)
           GST_TYPE_AUDIO_BASE_SRC_SLAVE_METHOD, DEFAULT_SLAVE_METHOD,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioBaseSrc:stats:
+   *
+   * Various statistics about the capture. This property returns a
+   * #GstStructure named "GstAudioBaseSrcStats" with the following fields:
+   *
+   * - "resyncs" (#guint64): the number of times the ringbuffer was moved to
+   *   the running time of the pipeline clock by the skew slaving algorithm
+   * - "discontinuities" (#guint64): the number of buffers that were marked
+   *   DISCONT because samples were dropped
+   * - "latency" (#guint64): the current latency in nanoseconds, the data
+   *   queued in the device and in the ringbuffer
+   *
+   * When a ringbuffer was created, the fields of
+   * gst_audio_ring_buffer_get_stats() are added as well. The "xruns" field
+   * then counts the overruns of the source and "fill-level" is a histogram
+   * of the ringbuffer fill level.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Source Statistics", GST_TYPE_STRUCTURE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_audio_base_src_change_state);
   gstelement_class->provide_clock =
@@ -468,6 +498,54 @@ gst_audio_base_src_set_property (GObject * object, guint prop_id,
   }
 }
 
+static gboolean
+copy_stats_field (GQuark field_id, const GValue * value, gpointer user_data)
+{
+  gst_structure_id_set_value (user_data, field_id, value);
+  return TRUE;
+}
+
+static GstStructure *
+gst_audio_base_src_get_stats (GstAudioBaseSrc * src)
+{
+  GstAudioRingBuffer *ringbuf = NULL;
+  GstClockTime latency = 0;
+  GstStructure *s;
+
+  GST_OBJECT_LOCK (src);
+  s = gst_structure_new ("GstAudioBaseSrcStats",
+      "resyncs", G_TYPE_UINT64, src->priv->resyncs,
+      "discontinuities", G_TYPE_UINT64, src->priv->discontinuities, NULL);
+  if (src->ringbuffer)
+    ringbuf = gst_object_ref (src->ringbuffer);
+  GST_OBJECT_UNLOCK (src);
+
+  if (ringbuf) {
+    GstStructure *rs;
+    gint fill = 0, rate;
+
+    rs = gst_audio_ring_buffer_get_stats (ringbuf);
+    gst_structure_get_int (rs, "fill", &fill);
+    gst_structure_foreach (rs, copy_stats_field, s);
+    gst_structure_free (rs);
+
+    /* the data captured by the device but not read by us yet */
+    rate = GST_AUDIO_INFO_RATE (&ringbuf->spec.info);
+    if (gst_audio_ring_buffer_is_acquired (ringbuf) && rate > 0) {
+      guint64 queued;
+
+      queued = (guint64) fill * ringbuf->samples_per_seg +
+          gst_audio_ring_buffer_delay (ringbuf);
+      latency = gst_util_uint64_scale_int (queued, GST_SECOND, rate);
+    }
+    gst_object_unref (ringbuf);
+  }
+
+  gst_structure_set (s, "latency", G_TYPE_UINT64, latency, NULL);
+
+  return s;
+}
+
 static void
 gst_audio_base_src_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec)
@@ -505,6 +583,9 @@ gst_audio_base_src_get_property (GObject * object, guint prop_id,
     case PROP_SLAVE_METHOD:
       g_value_set_enum (value, gst_audio_base_src_get_slave_method (src));
       break;
+    case PROP_STATS:
+      g_value_take_boxed (value, gst_audio_base_src_get_stats (src));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -869,6 +950,10 @@ gst_audio_base_src_create (GstBaseSrc * bsrc, guint64 offset, guint length,
             "downstream can't keep up and is consuming samples too slowly.",
             sample - src->next_sample));
     GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DISCONT);
+
+    GST_OBJECT_LOCK (src);
+    src->priv->discontinuities++;
+    GST_OBJECT_UNLOCK (src);
   }
 
   src->next_sample = sample + samples;
@@ -971,6 +1056,8 @@ gst_audio_base_src_create (GstBaseSrc * bsrc, guint64 offset, guint length,
 
           /* advance the ringbuffer */
           gst_audio_ring_buffer_advance (ringbuffer, segment_diff);
+          /* the object lock is held for the whole clock sync */
+          src->priv->resyncs++;
 
           /* we move the  new read segment to the last known written segment */
           new_read_segment =
@@ -56,7 +56,9 @@
  *       to parse this into subsequently manageable (as defined by subclass)
  *       chunks.  Such chunks are subsequently referred to as 'frames',
  *       though they may or may not correspond to 1 (or more) audio format frame.
- *     * Input frame is provided to subclass' @handle_frame.
+ *     * Input frame is provided to subclass' @handle_frame.  In non-live
+ *       pipelines, subclass can also opt in to have a batch of frames
+ *       provided to @handle_frames (see gst_audio_decoder_set_max_batch()).
  *     * If codec processing results in decoded data, subclass should call
  *       @gst_audio_decoder_finish_frame to have decoded data pushed
  *       downstream.
@@ -151,6 +153,7 @@ enum
 #define DEFAULT_PLC        FALSE
 #define DEFAULT_DRAINABLE  TRUE
 #define DEFAULT_NEEDS_FORMAT  FALSE
+#define DEFAULT_MAX_BATCH  1
 
 typedef struct _GstAudioDecoderContext
 {
@@ -201,6 +204,10 @@ struct _GstAudioDecoderPrivate
   guint64 prev_distance;
   /* frames obtained from input */
   GQueue frames;
+  /* number of frames at the tail of frames not yet handed to subclass */
+  guint batch_len;
+  /* storage for the frames handed to handle_frames */
+  GPtrArray *batch;
   /* collected output data */
   GstAdapter *adapter_out;
   /* ts and duration for output data collected above */
@@ -257,6 +264,7 @@ struct _GstAudioDecoderPrivate
   gboolean plc;
   gboolean drainable;
   gboolean needs_format;
+  guint max_batch;
 
   /* pending serialized sink events, will be sent from finish_frame() */
   GList *pending_events;
@@ -303,6 +311,8 @@ static gboolean gst_audio_decoder_negotiate_default (GstAudioDecoder * dec);
 static gboolean gst_audio_decoder_negotiate_unlocked (GstAudioDecoder * dec);
 static gboolean gst_audio_decoder_handle_gap (GstAudioDecoder * dec,
     GstEvent * event);
+static GstFlowReturn gst_audio_decoder_handle_batch (GstAudioDecoder * dec,
+    GstAudioDecoderClass * klass);
 static gboolean gst_audio_decoder_sink_query_default (GstAudioDecoder * dec,
     GstQuery * query);
 static gboolean gst_audio_decoder_src_query_default (GstAudioDecoder * dec,
@@ -445,6 +455,7 @@ gst_audio_decoder_init (GstAudioDecoder * dec, GstAudioDecoderClass * klass)
   dec->priv->adapter = gst_adapter_new ();
   dec->priv->adapter_out = gst_adapter_new ();
   g_queue_init (&dec->priv->frames);
+  dec->priv->batch = g_ptr_array_new ();
 
   g_rec_mutex_init (&dec->stream_lock);
 
@@ -454,6 +465,7 @@ gst_audio_decoder_init (GstAudioDecoder * dec, GstAudioDecoderClass * klass)
   dec->priv->plc = DEFAULT_PLC;
   dec->priv->drainable = DEFAULT_DRAINABLE;
   dec->priv->needs_format = DEFAULT_NEEDS_FORMAT;
+  dec->priv->max_batch = DEFAULT_MAX_BATCH;
 
   /* init state */
   dec->priv->ctx.min_latency = 0;
@@ -516,6 +528,7 @@ gst_audio_decoder_reset (GstAudioDecoder * dec, gboolean full)
 
   g_queue_foreach (&dec->priv->frames, (GFunc) gst_buffer_unref, NULL);
   g_queue_clear (&dec->priv->frames);
+  dec->priv->batch_len = 0;
   gst_adapter_clear (dec->priv->adapter);
   gst_adapter_clear (dec->priv->adapter_out);
   dec->priv->out_ts = GST_CLOCK_TIME_NONE;
@@ -545,6 +558,7 @@ gst_audio_decoder_finalize (GObject * object)
   if (dec->priv->adapter_out) {
     g_object_unref (dec->priv->adapter_out);
   }
+  g_ptr_array_free (dec->priv->batch, TRUE);
 
   g_rec_mutex_clear (&dec->stream_lock);
 
@@ -844,6 +858,10 @@ gst_audio_decoder_sink_setcaps (GstAudioDecoder * dec, GstCaps * caps)
   dec->priv->taglist_changed = TRUE;
 #endif
 
+  /* frames still waiting in a batch were encoded with the old caps */
+  if (gst_audio_decoder_handle_batch (dec, klass) != GST_FLOW_OK)
+    GST_DEBUG_OBJECT (dec, "failed to decode pending batch before new caps");
+
   if (klass->set_format)
     res = klass->set_format (dec, caps);
 
@@ -1397,10 +1415,43 @@ wrong_buffer:
   }
 }
 
+/* hand the frames collected for a batch to subclass */
+static GstFlowReturn
+gst_audio_decoder_handle_batch (GstAudioDecoder * dec,
+    GstAudioDecoderClass * klass)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  GList *l;
+  guint i, n;
+
+  n = priv->batch_len;
+  if (n == 0)
+    return GST_FLOW_OK;
+
+  priv->batch_len = 0;
+
+  /* the batch is at the tail of the frames queue */
+  g_ptr_array_set_size (priv->batch, n);
+  for (i = n, l = priv->frames.tail; i > 0 && l; l = l->prev)
+    g_ptr_array_index (priv->batch, --i) = l->data;
+  g_assert (i == 0);
+
+  GST_LOG_OBJECT (dec, "providing subclass with batch of %u frames", n);
+
+  if (n == 1)
+    return klass->handle_frame (dec, g_ptr_array_index (priv->batch, 0));
+
+  return klass->handle_frames (dec, (GstBuffer **) priv->batch->pdata, n);
+}
+
 static GstFlowReturn
 gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
     GstAudioDecoderClass * klass, GstBuffer * buffer)
 {
+  GstAudioDecoderPrivate *priv = dec->priv;
+  gboolean batch = FALSE;
+  GstFlowReturn ret;
+
   /* Skip decoding and send a GAP instead if
    * GST_SEGMENT_FLAG_TRICKMODE_NO_AUDIO is set and we have timestamps
    * FIXME: We only do this for forward playback atm, because reverse
@@ -1415,6 +1466,12 @@ gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
         GstEvent *event = gst_event_new_gap (ts, GST_BUFFER_DURATION (buffer));
 
         gst_buffer_unref (buffer);
+        /* keep the gap after any frames still waiting in a batch */
+        ret = gst_audio_decoder_handle_batch (dec, klass);
+        if (ret != GST_FLOW_OK) {
+          gst_event_unref (event);
+          return ret;
+        }
         GST_LOG_OBJECT (dec, "Skipping decode in trickmode and sending gap");
         gst_audio_decoder_handle_gap (dec, event);
         return GST_FLOW_OK;
@@ -1433,11 +1490,29 @@ gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
     GST_OBJECT_LOCK (dec);
     dec->priv->bytes_in += size;
     GST_OBJECT_UNLOCK (dec);
-  } else {
-    GST_LOG_OBJECT (dec, "providing subclass with NULL frame");
+
+    /* collect frames for subclass if it can handle a batch of them, which
+     * would add latency so is only done in non-live pipelines */
+    if (priv->max_batch > 1 && klass->handle_frames) {
+      if (G_UNLIKELY (priv->agg < 0))
+        gst_audio_decoder_setup (dec);
+      batch = priv->agg;
+    }
+
+    priv->batch_len++;
+    if (batch && priv->batch_len < priv->max_batch)
+      return GST_FLOW_OK;
+
+    return gst_audio_decoder_handle_batch (dec, klass);
   }
 
-  return klass->handle_frame (dec, buffer);
+  GST_LOG_OBJECT (dec, "providing subclass with NULL frame");
+
+  ret = gst_audio_decoder_handle_batch (dec, klass);
+  if (ret != GST_FLOW_OK)
+    return ret;
+
+  return klass->handle_frame (dec, NULL);
 }
 
 /* maybe subclass configurable instead, but this allows for a whole lot of
@@ -1527,6 +1602,10 @@ gst_audio_decoder_push_buffers (GstAudioDecoder * dec, gboolean force)
     } else {
       if (!force)
         break;
+      /* whatever happens, frames collected for a batch are due now */
+      ret = gst_audio_decoder_handle_batch (dec, klass);
+      if (ret != GST_FLOW_OK)
+        break;
       if (!priv->drainable) {
         priv->drained = TRUE;
         break;
@@ -2097,17 +2176,35 @@ gst_audio_decoder_handle_gap (GstAudioDecoder * dec, GstEvent * event)
     buf = gst_buffer_new ();
     GST_BUFFER_TIMESTAMP (buf) = timestamp;
     GST_BUFFER_DURATION (buf) = duration;
-    /* best effort, not much error handling */
-    gst_audio_decoder_handle_frame (dec, klass, buf);
+    /* best effort, not much error handling. The frames still waiting in a
+     * batch precede the gap, and the concealment frame goes to subclass on
+     * its own right away instead of waiting in the next batch */
+    GST_AUDIO_DECODER_STREAM_LOCK (dec);
+    if (gst_audio_decoder_handle_batch (dec, klass) == GST_FLOW_OK) {
+      g_queue_push_tail (&dec->priv->frames, buf);
+      dec->priv->ctx.delay = dec->priv->frames.length;
+      GST_LOG_OBJECT (dec, "providing subclass with concealment frame");
+      klass->handle_frame (dec, buf);
+    } else {
+      gst_buffer_unref (buf);
+    }
+    GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
     ret = TRUE;
     dec->priv->expecting_discont_buf = TRUE;
     gst_event_unref (event);
   } else {
+    GstAudioDecoderClass *klass = GST_AUDIO_DECODER_GET_CLASS (dec);
     GstFlowReturn flowret;
 
+    /* frames still waiting in a batch precede the gap */
+    GST_AUDIO_DECODER_STREAM_LOCK (dec);
+    flowret = gst_audio_decoder_handle_batch (dec, klass);
+    GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+
     /* sub-class doesn't know how to handle empty buffers,
      * so just try sending GAP downstream */
-    flowret = check_pending_reconfigure (dec);
+    if (flowret == GST_FLOW_OK)
+      flowret = check_pending_reconfigure (dec);
     if (flowret == GST_FLOW_OK) {
       send_pending_events (dec);
       ret = gst_audio_decoder_push_event (dec, event);
@@ -2166,6 +2263,9 @@ gst_audio_decoder_sink_eventfunc (GstAudioDecoder * dec, GstEvent * event)
       GstFormat format;
 
       GST_AUDIO_DECODER_STREAM_LOCK (dec);
+      /* frames still waiting in a batch belong to the previous segment */
+      gst_audio_decoder_handle_batch (dec, GST_AUDIO_DECODER_GET_CLASS (dec));
+
       gst_event_copy_segment (event, &seg);
 
       format = seg.format;
@@ -3417,6 +3517,64 @@ gst_audio_decoder_get_drainable (GstAudioDecoder * dec)
   return result;
 }
 
+/**
+ * gst_audio_decoder_set_max_batch:
+ * @dec: a #GstAudioDecoder
+ * @frames: maximum number of frames in a batch
+ *
+ * Configures the maximum number of input frames that are collected and
+ * handed to the subclass' #GstAudioDecoderClass.handle_frames() at once.
+ * Decoding a batch of frames into a single output buffer avoids the
+ * per-frame overhead of the base class for codecs with very small frames.
+ *
+ * Batching is only done when the subclass implements
+ * #GstAudioDecoderClass.handle_frames() and the pipeline is not live, as it
+ * delays decoding until enough frames were received. A batch is also handed
+ * over when draining, e.g. on discontinuities or EOS, and before a gap, a new
+ * segment or new caps are handled, so it never spans any of these. A value
+ * of 1 disables batching.
+ *
+ * MT safe.
+ *
+ * Since: 1.12
+ */
+void
+gst_audio_decoder_set_max_batch (GstAudioDecoder * dec, guint frames)
+{
+  g_return_if_fail (GST_IS_AUDIO_DECODER (dec));
+  g_return_if_fail (frames > 0);
+
+  GST_OBJECT_LOCK (dec);
+  dec->priv->max_batch = frames;
+  GST_OBJECT_UNLOCK (dec);
+}
+
+/**
+ * gst_audio_decoder_get_max_batch:
+ * @dec: a #GstAudioDecoder
+ *
+ * Queries the maximum number of frames handed to subclass at once.
+ *
+ * Returns: the maximum number of frames in a batch.
+ *
+ * MT safe.
+ *
+ * Since: 1.12
+ */
+guint
+gst_audio_decoder_get_max_batch (GstAudioDecoder * dec)
+{
+  guint result;
+
+  g_return_val_if_fail (GST_IS_AUDIO_DECODER (dec), 0);
+
+  GST_OBJECT_LOCK (dec);
+  result = dec->priv->max_batch;
+  GST_OBJECT_UNLOCK (dec);
+
+  return result;
+}
+
 /**
  * gst_audio_decoder_set_needs_format:
  * @dec: a #GstAudioDecoder
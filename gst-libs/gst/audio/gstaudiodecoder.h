@@ -251,6 +251,13 @@ struct _GstAudioDecoder
  *                  tags and meta with only the "audio" tag. subclasses can
  *                  implement this method and return %TRUE if the metadata is to be
  *                  copied. Since 1.6
+ * @handle_frames:  Optional.
+ *                  Provides a batch of input frames to subclass, see
+ *                  gst_audio_decoder_set_max_batch().  As for @handle_frame,
+ *                  input data ref management is performed by base class.
+ *                  Subclass may decode the frames into a single output
+ *                  buffer and finish them with one call to
+ *                  gst_audio_decoder_finish_frame(). Since 1.12
  *
  * Subclasses can override any of the available virtual methods or not, as
  * needed. At minimum @handle_frame (and likely @set_format) needs to be
@@ -308,8 +315,12 @@ struct _GstAudioDecoderClass
   gboolean      (*transform_meta)     (GstAudioDecoder *enc, GstBuffer *outbuf,
                                        GstMeta *meta, GstBuffer *inbuf);
 
+  GstFlowReturn (*handle_frames)      (GstAudioDecoder *dec,
+                                       GstBuffer **buffers,
+                                       guint n_buffers);
+
   /*< private >*/
-  gpointer       _gst_reserved[GST_PADDING_LARGE - 4];
+  gpointer       _gst_reserved[GST_PADDING_LARGE - 5];
 };
 
 GType             gst_audio_decoder_get_type (void);
@@ -389,6 +400,11 @@ void              gst_audio_decoder_set_needs_format (GstAudioDecoder * dec,
 
 gboolean          gst_audio_decoder_get_needs_format (GstAudioDecoder * dec);
 
+void              gst_audio_decoder_set_max_batch (GstAudioDecoder * dec,
+                                                   guint frames);
+
+guint             gst_audio_decoder_get_max_batch (GstAudioDecoder * dec);
+
 void              gst_audio_decoder_get_allocator (GstAudioDecoder * dec,
                                                    GstAllocator ** allocator,
                                                    GstAllocationParams * params);
@@ -59,6 +59,10 @@
  *       downstream. Alternatively, it might also call
  *       gst_audio_encoder_finish_frame() (with a NULL buffer and some number of
  *       dropped samples) to indicate dropped (non-encoded) samples.
+ *     * Subclass encoding each chunk independently of the others may
+ *       also implement @encode_frame, which lets base class encode chunks
+ *       on several threads in non-live pipelines
+ *       (see gst_audio_encoder_set_max_threads()).
  *     * Just prior to actually pushing a buffer downstream,
  *       it is passed to @pre_push.
  *     * During the parsing process GstAudioEncoderClass will handle both
@@ -156,6 +160,7 @@ enum
 #define DEFAULT_TOLERANCE    40000000
 #define DEFAULT_HARD_MIN     FALSE
 #define DEFAULT_DRAINABLE    TRUE
+#define DEFAULT_MAX_THREADS  1
 
 typedef struct _GstAudioEncoderContext
 {
@@ -243,8 +248,29 @@ struct _GstAudioEncoderPrivate
 
   /* pending serialized sink events, will be sent from finish_frame() */
   GList *pending_events;
+
+  /* parallel encoding of independent frames */
+  guint max_threads;
+  /* upstream is live, -1 if not known yet */
+  gint live;
+  GThreadPool *pool;
+  guint pool_threads;
+  /* encode jobs in input order, protected by job_lock */
+  GQueue jobs;
+  GMutex job_lock;
+  GCond job_cond;
 };
 
+typedef struct _GstAudioEncoderJob
+{
+  GstBuffer *inbuf;
+  gint samples;
+  /* result, protected by job_lock */
+  GstBuffer *outbuf;
+  GstFlowReturn ret;
+  gboolean done;
+} GstAudioEncoderJob;
+
 
 static GstElementClass *parent_class = NULL;
 
@@ -286,6 +312,9 @@ gst_audio_encoder_get_type (void)
 
 static void gst_audio_encoder_finalize (GObject * object);
 static void gst_audio_encoder_reset (GstAudioEncoder * enc, gboolean full);
+static GstFlowReturn gst_audio_encoder_collect_jobs (GstAudioEncoder * enc,
+    guint max);
+static void gst_audio_encoder_discard_jobs (GstAudioEncoder * enc);
 
 static void gst_audio_encoder_set_property (GObject * object,
     guint prop_id, const GValue * value, GParamSpec * pspec);
@@ -428,6 +457,10 @@ gst_audio_encoder_init (GstAudioEncoder * enc, GstAudioEncoderClass * bclass)
 
   g_rec_mutex_init (&enc->stream_lock);
 
+  g_queue_init (&enc->priv->jobs);
+  g_mutex_init (&enc->priv->job_lock);
+  g_cond_init (&enc->priv->job_cond);
+
   /* property default */
   enc->priv->granule = DEFAULT_GRANULE;
   enc->priv->perfect_ts = DEFAULT_PERFECT_TS;
@@ -435,6 +468,7 @@ gst_audio_encoder_init (GstAudioEncoder * enc, GstAudioEncoderClass * bclass)
   enc->priv->tolerance = DEFAULT_TOLERANCE;
   enc->priv->hard_min = DEFAULT_HARD_MIN;
   enc->priv->drainable = DEFAULT_DRAINABLE;
+  enc->priv->max_threads = DEFAULT_MAX_THREADS;
 
   /* init state */
   enc->priv->ctx.min_latency = 0;
@@ -450,6 +484,9 @@ gst_audio_encoder_reset (GstAudioEncoder * enc, gboolean full)
 
   GST_LOG_OBJECT (enc, "reset full %d", full);
 
+  /* encoded data of pending jobs no longer belongs to the stream */
+  gst_audio_encoder_discard_jobs (enc);
+
   if (full) {
     enc->priv->active = FALSE;
     GST_OBJECT_LOCK (enc);
@@ -488,6 +525,11 @@ gst_audio_encoder_reset (GstAudioEncoder * enc, gboolean full)
     g_list_foreach (enc->priv->pending_events, (GFunc) gst_event_unref, NULL);
     g_list_free (enc->priv->pending_events);
     enc->priv->pending_events = NULL;
+
+    if (enc->priv->pool) {
+      g_thread_pool_free (enc->priv->pool, FALSE, TRUE);
+      enc->priv->pool = NULL;
+    }
   }
 
   gst_segment_init (&enc->input_segment, GST_FORMAT_TIME);
@@ -501,6 +543,7 @@ gst_audio_encoder_reset (GstAudioEncoder * enc, gboolean full)
   enc->priv->base_gp = -1;
   enc->priv->samples = 0;
   enc->priv->discont = FALSE;
+  enc->priv->live = -1;
 
   GST_AUDIO_ENCODER_STREAM_UNLOCK (enc);
 }
@@ -512,6 +555,11 @@ gst_audio_encoder_finalize (GObject * object)
 
   g_object_unref (enc->priv->adapter);
 
+  if (enc->priv->pool)
+    g_thread_pool_free (enc->priv->pool, FALSE, TRUE);
+  g_mutex_clear (&enc->priv->job_lock);
+  g_cond_clear (&enc->priv->job_cond);
+
   g_rec_mutex_clear (&enc->stream_lock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -1026,6 +1074,172 @@ overflow:
   }
 }
 
+static void
+gst_audio_encoder_encode_job (GstAudioEncoderJob * job, GstAudioEncoder * enc)
+{
+  GstAudioEncoderClass *klass;
+  GstBuffer *outbuf = NULL;
+  GstFlowReturn ret;
+
+  klass = GST_AUDIO_ENCODER_GET_CLASS (enc);
+
+  ret = klass->encode_frame (enc, job->inbuf, &outbuf);
+
+  g_mutex_lock (&enc->priv->job_lock);
+  job->outbuf = outbuf;
+  job->ret = ret;
+  job->done = TRUE;
+  g_cond_broadcast (&enc->priv->job_cond);
+  g_mutex_unlock (&enc->priv->job_lock);
+}
+
+static void
+gst_audio_encoder_free_job (GstAudioEncoderJob * job)
+{
+  gst_buffer_unref (job->inbuf);
+  if (job->outbuf)
+    gst_buffer_unref (job->outbuf);
+  g_slice_free (GstAudioEncoderJob, job);
+}
+
+/* finishes encoded jobs in input order, waiting for the oldest ones
+ * as long as more than @max jobs are pending */
+static GstFlowReturn
+gst_audio_encoder_collect_jobs (GstAudioEncoder * enc, guint max)
+{
+  GstAudioEncoderPrivate *priv = enc->priv;
+  GstAudioEncoderJob *job;
+  GstFlowReturn ret = GST_FLOW_OK;
+
+  g_mutex_lock (&priv->job_lock);
+  while ((job = g_queue_peek_head (&priv->jobs))) {
+    if (!job->done) {
+      if (priv->jobs.length <= max)
+        break;
+      g_cond_wait (&priv->job_cond, &priv->job_lock);
+      continue;
+    }
+    g_queue_pop_head (&priv->jobs);
+    g_mutex_unlock (&priv->job_lock);
+
+    if (ret == GST_FLOW_OK)
+      ret = job->ret;
+    if (ret == GST_FLOW_OK) {
+      GST_LOG_OBJECT (enc, "finishing job of %d samples", job->samples);
+      ret = gst_audio_encoder_finish_frame (enc, job->outbuf, job->samples);
+      job->outbuf = NULL;
+    } else {
+      /* drop the output after an error, but still consume the input so the
+       * adapter and timestamp tracking stay in sync with the jobs */
+      GST_LOG_OBJECT (enc, "dropping job of %d samples", job->samples);
+      gst_audio_encoder_finish_frame (enc, NULL, job->samples);
+    }
+    gst_audio_encoder_free_job (job);
+
+    g_mutex_lock (&priv->job_lock);
+  }
+  g_mutex_unlock (&priv->job_lock);
+
+  return ret;
+}
+
+static void
+gst_audio_encoder_discard_jobs (GstAudioEncoder * enc)
+{
+  GstAudioEncoderPrivate *priv = enc->priv;
+  GstAudioEncoderJob *job;
+
+  g_mutex_lock (&priv->job_lock);
+  while ((job = g_queue_pop_head (&priv->jobs))) {
+    /* worker might still be busy with it */
+    while (!job->done)
+      g_cond_wait (&priv->job_cond, &priv->job_lock);
+    gst_audio_encoder_free_job (job);
+  }
+  g_mutex_unlock (&priv->job_lock);
+}
+
+static GstFlowReturn
+gst_audio_encoder_push_job (GstAudioEncoder * enc, GstBuffer * buf,
+    gint samples)
+{
+  GstAudioEncoderPrivate *priv = enc->priv;
+  GstAudioEncoderJob *job;
+
+  job = g_slice_new0 (GstAudioEncoderJob);
+  job->inbuf = gst_buffer_ref (buf);
+  job->samples = samples;
+  job->ret = GST_FLOW_OK;
+
+  g_mutex_lock (&priv->job_lock);
+  g_queue_push_tail (&priv->jobs, job);
+  g_mutex_unlock (&priv->job_lock);
+
+  g_thread_pool_push (priv->pool, job, NULL);
+
+  /* push out what is done already, and keep a bounded amount in flight */
+  return gst_audio_encoder_collect_jobs (enc, 2 * priv->pool_threads);
+}
+
+static gboolean
+gst_audio_encoder_query_live (GstAudioEncoder * enc)
+{
+  GstQuery *query;
+  gboolean live = TRUE;
+
+  /* assume live unless told otherwise, as it is the safe option */
+  query = gst_query_new_latency ();
+  if (gst_pad_peer_query (enc->sinkpad, query))
+    gst_query_parse_latency (query, &live, NULL, NULL);
+  gst_query_unref (query);
+
+  return ! !live;
+}
+
+/* checks whether input chunks are to be encoded in parallel,
+ * and if so, prepares the worker pool for it */
+static gboolean
+gst_audio_encoder_setup_workers (GstAudioEncoder * enc)
+{
+  GstAudioEncoderClass *klass;
+  GstAudioEncoderPrivate *priv;
+  guint threads;
+
+  klass = GST_AUDIO_ENCODER_GET_CLASS (enc);
+  priv = enc->priv;
+
+  if (!klass->encode_frame)
+    return FALSE;
+
+  GST_OBJECT_LOCK (enc);
+  threads = priv->max_threads;
+  GST_OBJECT_UNLOCK (enc);
+
+  if (threads == 0)
+    threads = g_get_num_processors ();
+  if (threads < 2)
+    return FALSE;
+
+  /* in a live pipeline, better not add the latency of in-flight jobs */
+  if (priv->live < 0) {
+    priv->live = gst_audio_encoder_query_live (enc);
+    GST_DEBUG_OBJECT (enc, "upstream live: %d", priv->live);
+  }
+  if (priv->live)
+    return FALSE;
+
+  if (!priv->pool) {
+    GST_DEBUG_OBJECT (enc, "creating pool of %u workers", threads);
+    priv->pool = g_thread_pool_new ((GFunc) gst_audio_encoder_encode_job, enc,
+        threads, FALSE, NULL);
+  } else if (threads != priv->pool_threads) {
+    g_thread_pool_set_max_threads (priv->pool, threads, NULL);
+  }
+  priv->pool_threads = threads;
+
+  return TRUE;
+}
+
  /* adapter tracking idea:
   * - start of adapter corresponds with what has already been encoded
   * (i.e. really returned by encoder subclass)
@@ -1039,6 +1253,7 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
   gint av, need;
   GstBuffer *buf;
   GstFlowReturn ret = GST_FLOW_OK;
+  gboolean parallel, queued;
 
   klass = GST_AUDIO_ENCODER_GET_CLASS (enc);
 
@@ -1047,9 +1262,12 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
   priv = enc->priv;
   ctx = &enc->priv->ctx;
 
+  parallel = gst_audio_encoder_setup_workers (enc);
+
   while (ret == GST_FLOW_OK) {
 
     buf = NULL;
+    queued = FALSE;
     av = gst_adapter_available (priv->adapter);
 
     g_assert (priv->offset <= av);
@@ -1088,16 +1306,33 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
     }
 
     priv->got_data = FALSE;
-    if (G_LIKELY (need)) {
-      const guint8 *data;
-
-      data = gst_adapter_map (priv->adapter, priv->offset + need);
-      buf =
-          gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
-          (gpointer) data, priv->offset + need, priv->offset, need, NULL, NULL);
-    } else if (!priv->drainable) {
-      GST_DEBUG_OBJECT (enc, "non-drainable and no more data");
-      goto finish;
+    if (G_LIKELY (need) && parallel && !(priv->force && priv->hard_min)) {
+      GstMapInfo map;
+
+      /* jobs outlive the adapter's mapping, so they get their own copy */
+      buf = gst_buffer_new_allocate (NULL, need, NULL);
+      gst_buffer_map (buf, &map, GST_MAP_WRITE);
+      gst_adapter_copy (priv->adapter, map.data, priv->offset, need);
+      gst_buffer_unmap (buf, &map);
+      queued = TRUE;
+    } else {
+      /* pending jobs go first, and also need the adapter as-is */
+      ret = gst_audio_encoder_collect_jobs (enc, 0);
+      if (ret != GST_FLOW_OK)
+        break;
+
+      if (G_LIKELY (need)) {
+        const guint8 *data;
+
+        data = gst_adapter_map (priv->adapter, priv->offset + need);
+        buf =
+            gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+            (gpointer) data, priv->offset + need, priv->offset, need, NULL,
+            NULL);
+      } else if (!priv->drainable) {
+        GST_DEBUG_OBJECT (enc, "non-drainable and no more data");
+        goto finish;
+      }
     }
 
     GST_LOG_OBJECT (enc, "providing subclass with %d bytes at offset %d",
@@ -1115,13 +1350,16 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
     if (G_UNLIKELY (priv->force && priv->hard_min && buf)) {
       GST_DEBUG_OBJECT (enc, "bypassing subclass with leftover");
       ret = gst_audio_encoder_finish_frame (enc, NULL, -1);
+    } else if (queued) {
+      ret = gst_audio_encoder_push_job (enc, buf, need / ctx->info.bpf);
     } else {
       ret = klass->handle_frame (enc, buf);
     }
 
     if (G_LIKELY (buf)) {
       gst_buffer_unref (buf);
-      gst_adapter_unmap (priv->adapter);
+      if (!queued)
+        gst_adapter_unmap (priv->adapter);
     }
 
   finish:
@@ -1653,6 +1891,8 @@ gst_audio_encoder_sink_event_default (GstAudioEncoder * enc, GstEvent * event)
             gst_pad_event_default (enc->sinkpad, GST_OBJECT_CAST (enc), event);
       } else {
         GST_AUDIO_ENCODER_STREAM_LOCK (enc);
+        /* keep event after output of data that came before it */
+        gst_audio_encoder_collect_jobs (enc, 0);
         enc->priv->pending_events =
             g_list_append (enc->priv->pending_events, event);
         GST_AUDIO_ENCODER_STREAM_UNLOCK (enc);
@@ -2625,6 +2865,58 @@ gst_audio_encoder_get_drainable (GstAudioEncoder * enc)
   return result;
 }
 
+/**
+ * gst_audio_encoder_set_max_threads:
+ * @enc: a #GstAudioEncoder
+ * @threads: maximum number of worker threads, or 0 for one per processor
+ *
+ * Configures the number of worker threads used to encode input chunks in
+ * parallel.  This is only done if subclass implements
+ * #GstAudioEncoderClass.encode_frame(), i.e. encodes each chunk
+ * independently, and the pipeline is not live.  Encoded chunks are still
+ * finished in input order, so timestamping is not affected.
+ * A value of 1 (the default) disables parallel encoding.
+ *
+ * MT safe.
+ *
+ * Since: 1.12
+ */
+void
+gst_audio_encoder_set_max_threads (GstAudioEncoder * enc, guint threads)
+{
+  g_return_if_fail (GST_IS_AUDIO_ENCODER (enc));
+
+  GST_OBJECT_LOCK (enc);
+  enc->priv->max_threads = threads;
+  GST_OBJECT_UNLOCK (enc);
+}
+
+/**
+ * gst_audio_encoder_get_max_threads:
+ * @enc: a #GstAudioEncoder
+ *
+ * Queries the configured number of worker threads.
+ *
+ * Returns: the maximum number of worker threads, 0 meaning one per processor.
+ *
+ * MT safe.
+ *
+ * Since: 1.12
+ */
+guint
+gst_audio_encoder_get_max_threads (GstAudioEncoder * enc)
+{
+  guint result;
+
+  g_return_val_if_fail (GST_IS_AUDIO_ENCODER (enc), 0);
+
+  GST_OBJECT_LOCK (enc);
+  result = enc->priv->max_threads;
+  GST_OBJECT_UNLOCK (enc);
+
+  return result;
+}
+
 /**
  * gst_audio_encoder_merge_tags:
  * @enc: a #GstAudioEncoder
@@ -189,6 +189,14 @@ struct _GstAudioEncoder {
  *                  return TRUE if the query could be performed. Subclasses
  *                  should chain up to the parent implementation to invoke the
  *                  default handler. Since 1.6
+ * @encode_frame:   Optional.
+ *                  Encodes a chunk of input data into @outbuf without
+ *                  relying on any state kept across chunks, see
+ *                  gst_audio_encoder_set_max_threads().  Might be called
+ *                  concurrently from several worker threads, so it must not
+ *                  call gst_audio_encoder_finish_frame() or other base class
+ *                  API.  Setting @outbuf to NULL marks the samples as
+ *                  dropped. Since 1.12
  *
  * Subclasses can override any of the available virtual methods or not, as
  * needed. At minimum @set_format and @handle_frame needs to be overridden.
@@ -242,9 +250,12 @@ struct _GstAudioEncoderClass {
   gboolean      (*src_query)          (GstAudioEncoder *encoder,
 				       GstQuery *query);
 
+  GstFlowReturn (*encode_frame)       (GstAudioEncoder *enc,
+                                       GstBuffer *buffer,
+                                       GstBuffer **outbuf);
 
   /*< private >*/
-  gpointer       _gst_reserved[GST_PADDING_LARGE-3];
+  gpointer       _gst_reserved[GST_PADDING_LARGE-4];
 };
 
 GType           gst_audio_encoder_get_type         (void);
@@ -330,6 +341,11 @@ void            gst_audio_encoder_set_drainable (GstAudioEncoder * enc,
 
 gboolean        gst_audio_encoder_get_drainable (GstAudioEncoder * enc);
 
+void            gst_audio_encoder_set_max_threads (GstAudioEncoder * enc,
+                                                   guint threads);
+
+guint           gst_audio_encoder_get_max_threads (GstAudioEncoder * enc);
+
 void            gst_audio_encoder_get_allocator (GstAudioEncoder * enc,
                                                  GstAllocator ** allocator,
                                                  GstAllocationParams * params);
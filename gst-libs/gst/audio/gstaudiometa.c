@@ -25,6 +25,9 @@
  * #GstAudioDownmixMeta defines an audio downmix matrix to be send along with
  * audio buffers. These functions in this module help to create and attach the
  * meta as well as extracting it.
+ *
+ * #GstAudioMeta describes where the channel planes of non-interleaved audio
+ * are located inside a buffer.
  */
 
 #include <string.h>
@@ -304,3 +307,170 @@ gst_audio_clipping_meta_get_info (void)
   }
   return audio_clipping_meta_info;
 }
+
+static gboolean
+gst_audio_meta_init (GstMeta * meta, gpointer params, GstBuffer * buffer)
+{
+  GstAudioMeta *ameta = (GstAudioMeta *) meta;
+
+  gst_audio_info_init (&ameta->info);
+  ameta->samples = 0;
+  ameta->offsets = NULL;
+
+  return TRUE;
+}
+
+static void
+gst_audio_meta_free (GstMeta * meta, GstBuffer * buffer)
+{
+  GstAudioMeta *ameta = (GstAudioMeta *) meta;
+
+  if (ameta->offsets && ameta->offsets != ameta->priv_offsets_arr)
+    g_free (ameta->offsets);
+}
+
+static gboolean
+gst_audio_meta_transform (GstBuffer * dest, GstMeta * meta,
+    GstBuffer * buffer, GQuark type, gpointer data)
+{
+  GstAudioMeta *smeta, *dmeta;
+
+  smeta = (GstAudioMeta *) meta;
+
+  if (GST_META_TRANSFORM_IS_COPY (type)) {
+    GstMetaTransformCopy *copy = data;
+
+    /* the offsets are only valid for the complete buffer */
+    if (copy->region)
+      return FALSE;
+
+    dmeta = gst_buffer_add_audio_meta (dest, &smeta->info, smeta->samples,
+        smeta->offsets);
+    if (!dmeta)
+      return FALSE;
+  } else {
+    /* return FALSE, if transform type is not supported */
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * gst_buffer_add_audio_meta:
+ * @buffer: a #GstBuffer
+ * @info: the audio properties of the buffer
+ * @samples: the number of valid samples per channel in the buffer
+ * @offsets: (nullable) (array): the offsets (in bytes) where each channel
+ *   plane starts in the buffer, or %NULL to have the planes follow each
+ *   other without gaps
+ *
+ * Attaches #GstAudioMeta metadata to @buffer with the given parameters.
+ *
+ * @offsets must be %NULL for interleaved layouts. For non-interleaved
+ * layouts, each of the @info.channels planes of @samples samples must fit
+ * in @buffer without overlapping any other plane.
+ *
+ * Returns: (transfer none): the #GstAudioMeta on @buffer, or %NULL if
+ *   the parameters don't match the buffer.
+ *
+ * Since: 1.12
+ */
+GstAudioMeta *
+gst_buffer_add_audio_meta (GstBuffer * buffer, const GstAudioInfo * info,
+    gsize samples, gsize offsets[])
+{
+  GstAudioMeta *meta;
+  gsize plane_size, max_offset = 0;
+  gint i, j, channels;
+
+  g_return_val_if_fail (GST_IS_BUFFER (buffer), NULL);
+  g_return_val_if_fail (info != NULL, NULL);
+  g_return_val_if_fail (GST_AUDIO_INFO_FORMAT (info) !=
+      GST_AUDIO_FORMAT_UNKNOWN, NULL);
+  g_return_val_if_fail (info->layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED
+      || offsets == NULL, NULL);
+
+  meta =
+      (GstAudioMeta *) gst_buffer_add_meta (buffer, GST_AUDIO_META_INFO, NULL);
+
+  meta->info = *info;
+  meta->samples = samples;
+
+  channels = GST_AUDIO_INFO_CHANNELS (info);
+  plane_size = samples * GST_AUDIO_INFO_BPS (info);
+
+  if (info->layout == GST_AUDIO_LAYOUT_INTERLEAVED) {
+    plane_size *= channels;
+  } else {
+    if (G_UNLIKELY (channels > (gint) G_N_ELEMENTS (meta->priv_offsets_arr)))
+      meta->offsets = g_new (gsize, channels);
+    else
+      meta->offsets = meta->priv_offsets_arr;
+
+    for (i = 0; i < channels; i++) {
+      meta->offsets[i] = offsets ? offsets[i] : i * plane_size;
+      max_offset = MAX (max_offset, meta->offsets[i]);
+
+      for (j = 0; j < i; j++) {
+        if (meta->offsets[i] < meta->offsets[j] + plane_size &&
+            meta->offsets[j] < meta->offsets[i] + plane_size)
+          goto overlap;
+      }
+    }
+  }
+
+  if (max_offset + plane_size > gst_buffer_get_size (buffer))
+    goto too_small;
+
+  return meta;
+
+  /* ERRORS */
+overlap:
+  {
+    g_critical ("planes %d and %d of %" G_GSIZE_FORMAT " bytes overlap", j,
+        i, plane_size);
+    gst_buffer_remove_meta (buffer, (GstMeta *) meta);
+    return NULL;
+  }
+too_small:
+  {
+    g_critical ("buffer of %" G_GSIZE_FORMAT " bytes too small for %"
+        G_GSIZE_FORMAT " samples", gst_buffer_get_size (buffer), samples);
+    gst_buffer_remove_meta (buffer, (GstMeta *) meta);
+    return NULL;
+  }
+}
+
+GType
+gst_audio_meta_api_get_type (void)
+{
+  static volatile GType type;
+  static const gchar *tags[] = {
+    GST_META_TAG_AUDIO_STR, GST_META_TAG_AUDIO_CHANNELS_STR,
+    GST_META_TAG_AUDIO_RATE_STR, GST_META_TAG_MEMORY_STR, NULL
+  };
+
+  if (g_once_init_enter (&type)) {
+    GType _type = gst_meta_api_type_register ("GstAudioMetaAPI", tags);
+    g_once_init_leave (&type, _type);
+  }
+  return type;
+}
+
+const GstMetaInfo *
+gst_audio_meta_get_info (void)
+{
+  static const GstMetaInfo *audio_meta_info = NULL;
+
+  if (g_once_init_enter ((GstMetaInfo **) & audio_meta_info)) {
+    const GstMetaInfo *meta =
+        gst_meta_register (GST_AUDIO_META_API_TYPE,
+        "GstAudioMeta", sizeof (GstAudioMeta),
+        gst_audio_meta_init, gst_audio_meta_free,
+        gst_audio_meta_transform);
+    g_once_init_leave ((GstMetaInfo **) & audio_meta_info,
+        (GstMetaInfo *) meta);
+  }
+  return audio_meta_info;
+}
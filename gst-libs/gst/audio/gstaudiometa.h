@@ -116,6 +116,54 @@ GstAudioClippingMeta * gst_buffer_add_audio_clipping_meta (GstBuffer *buffer,
                                                            guint64    start,
                                                            guint64    end);
 
+
+#define GST_AUDIO_META_API_TYPE (gst_audio_meta_api_get_type())
+#define GST_AUDIO_META_INFO  (gst_audio_meta_get_info())
+
+typedef struct _GstAudioMeta GstAudioMeta;
+
+/**
+ * GstAudioMeta:
+ * @meta: parent #GstMeta
+ * @info: the audio properties of the buffer
+ * @samples: the number of valid samples per channel in the buffer
+ * @offsets: the offsets (in bytes) where each channel plane starts in the
+ *   buffer, or %NULL if the buffer has interleaved layout. If not %NULL,
+ *   this is an array of @info.channels elements.
+ *
+ * Extra buffer metadata describing how audio data is laid out inside the
+ * buffer. This is mostly useful for non-interleaved (planar) buffers, where
+ * it allows the channel planes to start at arbitrary offsets, e.g. because
+ * of padding, or because the samples of a channel were clipped without
+ * moving the other planes around.
+ *
+ * Non-interleaved buffers without this meta are expected to hold @samples
+ * samples of each channel right after each other.
+ *
+ * Since: 1.12
+ */
+struct _GstAudioMeta {
+  GstMeta      meta;
+
+  GstAudioInfo info;
+  gsize        samples;
+  gsize       *offsets;
+
+  /*< private >*/
+  gsize        priv_offsets_arr[8];
+  gpointer     _gst_reserved[GST_PADDING];
+};
+
+GType gst_audio_meta_api_get_type (void);
+const GstMetaInfo * gst_audio_meta_get_info (void);
+
+#define gst_buffer_get_audio_meta(b) ((GstAudioMeta*)gst_buffer_get_meta((b), GST_AUDIO_META_API_TYPE))
+
+GstAudioMeta * gst_buffer_add_audio_meta (GstBuffer          *buffer,
+                                          const GstAudioInfo *info,
+                                          gsize               samples,
+                                          gsize               offsets[]);
+
 G_END_DECLS
 
 #endif /* __GST_AUDIO_META_H__ */
@@ -188,6 +188,11 @@ void audio_orc_int_dither (gint32 * ORC_RESTRICT d1,
     const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2, int p1,
     int n);
 void audio_orc_update_rand (guint32 * ORC_RESTRICT d1, int n);
+void audio_orc_dither_rpdf (gint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n);
+void audio_orc_dither_tpdf (gint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int p1,
+    int p2, int n);
 void audio_orc_s32_to_double (gdouble * ORC_RESTRICT d1,
     const gint32 * ORC_RESTRICT s1, int n);
 void audio_orc_double_to_s32 (gint32 * ORC_RESTRICT d1,
@@ -6169,6 +6174,300 @@ audio_orc_update_rand (guint32 * ORC_RESTRICT d1, int n)
 #endif
 
 
+/* audio_orc_dither_rpdf */
+#ifdef DISABLE_ORC
+void
+audio_orc_dither_rpdf (gint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+  /* 1: loadpl */
+  var34.i = p1;
+  /* 3: loadpl */
+  var35.i = p2;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 2: shrul */
+    var37.i = ((orc_uint32) var33.i) >> var34.i;
+    /* 4: addl */
+    var36.i = ((orc_uint32) var37.i) + ((orc_uint32) var35.i);
+    /* 5: storel */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_audio_orc_dither_rpdf (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+  /* 1: loadpl */
+  var34.i = ex->params[24];
+  /* 3: loadpl */
+  var35.i = ex->params[25];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 2: shrul */
+    var37.i = ((orc_uint32) var33.i) >> var34.i;
+    /* 4: addl */
+    var36.i = ((orc_uint32) var37.i) + ((orc_uint32) var35.i);
+    /* 5: storel */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+audio_orc_dither_rpdf (gint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 21, 97, 117, 100, 105, 111, 95, 111, 114, 99, 95, 100, 105, 116,
+        104, 101, 114, 95, 114, 112, 100, 102, 11, 4, 4, 12, 4, 4, 16, 4,
+        16, 4, 20, 4, 126, 32, 4, 24, 103, 0, 32, 25, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_audio_orc_dither_rpdf);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "audio_orc_dither_rpdf");
+      orc_program_set_backup_function (p, _backup_audio_orc_dither_rpdf);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_P2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* audio_orc_dither_tpdf */
+#ifdef DISABLE_ORC
+void
+audio_orc_dither_tpdf (gint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int p1,
+    int p2, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union32 *) s2;
+
+  /* 1: loadpl */
+  var35.i = p1;
+  /* 6: loadpl */
+  var37.i = p2;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr4[i];
+    /* 2: shrul */
+    var39.i = ((orc_uint32) var34.i) >> var35.i;
+    /* 3: loadl */
+    var36 = ptr5[i];
+    /* 4: shrul */
+    var40.i = ((orc_uint32) var36.i) >> var35.i;
+    /* 5: addl */
+    var41.i = ((orc_uint32) var39.i) + ((orc_uint32) var40.i);
+    /* 7: addl */
+    var38.i = ((orc_uint32) var41.i) + ((orc_uint32) var37.i);
+    /* 8: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_audio_orc_dither_tpdf (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+
+  /* 1: loadpl */
+  var35.i = ex->params[24];
+  /* 6: loadpl */
+  var37.i = ex->params[25];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr4[i];
+    /* 2: shrul */
+    var39.i = ((orc_uint32) var34.i) >> var35.i;
+    /* 3: loadl */
+    var36 = ptr5[i];
+    /* 4: shrul */
+    var40.i = ((orc_uint32) var36.i) >> var35.i;
+    /* 5: addl */
+    var41.i = ((orc_uint32) var39.i) + ((orc_uint32) var40.i);
+    /* 7: addl */
+    var38.i = ((orc_uint32) var41.i) + ((orc_uint32) var37.i);
+    /* 8: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+audio_orc_dither_tpdf (gint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int p1,
+    int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 21, 97, 117, 100, 105, 111, 95, 111, 114, 99, 95, 100, 105, 116,
+        104, 101, 114, 95, 116, 112, 100, 102, 11, 4, 4, 12, 4, 4, 12, 4,
+        4, 16, 4, 16, 4, 20, 4, 20, 4, 126, 32, 4, 24, 126, 33, 5,
+        24, 103, 32, 32, 33, 103, 0, 32, 25, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_audio_orc_dither_tpdf);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "audio_orc_dither_tpdf");
+      orc_program_set_backup_function (p, _backup_audio_orc_dither_tpdf);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_P2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
 /* audio_orc_s32_to_double */
 #ifdef DISABLE_ORC
 void
@@ -42,6 +42,34 @@
 GST_DEBUG_CATEGORY_STATIC (gst_audio_ring_buffer_debug);
 #define GST_CAT_DEFAULT gst_audio_ring_buffer_debug
 
+#define GST_AUDIO_RING_BUFFER_GET_PRIVATE(obj)  \
+    (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_RING_BUFFER, \
+        GstAudioRingBufferPrivate))
+
+/* number of buckets in the fill level histogram */
+#define FILL_BUCKETS 8
+
+struct _GstAudioRingBufferPrivate
+{
+  /* ATOMIC */
+  gint lock_free;
+
+  /* ATOMIC, statistics of the waits for a free segment, only updated by the
+   * thread that commits or reads samples. Times are in microseconds */
+  gint waits;
+  gint spin_waits;
+  gsize wait_time;
+  gsize max_wait_time;
+
+  /* ATOMIC, segments dropped or padded with silence because the application
+   * could not keep up with the device */
+  gint xruns;
+  /* ATOMIC, segments queued at the last commit or read and a histogram of
+   * them */
+  gint fill;
+  gint fill_hist[FILL_BUCKETS];
+};
+
 static void gst_audio_ring_buffer_dispose (GObject * object);
 static void gst_audio_ring_buffer_finalize (GObject * object);
 
@@ -63,6 +91,8 @@ gst_audio_ring_buffer_class_init (GstAudioRingBufferClass * klass)
   gobject_class = (GObjectClass *) klass;
   gstaudioringbuffer_class = (GstAudioRingBufferClass *) klass;
 
+  g_type_class_add_private (klass, sizeof (GstAudioRingBufferPrivate));
+
   GST_DEBUG_CATEGORY_INIT (gst_audio_ring_buffer_debug, "ringbuffer", 0,
       "ringbuffer class");
 
@@ -76,6 +106,8 @@ gst_audio_ring_buffer_class_init (GstAudioRingBufferClass * klass)
 static void
 gst_audio_ring_buffer_init (GstAudioRingBuffer * ringbuffer)
 {
+  ringbuffer->priv = GST_AUDIO_RING_BUFFER_GET_PRIVATE (ringbuffer);
+
   ringbuffer->open = FALSE;
   ringbuffer->acquired = FALSE;
   ringbuffer->state = GST_AUDIO_RING_BUFFER_STATE_STOPPED;
@@ -1326,11 +1358,109 @@ gst_audio_ring_buffer_clear_all (GstAudioRingBuffer * buf)
 }
 
 
+static void
+update_wait_stats (GstAudioRingBuffer * buf, gint64 start, gboolean spun)
+{
+  GstAudioRingBufferPrivate *priv = buf->priv;
+  gsize elapsed;
+
+  elapsed = g_get_monotonic_time () - start;
+
+  /* we are the only writer, the atomics only make the values safe to read
+   * from other threads */
+  g_atomic_int_inc (&priv->waits);
+  if (spun)
+    g_atomic_int_inc (&priv->spin_waits);
+  g_atomic_pointer_add (&priv->wait_time, elapsed);
+  if (elapsed > (gsize) g_atomic_pointer_get (&priv->max_wait_time))
+    g_atomic_pointer_set (&priv->max_wait_time, elapsed);
+
+  GST_LOG_OBJECT (buf, "waited %" G_GSIZE_FORMAT "us for a segment, spun %d",
+      elapsed, spun);
+}
+
+/* account a segment that is about to be written or read with @fill segments
+ * queued between the application and the device, or a dropped segment */
+static void
+update_fill_stats (GstAudioRingBuffer * buf, gint fill, gboolean xrun)
+{
+  GstAudioRingBufferPrivate *priv = buf->priv;
+  gint segtotal = buf->spec.segtotal;
+  gint bucket;
+
+  fill = CLAMP (fill, 0, segtotal);
+  bucket = MIN (fill * FILL_BUCKETS / MAX (segtotal, 1), FILL_BUCKETS - 1);
+
+  if (G_UNLIKELY (xrun))
+    g_atomic_int_inc (&priv->xruns);
+  g_atomic_int_set (&priv->fill, fill);
+  g_atomic_int_inc (&priv->fill_hist[bucket]);
+}
+
+/* wait for the device to complete a segment without taking the lock. We never
+ * set the waiting flag, so the device thread does not take the lock in
+ * gst_audio_ring_buffer_advance() either.
+ *
+ * The ringbuffer is full, so the device frees a segment within one segment
+ * time. We spin until then and only sleep between polls after that, when
+ * the device is stalled. */
+static gboolean
+poll_segment (GstAudioRingBuffer * buf, gint segments, gint64 start)
+{
+  gint64 segtime, deadline;
+  gint bpf, rate;
+  gboolean spun = TRUE;
+
+  bpf = GST_AUDIO_INFO_BPF (&buf->spec.info);
+  rate = GST_AUDIO_INFO_RATE (&buf->spec.info);
+  if (G_LIKELY (bpf > 0 && rate > 0))
+    segtime = gst_util_uint64_scale_int (buf->spec.segsize / bpf,
+        G_USEC_PER_SEC, rate);
+  else
+    segtime = buf->spec.latency_time;
+  segtime = MAX (segtime, 100);
+  deadline = start + segtime;
+
+  while (g_atomic_int_get (&buf->segdone) == segments) {
+    if (G_UNLIKELY (g_atomic_int_get (&buf->flushing)))
+      goto flushing;
+    if (G_UNLIKELY (g_atomic_int_get (&buf->state) !=
+            GST_AUDIO_RING_BUFFER_STATE_STARTED))
+      goto not_started;
+
+    if (spun && g_get_monotonic_time () < deadline) {
+      g_thread_yield ();
+    } else {
+      spun = FALSE;
+      g_usleep (segtime / 4);
+    }
+  }
+  update_wait_stats (buf, start, spun);
+
+  return TRUE;
+
+  /* ERRORS */
+not_started:
+  {
+    GST_DEBUG_OBJECT (buf, "stopped processing");
+    return FALSE;
+  }
+flushing:
+  {
+    GST_DEBUG_OBJECT (buf, "flushing");
+    return FALSE;
+  }
+}
+
 static gboolean
 wait_segment (GstAudioRingBuffer * buf)
 {
   gint segments;
   gboolean wait = TRUE;
+  gint64 start;
+
+  start = g_get_monotonic_time ();
+  segments = g_atomic_int_get (&buf->segdone);
 
   /* buffer must be started now or we deadlock since nobody is reading */
   if (G_UNLIKELY (g_atomic_int_get (&buf->state) !=
@@ -1340,7 +1470,6 @@ wait_segment (GstAudioRingBuffer * buf)
       goto no_start;
 
     GST_DEBUG_OBJECT (buf, "start!");
-    segments = g_atomic_int_get (&buf->segdone);
     gst_audio_ring_buffer_start (buf);
 
     /* After starting, the writer may have wrote segments already and then we
@@ -1349,6 +1478,11 @@ wait_segment (GstAudioRingBuffer * buf)
       wait = FALSE;
   }
 
+  /* in lock-free mode we poll for a free segment instead of blocking on
+   * the cond */
+  if (wait && g_atomic_int_get (&buf->priv->lock_free))
+    return poll_segment (buf, segments, start);
+
   /* take lock first, then update our waiting flag */
   GST_OBJECT_LOCK (buf);
   if (G_UNLIKELY (buf->flushing))
@@ -1373,6 +1507,9 @@ wait_segment (GstAudioRingBuffer * buf)
   }
   GST_OBJECT_UNLOCK (buf);
 
+  if (wait)
+    update_wait_stats (buf, start, FALSE);
+
   return TRUE;
 
   /* ERROR */
@@ -1576,6 +1713,7 @@ default_commit (GstAudioRingBuffer * buf, guint64 * sample,
       /* segment too far ahead, writer too slow, we need to drop, hopefully UNLIKELY */
       if (G_UNLIKELY (diff < 0)) {
         /* we need to drop one segment at a time, pretend we wrote a segment. */
+        update_fill_stats (buf, 0, TRUE);
         skip = TRUE;
         break;
       }
@@ -1583,6 +1721,7 @@ default_commit (GstAudioRingBuffer * buf, guint64 * sample,
       /* write segment is within writable range, we can break the loop and
        * start writing the data. */
       if (diff < segtotal) {
+        update_fill_stats (buf, diff, FALSE);
         skip = FALSE;
         break;
       }
@@ -1793,6 +1932,7 @@ gst_audio_ring_buffer_read (GstAudioRingBuffer * buf, guint64 sample,
       /* segment too far ahead, reader too slow */
       if (G_UNLIKELY (diff >= segtotal)) {
         /* pretend we read an empty segment. */
+        update_fill_stats (buf, segtotal, TRUE);
         sampleslen = MIN (sps, to_read);
         memcpy (data, buf->empty_seg, sampleslen * bpf);
         goto next;
@@ -1800,8 +1940,10 @@ gst_audio_ring_buffer_read (GstAudioRingBuffer * buf, guint64 sample,
 
       /* read segment is within readable range, we can break the loop and
        * start reading the data. */
-      if (diff > 0)
+      if (diff > 0) {
+        update_fill_stats (buf, diff, FALSE);
         break;
+      }
 
       /* else we need to wait for the segment to become readable. */
       if (!wait_segment (buf))
@@ -1991,6 +2133,130 @@ gst_audio_ring_buffer_may_start (GstAudioRingBuffer * buf, gboolean allowed)
   g_atomic_int_set (&buf->may_start, allowed);
 }
 
+/**
+ * gst_audio_ring_buffer_set_lock_free:
+ * @buf: the #GstAudioRingBuffer
+ * @lock_free: the new value
+ *
+ * Make gst_audio_ring_buffer_commit() and gst_audio_ring_buffer_read()
+ * poll the progress of the device when the ringbuffer is full, instead of
+ * blocking on the ringbuffer lock. A waiter spins for at most one segment
+ * time, the time in which the device normally frees a segment, and then
+ * sleeps between polls until the device makes progress again.
+ *
+ * The application and the device thread then only synchronize with atomic
+ * operations and gst_audio_ring_buffer_advance() never takes the lock. This
+ * avoids the wakeup latency and the lock contention of the device thread with
+ * small segments, at the cost of a busy waiting application thread.
+ *
+ * MT safe.
+ *
+ * Since: 1.12
+ */
+void
+gst_audio_ring_buffer_set_lock_free (GstAudioRingBuffer * buf,
+    gboolean lock_free)
+{
+  g_return_if_fail (GST_IS_AUDIO_RING_BUFFER (buf));
+
+  GST_DEBUG_OBJECT (buf, "lock free: %d", lock_free);
+  g_atomic_int_set (&buf->priv->lock_free, lock_free);
+}
+
+/**
+ * gst_audio_ring_buffer_get_lock_free:
+ * @buf: the #GstAudioRingBuffer
+ *
+ * Check if @buf polls for free segments, see
+ * gst_audio_ring_buffer_set_lock_free().
+ *
+ * MT safe.
+ *
+ * Returns: %TRUE when @buf polls for free segments before blocking.
+ *
+ * Since: 1.12
+ */
+gboolean
+gst_audio_ring_buffer_get_lock_free (GstAudioRingBuffer * buf)
+{
+  g_return_val_if_fail (GST_IS_AUDIO_RING_BUFFER (buf), FALSE);
+
+  return g_atomic_int_get (&buf->priv->lock_free);
+}
+
+/**
+ * gst_audio_ring_buffer_get_stats:
+ * @buf: the #GstAudioRingBuffer
+ *
+ * Get statistics about the times gst_audio_ring_buffer_commit() and
+ * gst_audio_ring_buffer_read() had to wait for the device to process a
+ * segment.
+ *
+ * The structure contains the following fields:
+ *
+ * - "waits" (#guint64): the number of waits for a segment
+ * - "spin-waits" (#guint64): the number of waits that completed while
+ *   spinning, without sleeping or blocking
+ * - "wait-time" (#guint64): the total time spent waiting in nanoseconds
+ * - "max-wait-time" (#guint64): the longest wait in nanoseconds
+ * - "xruns" (#guint64): the number of segments that were dropped on playback
+ *   or replaced by silence on capture because the application did not keep
+ *   up with the device
+ * - "fill" (#gint): the number of segments that were queued between the
+ *   application and the device at the last commit or read
+ * - "fill-level" (#GstValueArray of #guint64): a histogram of the number of
+ *   queued segments, sampled for every segment that is committed or read.
+ *   Bucket i counts the segments seen while between i/n and (i+1)/n of the
+ *   ringbuffer was filled.
+ *
+ * MT safe.
+ *
+ * Returns: (transfer full): a #GstStructure with the statistics. Free
+ *   with gst_structure_free().
+ *
+ * Since: 1.12
+ */
+GstStructure *
+gst_audio_ring_buffer_get_stats (GstAudioRingBuffer * buf)
+{
+  GstAudioRingBufferPrivate *priv;
+  GstStructure *s;
+  GValue hist = G_VALUE_INIT;
+  GValue v = G_VALUE_INIT;
+  gint i;
+
+  g_return_val_if_fail (GST_IS_AUDIO_RING_BUFFER (buf), NULL);
+
+  priv = buf->priv;
+
+  g_value_init (&hist, GST_TYPE_ARRAY);
+  g_value_init (&v, G_TYPE_UINT64);
+
+  s = gst_structure_new ("GstAudioRingBufferStats",
+      "waits", G_TYPE_UINT64,
+      (guint64) (guint) g_atomic_int_get (&priv->waits),
+      "spin-waits", G_TYPE_UINT64,
+      (guint64) (guint) g_atomic_int_get (&priv->spin_waits),
+      "wait-time", G_TYPE_UINT64,
+      (guint64) (gsize) g_atomic_pointer_get (&priv->wait_time) * GST_USECOND,
+      "max-wait-time", G_TYPE_UINT64,
+      (guint64) (gsize) g_atomic_pointer_get (&priv->max_wait_time) *
+      GST_USECOND, NULL);
+
+  gst_structure_set (s,
+      "xruns", G_TYPE_UINT64, (guint64) (guint) g_atomic_int_get (&priv->xruns),
+      "fill", G_TYPE_INT, g_atomic_int_get (&priv->fill), NULL);
+  for (i = 0; i < FILL_BUCKETS; i++) {
+    g_value_set_uint64 (&v, (guint) g_atomic_int_get (&priv->fill_hist[i]));
+    gst_value_array_append_value (&hist, &v);
+  }
+
+  gst_structure_take_value (s, "fill-level", &hist);
+  g_value_unset (&v);
+
+  return s;
+}
+
 /* GST_AUDIO_CHANNEL_POSITION_NONE is used for position-less
  * mutually exclusive channels. In this case we should not attempt
  * to do any reordering.
@@ -40,6 +40,7 @@ G_BEGIN_DECLS
 typedef struct _GstAudioRingBuffer GstAudioRingBuffer;
 typedef struct _GstAudioRingBufferClass GstAudioRingBufferClass;
 typedef struct _GstAudioRingBufferSpec GstAudioRingBufferSpec;
+typedef struct _GstAudioRingBufferPrivate GstAudioRingBufferPrivate;
 
 /**
  * GstAudioRingBufferCallback:
@@ -214,7 +215,9 @@ struct _GstAudioRingBuffer {
   GDestroyNotify              cb_data_notify;
 
   /*< private >*/
-  gpointer _gst_reserved[GST_PADDING - 1];
+  GstAudioRingBufferPrivate  *priv;
+
+  gpointer _gst_reserved[GST_PADDING - 2];
 };
 
 /**
@@ -345,6 +348,12 @@ void            gst_audio_ring_buffer_advance         (GstAudioRingBuffer *buf,
 
 void            gst_audio_ring_buffer_may_start       (GstAudioRingBuffer *buf, gboolean allowed);
 
+/* waiting for segments */
+void            gst_audio_ring_buffer_set_lock_free   (GstAudioRingBuffer *buf, gboolean lock_free);
+gboolean        gst_audio_ring_buffer_get_lock_free   (GstAudioRingBuffer *buf);
+
+GstStructure *  gst_audio_ring_buffer_get_stats       (GstAudioRingBuffer *buf);
+
 #ifdef G_DEFINE_AUTOPTR_CLEANUP_FUNC
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GstAudioRingBuffer, gst_object_unref)
 #endif
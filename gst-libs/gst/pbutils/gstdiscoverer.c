@@ -37,6 +37,8 @@
  * asks for the discovery to begin (through gst_discoverer_start()).
  * By default this will use the GLib default main context unless you have
  * set a custom context using g_main_context_push_thread_default().
+ * Several URIs can be discovered in parallel in this mode by setting the
+ * #GstDiscoverer:max-concurrency property.
  *
  * All the information is returned in a #GstDiscovererInfo structure.
  */
@@ -49,6 +51,7 @@
 #include <gst/audio/audio.h>
 
 #include <string.h>
+#include <glib/gstdio.h>
 
 #include "pbutils.h"
 #include "pbutils-private.h"
@@ -98,6 +101,14 @@ struct _GstDiscovererPrivate
   /* TRUE if ASYNC_DONE has been received (need to check for subtitle tags) */
   gboolean async_done;
 
+  /* TRUE to look up and store results in the discovery cache */
+  gboolean use_cache;
+  /* TRUE if current_info comes from the cache */
+  gboolean current_cached;
+
+  /* TRUE to keep the plugged elements around for the next URI */
+  gboolean reuse_elements;
+
   /* current items */
   GstDiscovererInfo *current_info;
   GError *current_error;
@@ -130,8 +141,25 @@ struct _GstDiscovererPrivate
   gulong source_chg_id;
   gulong element_added_id;
   gulong bus_cb_id;
+
+  /* concurrent discovery */
+  guint max_concurrency;
+  gboolean ordered;
+  /* TRUE if the pending URIs are handed to the helpers */
+  gboolean concurrent;
+  GPtrArray *helpers;
+  /* DiscovererJob, in the order the URIs were handed out */
+  GQueue jobs;
 };
 
+typedef struct
+{
+  /* helper discovering the URI, NULL once done */
+  GstDiscoverer *helper;
+  GstDiscovererInfo *info;
+  GError *error;
+} DiscovererJob;
+
 #define DISCO_LOCK(dc) g_mutex_lock (&dc->priv->lock);
 #define DISCO_UNLOCK(dc) g_mutex_unlock (&dc->priv->lock);
 
@@ -163,11 +191,19 @@ enum
 };
 
 #define DEFAULT_PROP_TIMEOUT 15 * GST_SECOND
+#define DEFAULT_PROP_MAX_CONCURRENCY 1
+#define DEFAULT_PROP_ORDERED TRUE
+#define DEFAULT_PROP_USE_CACHE FALSE
+#define DEFAULT_PROP_REUSE_ELEMENTS FALSE
 
 enum
 {
   PROP_0,
-  PROP_TIMEOUT
+  PROP_TIMEOUT,
+  PROP_MAX_CONCURRENCY,
+  PROP_ORDERED,
+  PROP_USE_CACHE,
+  PROP_REUSE_ELEMENTS
 };
 
 static guint gst_discoverer_signals[LAST_SIGNAL] = { 0 };
@@ -175,6 +211,7 @@ static guint gst_discoverer_signals[LAST_SIGNAL] = { 0 };
 static void gst_discoverer_set_timeout (GstDiscoverer * dc,
     GstClockTime timeout);
 static gboolean async_timeout_cb (GstDiscoverer * dc);
+static void discoverer_cleanup (GstDiscoverer * dc);
 
 static void discoverer_bus_cb (GstBus * bus, GstMessage * msg,
     GstDiscoverer * dc);
@@ -220,6 +257,73 @@ gst_discoverer_class_init (GstDiscovererClass * klass)
           GST_SECOND, 3600 * GST_SECOND, DEFAULT_PROP_TIMEOUT,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstDiscoverer:max-concurrency:
+   *
+   * The maximum number of URIs that are discovered at the same time in
+   * asynchronous mode, each of them with its own pipeline. This is useful
+   * when discovering many URIs, as most of the time is spent waiting for
+   * I/O and state changes.
+   *
+   * Changes take effect on the next call to gst_discoverer_start().
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_CONCURRENCY,
+      g_param_spec_uint ("max-concurrency", "Max concurrency",
+          "Maximum number of URIs discovered in parallel in asynchronous mode",
+          1, 64, DEFAULT_PROP_MAX_CONCURRENCY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDiscoverer:ordered:
+   *
+   * If %TRUE, #GstDiscoverer::discovered is emitted in the order the URIs
+   * were added, even when a later URI finished first. Otherwise results
+   * are emitted as soon as they are available. This only makes a
+   * difference if #GstDiscoverer:max-concurrency is bigger than 1.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_ORDERED,
+      g_param_spec_boolean ("ordered", "Ordered",
+          "Emit results in the order the URIs were added",
+          DEFAULT_PROP_ORDERED, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDiscoverer:use-cache:
+   *
+   * Whether to cache the results of successful discoveries of local files
+   * in the user cache directory. A cached result is returned right away
+   * as long as the modification time and size of the file did not change.
+   * The cache is limited in size, the least recently used results are
+   * removed from it first.
+   *
+   * Note that tables of contents are not stored in the cache.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_USE_CACHE,
+      g_param_spec_boolean ("use-cache", "Use cache",
+          "Use the discovery cache for local files",
+          DEFAULT_PROP_USE_CACHE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDiscoverer:reuse-elements:
+   *
+   * Whether to keep the demuxers, parsers and decoders that were plugged for
+   * a URI around, and re-use them for the following URIs instead of
+   * creating new ones. This speeds up discovering many files of the same
+   * type.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_REUSE_ELEMENTS,
+      g_param_spec_boolean ("reuse-elements", "Reuse elements",
+          "Re-use the plugged elements across URIs",
+          DEFAULT_PROP_REUSE_ELEMENTS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /* signals */
   /**
    * GstDiscoverer::finished:
@@ -292,7 +396,14 @@ uridecodebin_element_added_cb (GstElement * uridecodebin,
       GST_ELEMENT_NAME (child));
 
   if (G_OBJECT_TYPE (child) == dc->priv->decodebin_type) {
-    g_object_set (child, "post-stream-topology", TRUE, NULL);
+    gboolean reuse_elements;
+
+    DISCO_LOCK (dc);
+    reuse_elements = dc->priv->reuse_elements;
+    DISCO_UNLOCK (dc);
+
+    g_object_set (child, "post-stream-topology", TRUE,
+        "reuse-elements", reuse_elements, NULL);
   }
 }
 
@@ -308,6 +419,11 @@ gst_discoverer_init (GstDiscoverer * dc)
   dc->priv->timeout = DEFAULT_PROP_TIMEOUT;
   dc->priv->async = FALSE;
   dc->priv->async_done = FALSE;
+  dc->priv->max_concurrency = DEFAULT_PROP_MAX_CONCURRENCY;
+  dc->priv->ordered = DEFAULT_PROP_ORDERED;
+  dc->priv->use_cache = DEFAULT_PROP_USE_CACHE;
+  dc->priv->reuse_elements = DEFAULT_PROP_REUSE_ELEMENTS;
+  g_queue_init (&dc->priv->jobs);
 
   g_mutex_init (&dc->priv->lock);
 
@@ -408,6 +524,11 @@ gst_discoverer_dispose (GObject * obj)
 
   gst_discoverer_stop (dc);
 
+  if (dc->priv->helpers) {
+    g_ptr_array_unref (dc->priv->helpers);
+    dc->priv->helpers = NULL;
+  }
+
   if (dc->priv->seeking_query) {
     gst_query_unref (dc->priv->seeking_query);
     dc->priv->seeking_query = NULL;
@@ -436,6 +557,26 @@ gst_discoverer_set_property (GObject * object, guint prop_id,
     case PROP_TIMEOUT:
       gst_discoverer_set_timeout (dc, g_value_get_uint64 (value));
       break;
+    case PROP_MAX_CONCURRENCY:
+      DISCO_LOCK (dc);
+      dc->priv->max_concurrency = g_value_get_uint (value);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_ORDERED:
+      DISCO_LOCK (dc);
+      dc->priv->ordered = g_value_get_boolean (value);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_USE_CACHE:
+      DISCO_LOCK (dc);
+      dc->priv->use_cache = g_value_get_boolean (value);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_REUSE_ELEMENTS:
+      DISCO_LOCK (dc);
+      dc->priv->reuse_elements = g_value_get_boolean (value);
+      DISCO_UNLOCK (dc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -454,6 +595,26 @@ gst_discoverer_get_property (GObject * object, guint prop_id,
       g_value_set_uint64 (value, dc->priv->timeout);
       DISCO_UNLOCK (dc);
       break;
+    case PROP_MAX_CONCURRENCY:
+      DISCO_LOCK (dc);
+      g_value_set_uint (value, dc->priv->max_concurrency);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_ORDERED:
+      DISCO_LOCK (dc);
+      g_value_set_boolean (value, dc->priv->ordered);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_USE_CACHE:
+      DISCO_LOCK (dc);
+      g_value_set_boolean (value, dc->priv->use_cache);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_REUSE_ELEMENTS:
+      DISCO_LOCK (dc);
+      g_value_set_boolean (value, dc->priv->reuse_elements);
+      DISCO_UNLOCK (dc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1257,6 +1418,227 @@ parse_stream_topology (GstDiscoverer * dc, const GstStructure * topology,
   return res;
 }
 
+/* Discovery cache
+ *
+ * Results for local files are stored in the user cache directory, one
+ * serialized #GstDiscovererInfo per file that is memory-mapped when read
+ * back. The name of the cache file is a hash of the URI together with the
+ * modification time (in nanoseconds where the platform has them) and size
+ * of the file, so that changed files are discovered again. The hash also
+ * covers the cache format version and the library version, so results
+ * serialized by another version are never mistaken for ours.
+ *
+ * Cache files that can't be parsed are removed. Every use of a cache file
+ * refreshes its modification time, and when the cache grows beyond
+ * DISCOVERER_CACHE_MAX_SIZE the least recently used files are removed. */
+
+/* bump when the content of the cache files changes */
+#define DISCOVERER_CACHE_VERSION 1
+
+/* the number of bytes the cache files may take up together */
+#define DISCOVERER_CACHE_MAX_SIZE (8 * 1024 * 1024)
+
+typedef struct
+{
+  gchar *path;
+  gint64 mtime;
+  gint64 size;
+} DiscovererCacheFile;
+
+/* the modification time of @st in nanoseconds */
+static gint64
+discoverer_get_mtime (GStatBuf * st)
+{
+  gint64 mtime = (gint64) st->st_mtime * GST_SECOND;
+
+#if defined (HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC)
+  mtime += st->st_mtim.tv_nsec;
+#elif defined (HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC)
+  mtime += st->st_mtimespec.tv_nsec;
+#endif
+
+  return mtime;
+}
+
+static gchar *
+discoverer_get_cache_file (const gchar * uri)
+{
+  gchar *filename, *key, *checksum, *basename, *cachefile;
+  GStatBuf st;
+
+  /* only local files can be checked for changes cheaply */
+  filename = g_filename_from_uri (uri, NULL, NULL);
+  if (filename == NULL)
+    return NULL;
+
+  if (g_stat (filename, &st) != 0) {
+    g_free (filename);
+    return NULL;
+  }
+  g_free (filename);
+
+  key = g_strdup_printf ("%d %s %s %" G_GINT64_FORMAT " %" G_GINT64_FORMAT,
+      DISCOVERER_CACHE_VERSION, PACKAGE_VERSION, uri,
+      discoverer_get_mtime (&st), (gint64) st.st_size);
+  checksum = g_compute_checksum_for_string (G_CHECKSUM_SHA1, key, -1);
+  basename = g_strconcat (checksum, ".gstdiscoverer", NULL);
+
+  cachefile = g_build_filename (g_get_user_cache_dir (),
+      "gstreamer-" GST_API_VERSION, "discoverer", basename, NULL);
+
+  g_free (basename);
+  g_free (checksum);
+  g_free (key);
+
+  return cachefile;
+}
+
+static GstDiscovererInfo *
+discoverer_load_cached_info (const gchar * uri)
+{
+  GstDiscovererInfo *info = NULL;
+  GMappedFile *mapped;
+  GVariant *variant, *inner;
+  GBytes *bytes;
+  gchar *cachefile;
+
+  cachefile = discoverer_get_cache_file (uri);
+  if (cachefile == NULL)
+    return NULL;
+
+  mapped = g_mapped_file_new (cachefile, FALSE, NULL);
+  if (mapped == NULL) {
+    g_free (cachefile);
+    return NULL;
+  }
+
+  bytes = g_mapped_file_get_bytes (mapped);
+  variant = g_variant_ref_sink (g_variant_new_from_bytes
+      (G_VARIANT_TYPE_VARIANT, bytes, FALSE));
+
+  /* the file might be truncated or not written by us, so only parse it
+   * when it has the layout gst_discoverer_info_to_variant() produces */
+  if (g_variant_is_normal_form (variant)) {
+    inner = g_variant_get_variant (variant);
+    if (g_variant_is_of_type (inner, G_VARIANT_TYPE ("(vv)")))
+      info = gst_discoverer_info_from_variant (variant);
+    g_variant_unref (inner);
+  }
+  g_variant_unref (variant);
+  g_bytes_unref (bytes);
+  g_mapped_file_unref (mapped);
+
+  /* make sure this really is the result for our URI */
+  if (info && g_strcmp0 (info->uri, uri) != 0) {
+    gst_discoverer_info_unref (info);
+    info = NULL;
+  }
+
+  if (info) {
+    /* mark as recently used so pruning the cache keeps it */
+    g_utime (cachefile, NULL);
+  } else {
+    GST_WARNING ("Removing invalid cache file %s", cachefile);
+    g_unlink (cachefile);
+  }
+  g_free (cachefile);
+
+  return info;
+}
+
+static gint
+compare_cache_file_mtime (gconstpointer a, gconstpointer b)
+{
+  const DiscovererCacheFile *fa = a, *fb = b;
+
+  if (fa->mtime < fb->mtime)
+    return -1;
+  if (fa->mtime > fb->mtime)
+    return 1;
+  return 0;
+}
+
+/* removes the least recently used cache files in @dirname until the rest
+ * fits in DISCOVERER_CACHE_MAX_SIZE */
+static void
+discoverer_prune_cache (const gchar * dirname)
+{
+  DiscovererCacheFile file;
+  GArray *files;
+  const gchar *name;
+  gint64 total = 0;
+  GStatBuf st;
+  GDir *dir;
+  guint i;
+
+  dir = g_dir_open (dirname, 0, NULL);
+  if (dir == NULL)
+    return;
+
+  files = g_array_new (FALSE, FALSE, sizeof (DiscovererCacheFile));
+  while ((name = g_dir_read_name (dir))) {
+    if (!g_str_has_suffix (name, ".gstdiscoverer"))
+      continue;
+
+    file.path = g_build_filename (dirname, name, NULL);
+    if (g_stat (file.path, &st) != 0) {
+      g_free (file.path);
+      continue;
+    }
+    file.mtime = discoverer_get_mtime (&st);
+    file.size = st.st_size;
+    total += file.size;
+    g_array_append_val (files, file);
+  }
+  g_dir_close (dir);
+
+  if (total > DISCOVERER_CACHE_MAX_SIZE) {
+    g_array_sort (files, compare_cache_file_mtime);
+    for (i = 0; i < files->len && total > DISCOVERER_CACHE_MAX_SIZE; i++) {
+      DiscovererCacheFile *f = &g_array_index (files, DiscovererCacheFile, i);
+
+      GST_DEBUG ("Pruning cache file %s", f->path);
+      if (g_unlink (f->path) == 0)
+        total -= f->size;
+    }
+  }
+
+  for (i = 0; i < files->len; i++)
+    g_free (g_array_index (files, DiscovererCacheFile, i).path);
+  g_array_free (files, TRUE);
+}
+
+static void
+discoverer_store_cached_info (GstDiscovererInfo * info)
+{
+  GError *err = NULL;
+  GVariant *variant;
+  gchar *cachefile, *dir;
+
+  cachefile = discoverer_get_cache_file (info->uri);
+  if (cachefile == NULL)
+    return;
+
+  dir = g_path_get_dirname (cachefile);
+  g_mkdir_with_parents (dir, 0700);
+
+  variant = g_variant_ref_sink (gst_discoverer_info_to_variant (info,
+          GST_DISCOVERER_SERIALIZE_ALL));
+
+  GST_DEBUG ("Storing result for %s in %s", info->uri, cachefile);
+  if (!g_file_set_contents (cachefile, g_variant_get_data (variant),
+          g_variant_get_size (variant), &err)) {
+    GST_WARNING ("Couldn't write cache file %s: %s", cachefile, err->message);
+    g_error_free (err);
+  } else {
+    discoverer_prune_cache (dir);
+  }
+
+  g_variant_unref (variant);
+  g_free (cachefile);
+  g_free (dir);
+}
+
 /* Called when pipeline is pre-rolled */
 static void
 discoverer_collect (GstDiscoverer * dc)
@@ -1350,6 +1732,11 @@ discoverer_collect (GstDiscoverer * dc)
     }
   }
 
+  if (dc->priv->use_cache && !dc->priv->current_cached &&
+      dc->priv->current_info &&
+      dc->priv->current_info->result == GST_DISCOVERER_OK)
+    discoverer_store_cached_info (dc->priv->current_info);
+
   if (dc->priv->async) {
     GST_DEBUG ("Emitting 'discoverered'");
     g_signal_emit (dc, gst_discoverer_signals[SIGNAL_DISCOVERED], 0,
@@ -1392,6 +1779,32 @@ handle_current_async (GstDiscoverer * dc)
   g_source_unref (source);
 }
 
+static gboolean
+async_cached_cb (GstDiscoverer * dc)
+{
+  if (!g_source_is_destroyed (g_main_current_source ())) {
+    dc->priv->timeoutid = 0;
+    GST_DEBUG ("Emitting cached result");
+    discoverer_collect (dc);
+    discoverer_cleanup (dc);
+  }
+  return FALSE;
+}
+
+/* Emits the cached result from the main context, the same way a
+ * discovered one would be */
+static void
+handle_cached_async (GstDiscoverer * dc)
+{
+  GSource *source;
+
+  source = g_idle_source_new ();
+  g_source_set_callback (source, (GSourceFunc) async_cached_cb,
+      g_object_ref (dc), g_object_unref);
+  dc->priv->timeoutid = g_source_attach (source, dc->priv->ctx);
+  g_source_unref (source);
+}
+
 
 /* Returns TRUE if processing should stop */
 static gboolean
@@ -1591,20 +2004,36 @@ handle_current_sync (GstDiscoverer * dc)
   g_timer_destroy (timer);
 }
 
-static void
+/* Returns FALSE if the result was found in the cache and there is nothing
+ * to process */
+static gboolean
 _setup_locked (GstDiscoverer * dc)
 {
   GstStateChangeReturn ret;
+  GstDiscovererInfo *cached = NULL;
+  gchar *uri;
 
   GST_DEBUG ("Setting up");
 
   /* Pop URI off the pending URI list */
-  dc->priv->current_info =
-      (GstDiscovererInfo *) g_object_new (GST_TYPE_DISCOVERER_INFO, NULL);
-  dc->priv->current_info->uri = (gchar *) dc->priv->pending_uris->data;
+  uri = (gchar *) dc->priv->pending_uris->data;
   dc->priv->pending_uris =
       g_list_delete_link (dc->priv->pending_uris, dc->priv->pending_uris);
 
+  if (dc->priv->use_cache)
+    cached = discoverer_load_cached_info (uri);
+  if (cached) {
+    GST_DEBUG ("Using cached result for %s", uri);
+    g_free (uri);
+    dc->priv->current_info = cached;
+    dc->priv->current_cached = TRUE;
+    return FALSE;
+  }
+
+  dc->priv->current_info =
+      (GstDiscovererInfo *) g_object_new (GST_TYPE_DISCOVERER_INFO, NULL);
+  dc->priv->current_info->uri = uri;
+
   /* set uri on uridecodebin */
   g_object_set (dc->priv->uridecodebin, "uri", dc->priv->current_info->uri,
       NULL);
@@ -1629,6 +2058,8 @@ _setup_locked (GstDiscoverer * dc)
 
   GST_DEBUG_OBJECT (dc, "Pipeline going to PAUSED : %s",
       gst_element_state_change_return_get_name (ret));
+
+  return TRUE;
 }
 
 static void
@@ -1658,6 +2089,7 @@ discoverer_cleanup (GstDiscoverer * dc)
   }
 
   dc->priv->current_info = NULL;
+  dc->priv->current_cached = FALSE;
 
   dc->priv->pending_subtitle_pads = 0;
   dc->priv->async_done = FALSE;
@@ -1665,10 +2097,14 @@ discoverer_cleanup (GstDiscoverer * dc)
   /* Try popping the next uri */
   if (dc->priv->async) {
     if (dc->priv->pending_uris != NULL) {
-      _setup_locked (dc);
-      DISCO_UNLOCK (dc);
-      /* Start timeout */
-      handle_current_async (dc);
+      if (_setup_locked (dc)) {
+        DISCO_UNLOCK (dc);
+        /* Start timeout */
+        handle_current_async (dc);
+      } else {
+        DISCO_UNLOCK (dc);
+        handle_cached_async (dc);
+      }
     } else {
       /* We're done ! */
       DISCO_UNLOCK (dc);
@@ -1720,6 +2156,7 @@ static GstDiscovererResult
 start_discovering (GstDiscoverer * dc)
 {
   GstDiscovererResult res = GST_DISCOVERER_OK;
+  gboolean process;
 
   GST_DEBUG ("Starting");
 
@@ -1740,19 +2177,230 @@ start_discovering (GstDiscoverer * dc)
 
   g_signal_emit (dc, gst_discoverer_signals[SIGNAL_STARTING], 0);
 
-  _setup_locked (dc);
+  process = _setup_locked (dc);
 
   DISCO_UNLOCK (dc);
 
-  if (dc->priv->async)
-    handle_current_async (dc);
-  else
+  if (dc->priv->async) {
+    if (process)
+      handle_current_async (dc);
+    else
+      handle_cached_async (dc);
+  } else if (process) {
     handle_current_sync (dc);
+  }
 
 beach:
   return res;
 }
 
+/* Concurrent discovery
+ *
+ * With a max-concurrency above 1 the pending URIs are handed one at a time
+ * to a set of helper discoverers that run in the same main context, and
+ * their results are emitted from here. */
+
+static void
+discoverer_job_free (DiscovererJob * job)
+{
+  if (job->info)
+    gst_discoverer_info_unref (job->info);
+  if (job->error)
+    g_error_free (job->error);
+  g_slice_free (DiscovererJob, job);
+}
+
+static DiscovererJob *
+find_job_locked (GstDiscoverer * dc, GstDiscoverer * helper)
+{
+  GList *l;
+
+  for (l = dc->priv->jobs.head; l; l = l->next) {
+    DiscovererJob *job = l->data;
+
+    if (job->helper == helper)
+      return job;
+  }
+  return NULL;
+}
+
+/* Hands pending URIs to the helpers that are idle */
+static void
+discoverer_dispatch (GstDiscoverer * dc)
+{
+  GstDiscoverer *helper;
+  DiscovererJob *job;
+  gboolean busy;
+  gchar *uri;
+  guint i;
+
+  DISCO_LOCK (dc);
+  for (i = 0; i < dc->priv->helpers->len; i++) {
+    if (!dc->priv->concurrent || dc->priv->pending_uris == NULL)
+      break;
+
+    helper = g_ptr_array_index (dc->priv->helpers, i);
+    if (find_job_locked (dc, helper))
+      continue;
+
+    /* the helper might still be cleaning up after its last URI, it will
+     * come back to us with ::finished */
+    DISCO_LOCK (helper);
+    busy = helper->priv->current_info != NULL;
+    DISCO_UNLOCK (helper);
+    if (busy)
+      continue;
+
+    uri = dc->priv->pending_uris->data;
+    dc->priv->pending_uris =
+        g_list_delete_link (dc->priv->pending_uris, dc->priv->pending_uris);
+
+    job = g_slice_new0 (DiscovererJob);
+    job->helper = helper;
+    g_queue_push_tail (&dc->priv->jobs, job);
+    DISCO_UNLOCK (dc);
+
+    GST_DEBUG_OBJECT (dc, "Handing %s to %" GST_PTR_FORMAT, uri, helper);
+    gst_discoverer_discover_uri_async (helper, uri);
+    g_free (uri);
+
+    DISCO_LOCK (dc);
+  }
+  DISCO_UNLOCK (dc);
+}
+
+/* Emits the results at the head of the queue that are complete */
+static void
+discoverer_emit_jobs (GstDiscoverer * dc)
+{
+  DiscovererJob *job;
+
+  DISCO_LOCK (dc);
+  while ((job = g_queue_peek_head (&dc->priv->jobs)) && job->helper == NULL) {
+    g_queue_pop_head (&dc->priv->jobs);
+    DISCO_UNLOCK (dc);
+
+    GST_DEBUG ("Emitting 'discovered'");
+    g_signal_emit (dc, gst_discoverer_signals[SIGNAL_DISCOVERED], 0,
+        job->info, job->error);
+    discoverer_job_free (job);
+
+    DISCO_LOCK (dc);
+  }
+  DISCO_UNLOCK (dc);
+}
+
+static void
+helper_discovered_cb (GstDiscoverer * helper, GstDiscovererInfo * info,
+    const GError * err, GstDiscoverer * dc)
+{
+  DiscovererJob *job;
+  gboolean ordered;
+
+  DISCO_LOCK (dc);
+  job = find_job_locked (dc, helper);
+  if (job == NULL) {
+    /* we were stopped in the meantime */
+    DISCO_UNLOCK (dc);
+    return;
+  }
+
+  job->helper = NULL;
+  ordered = dc->priv->ordered;
+  if (ordered) {
+    /* the helper frees both after we return */
+    job->info = (GstDiscovererInfo *) gst_discoverer_info_ref (info);
+    job->error = err ? g_error_copy (err) : NULL;
+  } else {
+    g_queue_remove (&dc->priv->jobs, job);
+  }
+  DISCO_UNLOCK (dc);
+
+  if (ordered) {
+    discoverer_emit_jobs (dc);
+  } else {
+    GST_DEBUG ("Emitting 'discovered'");
+    g_signal_emit (dc, gst_discoverer_signals[SIGNAL_DISCOVERED], 0, info,
+        err);
+    discoverer_job_free (job);
+  }
+}
+
+static void
+helper_finished_cb (GstDiscoverer * helper, GstDiscoverer * dc)
+{
+  gboolean done;
+
+  discoverer_dispatch (dc);
+
+  DISCO_LOCK (dc);
+  done = dc->priv->concurrent && dc->priv->pending_uris == NULL
+      && g_queue_is_empty (&dc->priv->jobs);
+  DISCO_UNLOCK (dc);
+
+  if (done)
+    g_signal_emit (dc, gst_discoverer_signals[SIGNAL_FINISHED], 0);
+}
+
+static void
+helper_source_setup_cb (GstDiscoverer * helper, GstElement * source,
+    GstDiscoverer * dc)
+{
+  g_signal_emit (dc, gst_discoverer_signals[SIGNAL_SOURCE_SETUP], 0, source);
+}
+
+static void discoverer_attach_async (GstDiscoverer * dc);
+
+static void
+start_concurrent_discovering (GstDiscoverer * dc)
+{
+  GstDiscoverer *helper;
+  GstClockTime timeout;
+  gboolean use_cache, reuse_elements;
+  guint i, n;
+
+  GST_DEBUG ("Starting concurrently");
+
+  DISCO_LOCK (dc);
+  n = dc->priv->max_concurrency;
+  timeout = dc->priv->timeout;
+  use_cache = dc->priv->use_cache;
+  reuse_elements = dc->priv->reuse_elements;
+  DISCO_UNLOCK (dc);
+
+  if (dc->priv->helpers == NULL)
+    dc->priv->helpers = g_ptr_array_new_with_free_func (g_object_unref);
+  if (dc->priv->helpers->len > n)
+    g_ptr_array_set_size (dc->priv->helpers, n);
+
+  while (dc->priv->helpers->len < n) {
+    helper = g_object_new (GST_TYPE_DISCOVERER, NULL);
+    g_signal_connect_object (helper, "discovered",
+        G_CALLBACK (helper_discovered_cb), dc, 0);
+    g_signal_connect_object (helper, "finished",
+        G_CALLBACK (helper_finished_cb), dc, 0);
+    g_signal_connect_object (helper, "source-setup",
+        G_CALLBACK (helper_source_setup_cb), dc, 0);
+    g_ptr_array_add (dc->priv->helpers, helper);
+  }
+
+  for (i = 0; i < n; i++) {
+    helper = g_ptr_array_index (dc->priv->helpers, i);
+    gst_discoverer_set_timeout (helper, timeout);
+    g_object_set (helper, "use-cache", use_cache, "reuse-elements",
+        reuse_elements, NULL);
+    discoverer_attach_async (helper);
+  }
+
+  DISCO_LOCK (dc);
+  dc->priv->concurrent = TRUE;
+  DISCO_UNLOCK (dc);
+
+  g_signal_emit (dc, gst_discoverer_signals[SIGNAL_STARTING], 0);
+
+  discoverer_dispatch (dc);
+}
+
 /* Serializing code */
 
 static GVariant *
@@ -2075,9 +2723,6 @@ out:
 void
 gst_discoverer_start (GstDiscoverer * discoverer)
 {
-  GSource *source;
-  GMainContext *ctx = NULL;
-
   g_return_if_fail (GST_IS_DISCOVERER (discoverer));
 
   GST_DEBUG_OBJECT (discoverer, "Starting...");
@@ -2087,6 +2732,22 @@ gst_discoverer_start (GstDiscoverer * discoverer)
     return;
   }
 
+  discoverer_attach_async (discoverer);
+
+  if (discoverer->priv->max_concurrency > 1)
+    start_concurrent_discovering (discoverer);
+  else
+    start_discovering (discoverer);
+  GST_DEBUG_OBJECT (discoverer, "Started");
+}
+
+/* Sets up @discoverer to run in the thread default main context */
+static void
+discoverer_attach_async (GstDiscoverer * discoverer)
+{
+  GSource *source;
+  GMainContext *ctx = NULL;
+
   discoverer->priv->async = TRUE;
   discoverer->priv->running = TRUE;
 
@@ -2102,9 +2763,6 @@ gst_discoverer_start (GstDiscoverer * discoverer)
   discoverer->priv->sourceid = g_source_attach (source, ctx);
   g_source_unref (source);
   discoverer->priv->ctx = g_main_context_ref (ctx);
-
-  start_discovering (discoverer);
-  GST_DEBUG_OBJECT (discoverer, "Started");
 }
 
 /**
@@ -2117,6 +2775,8 @@ gst_discoverer_start (GstDiscoverer * discoverer)
 void
 gst_discoverer_stop (GstDiscoverer * discoverer)
 {
+  gboolean concurrent;
+
   g_return_if_fail (GST_IS_DISCOVERER (discoverer));
 
   GST_DEBUG_OBJECT (discoverer, "Stopping...");
@@ -2139,8 +2799,19 @@ gst_discoverer_stop (GstDiscoverer * discoverer)
           GST_STATE_READY);
   }
   discoverer->priv->running = FALSE;
+  concurrent = discoverer->priv->concurrent;
+  discoverer->priv->concurrent = FALSE;
+  g_queue_foreach (&discoverer->priv->jobs, (GFunc) discoverer_job_free, NULL);
+  g_queue_clear (&discoverer->priv->jobs);
   DISCO_UNLOCK (discoverer);
 
+  if (concurrent) {
+    guint i;
+
+    for (i = 0; i < discoverer->priv->helpers->len; i++)
+      gst_discoverer_stop (g_ptr_array_index (discoverer->priv->helpers, i));
+  }
+
   /* Remove timeout handler */
   if (discoverer->priv->timeoutid) {
     g_source_remove (discoverer->priv->timeoutid);
@@ -2182,7 +2853,7 @@ gboolean
 gst_discoverer_discover_uri_async (GstDiscoverer * discoverer,
     const gchar * uri)
 {
-  gboolean can_run;
+  gboolean can_run, concurrent;
 
   g_return_val_if_fail (GST_IS_DISCOVERER (discoverer), FALSE);
 
@@ -2190,11 +2861,14 @@ gst_discoverer_discover_uri_async (GstDiscoverer * discoverer,
 
   DISCO_LOCK (discoverer);
   can_run = (discoverer->priv->pending_uris == NULL);
+  concurrent = discoverer->priv->concurrent;
   discoverer->priv->pending_uris =
       g_list_append (discoverer->priv->pending_uris, g_strdup (uri));
   DISCO_UNLOCK (discoverer);
 
-  if (can_run)
+  if (concurrent)
+    discoverer_dispatch (discoverer);
+  else if (can_run)
     start_discovering (discoverer);
 
   return TRUE;
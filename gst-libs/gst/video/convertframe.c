@@ -277,6 +277,380 @@ link_failed:
   }
 }
 
+/* Raw to raw conversions don't need a pipeline, we convert those directly
+ * with a #GstVideoConverter. Setting up a converter is still expensive so we
+ * keep a few of them around, keyed on the input and output info and the
+ * converter options. An entry is removed from the cache while it is in use
+ * so that concurrent conversions never share a converter. */
+#define CONVERT_FRAME_CACHE_SIZE 8
+
+typedef struct
+{
+  GstVideoInfo in_info;
+  GstVideoInfo out_info;
+  GstStructure *config;
+  GstVideoConverter *convert;
+} ConvertFrameCacheEntry;
+
+static GMutex convert_frame_cache_lock;
+static GQueue convert_frame_cache = G_QUEUE_INIT;
+
+static void
+convert_frame_cache_entry_free (ConvertFrameCacheEntry * entry)
+{
+  gst_video_converter_free (entry->convert);
+  gst_structure_free (entry->config);
+  g_slice_free (ConvertFrameCacheEntry, entry);
+}
+
+static ConvertFrameCacheEntry *
+convert_frame_cache_acquire (const GstVideoInfo * in_info,
+    const GstVideoInfo * out_info, GstStructure * config)
+{
+  ConvertFrameCacheEntry *entry = NULL;
+  GList *l;
+
+  g_mutex_lock (&convert_frame_cache_lock);
+  for (l = convert_frame_cache.head; l; l = l->next) {
+    ConvertFrameCacheEntry *e = l->data;
+
+    if (gst_video_info_is_equal (&e->in_info, in_info) &&
+        gst_video_info_is_equal (&e->out_info, out_info) &&
+        gst_structure_is_equal (e->config, config)) {
+      g_queue_delete_link (&convert_frame_cache, l);
+      entry = e;
+      break;
+    }
+  }
+  g_mutex_unlock (&convert_frame_cache_lock);
+
+  if (entry) {
+    GST_DEBUG ("reusing converter %p", entry->convert);
+    gst_structure_free (config);
+    return entry;
+  }
+
+  entry = g_slice_new (ConvertFrameCacheEntry);
+  entry->in_info = *in_info;
+  entry->out_info = *out_info;
+  entry->config = gst_structure_copy (config);
+  entry->convert =
+      gst_video_converter_new (&entry->in_info, &entry->out_info, config);
+  if (entry->convert == NULL) {
+    GST_WARNING ("could not create converter");
+    gst_structure_free (entry->config);
+    g_slice_free (ConvertFrameCacheEntry, entry);
+    return NULL;
+  }
+  GST_DEBUG ("created converter %p", entry->convert);
+
+  return entry;
+}
+
+static void
+convert_frame_cache_release (ConvertFrameCacheEntry * entry)
+{
+  GList *expired = NULL;
+
+  /* most recently used entries are at the head, expire from the tail */
+  g_mutex_lock (&convert_frame_cache_lock);
+  g_queue_push_head (&convert_frame_cache, entry);
+  while (convert_frame_cache.length > CONVERT_FRAME_CACHE_SIZE)
+    expired = g_list_prepend (expired, g_queue_pop_tail (&convert_frame_cache));
+  g_mutex_unlock (&convert_frame_cache_lock);
+
+  g_list_free_full (expired, (GDestroyNotify) convert_frame_cache_entry_free);
+}
+
+static gboolean
+caps_are_sysmem (const GstCaps * caps)
+{
+  GstCapsFeatures *features = gst_caps_get_features (caps, 0);
+
+  return features == NULL
+      || gst_caps_features_is_equal (features,
+      GST_CAPS_FEATURES_MEMORY_SYSTEM_MEMORY);
+}
+
+/* Fixate @to_caps against @in_info the way videoconvert ! videoscale
+ * add-borders=true would and set up the converter options for it. Returns
+ * %FALSE when @to_caps can't be handled without a pipeline. */
+static gboolean
+convert_frame_setup_raw (const GstVideoInfo * in_info,
+    GstVideoCropMeta * cmeta, const GstCaps * to_caps, GstVideoInfo * out_info,
+    GstCaps ** out_caps, GstStructure ** config)
+{
+  GstStructure *s;
+  GstCaps *caps;
+  gint in_x = 0, in_y = 0, in_w, in_h;
+  gint out_w = 0, out_h = 0, out_par_n, out_par_d;
+  gint dar_n, dar_d, n, d, dest_w, dest_h;
+  gboolean in_yuv, out_yuv;
+
+  if (gst_caps_get_size (to_caps) != 1 || !caps_are_sysmem (to_caps))
+    return FALSE;
+
+  s = gst_caps_get_structure (to_caps, 0);
+  if (!gst_structure_has_name (s, "video/x-raw"))
+    return FALSE;
+
+  /* anything that still needs to be negotiated goes through the pipeline */
+  if ((gst_structure_has_field (s, "format") &&
+          !gst_structure_has_field_typed (s, "format", G_TYPE_STRING)) ||
+      (gst_structure_has_field (s, "width") &&
+          !gst_structure_has_field_typed (s, "width", G_TYPE_INT)) ||
+      (gst_structure_has_field (s, "height") &&
+          !gst_structure_has_field_typed (s, "height", G_TYPE_INT)) ||
+      (gst_structure_has_field (s, "pixel-aspect-ratio") &&
+          !gst_structure_has_field_typed (s, "pixel-aspect-ratio",
+              GST_TYPE_FRACTION)))
+    return FALSE;
+
+  if (GST_VIDEO_INFO_INTERLACE_MODE (in_info) !=
+      GST_VIDEO_INTERLACE_MODE_PROGRESSIVE)
+    return FALSE;
+
+  in_w = GST_VIDEO_INFO_WIDTH (in_info);
+  in_h = GST_VIDEO_INFO_HEIGHT (in_info);
+  if (cmeta) {
+    in_x = cmeta->x;
+    in_y = cmeta->y;
+    in_w = cmeta->width;
+    in_h = cmeta->height;
+  }
+  if (in_w <= 0 || in_h <= 0)
+    return FALSE;
+
+  if (!gst_util_fraction_multiply (in_w, in_h,
+          GST_VIDEO_INFO_PAR_N (in_info), GST_VIDEO_INFO_PAR_D (in_info),
+          &dar_n, &dar_d))
+    return FALSE;
+
+  s = gst_structure_copy (s);
+  gst_structure_get_int (s, "width", &out_w);
+  gst_structure_get_int (s, "height", &out_h);
+
+  if (!gst_structure_has_field (s, "format"))
+    gst_structure_set (s, "format", G_TYPE_STRING,
+        GST_VIDEO_INFO_NAME (in_info), NULL);
+
+  if (!gst_structure_get_fraction (s, "pixel-aspect-ratio", &out_par_n,
+          &out_par_d)) {
+    if (out_w > 0 && out_h > 0) {
+      /* pick the PAR that keeps the display aspect ratio */
+      if (!gst_util_fraction_multiply (dar_n, dar_d, out_h, out_w,
+              &out_par_n, &out_par_d))
+        goto failed;
+    } else {
+      out_par_n = GST_VIDEO_INFO_PAR_N (in_info);
+      out_par_d = GST_VIDEO_INFO_PAR_D (in_info);
+    }
+    gst_structure_set (s, "pixel-aspect-ratio", GST_TYPE_FRACTION,
+        out_par_n, out_par_d, NULL);
+  }
+
+  /* the aspect ratio of the picture in output pixels */
+  if (!gst_util_fraction_multiply (dar_n, dar_d, out_par_d, out_par_n, &n, &d))
+    goto failed;
+
+  if (out_w <= 0 && out_h <= 0)
+    out_h = in_h;
+  if (out_w <= 0)
+    out_w = MAX (1, (gint) gst_util_uint64_scale_int (out_h, n, d));
+  else if (out_h <= 0)
+    out_h = MAX (1, (gint) gst_util_uint64_scale_int (out_w, d, n));
+  gst_structure_set (s, "width", G_TYPE_INT, out_w, "height", G_TYPE_INT,
+      out_h, NULL);
+
+  if (GST_VIDEO_INFO_FPS_D (in_info) > 0)
+    gst_structure_set (s, "framerate", GST_TYPE_FRACTION,
+        GST_VIDEO_INFO_FPS_N (in_info), GST_VIDEO_INFO_FPS_D (in_info), NULL);
+
+  /* videoconvert keeps the colorimetry when it doesn't have to change it */
+  caps = gst_caps_new_full (s, NULL);
+  if (!gst_video_info_from_caps (out_info, caps))
+    goto failed_caps;
+
+  in_yuv = GST_VIDEO_INFO_IS_YUV (in_info);
+  out_yuv = GST_VIDEO_INFO_IS_YUV (out_info);
+  if (in_yuv == out_yuv && !GST_VIDEO_INFO_IS_GRAY (in_info) &&
+      !GST_VIDEO_INFO_IS_GRAY (out_info)) {
+    if (!gst_structure_has_field (s, "colorimetry"))
+      out_info->colorimetry = in_info->colorimetry;
+    if (in_yuv && !gst_structure_has_field (s, "chroma-site"))
+      out_info->chroma_site = in_info->chroma_site;
+  }
+
+  gst_caps_unref (caps);
+  caps = gst_video_info_to_caps (out_info);
+  if (!gst_caps_is_fixed (caps))
+    goto failed_caps;
+
+  /* add borders to keep the display aspect ratio */
+  if ((guint64) out_w * d > (guint64) out_h * n) {
+    dest_h = out_h;
+    dest_w = CLAMP ((gint) gst_util_uint64_scale_int (out_h, n, d), 1, out_w);
+  } else {
+    dest_w = out_w;
+    dest_h = CLAMP ((gint) gst_util_uint64_scale_int (out_w, d, n), 1, out_h);
+  }
+
+  *config = gst_structure_new ("GstVideoConvertSample",
+      GST_VIDEO_CONVERTER_OPT_RESAMPLER_METHOD,
+      GST_TYPE_VIDEO_RESAMPLER_METHOD, GST_VIDEO_RESAMPLER_METHOD_LINEAR,
+      GST_VIDEO_CONVERTER_OPT_SRC_X, G_TYPE_INT, in_x,
+      GST_VIDEO_CONVERTER_OPT_SRC_Y, G_TYPE_INT, in_y,
+      GST_VIDEO_CONVERTER_OPT_SRC_WIDTH, G_TYPE_INT, in_w,
+      GST_VIDEO_CONVERTER_OPT_SRC_HEIGHT, G_TYPE_INT, in_h,
+      GST_VIDEO_CONVERTER_OPT_DEST_X, G_TYPE_INT, (out_w - dest_w) / 2,
+      GST_VIDEO_CONVERTER_OPT_DEST_Y, G_TYPE_INT, (out_h - dest_h) / 2,
+      GST_VIDEO_CONVERTER_OPT_DEST_WIDTH, G_TYPE_INT, dest_w,
+      GST_VIDEO_CONVERTER_OPT_DEST_HEIGHT, G_TYPE_INT, dest_h, NULL);
+  *out_caps = caps;
+
+  return TRUE;
+
+failed:
+  {
+    gst_structure_free (s);
+    return FALSE;
+  }
+failed_caps:
+  {
+    gst_caps_unref (caps);
+    return FALSE;
+  }
+}
+
+/* a conversion that doesn't need a pipeline */
+typedef struct
+{
+  GstSample *sample;
+  GstVideoInfo in_info;
+  GstVideoInfo out_info;
+  GstCaps *out_caps;
+  GstStructure *config;
+
+  /* for gst_video_convert_sample_async() */
+  GstVideoConvertSampleCallback callback;
+  gpointer user_data;
+  GDestroyNotify destroy_notify;
+  GMainContext *context;
+} ConvertFrameRaw;
+
+static void
+convert_frame_raw_free (ConvertFrameRaw * raw)
+{
+  gst_sample_unref (raw->sample);
+  gst_caps_unref (raw->out_caps);
+  if (raw->config)
+    gst_structure_free (raw->config);
+  if (raw->context)
+    g_main_context_unref (raw->context);
+  g_slice_free (ConvertFrameRaw, raw);
+}
+
+/* Returns %NULL when the pipeline should be used for the conversion */
+static ConvertFrameRaw *
+convert_frame_raw_new (GstSample * sample, const GstCaps * to_caps)
+{
+  ConvertFrameRaw *raw;
+  GstVideoInfo in_info, out_info;
+  GstCaps *from_caps, *out_caps;
+  GstStructure *config;
+
+  from_caps = gst_sample_get_caps (sample);
+
+  if (!caps_are_sysmem (from_caps)
+      || !gst_video_info_from_caps (&in_info, from_caps))
+    return NULL;
+
+  if (!convert_frame_setup_raw (&in_info,
+          gst_buffer_get_video_crop_meta (gst_sample_get_buffer (sample)),
+          to_caps, &out_info, &out_caps, &config))
+    return NULL;
+
+  raw = g_slice_new0 (ConvertFrameRaw);
+  raw->sample = gst_sample_ref (sample);
+  raw->in_info = in_info;
+  raw->out_info = out_info;
+  raw->out_caps = out_caps;
+  raw->config = config;
+
+  return raw;
+}
+
+static GstSample *
+convert_frame_raw_run (ConvertFrameRaw * raw, GError ** err)
+{
+  GstVideoFrame in_frame, out_frame;
+  GstBuffer *buf, *outbuf;
+  ConvertFrameCacheEntry *entry;
+  GstSample *result;
+
+  GST_DEBUG ("converting directly to caps %" GST_PTR_FORMAT, raw->out_caps);
+
+  buf = gst_sample_get_buffer (raw->sample);
+  if (!gst_video_frame_map (&in_frame, &raw->in_info, buf, GST_MAP_READ))
+    goto map_failed;
+
+  outbuf = gst_buffer_new_allocate (NULL, GST_VIDEO_INFO_SIZE (&raw->out_info),
+      NULL);
+  if (!gst_video_frame_map (&out_frame, &raw->out_info, outbuf,
+          GST_MAP_WRITE)) {
+    gst_video_frame_unmap (&in_frame);
+    gst_buffer_unref (outbuf);
+    goto map_failed;
+  }
+
+  /* takes ownership of the config */
+  entry = convert_frame_cache_acquire (&raw->in_info, &raw->out_info,
+      raw->config);
+  raw->config = NULL;
+  if (entry) {
+    gst_video_converter_frame (entry->convert, &in_frame, &out_frame);
+    convert_frame_cache_release (entry);
+  }
+
+  gst_video_frame_unmap (&out_frame);
+  gst_video_frame_unmap (&in_frame);
+
+  if (entry == NULL) {
+    gst_buffer_unref (outbuf);
+    goto no_converter;
+  }
+
+  gst_buffer_copy_into (outbuf, buf,
+      GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
+
+  result = gst_sample_new (outbuf, raw->out_caps,
+      gst_sample_get_segment (raw->sample), NULL);
+  gst_buffer_unref (outbuf);
+
+  GST_DEBUG ("conversion successful: result = %p", result);
+
+  return result;
+
+  /* ERRORS */
+map_failed:
+  {
+    GST_ERROR ("Could not convert video frame: failed to map buffer");
+    if (err)
+      *err = g_error_new (GST_CORE_ERROR, GST_CORE_ERROR_FAILED,
+          "Could not convert video frame: failed to map buffer");
+    return NULL;
+  }
+no_converter:
+  {
+    GST_ERROR ("Could not convert video frame: no converter for caps %"
+        GST_PTR_FORMAT, raw->out_caps);
+    if (err)
+      *err = g_error_new (GST_CORE_ERROR, GST_CORE_ERROR_NEGOTIATION,
+          "Could not convert video frame: conversion not supported");
+    return NULL;
+  }
+}
+
 /**
  * gst_video_convert_sample:
  * @sample: a #GstSample
@@ -305,6 +679,7 @@ gst_video_convert_sample (GstSample * sample, const GstCaps * to_caps,
   GstCaps *from_caps, *to_caps_copy = NULL;
   GstFlowReturn ret;
   GstElement *pipeline, *src, *sink;
+  ConvertFrameRaw *raw;
   guint i, n;
 
   g_return_val_if_fail (sample != NULL, NULL);
@@ -327,6 +702,16 @@ gst_video_convert_sample (GstSample * sample, const GstCaps * to_caps,
     gst_caps_append_structure (to_caps_copy, s);
   }
 
+  /* raw to raw conversions don't need a pipeline */
+  if ((raw = convert_frame_raw_new (sample, to_caps_copy))) {
+    gst_caps_unref (to_caps_copy);
+
+    result = convert_frame_raw_run (raw, error);
+    convert_frame_raw_free (raw);
+
+    return result;
+  }
+
   pipeline =
       build_convert_frame_pipeline (&src, &sink, from_caps,
       gst_buffer_get_video_crop_meta (buf), to_caps_copy, &err);
@@ -628,6 +1013,45 @@ done:
   return GST_FLOW_OK;
 }
 
+static void
+convert_frame_raw_func (ConvertFrameRaw * raw, gpointer user_data)
+{
+  GstVideoConvertSampleCallbackContext *ctx;
+  GSource *source;
+
+  ctx = g_slice_new0 (GstVideoConvertSampleCallbackContext);
+  ctx->callback = raw->callback;
+  ctx->user_data = raw->user_data;
+  ctx->destroy_notify = raw->destroy_notify;
+  ctx->sample = convert_frame_raw_run (raw, &ctx->error);
+
+  source = g_timeout_source_new (0);
+  g_source_set_callback (source,
+      (GSourceFunc) convert_frame_dispatch_callback, ctx,
+      (GDestroyNotify) gst_video_convert_frame_callback_context_free);
+  g_source_attach (source, raw->context);
+  g_source_unref (source);
+
+  convert_frame_raw_free (raw);
+}
+
+/* shared by all asynchronous raw conversions */
+static GThreadPool *
+convert_frame_get_pool (void)
+{
+  static gsize pool = 0;
+
+  if (g_once_init_enter (&pool)) {
+    GThreadPool *p;
+
+    p = g_thread_pool_new ((GFunc) convert_frame_raw_func, NULL,
+        g_get_num_processors (), FALSE, NULL);
+    g_once_init_leave (&pool, (gsize) p);
+  }
+
+  return (GThreadPool *) pool;
+}
+
 /**
  * gst_video_convert_sample_async:
  * @sample: a #GstSample
@@ -650,6 +1074,9 @@ done:
  *
  * @destroy_notify will be called after the callback was called and @user_data is not needed
  * anymore.
+ *
+ * Conversions between raw video formats are done without a pipeline in a
+ * shared thread pool.
  */
 void
 gst_video_convert_sample_async (GstSample * sample,
@@ -666,6 +1093,7 @@ gst_video_convert_sample_async (GstSample * sample,
   guint i, n;
   GSource *source;
   GstVideoConvertSampleContext *ctx;
+  ConvertFrameRaw *raw;
 
   g_return_if_fail (sample != NULL);
   buf = gst_sample_get_buffer (sample);
@@ -692,6 +1120,20 @@ gst_video_convert_sample_async (GstSample * sample,
     gst_caps_append_structure (to_caps_copy, s);
   }
 
+  /* raw to raw conversions don't need a pipeline, these finish quickly so
+   * we don't install the timeout for them */
+  if ((raw = convert_frame_raw_new (sample, to_caps_copy))) {
+    gst_caps_unref (to_caps_copy);
+
+    raw->callback = callback;
+    raw->user_data = user_data;
+    raw->destroy_notify = destroy_notify;
+    raw->context = g_main_context_ref (context);
+
+    g_thread_pool_push (convert_frame_get_pool (), raw, NULL);
+    return;
+  }
+
   pipeline =
       build_convert_frame_pipeline (&src, &sink, from_caps,
       gst_buffer_get_video_crop_meta (buf), to_caps_copy, &error);
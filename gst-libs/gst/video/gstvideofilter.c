@@ -47,6 +47,37 @@ GST_DEBUG_CATEGORY_STATIC (gst_video_filter_debug);
 G_DEFINE_ABSTRACT_TYPE (GstVideoFilter, gst_video_filter,
     GST_TYPE_BASE_TRANSFORM);
 
+/* the page backing options are opt-in: forward the ones that were enabled
+ * on the downstream pool to the pool we propose upstream */
+static void
+gst_video_filter_forward_page_options (GstQuery * decide_query,
+    GstBufferPool * pool, GstStructure * config)
+{
+  static const gchar *options[] = {
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES,
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB,
+    GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL
+  };
+  GstBufferPool *dpool = NULL;
+  GstStructure *dconfig;
+  guint i;
+
+  if (gst_query_get_n_allocation_pools (decide_query) > 0)
+    gst_query_parse_nth_allocation_pool (decide_query, 0, &dpool, NULL, NULL,
+        NULL);
+  if (dpool == NULL)
+    return;
+
+  dconfig = gst_buffer_pool_get_config (dpool);
+  for (i = 0; i < G_N_ELEMENTS (options); i++) {
+    if (gst_buffer_pool_config_has_option (dconfig, options[i])
+        && gst_buffer_pool_has_option (pool, options[i]))
+      gst_buffer_pool_config_add_option (config, options[i]);
+  }
+  gst_structure_free (dconfig);
+  gst_object_unref (dpool);
+}
+
 /* Answer the allocation query downstream. */
 static gboolean
 gst_video_filter_propose_allocation (GstBaseTransform * trans,
@@ -91,6 +122,7 @@ gst_video_filter_propose_allocation (GstBaseTransform * trans,
     structure = gst_buffer_pool_get_config (pool);
     gst_buffer_pool_config_set_params (structure, caps, size, 0, 0);
     gst_buffer_pool_config_set_allocator (structure, allocator, &params);
+    gst_video_filter_forward_page_options (decide_query, pool, structure);
 
     if (allocator)
       gst_object_unref (allocator);
@@ -17,6 +17,21 @@
  * Boston, MA 02110-1301, USA.
  */
 
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#if defined (SYS_mbind) && defined (SYS_getcpu)
+#define HAVE_NUMA_SYSCALLS 1
+#endif
+#endif
+#endif
+
 #include "gst/video/gstvideometa.h"
 #include "gst/video/gstvideopool.h"
 
@@ -35,6 +50,15 @@ GST_DEBUG_CATEGORY_STATIC (gst_video_pool_debug);
  * Allows configuration of video-specific requirements such as
  * stride alignments or pixel padding, and can also be configured
  * to automatically add #GstVideoMeta to the buffers.
+ *
+ * For large frames the pool can be configured to use huge pages and
+ * to keep its memory on the NUMA node of the thread that uses it with
+ * the #GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES,
+ * #GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB and
+ * #GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL options. These options are
+ * never enabled by default. The application or a downstream element sets
+ * them on the pool config, and #GstVideoFilter forwards them to the pool it
+ * proposes upstream.
  */
 
 /**
@@ -91,6 +115,10 @@ gst_buffer_pool_config_get_video_alignment (GstStructure * config,
       "stride-align3", G_TYPE_UINT, &align->stride_align[3], NULL);
 }
 
+/* size of the huge pages we try to use, buffers smaller than this are
+ * allocated from the allocator */
+#define HUGEPAGE_SIZE (2 * 1024 * 1024)
+
 /* bufferpool */
 struct _GstVideoBufferPoolPrivate
 {
@@ -101,6 +129,13 @@ struct _GstVideoBufferPoolPrivate
   gboolean need_alignment;
   GstAllocator *allocator;
   GstAllocationParams params;
+
+  /* page backing */
+  gboolean use_pages;
+  gboolean hugepages;
+  gboolean hugetlb;
+  gboolean numa_local;
+  gint numa_node;
 };
 
 static void gst_video_buffer_pool_finalize (GObject * object);
@@ -115,7 +150,15 @@ static const gchar **
 video_buffer_pool_get_options (GstBufferPool * pool)
 {
   static const gchar *options[] = { GST_BUFFER_POOL_OPTION_VIDEO_META,
-    GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT, NULL
+    GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT,
+#ifdef HAVE_MMAP
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES,
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB,
+#endif
+#ifdef HAVE_NUMA_SYSCALLS
+    GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL,
+#endif
+    NULL
   };
   return options;
 }
@@ -203,6 +246,31 @@ video_buffer_pool_set_config (GstBufferPool * pool, GstStructure * config)
   info.size = MAX (size, info.size);
   priv->info = info;
 
+  /* huge pages and NUMA placement, we can only do this when we allocate the
+   * memory ourselves. alloc_buffer updates these from the streaming threads,
+   * so they are protected with the object lock */
+  GST_OBJECT_LOCK (pool);
+  priv->hugepages = gst_buffer_pool_config_has_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES);
+  priv->hugetlb = gst_buffer_pool_config_has_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB);
+  priv->numa_local = gst_buffer_pool_config_has_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL);
+  priv->numa_node = -1;
+  GST_OBJECT_UNLOCK (pool);
+
+  priv->use_pages = (priv->hugepages || priv->hugetlb || priv->numa_local) &&
+      (allocator == NULL
+      || g_strcmp0 (allocator->mem_type, GST_ALLOCATOR_SYSMEM) == 0);
+  if (priv->use_pages && priv->params.align >= 4096) {
+    GST_WARNING_OBJECT (pool, "alignment %u too large for page allocation",
+        (guint) priv->params.align);
+    priv->use_pages = FALSE;
+  }
+  GST_DEBUG_OBJECT (pool, "hugepages %d, hugetlb %d, numa local %d, "
+      "use pages %d", priv->hugepages, priv->hugetlb, priv->numa_local,
+      priv->use_pages);
+
   gst_buffer_pool_config_set_params (config, caps, info.size, min_buffers,
       max_buffers);
 
@@ -238,6 +306,142 @@ failed_to_align:
   }
 }
 
+#ifdef HAVE_MMAP
+typedef struct
+{
+  gpointer data;
+  gsize size;
+} PageMapping;
+
+static void
+page_mapping_free (PageMapping * mapping)
+{
+  munmap (mapping->data, mapping->size);
+  g_slice_free (PageMapping, mapping);
+}
+
+#ifdef HAVE_NUMA_SYSCALLS
+/* from linux/mempolicy.h */
+#define VIDEO_POOL_MPOL_PREFERRED 1
+#define VIDEO_POOL_MAX_NODES 1024
+
+static gint
+video_buffer_pool_current_node (void)
+{
+  unsigned int cpu, node;
+
+  if (syscall (SYS_getcpu, &cpu, &node, NULL) != 0)
+    return -1;
+
+  return node;
+}
+
+static void
+video_buffer_pool_bind_node (GstBufferPool * pool, gpointer data, gsize size,
+    gint node)
+{
+  gulong mask[VIDEO_POOL_MAX_NODES / (8 * sizeof (gulong))] = { 0, };
+
+  if (node < 0 || node >= VIDEO_POOL_MAX_NODES)
+    return;
+
+  mask[node / (8 * sizeof (gulong))] = 1UL << (node % (8 * sizeof (gulong)));
+
+  /* must happen before the pages are touched for the first time */
+  if (syscall (SYS_mbind, data, size, VIDEO_POOL_MPOL_PREFERRED, mask,
+          (gulong) VIDEO_POOL_MAX_NODES + 1, 0) != 0)
+    GST_DEBUG_OBJECT (pool, "could not bind memory to node %d", node);
+}
+#endif
+
+/* allocate the memory directly from the kernel so that we can control the
+ * page size and placement. Returns %NULL when the pool allocator should be
+ * used instead. */
+static GstMemory *
+video_buffer_pool_alloc_pages (GstBufferPool * pool, gsize size)
+{
+  GstVideoBufferPool *vpool = GST_VIDEO_BUFFER_POOL_CAST (pool);
+  GstVideoBufferPoolPrivate *priv = vpool->priv;
+  PageMapping *mapping;
+  gsize offset, maxsize, mapsize;
+  gpointer data = MAP_FAILED;
+  gboolean huge, hugetlb, numa_local;
+
+  /* the mapping is page aligned, keep the data after the prefix aligned */
+  offset = (priv->params.prefix + priv->params.align) & ~priv->params.align;
+  maxsize = offset + size + priv->params.padding;
+
+  /* smaller frames come from the allocator. A mapping of their own would
+   * cost extra syscalls for every buffer, and the kernel already places
+   * them on the node of the thread that touches them first */
+  if (maxsize < HUGEPAGE_SIZE)
+    return NULL;
+
+  GST_OBJECT_LOCK (pool);
+  huge = priv->hugepages || priv->hugetlb;
+  hugetlb = priv->hugetlb;
+  numa_local = priv->numa_local;
+  GST_OBJECT_UNLOCK (pool);
+
+  /* round up to whole huge pages, this is required for hugetlb and makes
+   * the whole range eligible for transparent huge pages */
+  if (huge)
+    mapsize = GST_ROUND_UP_N (maxsize, HUGEPAGE_SIZE);
+  else
+    mapsize = GST_ROUND_UP_N (maxsize, 4096);
+
+#ifdef MAP_HUGETLB
+  if (hugetlb) {
+    data = mmap (NULL, mapsize, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (data == MAP_FAILED) {
+      /* don't try again, the reserved pages are used up */
+      GST_INFO_OBJECT (pool, "no huge pages available, using transparent "
+          "huge pages");
+      GST_OBJECT_LOCK (pool);
+      priv->hugetlb = FALSE;
+      priv->hugepages = TRUE;
+      GST_OBJECT_UNLOCK (pool);
+    }
+  }
+#endif
+
+  if (data == MAP_FAILED) {
+    data = mmap (NULL, mapsize, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+      return NULL;
+
+#ifdef MADV_HUGEPAGE
+    if (huge && madvise (data, mapsize, MADV_HUGEPAGE) != 0)
+      GST_DEBUG_OBJECT (pool, "transparent huge pages not available");
+#endif
+  }
+#ifdef HAVE_NUMA_SYSCALLS
+  if (numa_local) {
+    gint node;
+
+    GST_OBJECT_LOCK (pool);
+    if (priv->numa_node == -1)
+      priv->numa_node = video_buffer_pool_current_node ();
+    node = priv->numa_node;
+    GST_OBJECT_UNLOCK (pool);
+
+    GST_LOG_OBJECT (pool, "placing memory on node %d", node);
+
+    video_buffer_pool_bind_node (pool, data, mapsize, node);
+  }
+#endif
+
+  mapping = g_slice_new (PageMapping);
+  mapping->data = data;
+  mapping->size = mapsize;
+
+  return gst_memory_new_wrapped (priv->params.flags, data, mapsize, offset,
+      size, mapping, (GDestroyNotify) page_mapping_free);
+}
+#endif
+
 static GstFlowReturn
 video_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
     GstBufferPoolAcquireParams * params)
@@ -250,8 +454,20 @@ video_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
 
   GST_DEBUG_OBJECT (pool, "alloc %" G_GSIZE_FORMAT, info->size);
 
-  *buffer =
-      gst_buffer_new_allocate (priv->allocator, info->size, &priv->params);
+  *buffer = NULL;
+#ifdef HAVE_MMAP
+  if (priv->use_pages) {
+    GstMemory *mem;
+
+    if ((mem = video_buffer_pool_alloc_pages (pool, info->size))) {
+      *buffer = gst_buffer_new ();
+      gst_buffer_append_memory (*buffer, mem);
+    }
+  }
+#endif
+  if (*buffer == NULL)
+    *buffer =
+        gst_buffer_new_allocate (priv->allocator, info->size, &priv->params);
   if (*buffer == NULL)
     goto no_memory;
 
@@ -316,6 +532,7 @@ static void
 gst_video_buffer_pool_init (GstVideoBufferPool * pool)
 {
   pool->priv = GST_VIDEO_BUFFER_POOL_GET_PRIVATE (pool);
+  pool->priv->numa_node = -1;
 }
 
 static void
@@ -45,6 +45,45 @@ G_BEGIN_DECLS
  */
 #define GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT "GstBufferPoolOptionVideoAlignment"
 
+/**
+ * GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES:
+ *
+ * A bufferpool option to back large video frames with transparent huge
+ * pages. Buffers smaller than a huge page are allocated as usual.
+ *
+ * This option only has an effect when the pool allocates system memory.
+ *
+ * Since: 1.12
+ */
+#define GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES "GstBufferPoolOptionVideoHugepages"
+
+/**
+ * GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB:
+ *
+ * A bufferpool option to back large video frames with explicitly reserved
+ * huge pages. When no huge pages are available the pool falls back to the
+ * behaviour of #GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES.
+ *
+ * This option only has an effect when the pool allocates system memory.
+ *
+ * Since: 1.12
+ */
+#define GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB "GstBufferPoolOptionVideoHugetlb"
+
+/**
+ * GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL:
+ *
+ * A bufferpool option to place the memory of the pool on the NUMA node
+ * of the thread that first allocates a buffer from the pool. Only frames
+ * of at least 2MB are bound explicitly, smaller frames are left to the
+ * first-touch placement of the kernel.
+ *
+ * This option only has an effect when the pool allocates system memory.
+ *
+ * Since: 1.12
+ */
+#define GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL "GstBufferPoolOptionVideoNumaLocal"
+
 /* setting a bufferpool config */
 void             gst_buffer_pool_config_set_video_alignment  (GstStructure *config, GstVideoAlignment *align);
 gboolean         gst_buffer_pool_config_get_video_alignment  (GstStructure *config, GstVideoAlignment *align);
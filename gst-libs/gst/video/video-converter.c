@@ -1303,6 +1303,17 @@ is_no_clip_matrix (MatrixData * data)
   return TRUE;
 }
 
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+static void
+video_converter_matrix16 (MatrixData * data, gpointer pixels)
+{
+  /* the first two rows are packed in pairs in orc_p1..orc_p4, the third
+   * row is passed as separate parameters */
+  video_orc_matrix16 (pixels, pixels, data->orc_p1, data->orc_p2,
+      data->orc_p3, data->orc_p4, data->im[2][0], data->im[2][1],
+      data->im[2][2], data->im[2][3], data->width);
+}
+#else
 static void
 video_converter_matrix16 (MatrixData * data, gpointer pixels)
 {
@@ -1329,6 +1340,7 @@ video_converter_matrix16 (MatrixData * data, gpointer pixels)
     p[i * 4 + 3] = CLAMP (v, 0, 65535);
   }
 }
+#endif
 
 
 static void
@@ -1377,6 +1389,15 @@ prepare_matrix (GstVideoConverter * convert, MatrixData * data)
   } else {
     GST_DEBUG ("use 16bit matrix");
     data->matrix_func = video_converter_matrix16;
+
+    data->orc_p1 = (((guint64) (guint32) data->im[1][0]) << 32) |
+        ((guint64) (guint32) data->im[0][0]);
+    data->orc_p2 = (((guint64) (guint32) data->im[1][1]) << 32) |
+        ((guint64) (guint32) data->im[0][1]);
+    data->orc_p3 = (((guint64) (guint32) data->im[1][2]) << 32) |
+        ((guint64) (guint32) data->im[0][2]);
+    data->orc_p4 = (((guint64) (guint32) data->im[1][3]) << 32) |
+        ((guint64) (guint32) data->im[0][3]);
   }
 }
 
@@ -0,0 +1,139 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "video-format-x86-sse41.h"
+
+#if defined (HAVE_SMMINTRIN_H) && defined (HAVE_EMMINTRIN_H) && \
+    defined (__SSE4_1__)
+
+#include <emmintrin.h>
+#include <smmintrin.h>
+
+/* byte shuffles selecting 16 bit word k, or nothing */
+#define W(k) (2 * (k)), (2 * (k) + 1)
+#define Z -128, -128
+
+/* One v210 group of 16 bytes holds 6 pixels in 4 little endian words of
+ * 3 10 bit samples each:
+ *
+ *   U0 Y0 V0 | Y1 U2 Y2 | V2 Y3 U4 | Y4 V4 Y5
+ *
+ * and unpacks to 6 AYUV64 pixels, 3 vectors of 2 pixels. */
+void
+video_format_unpack_v210_sse41 (guint16 * d, const guint8 * s, gint n_groups,
+    gboolean truncate_range)
+{
+  const __m128i mask = _mm_set1_epi32 (0x3ff);
+  const __m128i alpha = _mm_setr_epi16 (-1, 0, 0, 0, -1, 0, 0, 0);
+  /* move the first and second samples of the 32 bit words in place */
+  const __m128i s0a = _mm_setr_epi8 (Z, W (4), W (0), Z, Z, W (1), W (0), Z);
+  const __m128i s1a = _mm_setr_epi8 (Z, Z, W (5), W (2), Z, W (6), W (5),
+      W (2));
+  const __m128i s2a = _mm_setr_epi8 (Z, W (3), Z, W (7), Z, Z, Z, W (7));
+  /* and the third ones */
+  const __m128i s0b = _mm_setr_epi8 (Z, Z, Z, W (0), Z, Z, Z, W (0));
+  const __m128i s1b = _mm_setr_epi8 (Z, W (1), Z, Z, Z, Z, Z, Z);
+  const __m128i s2b = _mm_setr_epi8 (Z, Z, W (2), Z, Z, W (3), W (2), Z);
+  gint i;
+
+  for (i = 0; i < n_groups; i++) {
+    __m128i w, a, b;
+
+    w = _mm_loadu_si128 ((const __m128i *) (s + i * 16));
+
+    /* U0 Y1 V2 Y4 Y0 U2 Y3 V4 */
+    a = _mm_packs_epi32 (_mm_and_si128 (w, mask),
+        _mm_and_si128 (_mm_srli_epi32 (w, 10), mask));
+    /* V0 Y2 U4 Y5 */
+    b = _mm_and_si128 (_mm_srli_epi32 (w, 20), mask);
+    b = _mm_packs_epi32 (b, b);
+
+    a = _mm_slli_epi16 (a, 6);
+    b = _mm_slli_epi16 (b, 6);
+    if (!truncate_range) {
+      a = _mm_or_si128 (a, _mm_srli_epi16 (a, 10));
+      b = _mm_or_si128 (b, _mm_srli_epi16 (b, 10));
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i * 24 + 0),
+        _mm_or_si128 (alpha, _mm_or_si128 (_mm_shuffle_epi8 (a, s0a),
+                _mm_shuffle_epi8 (b, s0b))));
+    _mm_storeu_si128 ((__m128i *) (d + i * 24 + 8),
+        _mm_or_si128 (alpha, _mm_or_si128 (_mm_shuffle_epi8 (a, s1a),
+                _mm_shuffle_epi8 (b, s1b))));
+    _mm_storeu_si128 ((__m128i *) (d + i * 24 + 16),
+        _mm_or_si128 (alpha, _mm_or_si128 (_mm_shuffle_epi8 (a, s2a),
+                _mm_shuffle_epi8 (b, s2b))));
+  }
+}
+
+#undef Z
+#define Z -128, -128, -128, -128
+/* byte shuffles moving 16 bit word k into a 32 bit lane */
+#define L(k) (2 * (k)), (2 * (k) + 1), -128, -128
+
+void
+video_format_pack_v210_sse41 (guint8 * d, const guint16 * s, gint n_groups)
+{
+  /* the first sample of each word: U0 Y1 V2 Y4 */
+  const __m128i p00 = _mm_setr_epi8 (L (2), L (5), Z, Z);
+  const __m128i p01 = _mm_setr_epi8 (Z, Z, L (3), Z);
+  const __m128i p02 = _mm_setr_epi8 (Z, Z, Z, L (1));
+  /* the second: Y0 U2 Y3 V4 */
+  const __m128i p10 = _mm_setr_epi8 (L (1), Z, Z, Z);
+  const __m128i p11 = _mm_setr_epi8 (Z, L (2), L (5), Z);
+  const __m128i p12 = _mm_setr_epi8 (Z, Z, Z, L (3));
+  /* the third: V0 Y2 U4 Y5 */
+  const __m128i p20 = _mm_setr_epi8 (L (3), Z, Z, Z);
+  const __m128i p21 = _mm_setr_epi8 (Z, L (1), Z, Z);
+  const __m128i p22 = _mm_setr_epi8 (Z, Z, L (2), L (5));
+  gint i;
+
+  for (i = 0; i < n_groups; i++) {
+    __m128i in0, in1, in2, t0, t1, t2;
+
+    in0 = _mm_srli_epi16 (_mm_loadu_si128 ((const __m128i *) (s + i * 24)), 6);
+    in1 = _mm_srli_epi16 (_mm_loadu_si128 ((const __m128i *) (s + i * 24 +
+                8)), 6);
+    in2 = _mm_srli_epi16 (_mm_loadu_si128 ((const __m128i *) (s + i * 24 +
+                16)), 6);
+
+    t0 = _mm_or_si128 (_mm_shuffle_epi8 (in0, p00),
+        _mm_or_si128 (_mm_shuffle_epi8 (in1, p01),
+            _mm_shuffle_epi8 (in2, p02)));
+    t1 = _mm_or_si128 (_mm_shuffle_epi8 (in0, p10),
+        _mm_or_si128 (_mm_shuffle_epi8 (in1, p11),
+            _mm_shuffle_epi8 (in2, p12)));
+    t2 = _mm_or_si128 (_mm_shuffle_epi8 (in0, p20),
+        _mm_or_si128 (_mm_shuffle_epi8 (in1, p21),
+            _mm_shuffle_epi8 (in2, p22)));
+
+    _mm_storeu_si128 ((__m128i *) (d + i * 16), _mm_or_si128 (t0,
+            _mm_or_si128 (_mm_slli_epi32 (t1, 10), _mm_slli_epi32 (t2, 20))));
+  }
+}
+
+#undef Z
+#undef W
+#undef L
+
+#endif
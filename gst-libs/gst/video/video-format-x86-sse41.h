@@ -0,0 +1,32 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef VIDEO_FORMAT_X86_SSE41_H
+#define VIDEO_FORMAT_X86_SSE41_H
+
+#include <glib.h>
+
+G_GNUC_INTERNAL
+void video_format_unpack_v210_sse41 (guint16 * d, const guint8 * s,
+    gint n_groups, gboolean truncate_range);
+
+G_GNUC_INTERNAL
+void video_format_pack_v210_sse41 (guint8 * d, const guint16 * s,
+    gint n_groups);
+
+#endif /* VIDEO_FORMAT_X86_SSE41_H */
@@ -26,9 +26,20 @@
 #include <string.h>
 #include <stdio.h>
 
+#if defined HAVE_ORC && !defined DISABLE_ORC
+#include <orc/orc.h>
+#endif
+
 #include "video-format.h"
 #include "video-orc.h"
 
+#if defined HAVE_ORC && !defined DISABLE_ORC
+# if defined (__i386__) || defined (__x86_64__)
+#  define CHECK_X86
+#  include "video-format-x86-sse41.h"
+# endif
+#endif
+
 #ifndef restrict
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
 /* restrict should be available */
@@ -554,13 +565,63 @@ pack_copy4 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   memcpy (d, src, width * 4);
 }
 
+/* whole v210 groups of 6 pixels are unpacked and packed with SIMD when the
+ * CPU supports it, the scalar loops handle the remaining pixels */
+static void (*unpack_v210_groups) (guint16 * d, const guint8 * s,
+    gint n_groups, gboolean truncate_range);
+static void (*pack_v210_groups) (guint8 * d, const guint16 * s,
+    gint n_groups);
+
+#ifdef CHECK_X86
+static void
+video_format_check_x86 (const gchar * option)
+{
+  if (!strcmp (option, "sse41")) {
+#if defined (HAVE_SMMINTRIN_H) && defined (HAVE_EMMINTRIN_H) && HAVE_SSE41
+    unpack_v210_groups = video_format_unpack_v210_sse41;
+    pack_v210_groups = video_format_pack_v210_sse41;
+#endif
+  }
+}
+#endif
+
+static void
+video_format_init_simd (void)
+{
+  static gsize init_gonce = 0;
+
+  if (g_once_init_enter (&init_gonce)) {
+#ifdef CHECK_X86
+    OrcTarget *target;
+
+    orc_init ();
+    target = orc_target_get_default ();
+
+    if (target) {
+      unsigned int flags = orc_target_get_default_flags (target);
+      gint i;
+
+      for (i = 0; i < 32; ++i) {
+        if (flags & (1U << i)) {
+          const gchar *name = orc_target_get_flag_name (target, i);
+
+          if (name)
+            video_format_check_x86 (name);
+        }
+      }
+    }
+#endif
+    g_once_init_leave (&init_gonce, 1);
+  }
+}
+
 #define PACK_v210 GST_VIDEO_FORMAT_AYUV64, unpack_v210, 1, pack_v210
 static void
 unpack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
+  int i = 0;
   const guint8 *restrict s = GET_LINE (y);
   guint16 *restrict d = dest;
   guint32 a0, a1, a2, a3;
@@ -571,7 +632,14 @@ unpack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   /* FIXME */
   s += x * 2;
 
-  for (i = 0; i < width; i += 6) {
+  video_format_init_simd ();
+  if (unpack_v210_groups && width >= 6) {
+    unpack_v210_groups (d, s, width / 6,
+        (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE) != 0);
+    i = (width / 6) * 6;
+  }
+
+  for (; i < width; i += 6) {
     a0 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 0);
     a1 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 4);
     a2 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 8);
@@ -653,7 +721,7 @@ pack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
+  int i = 0;
   guint8 *restrict d = GET_LINE (y);
   const guint16 *restrict s = src;
   guint32 a0, a1, a2, a3;
@@ -661,7 +729,13 @@ pack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   guint16 u0, u1, u2;
   guint16 v0, v1, v2;
 
-  for (i = 0; i < width - 5; i += 6) {
+  video_format_init_simd ();
+  if (pack_v210_groups && width >= 6) {
+    pack_v210_groups (d, s, width / 6);
+    i = (width / 6) * 6;
+  }
+
+  for (; i < width - 5; i += 6) {
     y0 = s[4 * (i + 0) + 1] >> 6;
     y1 = s[4 * (i + 1) + 1] >> 6;
     y2 = s[4 * (i + 2) + 1] >> 6;
@@ -2303,32 +2377,43 @@ unpack_GBR_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *sg = GET_G_LINE (y);
   const guint16 *sb = GET_B_LINE (y);
   const guint16 *sr = GET_R_LINE (y);
-  guint16 *d = dest, G, B, R;
+  guint16 *d = dest;
 
   sg += x;
   sb += x;
   sr += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_LE (sg + i) << 6;
-    B = GST_READ_UINT16_LE (sb + i) << 6;
-    R = GST_READ_UINT16_LE (sr + i) << 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_10_trunc (d, sr, sg, sb, width);
+  else
+    video_orc_unpack_Y444_10 (d, sr, sg, sb, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 10);
-      G |= (G >> 10);
-      B |= (B >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_LE (sg + i) << 6;
+      B = GST_READ_UINT16_LE (sb + i) << 6;
+      R = GST_READ_UINT16_LE (sr + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 10);
+        G |= (G >> 10);
+        B |= (B >> 10);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2337,22 +2422,29 @@ pack_GBR_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
-  guint16 G, B, R;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = (s[i * 4 + 2]) >> 6;
-    B = (s[i * 4 + 3]) >> 6;
-    R = (s[i * 4 + 1]) >> 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_Y444_10 (dr, dg, db, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
+
+    for (i = 0; i < width; i++) {
+      G = (s[i * 4 + 2]) >> 6;
+      B = (s[i * 4 + 3]) >> 6;
+      R = (s[i * 4 + 1]) >> 6;
 
-    GST_WRITE_UINT16_LE (dg + i, G);
-    GST_WRITE_UINT16_LE (db + i, B);
-    GST_WRITE_UINT16_LE (dr + i, R);
+      GST_WRITE_UINT16_LE (dg + i, G);
+      GST_WRITE_UINT16_LE (db + i, B);
+      GST_WRITE_UINT16_LE (dr + i, R);
+    }
   }
+#endif
 }
 
 #define PACK_GBR_10BE GST_VIDEO_FORMAT_ARGB64, unpack_GBR_10BE, 1, pack_GBR_10BE
@@ -2361,32 +2453,43 @@ unpack_GBR_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sg = GET_G_LINE (y);
   const guint16 *restrict sb = GET_B_LINE (y);
   const guint16 *restrict sr = GET_R_LINE (y);
-  guint16 *restrict d = dest, G, B, R;
+  guint16 *restrict d = dest;
 
   sg += x;
   sb += x;
   sr += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_BE (sg + i) << 6;
-    B = GST_READ_UINT16_BE (sb + i) << 6;
-    R = GST_READ_UINT16_BE (sr + i) << 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_10_trunc (d, sr, sg, sb, width);
+  else
+    video_orc_unpack_Y444_10 (d, sr, sg, sb, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 10);
-      G |= (G >> 10);
-      B |= (B >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_BE (sg + i) << 6;
+      B = GST_READ_UINT16_BE (sb + i) << 6;
+      R = GST_READ_UINT16_BE (sr + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 10);
+        G |= (G >> 10);
+        B |= (B >> 10);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2395,22 +2498,29 @@ pack_GBR_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
-  guint16 G, B, R;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = s[i * 4 + 2] >> 6;
-    B = s[i * 4 + 3] >> 6;
-    R = s[i * 4 + 1] >> 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_Y444_10 (dr, dg, db, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
+
+    for (i = 0; i < width; i++) {
+      G = s[i * 4 + 2] >> 6;
+      B = s[i * 4 + 3] >> 6;
+      R = s[i * 4 + 1] >> 6;
 
-    GST_WRITE_UINT16_BE (dg + i, G);
-    GST_WRITE_UINT16_BE (db + i, B);
-    GST_WRITE_UINT16_BE (dr + i, R);
+      GST_WRITE_UINT16_BE (dg + i, G);
+      GST_WRITE_UINT16_BE (db + i, B);
+      GST_WRITE_UINT16_BE (dr + i, R);
+    }
   }
+#endif
 }
 
 #define PACK_GBRA_10LE GST_VIDEO_FORMAT_ARGB64, unpack_GBRA_10LE, 1, pack_GBRA_10LE
@@ -2419,36 +2529,47 @@ unpack_GBRA_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *sg = GET_G_LINE (y);
   const guint16 *sb = GET_B_LINE (y);
   const guint16 *sr = GET_R_LINE (y);
   const guint16 *sa = GET_A_LINE (y);
-  guint16 *d = dest, G, B, R, A;
+  guint16 *d = dest;
 
   sg += x;
   sb += x;
   sr += x;
   sa += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_LE (sg + i) << 6;
-    B = GST_READ_UINT16_LE (sb + i) << 6;
-    R = GST_READ_UINT16_LE (sr + i) << 6;
-    A = GST_READ_UINT16_LE (sa + i) << 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_A444_10_trunc (d, sr, sg, sb, sa, width);
+  else
+    video_orc_unpack_A444_10 (d, sr, sg, sb, sa, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 10);
-      G |= (G >> 10);
-      B |= (B >> 10);
-      A |= (A >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_LE (sg + i) << 6;
+      B = GST_READ_UINT16_LE (sb + i) << 6;
+      R = GST_READ_UINT16_LE (sr + i) << 6;
+      A = GST_READ_UINT16_LE (sa + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 10);
+        G |= (G >> 10);
+        B |= (B >> 10);
+        A |= (A >> 10);
+      }
 
-    d[i * 4 + 0] = A;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = A;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2457,25 +2578,32 @@ pack_GBRA_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
   guint16 *restrict da = GET_A_LINE (y);
-  guint16 G, B, R, A;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = (s[i * 4 + 2]) >> 6;
-    B = (s[i * 4 + 3]) >> 6;
-    R = (s[i * 4 + 1]) >> 6;
-    A = (s[i * 4 + 0]) >> 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_A444_10 (dr, dg, db, da, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    GST_WRITE_UINT16_LE (dg + i, G);
-    GST_WRITE_UINT16_LE (db + i, B);
-    GST_WRITE_UINT16_LE (dr + i, R);
-    GST_WRITE_UINT16_LE (da + i, A);
+    for (i = 0; i < width; i++) {
+      G = (s[i * 4 + 2]) >> 6;
+      B = (s[i * 4 + 3]) >> 6;
+      R = (s[i * 4 + 1]) >> 6;
+      A = (s[i * 4 + 0]) >> 6;
+
+      GST_WRITE_UINT16_LE (dg + i, G);
+      GST_WRITE_UINT16_LE (db + i, B);
+      GST_WRITE_UINT16_LE (dr + i, R);
+      GST_WRITE_UINT16_LE (da + i, A);
+    }
   }
+#endif
 }
 
 #define PACK_GBRA_10BE GST_VIDEO_FORMAT_ARGB64, unpack_GBRA_10BE, 1, pack_GBRA_10BE
@@ -2484,36 +2612,47 @@ unpack_GBRA_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sg = GET_G_LINE (y);
   const guint16 *restrict sb = GET_B_LINE (y);
   const guint16 *restrict sr = GET_R_LINE (y);
   const guint16 *restrict sa = GET_A_LINE (y);
-  guint16 *restrict d = dest, G, B, R, A;
+  guint16 *restrict d = dest;
 
   sg += x;
   sb += x;
   sr += x;
   sa += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_BE (sg + i) << 6;
-    B = GST_READ_UINT16_BE (sb + i) << 6;
-    R = GST_READ_UINT16_BE (sr + i) << 6;
-    A = GST_READ_UINT16_BE (sa + i) << 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_A444_10_trunc (d, sr, sg, sb, sa, width);
+  else
+    video_orc_unpack_A444_10 (d, sr, sg, sb, sa, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 10);
-      G |= (G >> 10);
-      B |= (B >> 10);
-      A |= (A >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_BE (sg + i) << 6;
+      B = GST_READ_UINT16_BE (sb + i) << 6;
+      R = GST_READ_UINT16_BE (sr + i) << 6;
+      A = GST_READ_UINT16_BE (sa + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 10);
+        G |= (G >> 10);
+        B |= (B >> 10);
+        A |= (A >> 10);
+      }
 
-    d[i * 4 + 0] = A;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = A;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2522,25 +2661,32 @@ pack_GBRA_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
   guint16 *restrict da = GET_A_LINE (y);
-  guint16 G, B, R, A;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = s[i * 4 + 2] >> 6;
-    B = s[i * 4 + 3] >> 6;
-    R = s[i * 4 + 1] >> 6;
-    A = s[i * 4 + 0] >> 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_A444_10 (dr, dg, db, da, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    GST_WRITE_UINT16_BE (dg + i, G);
-    GST_WRITE_UINT16_BE (db + i, B);
-    GST_WRITE_UINT16_BE (dr + i, R);
-    GST_WRITE_UINT16_BE (da + i, A);
+    for (i = 0; i < width; i++) {
+      G = s[i * 4 + 2] >> 6;
+      B = s[i * 4 + 3] >> 6;
+      R = s[i * 4 + 1] >> 6;
+      A = s[i * 4 + 0] >> 6;
+
+      GST_WRITE_UINT16_BE (dg + i, G);
+      GST_WRITE_UINT16_BE (db + i, B);
+      GST_WRITE_UINT16_BE (dr + i, R);
+      GST_WRITE_UINT16_BE (da + i, A);
+    }
   }
+#endif
 }
 
 #define PACK_GBR_12LE GST_VIDEO_FORMAT_ARGB64, unpack_GBR_12LE, 1, pack_GBR_12LE
@@ -2549,32 +2695,43 @@ unpack_GBR_12LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *sg = GET_G_LINE (y);
   const guint16 *sb = GET_B_LINE (y);
   const guint16 *sr = GET_R_LINE (y);
-  guint16 *d = dest, G, B, R;
+  guint16 *d = dest;
 
   sg += x;
   sb += x;
   sr += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_LE (sg + i) << 4;
-    B = GST_READ_UINT16_LE (sb + i) << 4;
-    R = GST_READ_UINT16_LE (sr + i) << 4;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_12_trunc (d, sr, sg, sb, width);
+  else
+    video_orc_unpack_Y444_12 (d, sr, sg, sb, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 12);
-      G |= (G >> 12);
-      B |= (B >> 12);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_LE (sg + i) << 4;
+      B = GST_READ_UINT16_LE (sb + i) << 4;
+      R = GST_READ_UINT16_LE (sr + i) << 4;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 12);
+        G |= (G >> 12);
+        B |= (B >> 12);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2583,22 +2740,29 @@ pack_GBR_12LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
-  guint16 G, B, R;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = (s[i * 4 + 2]) >> 4;
-    B = (s[i * 4 + 3]) >> 4;
-    R = (s[i * 4 + 1]) >> 4;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_Y444_12 (dr, dg, db, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
+
+    for (i = 0; i < width; i++) {
+      G = (s[i * 4 + 2]) >> 4;
+      B = (s[i * 4 + 3]) >> 4;
+      R = (s[i * 4 + 1]) >> 4;
 
-    GST_WRITE_UINT16_LE (dg + i, G);
-    GST_WRITE_UINT16_LE (db + i, B);
-    GST_WRITE_UINT16_LE (dr + i, R);
+      GST_WRITE_UINT16_LE (dg + i, G);
+      GST_WRITE_UINT16_LE (db + i, B);
+      GST_WRITE_UINT16_LE (dr + i, R);
+    }
   }
+#endif
 }
 
 #define PACK_GBR_12BE GST_VIDEO_FORMAT_ARGB64, unpack_GBR_12BE, 1, pack_GBR_12BE
@@ -2607,32 +2771,43 @@ unpack_GBR_12BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sg = GET_G_LINE (y);
   const guint16 *restrict sb = GET_B_LINE (y);
   const guint16 *restrict sr = GET_R_LINE (y);
-  guint16 *restrict d = dest, G, B, R;
+  guint16 *restrict d = dest;
 
   sg += x;
   sb += x;
   sr += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_BE (sg + i) << 4;
-    B = GST_READ_UINT16_BE (sb + i) << 4;
-    R = GST_READ_UINT16_BE (sr + i) << 4;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_12_trunc (d, sr, sg, sb, width);
+  else
+    video_orc_unpack_Y444_12 (d, sr, sg, sb, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 12);
-      G |= (G >> 12);
-      B |= (B >> 12);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_BE (sg + i) << 4;
+      B = GST_READ_UINT16_BE (sb + i) << 4;
+      R = GST_READ_UINT16_BE (sr + i) << 4;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 12);
+        G |= (G >> 12);
+        B |= (B >> 12);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2641,22 +2816,29 @@ pack_GBR_12BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
-  guint16 G, B, R;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = s[i * 4 + 2] >> 4;
-    B = s[i * 4 + 3] >> 4;
-    R = s[i * 4 + 1] >> 4;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_Y444_12 (dr, dg, db, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R;
+
+    for (i = 0; i < width; i++) {
+      G = s[i * 4 + 2] >> 4;
+      B = s[i * 4 + 3] >> 4;
+      R = s[i * 4 + 1] >> 4;
 
-    GST_WRITE_UINT16_BE (dg + i, G);
-    GST_WRITE_UINT16_BE (db + i, B);
-    GST_WRITE_UINT16_BE (dr + i, R);
+      GST_WRITE_UINT16_BE (dg + i, G);
+      GST_WRITE_UINT16_BE (db + i, B);
+      GST_WRITE_UINT16_BE (dr + i, R);
+    }
   }
+#endif
 }
 
 #define PACK_GBRA_12LE GST_VIDEO_FORMAT_ARGB64, unpack_GBRA_12LE, 1, pack_GBRA_12LE
@@ -2665,36 +2847,47 @@ unpack_GBRA_12LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *sg = GET_G_LINE (y);
   const guint16 *sb = GET_B_LINE (y);
   const guint16 *sr = GET_R_LINE (y);
   const guint16 *sa = GET_A_LINE (y);
-  guint16 *d = dest, G, B, R, A;
+  guint16 *d = dest;
 
   sg += x;
   sb += x;
   sr += x;
   sa += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_LE (sg + i) << 4;
-    B = GST_READ_UINT16_LE (sb + i) << 4;
-    R = GST_READ_UINT16_LE (sr + i) << 4;
-    A = GST_READ_UINT16_LE (sa + i) << 4;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_A444_12_trunc (d, sr, sg, sb, sa, width);
+  else
+    video_orc_unpack_A444_12 (d, sr, sg, sb, sa, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      A |= (A >> 12);
-      R |= (R >> 12);
-      G |= (G >> 12);
-      B |= (B >> 12);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_LE (sg + i) << 4;
+      B = GST_READ_UINT16_LE (sb + i) << 4;
+      R = GST_READ_UINT16_LE (sr + i) << 4;
+      A = GST_READ_UINT16_LE (sa + i) << 4;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        A |= (A >> 12);
+        R |= (R >> 12);
+        G |= (G >> 12);
+        B |= (B >> 12);
+      }
 
-    d[i * 4 + 0] = A;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = A;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2703,25 +2896,32 @@ pack_GBRA_12LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
   guint16 *restrict da = GET_A_LINE (y);
-  guint16 G, B, R, A;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = (s[i * 4 + 2]) >> 4;
-    B = (s[i * 4 + 3]) >> 4;
-    R = (s[i * 4 + 1]) >> 4;
-    A = (s[i * 4 + 0]) >> 4;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_A444_12 (dr, dg, db, da, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    GST_WRITE_UINT16_LE (dg + i, G);
-    GST_WRITE_UINT16_LE (db + i, B);
-    GST_WRITE_UINT16_LE (dr + i, R);
-    GST_WRITE_UINT16_LE (da + i, A);
+    for (i = 0; i < width; i++) {
+      G = (s[i * 4 + 2]) >> 4;
+      B = (s[i * 4 + 3]) >> 4;
+      R = (s[i * 4 + 1]) >> 4;
+      A = (s[i * 4 + 0]) >> 4;
+
+      GST_WRITE_UINT16_LE (dg + i, G);
+      GST_WRITE_UINT16_LE (db + i, B);
+      GST_WRITE_UINT16_LE (dr + i, R);
+      GST_WRITE_UINT16_LE (da + i, A);
+    }
   }
+#endif
 }
 
 #define PACK_GBRA_12BE GST_VIDEO_FORMAT_ARGB64, unpack_GBRA_12BE, 1, pack_GBRA_12BE
@@ -2730,36 +2930,47 @@ unpack_GBRA_12BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sg = GET_G_LINE (y);
   const guint16 *restrict sb = GET_B_LINE (y);
   const guint16 *restrict sr = GET_R_LINE (y);
   const guint16 *restrict sa = GET_A_LINE (y);
-  guint16 *restrict d = dest, G, B, R, A;
+  guint16 *restrict d = dest;
 
   sg += x;
   sb += x;
   sr += x;
   sa += x;
 
-  for (i = 0; i < width; i++) {
-    G = GST_READ_UINT16_BE (sg + i) << 4;
-    B = GST_READ_UINT16_BE (sb + i) << 4;
-    R = GST_READ_UINT16_BE (sr + i) << 4;
-    A = GST_READ_UINT16_BE (sa + i) << 4;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_A444_12_trunc (d, sr, sg, sb, sa, width);
+  else
+    video_orc_unpack_A444_12 (d, sr, sg, sb, sa, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      R |= (R >> 12);
-      G |= (G >> 12);
-      B |= (B >> 12);
-      A |= (A >> 12);
-    }
+    for (i = 0; i < width; i++) {
+      G = GST_READ_UINT16_BE (sg + i) << 4;
+      B = GST_READ_UINT16_BE (sb + i) << 4;
+      R = GST_READ_UINT16_BE (sr + i) << 4;
+      A = GST_READ_UINT16_BE (sa + i) << 4;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        R |= (R >> 12);
+        G |= (G >> 12);
+        B |= (B >> 12);
+        A |= (A >> 12);
+      }
 
-    d[i * 4 + 0] = A;
-    d[i * 4 + 1] = R;
-    d[i * 4 + 2] = G;
-    d[i * 4 + 3] = B;
+      d[i * 4 + 0] = A;
+      d[i * 4 + 1] = R;
+      d[i * 4 + 2] = G;
+      d[i * 4 + 3] = B;
+    }
   }
+#endif
 }
 
 static void
@@ -2768,25 +2979,32 @@ pack_GBRA_12BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dg = GET_G_LINE (y);
   guint16 *restrict db = GET_B_LINE (y);
   guint16 *restrict dr = GET_R_LINE (y);
   guint16 *restrict da = GET_A_LINE (y);
-  guint16 G, B, R, A;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    G = s[i * 4 + 2] >> 4;
-    B = s[i * 4 + 3] >> 4;
-    R = s[i * 4 + 1] >> 4;
-    A = s[i * 4 + 0] >> 4;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_A444_12 (dr, dg, db, da, s, width);
+#else
+  {
+    gint i;
+    guint16 G, B, R, A;
 
-    GST_WRITE_UINT16_BE (dg + i, G);
-    GST_WRITE_UINT16_BE (db + i, B);
-    GST_WRITE_UINT16_BE (dr + i, R);
-    GST_WRITE_UINT16_BE (da + i, A);
+    for (i = 0; i < width; i++) {
+      G = s[i * 4 + 2] >> 4;
+      B = s[i * 4 + 3] >> 4;
+      R = s[i * 4 + 1] >> 4;
+      A = s[i * 4 + 0] >> 4;
+
+      GST_WRITE_UINT16_BE (dg + i, G);
+      GST_WRITE_UINT16_BE (db + i, B);
+      GST_WRITE_UINT16_BE (dr + i, R);
+      GST_WRITE_UINT16_BE (da + i, A);
+    }
   }
+#endif
 }
 
 #define PACK_Y444_10LE GST_VIDEO_FORMAT_AYUV64, unpack_Y444_10LE, 1, pack_Y444_10LE
@@ -2795,32 +3013,43 @@ unpack_Y444_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   guint16 *restrict sy = GET_Y_LINE (y);
   guint16 *restrict su = GET_U_LINE (y);
   guint16 *restrict sv = GET_V_LINE (y);
-  guint16 *restrict d = dest, Y, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   su += x;
   sv += x;
 
-  for (i = 0; i < width; i++) {
-    Y = GST_READ_UINT16_LE (sy + i) << 6;
-    U = GST_READ_UINT16_LE (su + i) << 6;
-    V = GST_READ_UINT16_LE (sv + i) << 6;
-
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y |= (Y >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_10_trunc (d, sy, su, sv, width);
+  else
+    video_orc_unpack_Y444_10 (d, sy, su, sv, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+    for (i = 0; i < width; i++) {
+      Y = GST_READ_UINT16_LE (sy + i) << 6;
+      U = GST_READ_UINT16_LE (su + i) << 6;
+      V = GST_READ_UINT16_LE (sv + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y |= (Y >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
+
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -2829,22 +3058,29 @@ pack_Y444_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (y);
   guint16 *restrict dv = GET_V_LINE (y);
-  guint16 Y, U, V;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    Y = (s[i * 4 + 1]) >> 6;
-    U = (s[i * 4 + 2]) >> 6;
-    V = (s[i * 4 + 3]) >> 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_Y444_10 (dy, du, dv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
+
+    for (i = 0; i < width; i++) {
+      Y = (s[i * 4 + 1]) >> 6;
+      U = (s[i * 4 + 2]) >> 6;
+      V = (s[i * 4 + 3]) >> 6;
 
-    GST_WRITE_UINT16_LE (dy + i, Y);
-    GST_WRITE_UINT16_LE (du + i, U);
-    GST_WRITE_UINT16_LE (dv + i, V);
+      GST_WRITE_UINT16_LE (dy + i, Y);
+      GST_WRITE_UINT16_LE (du + i, U);
+      GST_WRITE_UINT16_LE (dv + i, V);
+    }
   }
+#endif
 }
 
 #define PACK_Y444_10BE GST_VIDEO_FORMAT_AYUV64, unpack_Y444_10BE, 1, pack_Y444_10BE
@@ -2853,32 +3089,43 @@ unpack_Y444_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sy = GET_Y_LINE (y);
   const guint16 *restrict su = GET_U_LINE (y);
   const guint16 *restrict sv = GET_V_LINE (y);
-  guint16 *restrict d = dest, Y, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   su += x;
   sv += x;
 
-  for (i = 0; i < width; i++) {
-    Y = GST_READ_UINT16_BE (sy + i) << 6;
-    U = GST_READ_UINT16_BE (su + i) << 6;
-    V = GST_READ_UINT16_BE (sv + i) << 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_10_trunc (d, sy, su, sv, width);
+  else
+    video_orc_unpack_Y444_10 (d, sy, su, sv, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y |= (Y >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      Y = GST_READ_UINT16_BE (sy + i) << 6;
+      U = GST_READ_UINT16_BE (su + i) << 6;
+      V = GST_READ_UINT16_BE (sv + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y |= (Y >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -2887,21 +3134,107 @@ pack_Y444_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (y);
   guint16 *restrict dv = GET_V_LINE (y);
-  guint16 Y, U, V;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    Y = s[i * 4 + 1] >> 6;
-    U = s[i * 4 + 2] >> 6;
-    V = s[i * 4 + 3] >> 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_Y444_10 (dy, du, dv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
+
+    for (i = 0; i < width; i++) {
+      Y = s[i * 4 + 1] >> 6;
+      U = s[i * 4 + 2] >> 6;
+      V = s[i * 4 + 3] >> 6;
+
+      GST_WRITE_UINT16_BE (dy + i, Y);
+      GST_WRITE_UINT16_BE (du + i, U);
+      GST_WRITE_UINT16_BE (dv + i, V);
+    }
+  }
+#endif
+}
+
+/* The 4:2:0 10 bit formats are unpacked and packed with ORC in chunks of
+ * pixels in native byte order: the chroma is first duplicated into (or
+ * decimated from) a line of 4:4:4 samples on the stack. */
+#define PACK_420_10_CHUNK 256
 
-    GST_WRITE_UINT16_BE (dy + i, Y);
-    GST_WRITE_UINT16_BE (du + i, U);
-    GST_WRITE_UINT16_BE (dv + i, V);
+static void
+unpack_I420_10_orc (GstVideoPackFlags flags, guint16 * restrict d,
+    const guint16 * restrict sy, const guint16 * restrict su,
+    const guint16 * restrict sv, gint x, gint width)
+{
+  guint16 uv[PACK_420_10_CHUNK * 2];
+  gint n;
+
+  if (x & 1) {
+    guint16 Y = sy[0] << 6, U = su[0] << 6, V = sv[0] << 6;
+
+    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+      Y |= (Y >> 10);
+      U |= (U >> 10);
+      V |= (V >> 10);
+    }
+    d[0] = 0xffff;
+    d[1] = Y;
+    d[2] = U;
+    d[3] = V;
+    d += 4;
+    sy++;
+    su++;
+    sv++;
+    width--;
+  }
+
+  while (width > 0) {
+    n = MIN (width, PACK_420_10_CHUNK);
+
+    video_orc_unpack_I420_10_uv (uv, su, sv, (n + 1) / 2);
+    if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+      video_orc_unpack_I420_10_trunc (d, sy, uv, n);
+    else
+      video_orc_unpack_I420_10 (d, sy, uv, n);
+
+    d += n * 4;
+    sy += n;
+    su += n / 2;
+    sv += n / 2;
+    width -= n;
+  }
+}
+
+static void
+pack_I420_10_orc (gboolean chroma, guint16 * restrict dy,
+    guint16 * restrict du, guint16 * restrict dv, const guint16 * restrict s,
+    gint width)
+{
+  guint16 u[PACK_420_10_CHUNK], v[PACK_420_10_CHUNK];
+  gint n;
+
+  if (!chroma) {
+    video_orc_pack_I420_10_y (dy, s, width);
+    return;
+  }
+
+  while (width > 0) {
+    n = MIN (width, PACK_420_10_CHUNK);
+
+    video_orc_pack_Y444_10 (dy, u, v, s, n);
+    /* the last chroma sample of an odd width has no right neighbour */
+    if (n & 1)
+      u[n] = v[n] = 0;
+    video_orc_pack_I420_10_uv (du, dv, u, v, (n + 1) / 2);
+
+    dy += n;
+    du += n / 2;
+    dv += n / 2;
+    s += n * 4;
+    width -= n;
   }
 }
 
@@ -2911,39 +3244,47 @@ unpack_I420_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   const guint16 *restrict sy = GET_Y_LINE (y);
   const guint16 *restrict su = GET_U_LINE (uv);
   const guint16 *restrict sv = GET_V_LINE (uv);
-  guint16 *restrict d = dest, Y, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   su += x >> 1;
   sv += x >> 1;
 
-  for (i = 0; i < width; i++) {
-    Y = GST_READ_UINT16_LE (sy + i) << 6;
-    U = GST_READ_UINT16_LE (su + (i >> 1)) << 6;
-    V = GST_READ_UINT16_LE (sv + (i >> 1)) << 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  unpack_I420_10_orc (flags, d, sy, su, sv, x, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y |= (Y >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      Y = GST_READ_UINT16_LE (sy + i) << 6;
+      U = GST_READ_UINT16_LE (su + (i >> 1)) << 6;
+      V = GST_READ_UINT16_LE (sv + (i >> 1)) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y |= (Y >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
 
-    if (x & 1) {
-      x = 0;
-      su++;
-      sv++;
+      if (x & 1) {
+        x = 0;
+        su++;
+        sv++;
+      }
     }
   }
+#endif
 }
 
 static void
@@ -2952,41 +3293,48 @@ pack_I420_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (uv);
   guint16 *restrict dv = GET_V_LINE (uv);
-  guint16 Y0, Y1, U, V;
   const guint16 *restrict s = src;
 
-  if (IS_CHROMA_LINE_420 (y, flags)) {
-    for (i = 0; i < width - 1; i += 2) {
-      Y0 = s[i * 4 + 1] >> 6;
-      Y1 = s[i * 4 + 5] >> 6;
-      U = s[i * 4 + 2] >> 6;
-      V = s[i * 4 + 3] >> 6;
-
-      GST_WRITE_UINT16_LE (dy + i + 0, Y0);
-      GST_WRITE_UINT16_LE (dy + i + 1, Y1);
-      GST_WRITE_UINT16_LE (du + (i >> 1), U);
-      GST_WRITE_UINT16_LE (dv + (i >> 1), V);
-    }
-    if (i == width - 1) {
-      Y0 = s[i * 4 + 1] >> 6;
-      U = s[i * 4 + 2] >> 6;
-      V = s[i * 4 + 3] >> 6;
-
-      GST_WRITE_UINT16_LE (dy + i, Y0);
-      GST_WRITE_UINT16_LE (du + (i >> 1), U);
-      GST_WRITE_UINT16_LE (dv + (i >> 1), V);
-    }
-  } else {
-    for (i = 0; i < width; i++) {
-      Y0 = s[i * 4 + 1] >> 6;
-      GST_WRITE_UINT16_LE (dy + i, Y0);
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  pack_I420_10_orc (IS_CHROMA_LINE_420 (y, flags), dy, du, dv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y0, Y1, U, V;
+
+    if (IS_CHROMA_LINE_420 (y, flags)) {
+      for (i = 0; i < width - 1; i += 2) {
+        Y0 = s[i * 4 + 1] >> 6;
+        Y1 = s[i * 4 + 5] >> 6;
+        U = s[i * 4 + 2] >> 6;
+        V = s[i * 4 + 3] >> 6;
+
+        GST_WRITE_UINT16_LE (dy + i + 0, Y0);
+        GST_WRITE_UINT16_LE (dy + i + 1, Y1);
+        GST_WRITE_UINT16_LE (du + (i >> 1), U);
+        GST_WRITE_UINT16_LE (dv + (i >> 1), V);
+      }
+      if (i == width - 1) {
+        Y0 = s[i * 4 + 1] >> 6;
+        U = s[i * 4 + 2] >> 6;
+        V = s[i * 4 + 3] >> 6;
+
+        GST_WRITE_UINT16_LE (dy + i, Y0);
+        GST_WRITE_UINT16_LE (du + (i >> 1), U);
+        GST_WRITE_UINT16_LE (dv + (i >> 1), V);
+      }
+    } else {
+      for (i = 0; i < width; i++) {
+        Y0 = s[i * 4 + 1] >> 6;
+        GST_WRITE_UINT16_LE (dy + i, Y0);
+      }
     }
   }
+#endif
 }
 
 #define PACK_I420_10BE GST_VIDEO_FORMAT_AYUV64, unpack_I420_10BE, 1, pack_I420_10BE
@@ -2995,39 +3343,47 @@ unpack_I420_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   const guint16 *restrict sy = GET_Y_LINE (y);
   const guint16 *restrict su = GET_U_LINE (uv);
   const guint16 *restrict sv = GET_V_LINE (uv);
-  guint16 *restrict d = dest, Y, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   su += x >> 1;
   sv += x >> 1;
 
-  for (i = 0; i < width; i++) {
-    Y = GST_READ_UINT16_BE (sy + i) << 6;
-    U = GST_READ_UINT16_BE (su + (i >> 1)) << 6;
-    V = GST_READ_UINT16_BE (sv + (i >> 1)) << 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  unpack_I420_10_orc (flags, d, sy, su, sv, x, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y |= (Y >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      Y = GST_READ_UINT16_BE (sy + i) << 6;
+      U = GST_READ_UINT16_BE (su + (i >> 1)) << 6;
+      V = GST_READ_UINT16_BE (sv + (i >> 1)) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y |= (Y >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
 
-    if (x & 1) {
-      x = 0;
-      su++;
-      sv++;
+      if (x & 1) {
+        x = 0;
+        su++;
+        sv++;
+      }
     }
   }
+#endif
 }
 
 static void
@@ -3036,41 +3392,48 @@ pack_I420_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (uv);
   guint16 *restrict dv = GET_V_LINE (uv);
-  guint16 Y0, Y1, U, V;
   const guint16 *restrict s = src;
 
-  if (IS_CHROMA_LINE_420 (y, flags)) {
-    for (i = 0; i < width - 1; i += 2) {
-      Y0 = s[i * 4 + 1] >> 6;
-      Y1 = s[i * 4 + 5] >> 6;
-      U = s[i * 4 + 2] >> 6;
-      V = s[i * 4 + 3] >> 6;
-
-      GST_WRITE_UINT16_BE (dy + i + 0, Y0);
-      GST_WRITE_UINT16_BE (dy + i + 1, Y1);
-      GST_WRITE_UINT16_BE (du + (i >> 1), U);
-      GST_WRITE_UINT16_BE (dv + (i >> 1), V);
-    }
-    if (i == width - 1) {
-      Y0 = s[i * 4 + 1] >> 6;
-      U = s[i * 4 + 2] >> 6;
-      V = s[i * 4 + 3] >> 6;
-
-      GST_WRITE_UINT16_BE (dy + i, Y0);
-      GST_WRITE_UINT16_BE (du + (i >> 1), U);
-      GST_WRITE_UINT16_BE (dv + (i >> 1), V);
-    }
-  } else {
-    for (i = 0; i < width; i++) {
-      Y0 = s[i * 4 + 1] >> 6;
-      GST_WRITE_UINT16_BE (dy + i, Y0);
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  pack_I420_10_orc (IS_CHROMA_LINE_420 (y, flags), dy, du, dv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y0, Y1, U, V;
+
+    if (IS_CHROMA_LINE_420 (y, flags)) {
+      for (i = 0; i < width - 1; i += 2) {
+        Y0 = s[i * 4 + 1] >> 6;
+        Y1 = s[i * 4 + 5] >> 6;
+        U = s[i * 4 + 2] >> 6;
+        V = s[i * 4 + 3] >> 6;
+
+        GST_WRITE_UINT16_BE (dy + i + 0, Y0);
+        GST_WRITE_UINT16_BE (dy + i + 1, Y1);
+        GST_WRITE_UINT16_BE (du + (i >> 1), U);
+        GST_WRITE_UINT16_BE (dv + (i >> 1), V);
+      }
+      if (i == width - 1) {
+        Y0 = s[i * 4 + 1] >> 6;
+        U = s[i * 4 + 2] >> 6;
+        V = s[i * 4 + 3] >> 6;
+
+        GST_WRITE_UINT16_BE (dy + i, Y0);
+        GST_WRITE_UINT16_BE (du + (i >> 1), U);
+        GST_WRITE_UINT16_BE (dv + (i >> 1), V);
+      }
+    } else {
+      for (i = 0; i < width; i++) {
+        Y0 = s[i * 4 + 1] >> 6;
+        GST_WRITE_UINT16_BE (dy + i, Y0);
+      }
     }
   }
+#endif
 }
 
 #define PACK_I422_10LE GST_VIDEO_FORMAT_AYUV64, unpack_I422_10LE, 1, pack_I422_10LE
@@ -3229,32 +3592,43 @@ unpack_Y444_12LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   guint16 *restrict sy = GET_Y_LINE (y);
   guint16 *restrict su = GET_U_LINE (y);
   guint16 *restrict sv = GET_V_LINE (y);
-  guint16 *restrict d = dest, Y, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   su += x;
   sv += x;
 
-  for (i = 0; i < width; i++) {
-    Y = GST_READ_UINT16_LE (sy + i) << 4;
-    U = GST_READ_UINT16_LE (su + i) << 4;
-    V = GST_READ_UINT16_LE (sv + i) << 4;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_12_trunc (d, sy, su, sv, width);
+  else
+    video_orc_unpack_Y444_12 (d, sy, su, sv, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y |= (Y >> 12);
-      U |= (U >> 12);
-      V |= (V >> 12);
-    }
+    for (i = 0; i < width; i++) {
+      Y = GST_READ_UINT16_LE (sy + i) << 4;
+      U = GST_READ_UINT16_LE (su + i) << 4;
+      V = GST_READ_UINT16_LE (sv + i) << 4;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y |= (Y >> 12);
+        U |= (U >> 12);
+        V |= (V >> 12);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -3263,22 +3637,29 @@ pack_Y444_12LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (y);
   guint16 *restrict dv = GET_V_LINE (y);
-  guint16 Y, U, V;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    Y = (s[i * 4 + 1]) >> 4;
-    U = (s[i * 4 + 2]) >> 4;
-    V = (s[i * 4 + 3]) >> 4;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_Y444_12 (dy, du, dv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
+
+    for (i = 0; i < width; i++) {
+      Y = (s[i * 4 + 1]) >> 4;
+      U = (s[i * 4 + 2]) >> 4;
+      V = (s[i * 4 + 3]) >> 4;
 
-    GST_WRITE_UINT16_LE (dy + i, Y);
-    GST_WRITE_UINT16_LE (du + i, U);
-    GST_WRITE_UINT16_LE (dv + i, V);
+      GST_WRITE_UINT16_LE (dy + i, Y);
+      GST_WRITE_UINT16_LE (du + i, U);
+      GST_WRITE_UINT16_LE (dv + i, V);
+    }
   }
+#endif
 }
 
 #define PACK_Y444_12BE GST_VIDEO_FORMAT_AYUV64, unpack_Y444_12BE, 1, pack_Y444_12BE
@@ -3287,32 +3668,43 @@ unpack_Y444_12BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sy = GET_Y_LINE (y);
   const guint16 *restrict su = GET_U_LINE (y);
   const guint16 *restrict sv = GET_V_LINE (y);
-  guint16 *restrict d = dest, Y, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   su += x;
   sv += x;
 
-  for (i = 0; i < width; i++) {
-    Y = GST_READ_UINT16_BE (sy + i) << 4;
-    U = GST_READ_UINT16_BE (su + i) << 4;
-    V = GST_READ_UINT16_BE (sv + i) << 4;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_Y444_12_trunc (d, sy, su, sv, width);
+  else
+    video_orc_unpack_Y444_12 (d, sy, su, sv, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y |= (Y >> 12);
-      U |= (U >> 12);
-      V |= (V >> 12);
-    }
+    for (i = 0; i < width; i++) {
+      Y = GST_READ_UINT16_BE (sy + i) << 4;
+      U = GST_READ_UINT16_BE (su + i) << 4;
+      V = GST_READ_UINT16_BE (sv + i) << 4;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y |= (Y >> 12);
+        U |= (U >> 12);
+        V |= (V >> 12);
+      }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -3321,22 +3713,29 @@ pack_Y444_12BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (y);
   guint16 *restrict dv = GET_V_LINE (y);
-  guint16 Y, U, V;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    Y = s[i * 4 + 1] >> 4;
-    U = s[i * 4 + 2] >> 4;
-    V = s[i * 4 + 3] >> 4;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_Y444_12 (dy, du, dv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y, U, V;
+
+    for (i = 0; i < width; i++) {
+      Y = s[i * 4 + 1] >> 4;
+      U = s[i * 4 + 2] >> 4;
+      V = s[i * 4 + 3] >> 4;
 
-    GST_WRITE_UINT16_BE (dy + i, Y);
-    GST_WRITE_UINT16_BE (du + i, U);
-    GST_WRITE_UINT16_BE (dv + i, V);
+      GST_WRITE_UINT16_BE (dy + i, Y);
+      GST_WRITE_UINT16_BE (du + i, U);
+      GST_WRITE_UINT16_BE (dv + i, V);
+    }
   }
+#endif
 }
 
 #define PACK_I420_12LE GST_VIDEO_FORMAT_AYUV64, unpack_I420_12LE, 1, pack_I420_12LE
@@ -3663,36 +4062,47 @@ unpack_A444_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   guint16 *restrict sa = GET_A_LINE (y);
   guint16 *restrict sy = GET_Y_LINE (y);
   guint16 *restrict su = GET_U_LINE (y);
   guint16 *restrict sv = GET_V_LINE (y);
-  guint16 *restrict d = dest, A, Y, U, V;
+  guint16 *restrict d = dest;
 
   sa += x;
   sy += x;
   su += x;
   sv += x;
 
-  for (i = 0; i < width; i++) {
-    A = GST_READ_UINT16_LE (sa + i) << 6;
-    Y = GST_READ_UINT16_LE (sy + i) << 6;
-    U = GST_READ_UINT16_LE (su + i) << 6;
-    V = GST_READ_UINT16_LE (sv + i) << 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_A444_10_trunc (d, sy, su, sv, sa, width);
+  else
+    video_orc_unpack_A444_10 (d, sy, su, sv, sa, width);
+#else
+  {
+    gint i;
+    guint16 A, Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      A |= (A >> 10);
-      Y |= (Y >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      A = GST_READ_UINT16_LE (sa + i) << 6;
+      Y = GST_READ_UINT16_LE (sy + i) << 6;
+      U = GST_READ_UINT16_LE (su + i) << 6;
+      V = GST_READ_UINT16_LE (sv + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        A |= (A >> 10);
+        Y |= (Y >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    d[i * 4 + 0] = A;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = A;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -3701,25 +4111,32 @@ pack_A444_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict da = GET_A_LINE (y);
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (y);
   guint16 *restrict dv = GET_V_LINE (y);
-  guint16 A, Y, U, V;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    A = (s[i * 4 + 0]) >> 6;
-    Y = (s[i * 4 + 1]) >> 6;
-    U = (s[i * 4 + 2]) >> 6;
-    V = (s[i * 4 + 3]) >> 6;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_A444_10 (dy, du, dv, da, s, width);
+#else
+  {
+    gint i;
+    guint16 A, Y, U, V;
 
-    GST_WRITE_UINT16_LE (da + i, A);
-    GST_WRITE_UINT16_LE (dy + i, Y);
-    GST_WRITE_UINT16_LE (du + i, U);
-    GST_WRITE_UINT16_LE (dv + i, V);
+    for (i = 0; i < width; i++) {
+      A = (s[i * 4 + 0]) >> 6;
+      Y = (s[i * 4 + 1]) >> 6;
+      U = (s[i * 4 + 2]) >> 6;
+      V = (s[i * 4 + 3]) >> 6;
+
+      GST_WRITE_UINT16_LE (da + i, A);
+      GST_WRITE_UINT16_LE (dy + i, Y);
+      GST_WRITE_UINT16_LE (du + i, U);
+      GST_WRITE_UINT16_LE (dv + i, V);
+    }
   }
+#endif
 }
 
 #define PACK_A444_10BE GST_VIDEO_FORMAT_AYUV64, unpack_A444_10BE, 1, pack_A444_10BE
@@ -3728,36 +4145,47 @@ unpack_A444_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   const guint16 *restrict sa = GET_A_LINE (y);
   const guint16 *restrict sy = GET_Y_LINE (y);
   const guint16 *restrict su = GET_U_LINE (y);
   const guint16 *restrict sv = GET_V_LINE (y);
-  guint16 *restrict d = dest, A, Y, U, V;
+  guint16 *restrict d = dest;
 
   sa += x;
   sy += x;
   su += x;
   sv += x;
 
-  for (i = 0; i < width; i++) {
-    A = GST_READ_UINT16_BE (sa + i) << 6;
-    Y = GST_READ_UINT16_BE (sy + i) << 6;
-    U = GST_READ_UINT16_BE (su + i) << 6;
-    V = GST_READ_UINT16_BE (sv + i) << 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+    video_orc_unpack_A444_10_trunc (d, sy, su, sv, sa, width);
+  else
+    video_orc_unpack_A444_10 (d, sy, su, sv, sa, width);
+#else
+  {
+    gint i;
+    guint16 A, Y, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      A |= (A >> 10);
-      Y |= (Y >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    for (i = 0; i < width; i++) {
+      A = GST_READ_UINT16_BE (sa + i) << 6;
+      Y = GST_READ_UINT16_BE (sy + i) << 6;
+      U = GST_READ_UINT16_BE (su + i) << 6;
+      V = GST_READ_UINT16_BE (sv + i) << 6;
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        A |= (A >> 10);
+        Y |= (Y >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    d[i * 4 + 0] = A;
-    d[i * 4 + 1] = Y;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+      d[i * 4 + 0] = A;
+      d[i * 4 + 1] = Y;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -3766,25 +4194,32 @@ pack_A444_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   guint16 *restrict da = GET_A_LINE (y);
   guint16 *restrict dy = GET_Y_LINE (y);
   guint16 *restrict du = GET_U_LINE (y);
   guint16 *restrict dv = GET_V_LINE (y);
-  guint16 A, Y, U, V;
   const guint16 *restrict s = src;
 
-  for (i = 0; i < width; i++) {
-    A = s[i * 4 + 0] >> 6;
-    Y = s[i * 4 + 1] >> 6;
-    U = s[i * 4 + 2] >> 6;
-    V = s[i * 4 + 3] >> 6;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  video_orc_pack_A444_10 (dy, du, dv, da, s, width);
+#else
+  {
+    gint i;
+    guint16 A, Y, U, V;
+
+    for (i = 0; i < width; i++) {
+      A = s[i * 4 + 0] >> 6;
+      Y = s[i * 4 + 1] >> 6;
+      U = s[i * 4 + 2] >> 6;
+      V = s[i * 4 + 3] >> 6;
 
-    GST_WRITE_UINT16_BE (da + i, A);
-    GST_WRITE_UINT16_BE (dy + i, Y);
-    GST_WRITE_UINT16_BE (du + i, U);
-    GST_WRITE_UINT16_BE (dv + i, V);
+      GST_WRITE_UINT16_BE (da + i, A);
+      GST_WRITE_UINT16_BE (dy + i, Y);
+      GST_WRITE_UINT16_BE (du + i, U);
+      GST_WRITE_UINT16_BE (dv + i, V);
+    }
   }
+#endif
 }
 
 #define PACK_A420_10LE GST_VIDEO_FORMAT_AYUV64, unpack_A420_10LE, 1, pack_A420_10LE
@@ -4287,83 +4722,160 @@ pack_NV12_64Z32 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   }
 }
 
-#define PACK_P010_10BE GST_VIDEO_FORMAT_AYUV64, unpack_P010_10BE, 1, pack_P010_10BE
 static void
-unpack_P010_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
-    gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
-    const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
+unpack_P010_orc (GstVideoPackFlags flags, guint16 * restrict d,
+    const guint16 * restrict sy, const guint16 * restrict suv, gint x,
+    gint width)
 {
-  int i;
-  gint uv = GET_UV_420 (y, flags);
-  const guint16 *restrict sy = GET_PLANE_LINE (0, y);
-  const guint16 *restrict suv = GET_PLANE_LINE (1, uv);
-  guint16 *restrict d = dest, Y0, Y1, U, V;
-
-  sy += x;
-  suv += (x & ~1);
+  guint16 uv[PACK_420_10_CHUNK * 2];
+  gint n;
 
   if (x & 1) {
-    Y0 = GST_READ_UINT16_BE (sy);
-    U = GST_READ_UINT16_BE (suv);
-    V = GST_READ_UINT16_BE (suv + 1);
+    guint16 Y = sy[0], U = suv[0], V = suv[1];
 
     if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y0 |= (Y0 >> 10);
+      Y |= (Y >> 10);
       U |= (U >> 10);
       V |= (V >> 10);
     }
-
     d[0] = 0xffff;
-    d[1] = Y0;
+    d[1] = Y;
     d[2] = U;
     d[3] = V;
-    width--;
     d += 4;
-    sy += 1;
+    sy++;
     suv += 2;
+    width--;
   }
 
-  for (i = 0; i < width / 2; i++) {
-    Y0 = GST_READ_UINT16_BE (sy + 2 * i);
-    Y1 = GST_READ_UINT16_BE (sy + 2 * i + 1);
-    U = GST_READ_UINT16_BE (suv + 2 * i);
-    V = GST_READ_UINT16_BE (suv + 2 * i + 1);
+  while (width > 0) {
+    n = MIN (width, PACK_420_10_CHUNK);
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y0 |= (Y0 >> 10);
-      Y1 |= (Y1 >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    video_orc_unpack_P010_uv (uv, suv, (n + 1) / 2);
+    if (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)
+      video_orc_unpack_P010_trunc (d, sy, uv, n);
+    else
+      video_orc_unpack_P010 (d, sy, uv, n);
 
-    d[i * 8 + 0] = 0xffff;
-    d[i * 8 + 1] = Y0;
-    d[i * 8 + 2] = U;
-    d[i * 8 + 3] = V;
-    d[i * 8 + 4] = 0xffff;
-    d[i * 8 + 5] = Y1;
-    d[i * 8 + 6] = U;
-    d[i * 8 + 7] = V;
+    d += n * 4;
+    sy += n;
+    suv += n;
+    width -= n;
   }
+}
 
-  if (width & 1) {
-    gint i = width - 1;
+static void
+pack_P010_orc (gboolean chroma, guint16 * restrict dy, guint16 * restrict duv,
+    const guint16 * restrict s, gint width)
+{
+  guint16 uv[PACK_420_10_CHUNK * 2];
+  gint n;
 
-    Y0 = GST_READ_UINT16_BE (sy + i);
-    U = GST_READ_UINT16_BE (suv + i);
-    V = GST_READ_UINT16_BE (suv + i + 1);
+  if (!chroma) {
+    video_orc_pack_P010_y (dy, s, width);
+    return;
+  }
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y0 |= (Y0 >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
+  while (width > 0) {
+    n = MIN (width, PACK_420_10_CHUNK);
+
+    video_orc_pack_P010 (dy, uv, s, n);
+    if (n & 1)
+      uv[n * 2] = uv[n * 2 + 1] = 0;
+    video_orc_pack_P010_uv (duv, uv, (n + 1) / 2);
+
+    dy += n;
+    duv += n;
+    s += n * 4;
+    width -= n;
+  }
+}
+
+#define PACK_P010_10BE GST_VIDEO_FORMAT_AYUV64, unpack_P010_10BE, 1, pack_P010_10BE
+static void
+unpack_P010_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
+    gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
+    const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
+{
+  gint uv = GET_UV_420 (y, flags);
+  const guint16 *restrict sy = GET_PLANE_LINE (0, y);
+  const guint16 *restrict suv = GET_PLANE_LINE (1, uv);
+  guint16 *restrict d = dest;
+
+  sy += x;
+  suv += (x & ~1);
+
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  unpack_P010_orc (flags, d, sy, suv, x, width);
+#else
+  {
+    gint i;
+    guint16 Y0, Y1, U, V;
+
+    if (x & 1) {
+      Y0 = GST_READ_UINT16_BE (sy);
+      U = GST_READ_UINT16_BE (suv);
+      V = GST_READ_UINT16_BE (suv + 1);
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y0 |= (Y0 >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
+
+      d[0] = 0xffff;
+      d[1] = Y0;
+      d[2] = U;
+      d[3] = V;
+      width--;
+      d += 4;
+      sy += 1;
+      suv += 2;
     }
 
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y0;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
+    for (i = 0; i < width / 2; i++) {
+      Y0 = GST_READ_UINT16_BE (sy + 2 * i);
+      Y1 = GST_READ_UINT16_BE (sy + 2 * i + 1);
+      U = GST_READ_UINT16_BE (suv + 2 * i);
+      V = GST_READ_UINT16_BE (suv + 2 * i + 1);
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y0 |= (Y0 >> 10);
+        Y1 |= (Y1 >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
+
+      d[i * 8 + 0] = 0xffff;
+      d[i * 8 + 1] = Y0;
+      d[i * 8 + 2] = U;
+      d[i * 8 + 3] = V;
+      d[i * 8 + 4] = 0xffff;
+      d[i * 8 + 5] = Y1;
+      d[i * 8 + 6] = U;
+      d[i * 8 + 7] = V;
+    }
+
+    if (width & 1) {
+      gint i = width - 1;
+
+      Y0 = GST_READ_UINT16_BE (sy + i);
+      U = GST_READ_UINT16_BE (suv + i);
+      V = GST_READ_UINT16_BE (suv + i + 1);
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y0 |= (Y0 >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
+
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y0;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
+    }
   }
+#endif
 }
 
 static void
@@ -4372,42 +4884,49 @@ pack_P010_10BE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   guint16 *restrict dy = GET_PLANE_LINE (0, y);
   guint16 *restrict duv = GET_PLANE_LINE (1, uv);
-  guint16 Y0, Y1, U, V;
   const guint16 *restrict s = src;
 
-  if (IS_CHROMA_LINE_420 (y, flags)) {
-    for (i = 0; i < width / 2; i++) {
-      Y0 = s[i * 8 + 1] & 0xffc0;
-      Y1 = s[i * 8 + 5] & 0xffc0;
-      U = s[i * 8 + 2] & 0xffc0;
-      V = s[i * 8 + 3] & 0xffc0;
-
-      GST_WRITE_UINT16_BE (dy + i * 2 + 0, Y0);
-      GST_WRITE_UINT16_BE (dy + i * 2 + 1, Y1);
-      GST_WRITE_UINT16_BE (duv + i * 2 + 0, U);
-      GST_WRITE_UINT16_BE (duv + i * 2 + 1, V);
-    }
-    if (width & 1) {
-      gint i = width - 1;
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+  pack_P010_orc (IS_CHROMA_LINE_420 (y, flags), dy, duv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y0, Y1, U, V;
 
-      Y0 = s[i * 4 + 1] & 0xffc0;
-      U = s[i * 4 + 2] & 0xffc0;
-      V = s[i * 4 + 3] & 0xffc0;
+    if (IS_CHROMA_LINE_420 (y, flags)) {
+      for (i = 0; i < width / 2; i++) {
+        Y0 = s[i * 8 + 1] & 0xffc0;
+        Y1 = s[i * 8 + 5] & 0xffc0;
+        U = s[i * 8 + 2] & 0xffc0;
+        V = s[i * 8 + 3] & 0xffc0;
+
+        GST_WRITE_UINT16_BE (dy + i * 2 + 0, Y0);
+        GST_WRITE_UINT16_BE (dy + i * 2 + 1, Y1);
+        GST_WRITE_UINT16_BE (duv + i * 2 + 0, U);
+        GST_WRITE_UINT16_BE (duv + i * 2 + 1, V);
+      }
+      if (width & 1) {
+        gint i = width - 1;
 
-      GST_WRITE_UINT16_BE (dy + i, Y0);
-      GST_WRITE_UINT16_BE (duv + i + 0, U);
-      GST_WRITE_UINT16_BE (duv + i + 1, V);
-    }
-  } else {
-    for (i = 0; i < width; i++) {
-      Y0 = s[i * 4 + 1] & 0xffc0;
-      GST_WRITE_UINT16_BE (dy + i, Y0);
+        Y0 = s[i * 4 + 1] & 0xffc0;
+        U = s[i * 4 + 2] & 0xffc0;
+        V = s[i * 4 + 3] & 0xffc0;
+
+        GST_WRITE_UINT16_BE (dy + i, Y0);
+        GST_WRITE_UINT16_BE (duv + i + 0, U);
+        GST_WRITE_UINT16_BE (duv + i + 1, V);
+      }
+    } else {
+      for (i = 0; i < width; i++) {
+        Y0 = s[i * 4 + 1] & 0xffc0;
+        GST_WRITE_UINT16_BE (dy + i, Y0);
+      }
     }
   }
+#endif
 }
 
 #define PACK_P010_10LE GST_VIDEO_FORMAT_AYUV64, unpack_P010_10LE, 1, pack_P010_10LE
@@ -4416,77 +4935,85 @@ unpack_P010_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   const guint16 *restrict sy = GET_PLANE_LINE (0, y);
   const guint16 *restrict suv = GET_PLANE_LINE (1, uv);
-  guint16 *restrict d = dest, Y0, Y1, U, V;
+  guint16 *restrict d = dest;
 
   sy += x;
   suv += (x & ~1);
 
-  if (x & 1) {
-    Y0 = GST_READ_UINT16_LE (sy);
-    U = GST_READ_UINT16_LE (suv);
-    V = GST_READ_UINT16_LE (suv + 1);
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  unpack_P010_orc (flags, d, sy, suv, x, width);
+#else
+  {
+    gint i;
+    guint16 Y0, Y1, U, V;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y0 |= (Y0 >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
-    }
+    if (x & 1) {
+      Y0 = GST_READ_UINT16_LE (sy);
+      U = GST_READ_UINT16_LE (suv);
+      V = GST_READ_UINT16_LE (suv + 1);
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y0 |= (Y0 >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    d[0] = 0xffff;
-    d[1] = Y0;
-    d[2] = U;
-    d[3] = V;
-    width--;
-    d += 4;
-    sy += 1;
-    suv += 2;
-  }
+      d[0] = 0xffff;
+      d[1] = Y0;
+      d[2] = U;
+      d[3] = V;
+      width--;
+      d += 4;
+      sy += 1;
+      suv += 2;
+    }
 
-  for (i = 0; i < width / 2; i++) {
-    Y0 = GST_READ_UINT16_LE (sy + 2 * i);
-    Y1 = GST_READ_UINT16_LE (sy + 2 * i + 1);
-    U = GST_READ_UINT16_LE (suv + 2 * i);
-    V = GST_READ_UINT16_LE (suv + 2 * i + 1);
+    for (i = 0; i < width / 2; i++) {
+      Y0 = GST_READ_UINT16_LE (sy + 2 * i);
+      Y1 = GST_READ_UINT16_LE (sy + 2 * i + 1);
+      U = GST_READ_UINT16_LE (suv + 2 * i);
+      V = GST_READ_UINT16_LE (suv + 2 * i + 1);
+
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y0 |= (Y0 >> 10);
+        Y1 |= (Y1 >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y0 |= (Y0 >> 10);
-      Y1 |= (Y1 >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
+      d[i * 8 + 0] = 0xffff;
+      d[i * 8 + 1] = Y0;
+      d[i * 8 + 2] = U;
+      d[i * 8 + 3] = V;
+      d[i * 8 + 4] = 0xffff;
+      d[i * 8 + 5] = Y1;
+      d[i * 8 + 6] = U;
+      d[i * 8 + 7] = V;
     }
 
-    d[i * 8 + 0] = 0xffff;
-    d[i * 8 + 1] = Y0;
-    d[i * 8 + 2] = U;
-    d[i * 8 + 3] = V;
-    d[i * 8 + 4] = 0xffff;
-    d[i * 8 + 5] = Y1;
-    d[i * 8 + 6] = U;
-    d[i * 8 + 7] = V;
-  }
+    if (width & 1) {
+      gint i = width - 1;
 
-  if (width & 1) {
-    gint i = width - 1;
+      Y0 = GST_READ_UINT16_LE (sy + i);
+      U = GST_READ_UINT16_LE (suv + i);
+      V = GST_READ_UINT16_LE (suv + i + 1);
 
-    Y0 = GST_READ_UINT16_LE (sy + i);
-    U = GST_READ_UINT16_LE (suv + i);
-    V = GST_READ_UINT16_LE (suv + i + 1);
+      if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+        Y0 |= (Y0 >> 10);
+        U |= (U >> 10);
+        V |= (V >> 10);
+      }
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      Y0 |= (Y0 >> 10);
-      U |= (U >> 10);
-      V |= (V >> 10);
+      d[i * 4 + 0] = 0xffff;
+      d[i * 4 + 1] = Y0;
+      d[i * 4 + 2] = U;
+      d[i * 4 + 3] = V;
     }
-
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = Y0;
-    d[i * 4 + 2] = U;
-    d[i * 4 + 3] = V;
   }
+#endif
 }
 
 static void
@@ -4495,42 +5022,49 @@ pack_P010_10LE (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
-  int i;
   gint uv = GET_UV_420 (y, flags);
   guint16 *restrict dy = GET_PLANE_LINE (0, y);
   guint16 *restrict duv = GET_PLANE_LINE (1, uv);
-  guint16 Y0, Y1, U, V;
   const guint16 *restrict s = src;
 
-  if (IS_CHROMA_LINE_420 (y, flags)) {
-    for (i = 0; i < width / 2; i++) {
-      Y0 = s[i * 8 + 1] & 0xffc0;
-      Y1 = s[i * 8 + 5] & 0xffc0;
-      U = s[i * 8 + 2] & 0xffc0;
-      V = s[i * 8 + 3] & 0xffc0;
-
-      GST_WRITE_UINT16_LE (dy + i * 2 + 0, Y0);
-      GST_WRITE_UINT16_LE (dy + i * 2 + 1, Y1);
-      GST_WRITE_UINT16_LE (duv + i * 2 + 0, U);
-      GST_WRITE_UINT16_LE (duv + i * 2 + 1, V);
-    }
-    if (width & 1) {
-      gint i = width - 1;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  pack_P010_orc (IS_CHROMA_LINE_420 (y, flags), dy, duv, s, width);
+#else
+  {
+    gint i;
+    guint16 Y0, Y1, U, V;
 
-      Y0 = s[i * 4 + 1] & 0xffc0;
-      U = s[i * 4 + 2] & 0xffc0;
-      V = s[i * 4 + 3] & 0xffc0;
+    if (IS_CHROMA_LINE_420 (y, flags)) {
+      for (i = 0; i < width / 2; i++) {
+        Y0 = s[i * 8 + 1] & 0xffc0;
+        Y1 = s[i * 8 + 5] & 0xffc0;
+        U = s[i * 8 + 2] & 0xffc0;
+        V = s[i * 8 + 3] & 0xffc0;
+
+        GST_WRITE_UINT16_LE (dy + i * 2 + 0, Y0);
+        GST_WRITE_UINT16_LE (dy + i * 2 + 1, Y1);
+        GST_WRITE_UINT16_LE (duv + i * 2 + 0, U);
+        GST_WRITE_UINT16_LE (duv + i * 2 + 1, V);
+      }
+      if (width & 1) {
+        gint i = width - 1;
 
-      GST_WRITE_UINT16_LE (dy + i, Y0);
-      GST_WRITE_UINT16_LE (duv + i + 0, U);
-      GST_WRITE_UINT16_LE (duv + i + 1, V);
-    }
-  } else {
-    for (i = 0; i < width; i++) {
-      Y0 = s[i * 4 + 1] & 0xffc0;
-      GST_WRITE_UINT16_LE (dy + i, Y0);
+        Y0 = s[i * 4 + 1] & 0xffc0;
+        U = s[i * 4 + 2] & 0xffc0;
+        V = s[i * 4 + 3] & 0xffc0;
+
+        GST_WRITE_UINT16_LE (dy + i, Y0);
+        GST_WRITE_UINT16_LE (duv + i + 0, U);
+        GST_WRITE_UINT16_LE (duv + i + 1, V);
+      }
+    } else {
+      for (i = 0; i < width; i++) {
+        Y0 = s[i * 4 + 1] & 0xffc0;
+        GST_WRITE_UINT16_LE (dy + i, Y0);
+      }
     }
   }
+#endif
 }
 
 typedef struct
@@ -271,6 +271,52 @@ gst_video_frame_unmap (GstVideoFrame * frame)
     gst_buffer_unref (frame->buffer);
 }
 
+/* copy @h lines of @w bytes */
+static void
+video_frame_copy_lines (guint8 * dp, gint ds, const guint8 * sp, gint ss,
+    guint w, guint h)
+{
+  guint j;
+
+  if (h == 0 || (dp == sp && ds == ss))
+    return;
+
+  /* when the lines are contiguous in both planes, copy the whole plane in
+   * one go instead of line by line. With padding between the lines this
+   * would overwrite the padding of the destination, which can belong to
+   * another view of the same memory */
+  if (ds == ss && ss > 0 && (guint) ss == w) {
+    memcpy (dp, sp, (gsize) ss * (h - 1) + w);
+    return;
+  }
+
+  for (j = 0; j < h; j++) {
+    memcpy (dp, sp, w);
+    dp += ds;
+    sp += ss;
+  }
+}
+
+/* number of bytes per line to copy for a non-tiled plane */
+static guint
+video_frame_plane_line_size (const GstVideoFrame * dest,
+    const GstVideoFrame * src, guint plane)
+{
+  guint w;
+
+  /* FIXME: assumes subsampling of component N is the same as plane N, which is
+   * currently true for all formats we have but it might not be in the future. */
+  w = GST_VIDEO_FRAME_COMP_WIDTH (dest,
+      plane) * GST_VIDEO_FRAME_COMP_PSTRIDE (dest, plane);
+  /* FIXME: workaround for complex formats like v210, UYVP and IYU1 that have
+   * pstride == 0 */
+  if (w == 0)
+    w = MIN (GST_VIDEO_INFO_PLANE_STRIDE (&dest->info, plane),
+        GST_VIDEO_INFO_PLANE_STRIDE (&src->info, plane));
+
+  return w;
+}
+
 /**
  * gst_video_frame_copy_plane:
  * @dest: a #GstVideoFrame
@@ -315,16 +361,7 @@ gst_video_frame_copy_plane (GstVideoFrame * dest, const GstVideoFrame * src,
     return TRUE;
   }
 
-  /* FIXME: assumes subsampling of component N is the same as plane N, which is
-   * currently true for all formats we have but it might not be in the future. */
-  w = GST_VIDEO_FRAME_COMP_WIDTH (dest,
-      plane) * GST_VIDEO_FRAME_COMP_PSTRIDE (dest, plane);
-  /* FIXME: workaround for complex formats like v210, UYVP and IYU1 that have
-   * pstride == 0 */
-  if (w == 0)
-    w = MIN (GST_VIDEO_INFO_PLANE_STRIDE (dinfo, plane),
-        GST_VIDEO_INFO_PLANE_STRIDE (sinfo, plane));
-
+  w = video_frame_plane_line_size (dest, src, plane);
   h = GST_VIDEO_FRAME_COMP_HEIGHT (dest, plane);
 
   ss = GST_VIDEO_INFO_PLANE_STRIDE (sinfo, plane);
@@ -367,15 +404,9 @@ gst_video_frame_copy_plane (GstVideoFrame * dest, const GstVideoFrame * src,
       }
     }
   } else {
-    guint j;
-
     GST_CAT_DEBUG (CAT_PERFORMANCE, "copy plane %d, w:%d h:%d ", plane, w, h);
 
-    for (j = 0; j < h; j++) {
-      memcpy (dp, sp, w);
-      dp += ds;
-      sp += ss;
-    }
+    video_frame_copy_lines (dp, ds, sp, ss, w, h);
   }
 
   return TRUE;
@@ -414,3 +445,160 @@ gst_video_frame_copy (GstVideoFrame * dest, const GstVideoFrame * src)
 
   return TRUE;
 }
+
+/* planes are only split over threads when every thread gets at least this
+ * many bytes to copy */
+#define COPY_THREADED_MIN_SIZE (256 * 1024)
+
+typedef struct
+{
+  guint8 *dp;
+  const guint8 *sp;
+  gint ds, ss;
+  guint w, h;
+
+  GMutex *lock;
+  GCond *cond;
+  guint *pending;
+} VideoFrameCopyTask;
+
+static void
+video_frame_copy_task_func (VideoFrameCopyTask * task, gpointer user_data)
+{
+  video_frame_copy_lines (task->dp, task->ds, task->sp, task->ss, task->w,
+      task->h);
+
+  g_mutex_lock (task->lock);
+  if (--*task->pending == 0)
+    g_cond_signal (task->cond);
+  g_mutex_unlock (task->lock);
+}
+
+static GThreadPool *
+video_frame_get_copy_pool (void)
+{
+  static gsize pool = 0;
+
+  if (g_once_init_enter (&pool)) {
+    GThreadPool *p;
+
+    p = g_thread_pool_new ((GFunc) video_frame_copy_task_func, NULL,
+        g_get_num_processors (), FALSE, NULL);
+    g_once_init_leave (&pool, (gsize) p);
+  }
+
+  return (GThreadPool *) pool;
+}
+
+/**
+ * gst_video_frame_copy_threaded:
+ * @dest: a #GstVideoFrame
+ * @src: a #GstVideoFrame
+ * @n_threads: the maximum number of threads to use or 0 to use one thread
+ *     per CPU
+ *
+ * Copy the contents from @src to @dest like gst_video_frame_copy() but
+ * split the copy of large planes over up to @n_threads threads.
+ *
+ * Returns: TRUE if the contents could be copied.
+ *
+ * Since: 1.12
+ */
+gboolean
+gst_video_frame_copy_threaded (GstVideoFrame * dest,
+    const GstVideoFrame * src, guint n_threads)
+{
+  const GstVideoFormatInfo *finfo;
+  VideoFrameCopyTask *tasks;
+  GThreadPool *pool = NULL;
+  GMutex lock;
+  GCond cond;
+  guint i, n_planes, pending;
+
+  g_return_val_if_fail (dest != NULL, FALSE);
+  g_return_val_if_fail (src != NULL, FALSE);
+  g_return_val_if_fail (dest->info.finfo->format == src->info.finfo->format,
+      FALSE);
+  g_return_val_if_fail (dest->info.width == src->info.width
+      && dest->info.height == src->info.height, FALSE);
+
+  if (n_threads == 0 || n_threads > g_get_num_processors ())
+    n_threads = g_get_num_processors ();
+
+  finfo = dest->info.finfo;
+  n_planes = finfo->n_planes;
+
+  if (n_threads < 2 || GST_VIDEO_FORMAT_INFO_IS_TILED (finfo))
+    return gst_video_frame_copy (dest, src);
+
+  tasks = g_newa (VideoFrameCopyTask, n_threads);
+  g_mutex_init (&lock);
+  g_cond_init (&cond);
+
+  for (i = 0; i < n_planes; i++) {
+    guint8 *dp;
+    const guint8 *sp;
+    guint w, h, n, j, lines;
+    gint ds, ss;
+
+    if (GST_VIDEO_FORMAT_INFO_HAS_PALETTE (finfo) && i == 1) {
+      gst_video_frame_copy_plane (dest, src, i);
+      continue;
+    }
+
+    w = video_frame_plane_line_size (dest, src, i);
+    h = GST_VIDEO_FRAME_COMP_HEIGHT (dest, i);
+
+    n = MIN (n_threads, ((gsize) w * h) / COPY_THREADED_MIN_SIZE);
+    n = MIN (n, h);
+    if (n < 2) {
+      gst_video_frame_copy_plane (dest, src, i);
+      continue;
+    }
+
+    dp = dest->data[i];
+    sp = src->data[i];
+    ds = GST_VIDEO_FRAME_PLANE_STRIDE (dest, i);
+    ss = GST_VIDEO_FRAME_PLANE_STRIDE (src, i);
+
+    GST_CAT_DEBUG (CAT_PERFORMANCE, "copy plane %d, w:%d h:%d with %d threads",
+        i, w, h, n);
+
+    if (pool == NULL)
+      pool = video_frame_get_copy_pool ();
+
+    pending = n - 1;
+    for (j = 0; j < n; j++) {
+      VideoFrameCopyTask *task = &tasks[j];
+      guint y = j * h / n;
+
+      lines = (j + 1) * h / n - y;
+
+      task->dp = dp + (gsize) y * ds;
+      task->sp = sp + (gsize) y * ss;
+      task->ds = ds;
+      task->ss = ss;
+      task->w = w;
+      task->h = lines;
+      task->lock = &lock;
+      task->cond = &cond;
+      task->pending = &pending;
+
+      /* the last part is copied from this thread */
+      if (j < n - 1)
+        g_thread_pool_push (pool, task, NULL);
+      else
+        video_frame_copy_lines (task->dp, ds, task->sp, ss, w, lines);
+    }
+
+    g_mutex_lock (&lock);
+    while (pending > 0)
+      g_cond_wait (&cond, &lock);
+    g_mutex_unlock (&lock);
+  }
+
+  g_cond_clear (&cond);
+  g_mutex_clear (&lock);
+
+  return TRUE;
+}
@@ -93,6 +93,8 @@ void        gst_video_frame_unmap         (GstVideoFrame *frame);
 gboolean    gst_video_frame_copy          (GstVideoFrame *dest, const GstVideoFrame *src);
 gboolean    gst_video_frame_copy_plane    (GstVideoFrame *dest, const GstVideoFrame *src,
                                            guint plane);
+gboolean    gst_video_frame_copy_threaded (GstVideoFrame *dest, const GstVideoFrame *src,
+                                           guint n_threads);
 
 /* general info */
 #define GST_VIDEO_FRAME_FORMAT(f)         (GST_VIDEO_INFO_FORMAT(&(f)->info))
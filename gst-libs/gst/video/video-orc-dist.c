@@ -135,6 +135,65 @@ void video_orc_unpack_Y444 (guint8 * ORC_RESTRICT d1,
     const guint8 * ORC_RESTRICT s3, int n);
 void video_orc_pack_Y444 (guint8 * ORC_RESTRICT d1, guint8 * ORC_RESTRICT d2,
     guint8 * ORC_RESTRICT d3, const guint8 * ORC_RESTRICT s1, int n);
+void video_orc_unpack_Y444_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n);
+void video_orc_unpack_Y444_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n);
+void video_orc_pack_Y444_10 (guint16 * ORC_RESTRICT d1,
+    guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_unpack_Y444_12 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n);
+void video_orc_unpack_Y444_12_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n);
+void video_orc_pack_Y444_12 (guint16 * ORC_RESTRICT d1,
+    guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_unpack_A444_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n);
+void video_orc_unpack_A444_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n);
+void video_orc_pack_A444_10 (guint16 * ORC_RESTRICT d1,
+    guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3,
+    guint16 * ORC_RESTRICT d4, const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_unpack_A444_12 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n);
+void video_orc_unpack_A444_12_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n);
+void video_orc_pack_A444_12 (guint16 * ORC_RESTRICT d1,
+    guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3,
+    guint16 * ORC_RESTRICT d4, const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_unpack_I420_10_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n);
+void video_orc_unpack_I420_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n);
+void video_orc_unpack_I420_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n);
+void video_orc_pack_I420_10_y (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_pack_I420_10_uv (guint16 * ORC_RESTRICT d1,
+    guint16 * ORC_RESTRICT d2, const guint16 * ORC_RESTRICT s1,
+    const guint16 * ORC_RESTRICT s2, int n);
+void video_orc_unpack_P010_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_unpack_P010 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n);
+void video_orc_unpack_P010_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n);
+void video_orc_pack_P010 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_pack_P010_y (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_orc_pack_P010_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n);
 void video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
     const guint8 * ORC_RESTRICT s1, int n);
 void video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1,
@@ -347,6 +406,9 @@ void video_orc_matrix8 (guint8 * ORC_RESTRICT d1,
 void _custom_video_orc_matrix8 (guint8 * ORC_RESTRICT d1,
     const guint8 * ORC_RESTRICT s1, orc_int64 p1, orc_int64 p2, orc_int64 p3,
     orc_int64 p4, int n);
+void video_orc_matrix16 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, orc_int64 p1, orc_int64 p2, orc_int64 p3,
+    orc_int64 p4, int p5, int p6, int p7, int p8, int n);
 void video_orc_resample_h_near_u32_lq (guint32 * ORC_RESTRICT d1,
     const guint32 * ORC_RESTRICT s1, int p1, int p2, int n);
 void video_orc_resample_h_2tap_1u8_lq (guint8 * ORC_RESTRICT d1,
@@ -4599,116 +4661,176 @@ video_orc_pack_Y444 (guint8 * ORC_RESTRICT d1, guint8 * ORC_RESTRICT d2,
 #endif
 
 
-/* video_orc_unpack_GRAY8 */
+/* video_orc_unpack_Y444_10 */
 #ifdef DISABLE_ORC
 void
-video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
-    const guint8 * ORC_RESTRICT s1, int n)
+video_orc_unpack_Y444_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
 {
   int i;
-  orc_union32 *ORC_RESTRICT ptr0;
-  const orc_int8 *ORC_RESTRICT ptr4;
-#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
-  volatile orc_int8 var33;
-#else
-  orc_int8 var33;
-#endif
-  orc_int8 var34;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
 #if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
-  volatile orc_union16 var35;
+  volatile orc_union16 var36;
 #else
-  orc_union16 var35;
+  orc_union16 var36;
 #endif
-  orc_union32 var36;
   orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
 
-  ptr0 = (orc_union32 *) d1;
-  ptr4 = (orc_int8 *) s1;
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
 
-  /* 0: loadpb */
-  var33 = (int) 0x000000ff;     /* 255 or 1.25987e-321f */
-  /* 3: loadpw */
-  var35.i = (int) 0x00008080;   /* 32896 or 1.62528e-319f */
+  /* 0: loadpw */
+  var36.i = (int) 0x000003ff;   /* 1023 or 5.05429e-321f */
 
   for (i = 0; i < n; i++) {
-    /* 1: loadb */
-    var34 = ptr4[i];
-    /* 2: mergebw */
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
     {
-      orc_union16 _dest;
-      _dest.x2[0] = var33;
-      _dest.x2[1] = var34;
-      var37.i = _dest.i;
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
     }
-    /* 4: mergewl */
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
     {
       orc_union32 _dest;
-      _dest.x2[0] = var37.i;
-      _dest.x2[1] = var35.i;
-      var36.i = _dest.i;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
     }
-    /* 5: storel */
-    ptr0[i] = var36;
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 6;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 6;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 6;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 6;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 10;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 10;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 10;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 10;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
   }
 
 }
 
 #else
 static void
-_backup_video_orc_unpack_GRAY8 (OrcExecutor * ORC_RESTRICT ex)
+_backup_video_orc_unpack_Y444_10 (OrcExecutor * ORC_RESTRICT ex)
 {
   int i;
   int n = ex->n;
-  orc_union32 *ORC_RESTRICT ptr0;
-  const orc_int8 *ORC_RESTRICT ptr4;
-#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
-  volatile orc_int8 var33;
-#else
-  orc_int8 var33;
-#endif
-  orc_int8 var34;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
 #if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
-  volatile orc_union16 var35;
+  volatile orc_union16 var36;
 #else
-  orc_union16 var35;
+  orc_union16 var36;
 #endif
-  orc_union32 var36;
   orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
 
-  ptr0 = (orc_union32 *) ex->arrays[0];
-  ptr4 = (orc_int8 *) ex->arrays[4];
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
 
-  /* 0: loadpb */
-  var33 = (int) 0x000000ff;     /* 255 or 1.25987e-321f */
-  /* 3: loadpw */
-  var35.i = (int) 0x00008080;   /* 32896 or 1.62528e-319f */
+  /* 0: loadpw */
+  var36.i = (int) 0x000003ff;   /* 1023 or 5.05429e-321f */
 
   for (i = 0; i < n; i++) {
-    /* 1: loadb */
-    var34 = ptr4[i];
-    /* 2: mergebw */
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
     {
-      orc_union16 _dest;
-      _dest.x2[0] = var33;
-      _dest.x2[1] = var34;
-      var37.i = _dest.i;
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
     }
-    /* 4: mergewl */
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
     {
       orc_union32 _dest;
-      _dest.x2[0] = var37.i;
-      _dest.x2[1] = var35.i;
-      var36.i = _dest.i;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
     }
-    /* 5: storel */
-    ptr0[i] = var36;
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 6;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 6;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 6;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 6;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 10;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 10;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 10;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 10;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
   }
 
 }
 
 void
-video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
-    const guint8 * ORC_RESTRICT s1, int n)
+video_orc_unpack_Y444_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
 {
   OrcExecutor _ex, *ex = &_ex;
   static volatile int p_inited = 0;
@@ -4722,26 +4844,43 @@ video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
 
 #if 1
       static const orc_uint8 bc[] = {
-        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
-        97, 99, 107, 95, 71, 82, 65, 89, 56, 11, 4, 4, 12, 1, 1, 14,
-        1, 255, 0, 0, 0, 14, 2, 128, 128, 0, 0, 20, 2, 196, 32, 16,
-        4, 195, 0, 32, 17, 2, 0,
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 89, 52, 52, 52, 95, 49, 48, 11, 8, 8, 12, 2,
+        2, 12, 2, 2, 12, 2, 2, 14, 2, 255, 3, 0, 0, 14, 2, 6,
+        0, 0, 0, 14, 2, 10, 0, 0, 0, 20, 4, 20, 4, 20, 8, 20,
+        8, 195, 32, 16, 4, 195, 33, 5, 6, 194, 34, 32, 33, 21, 2, 93,
+        34, 34, 17, 21, 2, 95, 35, 34, 18, 21, 2, 92, 0, 34, 35, 2,
+        0,
       };
       p = orc_program_new_from_static_bytecode (bc);
-      orc_program_set_backup_function (p, _backup_video_orc_unpack_GRAY8);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_Y444_10);
 #else
       p = orc_program_new ();
-      orc_program_set_name (p, "video_orc_unpack_GRAY8");
-      orc_program_set_backup_function (p, _backup_video_orc_unpack_GRAY8);
-      orc_program_add_destination (p, 4, "d1");
-      orc_program_add_source (p, 1, "s1");
-      orc_program_add_constant (p, 1, 0x000000ff, "c1");
-      orc_program_add_constant (p, 2, 0x00008080, "c2");
-      orc_program_add_temporary (p, 2, "t1");
+      orc_program_set_name (p, "video_orc_unpack_Y444_10");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_Y444_10);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 2, 0x000003ff, "c1");
+      orc_program_add_constant (p, 2, 0x00000006, "c2");
+      orc_program_add_constant (p, 2, 0x0000000a, "c3");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+      orc_program_add_temporary (p, 8, "t4");
 
-      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_C2,
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_C3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 2, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T4,
           ORC_VAR_D1);
 #endif
 
@@ -4758,6 +4897,8 @@ video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
   ex->n = n;
   ex->arrays[ORC_VAR_D1] = d1;
   ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
 
   func = c->exec;
   func (ex);
@@ -4765,84 +4906,154 @@ video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
 #endif
 
 
-/* video_orc_pack_GRAY8 */
+/* video_orc_unpack_Y444_10_trunc */
 #ifdef DISABLE_ORC
 void
-video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    int n)
+video_orc_unpack_Y444_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
 {
   int i;
-  orc_int8 *ORC_RESTRICT ptr0;
-  const orc_union32 *ORC_RESTRICT ptr4;
-  orc_union32 var33;
-  orc_int8 var34;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
   orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union16 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
 
-  ptr0 = (orc_int8 *) d1;
-  ptr4 = (orc_union32 *) s1;
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
 
+  /* 2: loadpw */
+  var36.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
 
   for (i = 0; i < n; i++) {
-    /* 0: loadl */
-    var33 = ptr4[i];
-    /* 1: select0lw */
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 1: shlw */
+    var40.i = ((orc_uint16) var35.i) << 6;
+    /* 3: mergewl */
     {
-      orc_union32 _src;
-      _src.i = var33.i;
-      var35.i = _src.x2[0];
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var40.i;
+      var41.i = _dest.i;
     }
-    /* 2: select1wb */
+    /* 4: loadw */
+    var37 = ptr5[i];
+    /* 5: loadw */
+    var38 = ptr6[i];
+    /* 6: mergewl */
     {
-      orc_union16 _src;
-      _src.i = var35.i;
-      var34 = _src.x2[1];
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var42.i = _dest.i;
     }
-    /* 3: storeb */
-    ptr0[i] = var34;
+    /* 7: shlw */
+    var43.x2[0] = ((orc_uint16) var42.x2[0]) << 6;
+    var43.x2[1] = ((orc_uint16) var42.x2[1]) << 6;
+    /* 8: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var43.i;
+      var39.i = _dest.i;
+    }
+    /* 9: storeq */
+    ptr0[i] = var39;
   }
 
 }
 
 #else
 static void
-_backup_video_orc_pack_GRAY8 (OrcExecutor * ORC_RESTRICT ex)
+_backup_video_orc_unpack_Y444_10_trunc (OrcExecutor * ORC_RESTRICT ex)
 {
   int i;
   int n = ex->n;
-  orc_int8 *ORC_RESTRICT ptr0;
-  const orc_union32 *ORC_RESTRICT ptr4;
-  orc_union32 var33;
-  orc_int8 var34;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
   orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union16 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
 
-  ptr0 = (orc_int8 *) ex->arrays[0];
-  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
 
+  /* 2: loadpw */
+  var36.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
 
   for (i = 0; i < n; i++) {
-    /* 0: loadl */
-    var33 = ptr4[i];
-    /* 1: select0lw */
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 1: shlw */
+    var40.i = ((orc_uint16) var35.i) << 6;
+    /* 3: mergewl */
     {
-      orc_union32 _src;
-      _src.i = var33.i;
-      var35.i = _src.x2[0];
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var40.i;
+      var41.i = _dest.i;
     }
-    /* 2: select1wb */
+    /* 4: loadw */
+    var37 = ptr5[i];
+    /* 5: loadw */
+    var38 = ptr6[i];
+    /* 6: mergewl */
     {
-      orc_union16 _src;
-      _src.i = var35.i;
-      var34 = _src.x2[1];
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var42.i = _dest.i;
     }
-    /* 3: storeb */
-    ptr0[i] = var34;
+    /* 7: shlw */
+    var43.x2[0] = ((orc_uint16) var42.x2[0]) << 6;
+    var43.x2[1] = ((orc_uint16) var42.x2[1]) << 6;
+    /* 8: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var43.i;
+      var39.i = _dest.i;
+    }
+    /* 9: storeq */
+    ptr0[i] = var39;
   }
 
 }
 
 void
-video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    int n)
+video_orc_unpack_Y444_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
 {
   OrcExecutor _ex, *ex = &_ex;
   static volatile int p_inited = 0;
@@ -4856,24 +5067,41 @@ video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
 
 #if 1
       static const orc_uint8 bc[] = {
-        1, 9, 20, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
-        107, 95, 71, 82, 65, 89, 56, 11, 1, 1, 12, 4, 4, 20, 2, 190,
-        32, 4, 189, 0, 32, 2, 0,
+        1, 9, 30, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 89, 52, 52, 52, 95, 49, 48, 95, 116, 114, 117, 110,
+        99, 11, 8, 8, 12, 2, 2, 12, 2, 2, 12, 2, 2, 14, 2, 255,
+        255, 0, 0, 14, 2, 6, 0, 0, 0, 20, 2, 20, 4, 20, 4, 93,
+        32, 4, 17, 195, 33, 16, 32, 195, 34, 5, 6, 21, 1, 93, 34, 34,
+        17, 194, 0, 33, 34, 2, 0,
       };
       p = orc_program_new_from_static_bytecode (bc);
-      orc_program_set_backup_function (p, _backup_video_orc_pack_GRAY8);
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_Y444_10_trunc);
 #else
       p = orc_program_new ();
-      orc_program_set_name (p, "video_orc_pack_GRAY8");
-      orc_program_set_backup_function (p, _backup_video_orc_pack_GRAY8);
-      orc_program_add_destination (p, 1, "d1");
-      orc_program_add_source (p, 4, "s1");
+      orc_program_set_name (p, "video_orc_unpack_Y444_10_trunc");
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_Y444_10_trunc);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 2, 0x0000ffff, "c1");
+      orc_program_add_constant (p, 2, 0x00000006, "c2");
       orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
 
-      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1,
-          ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_D1, ORC_VAR_T1,
-          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_C1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T3, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 1, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3,
+          ORC_VAR_D1);
 #endif
 
       orc_program_compile (p);
@@ -4889,6 +5117,8 @@ video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
   ex->n = n;
   ex->arrays[ORC_VAR_D1] = d1;
   ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
 
   func = c->exec;
   func (ex);
@@ -4896,62 +5126,134 @@ video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
 #endif
 
 
-/* video_orc_unpack_BGRA */
+/* video_orc_pack_Y444_10 */
 #ifdef DISABLE_ORC
 void
-video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    int n)
+video_orc_pack_Y444_10 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, const guint16 * ORC_RESTRICT s1, int n)
 {
   int i;
-  orc_union32 *ORC_RESTRICT ptr0;
-  const orc_union32 *ORC_RESTRICT ptr4;
-  orc_union32 var32;
-  orc_union32 var33;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
 
-  ptr0 = (orc_union32 *) d1;
-  ptr4 = (orc_union32 *) s1;
+  ptr0 = (orc_union16 *) d1;
+  ptr1 = (orc_union16 *) d2;
+  ptr2 = (orc_union16 *) d3;
+  ptr4 = (orc_union64 *) s1;
 
 
   for (i = 0; i < n; i++) {
-    /* 0: loadl */
-    var32 = ptr4[i];
-    /* 1: swapl */
-    var33.i = ORC_SWAP_L (var32.i);
-    /* 2: storel */
-    ptr0[i] = var33;
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var39.x4[0] = ((orc_uint16) var35.x4[0]) >> 6;
+    var39.x4[1] = ((orc_uint16) var35.x4[1]) >> 6;
+    var39.x4[2] = ((orc_uint16) var35.x4[2]) >> 6;
+    var39.x4[3] = ((orc_uint16) var35.x4[3]) >> 6;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var39.i;
+      var40.i = _src.x2[1];
+      var41.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var40.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var38.i = _src.x2[1];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
   }
 
 }
 
 #else
 static void
-_backup_video_orc_unpack_BGRA (OrcExecutor * ORC_RESTRICT ex)
+_backup_video_orc_pack_Y444_10 (OrcExecutor * ORC_RESTRICT ex)
 {
   int i;
   int n = ex->n;
-  orc_union32 *ORC_RESTRICT ptr0;
-  const orc_union32 *ORC_RESTRICT ptr4;
-  orc_union32 var32;
-  orc_union32 var33;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
 
-  ptr0 = (orc_union32 *) ex->arrays[0];
-  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr1 = (orc_union16 *) ex->arrays[1];
+  ptr2 = (orc_union16 *) ex->arrays[2];
+  ptr4 = (orc_union64 *) ex->arrays[4];
 
 
   for (i = 0; i < n; i++) {
-    /* 0: loadl */
-    var32 = ptr4[i];
-    /* 1: swapl */
-    var33.i = ORC_SWAP_L (var32.i);
-    /* 2: storel */
-    ptr0[i] = var33;
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var39.x4[0] = ((orc_uint16) var35.x4[0]) >> 6;
+    var39.x4[1] = ((orc_uint16) var35.x4[1]) >> 6;
+    var39.x4[2] = ((orc_uint16) var35.x4[2]) >> 6;
+    var39.x4[3] = ((orc_uint16) var35.x4[3]) >> 6;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var39.i;
+      var40.i = _src.x2[1];
+      var41.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var40.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var38.i = _src.x2[1];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
   }
 
 }
 
 void
-video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    int n)
+video_orc_pack_Y444_10 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, const guint16 * ORC_RESTRICT s1, int n)
 {
   OrcExecutor _ex, *ex = &_ex;
   static volatile int p_inited = 0;
@@ -4965,21 +5267,35 @@ video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
 
 #if 1
       static const orc_uint8 bc[] = {
-        1, 9, 21, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
-        97, 99, 107, 95, 66, 71, 82, 65, 11, 4, 4, 12, 4, 4, 184, 0,
-        4, 2, 0,
+        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 89, 52, 52, 52, 95, 49, 48, 11, 2, 2, 11, 2, 2, 11,
+        2, 2, 12, 8, 8, 14, 2, 6, 0, 0, 0, 20, 8, 20, 4, 20,
+        4, 21, 2, 95, 32, 4, 16, 197, 34, 33, 32, 198, 2, 1, 34, 191,
+        0, 33, 2, 0,
       };
       p = orc_program_new_from_static_bytecode (bc);
-      orc_program_set_backup_function (p, _backup_video_orc_unpack_BGRA);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_Y444_10);
 #else
       p = orc_program_new ();
-      orc_program_set_name (p, "video_orc_unpack_BGRA");
-      orc_program_set_backup_function (p, _backup_video_orc_unpack_BGRA);
-      orc_program_add_destination (p, 4, "d1");
-      orc_program_add_source (p, 4, "s1");
+      orc_program_set_name (p, "video_orc_pack_Y444_10");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_Y444_10);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_destination (p, 2, "d3");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x00000006, "c1");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
 
-      orc_program_append_2 (p, "swapl", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1,
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C1,
           ORC_VAR_D1);
+      orc_program_append_2 (p, "splitql", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_D3, ORC_VAR_D2, ORC_VAR_T3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1, ORC_VAR_D1);
 #endif
 
       orc_program_compile (p);
@@ -4994,6 +5310,8 @@ video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
 
   ex->n = n;
   ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
   ex->arrays[ORC_VAR_S1] = (void *) s1;
 
   func = c->exec;
@@ -5002,32 +5320,4180 @@ video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
 #endif
 
 
-/* video_orc_pack_BGRA */
+/* video_orc_unpack_Y444_12 */
 #ifdef DISABLE_ORC
 void
-video_orc_pack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    int n)
+video_orc_unpack_Y444_12 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
 {
   int i;
-  orc_union32 *ORC_RESTRICT ptr0;
-  const orc_union32 *ORC_RESTRICT ptr4;
-  orc_union32 var32;
-  orc_union32 var33;
-
-  ptr0 = (orc_union32 *) d1;
-  ptr4 = (orc_union32 *) s1;
-
-
-  for (i = 0; i < n; i++) {
-    /* 0: loadl */
-    var32 = ptr4[i];
-    /* 1: swapl */
-    var33.i = ORC_SWAP_L (var32.i);
-    /* 2: storel */
-    ptr0[i] = var33;
-  }
-
-}
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+
+  /* 0: loadpw */
+  var36.i = (int) 0x00000fff;   /* 4095 or 2.0232e-320f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
+    }
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 4;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 4;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 4;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 4;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 12;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 12;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 12;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 12;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_Y444_12 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+
+  /* 0: loadpw */
+  var36.i = (int) 0x00000fff;   /* 4095 or 2.0232e-320f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
+    }
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 4;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 4;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 4;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 4;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 12;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 12;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 12;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 12;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
+  }
+
+}
+
+void
+video_orc_unpack_Y444_12 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 89, 52, 52, 52, 95, 49, 50, 11, 8, 8, 12, 2,
+        2, 12, 2, 2, 12, 2, 2, 14, 2, 255, 15, 0, 0, 14, 2, 4,
+        0, 0, 0, 14, 2, 12, 0, 0, 0, 20, 4, 20, 4, 20, 8, 20,
+        8, 195, 32, 16, 4, 195, 33, 5, 6, 194, 34, 32, 33, 21, 2, 93,
+        34, 34, 17, 21, 2, 95, 35, 34, 18, 21, 2, 92, 0, 34, 35, 2,
+        0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_Y444_12);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_Y444_12");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_Y444_12);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 2, 0x00000fff, "c1");
+      orc_program_add_constant (p, 2, 0x00000004, "c2");
+      orc_program_add_constant (p, 2, 0x0000000c, "c3");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+      orc_program_add_temporary (p, 8, "t4");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_C3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 2, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T4,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_Y444_12_trunc */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_Y444_12_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union16 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+
+  /* 2: loadpw */
+  var36.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 1: shlw */
+    var40.i = ((orc_uint16) var35.i) << 4;
+    /* 3: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var40.i;
+      var41.i = _dest.i;
+    }
+    /* 4: loadw */
+    var37 = ptr5[i];
+    /* 5: loadw */
+    var38 = ptr6[i];
+    /* 6: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var42.i = _dest.i;
+    }
+    /* 7: shlw */
+    var43.x2[0] = ((orc_uint16) var42.x2[0]) << 4;
+    var43.x2[1] = ((orc_uint16) var42.x2[1]) << 4;
+    /* 8: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var43.i;
+      var39.i = _dest.i;
+    }
+    /* 9: storeq */
+    ptr0[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_Y444_12_trunc (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union16 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+
+  /* 2: loadpw */
+  var36.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 1: shlw */
+    var40.i = ((orc_uint16) var35.i) << 4;
+    /* 3: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var40.i;
+      var41.i = _dest.i;
+    }
+    /* 4: loadw */
+    var37 = ptr5[i];
+    /* 5: loadw */
+    var38 = ptr6[i];
+    /* 6: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var42.i = _dest.i;
+    }
+    /* 7: shlw */
+    var43.x2[0] = ((orc_uint16) var42.x2[0]) << 4;
+    var43.x2[1] = ((orc_uint16) var42.x2[1]) << 4;
+    /* 8: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var43.i;
+      var39.i = _dest.i;
+    }
+    /* 9: storeq */
+    ptr0[i] = var39;
+  }
+
+}
+
+void
+video_orc_unpack_Y444_12_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 30, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 89, 52, 52, 52, 95, 49, 50, 95, 116, 114, 117, 110,
+        99, 11, 8, 8, 12, 2, 2, 12, 2, 2, 12, 2, 2, 14, 2, 255,
+        255, 0, 0, 14, 2, 4, 0, 0, 0, 20, 2, 20, 4, 20, 4, 93,
+        32, 4, 17, 195, 33, 16, 32, 195, 34, 5, 6, 21, 1, 93, 34, 34,
+        17, 194, 0, 33, 34, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_Y444_12_trunc);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_Y444_12_trunc");
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_Y444_12_trunc);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 2, 0x0000ffff, "c1");
+      orc_program_add_constant (p, 2, 0x00000004, "c2");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_C1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T3, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 1, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_Y444_12 */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_Y444_12 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr1 = (orc_union16 *) d2;
+  ptr2 = (orc_union16 *) d3;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var39.x4[0] = ((orc_uint16) var35.x4[0]) >> 4;
+    var39.x4[1] = ((orc_uint16) var35.x4[1]) >> 4;
+    var39.x4[2] = ((orc_uint16) var35.x4[2]) >> 4;
+    var39.x4[3] = ((orc_uint16) var35.x4[3]) >> 4;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var39.i;
+      var40.i = _src.x2[1];
+      var41.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var40.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var38.i = _src.x2[1];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_Y444_12 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr1 = (orc_union16 *) ex->arrays[1];
+  ptr2 = (orc_union16 *) ex->arrays[2];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var39.x4[0] = ((orc_uint16) var35.x4[0]) >> 4;
+    var39.x4[1] = ((orc_uint16) var35.x4[1]) >> 4;
+    var39.x4[2] = ((orc_uint16) var35.x4[2]) >> 4;
+    var39.x4[3] = ((orc_uint16) var35.x4[3]) >> 4;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var39.i;
+      var40.i = _src.x2[1];
+      var41.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var40.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var38.i = _src.x2[1];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+video_orc_pack_Y444_12 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 89, 52, 52, 52, 95, 49, 50, 11, 2, 2, 11, 2, 2, 11,
+        2, 2, 12, 8, 8, 14, 2, 4, 0, 0, 0, 20, 8, 20, 4, 20,
+        4, 21, 2, 95, 32, 4, 16, 197, 34, 33, 32, 198, 2, 1, 34, 191,
+        0, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_Y444_12);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_Y444_12");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_Y444_12);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_destination (p, 2, "d3");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x00000004, "c1");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitql", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_D3, ORC_VAR_D2, ORC_VAR_T3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_A444_10 */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_A444_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var36 = ptr7[i];
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
+    }
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 6;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 6;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 6;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 6;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 10;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 10;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 10;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 10;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_A444_10 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var36 = ptr7[i];
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
+    }
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 6;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 6;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 6;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 6;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 10;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 10;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 10;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 10;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
+  }
+
+}
+
+void
+video_orc_unpack_A444_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 65, 52, 52, 52, 95, 49, 48, 11, 8, 8, 12, 2,
+        2, 12, 2, 2, 12, 2, 2, 12, 2, 2, 14, 2, 6, 0, 0, 0,
+        14, 2, 10, 0, 0, 0, 20, 4, 20, 4, 20, 8, 20, 8, 195, 32,
+        7, 4, 195, 33, 5, 6, 194, 34, 32, 33, 21, 2, 93, 34, 34, 16,
+        21, 2, 95, 35, 34, 17, 21, 2, 92, 0, 34, 35, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_A444_10);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_A444_10");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_A444_10);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_constant (p, 2, 0x00000006, "c1");
+      orc_program_add_constant (p, 2, 0x0000000a, "c2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+      orc_program_add_temporary (p, 8, "t4");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 2, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T4,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_A444_10_trunc */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_A444_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union64 var42;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr7[i];
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var40.i = _dest.i;
+    }
+    /* 3: loadw */
+    var37 = ptr5[i];
+    /* 4: loadw */
+    var38 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var41.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var40.i;
+      _dest.x2[1] = var41.i;
+      var42.i = _dest.i;
+    }
+    /* 7: shlw */
+    var39.x4[0] = ((orc_uint16) var42.x4[0]) << 6;
+    var39.x4[1] = ((orc_uint16) var42.x4[1]) << 6;
+    var39.x4[2] = ((orc_uint16) var42.x4[2]) << 6;
+    var39.x4[3] = ((orc_uint16) var42.x4[3]) << 6;
+    /* 8: storeq */
+    ptr0[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_A444_10_trunc (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union64 var42;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr7[i];
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var40.i = _dest.i;
+    }
+    /* 3: loadw */
+    var37 = ptr5[i];
+    /* 4: loadw */
+    var38 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var41.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var40.i;
+      _dest.x2[1] = var41.i;
+      var42.i = _dest.i;
+    }
+    /* 7: shlw */
+    var39.x4[0] = ((orc_uint16) var42.x4[0]) << 6;
+    var39.x4[1] = ((orc_uint16) var42.x4[1]) << 6;
+    var39.x4[2] = ((orc_uint16) var42.x4[2]) << 6;
+    var39.x4[3] = ((orc_uint16) var42.x4[3]) << 6;
+    /* 8: storeq */
+    ptr0[i] = var39;
+  }
+
+}
+
+void
+video_orc_unpack_A444_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 30, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 65, 52, 52, 52, 95, 49, 48, 95, 116, 114, 117, 110,
+        99, 11, 8, 8, 12, 2, 2, 12, 2, 2, 12, 2, 2, 12, 2, 2,
+        14, 2, 6, 0, 0, 0, 20, 4, 20, 4, 20, 8, 195, 32, 7, 4,
+        195, 33, 5, 6, 194, 34, 32, 33, 21, 2, 93, 0, 34, 16, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_A444_10_trunc);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_A444_10_trunc");
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_A444_10_trunc);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_constant (p, 2, 0x00000006, "c1");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_C1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_A444_10 */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_A444_10 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, guint16 * ORC_RESTRICT d4,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  orc_union16 *ORC_RESTRICT ptr3;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr1 = (orc_union16 *) d2;
+  ptr2 = (orc_union16 *) d3;
+  ptr3 = (orc_union16 *) d4;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var40.x4[0] = ((orc_uint16) var35.x4[0]) >> 6;
+    var40.x4[1] = ((orc_uint16) var35.x4[1]) >> 6;
+    var40.x4[2] = ((orc_uint16) var35.x4[2]) >> 6;
+    var40.x4[3] = ((orc_uint16) var35.x4[3]) >> 6;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var40.i;
+      var41.i = _src.x2[1];
+      var42.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var42.i;
+      var38.i = _src.x2[1];
+      var39.i = _src.x2[0];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
+    /* 8: storew */
+    ptr3[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_A444_10 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  orc_union16 *ORC_RESTRICT ptr3;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr1 = (orc_union16 *) ex->arrays[1];
+  ptr2 = (orc_union16 *) ex->arrays[2];
+  ptr3 = (orc_union16 *) ex->arrays[3];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var40.x4[0] = ((orc_uint16) var35.x4[0]) >> 6;
+    var40.x4[1] = ((orc_uint16) var35.x4[1]) >> 6;
+    var40.x4[2] = ((orc_uint16) var35.x4[2]) >> 6;
+    var40.x4[3] = ((orc_uint16) var35.x4[3]) >> 6;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var40.i;
+      var41.i = _src.x2[1];
+      var42.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var42.i;
+      var38.i = _src.x2[1];
+      var39.i = _src.x2[0];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
+    /* 8: storew */
+    ptr3[i] = var39;
+  }
+
+}
+
+void
+video_orc_pack_A444_10 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, guint16 * ORC_RESTRICT d4,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 65, 52, 52, 52, 95, 49, 48, 11, 2, 2, 11, 2, 2, 11,
+        2, 2, 11, 2, 2, 12, 8, 8, 14, 2, 6, 0, 0, 0, 20, 8,
+        20, 4, 20, 4, 21, 2, 95, 32, 4, 16, 197, 34, 33, 32, 198, 2,
+        1, 34, 198, 0, 3, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_A444_10);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_A444_10");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_A444_10);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_destination (p, 2, "d3");
+      orc_program_add_destination (p, 2, "d4");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x00000006, "c1");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitql", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_D3, ORC_VAR_D2, ORC_VAR_T3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_D1, ORC_VAR_D4, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_D4] = d4;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_A444_12 */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_A444_12 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var36 = ptr7[i];
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
+    }
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 4;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 4;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 4;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 4;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 12;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 12;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 12;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 12;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_A444_12 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var36 = ptr7[i];
+    /* 1: loadw */
+    var37 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var37.i;
+      var41.i = _dest.i;
+    }
+    /* 3: loadw */
+    var38 = ptr5[i];
+    /* 4: loadw */
+    var39 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var38.i;
+      _dest.x2[1] = var39.i;
+      var42.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var41.i;
+      _dest.x2[1] = var42.i;
+      var43.i = _dest.i;
+    }
+    /* 7: shlw */
+    var44.x4[0] = ((orc_uint16) var43.x4[0]) << 4;
+    var44.x4[1] = ((orc_uint16) var43.x4[1]) << 4;
+    var44.x4[2] = ((orc_uint16) var43.x4[2]) << 4;
+    var44.x4[3] = ((orc_uint16) var43.x4[3]) << 4;
+    /* 8: shruw */
+    var45.x4[0] = ((orc_uint16) var44.x4[0]) >> 12;
+    var45.x4[1] = ((orc_uint16) var44.x4[1]) >> 12;
+    var45.x4[2] = ((orc_uint16) var44.x4[2]) >> 12;
+    var45.x4[3] = ((orc_uint16) var44.x4[3]) >> 12;
+    /* 9: orw */
+    var40.x4[0] = var44.x4[0] | var45.x4[0];
+    var40.x4[1] = var44.x4[1] | var45.x4[1];
+    var40.x4[2] = var44.x4[2] | var45.x4[2];
+    var40.x4[3] = var44.x4[3] | var45.x4[3];
+    /* 10: storeq */
+    ptr0[i] = var40;
+  }
+
+}
+
+void
+video_orc_unpack_A444_12 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 65, 52, 52, 52, 95, 49, 50, 11, 8, 8, 12, 2,
+        2, 12, 2, 2, 12, 2, 2, 12, 2, 2, 14, 2, 4, 0, 0, 0,
+        14, 2, 12, 0, 0, 0, 20, 4, 20, 4, 20, 8, 20, 8, 195, 32,
+        7, 4, 195, 33, 5, 6, 194, 34, 32, 33, 21, 2, 93, 34, 34, 16,
+        21, 2, 95, 35, 34, 17, 21, 2, 92, 0, 34, 35, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_A444_12);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_A444_12");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_A444_12);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_constant (p, 2, 0x00000004, "c1");
+      orc_program_add_constant (p, 2, 0x0000000c, "c2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+      orc_program_add_temporary (p, 8, "t4");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 2, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T4,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_A444_12_trunc */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_A444_12_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union64 var42;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr7[i];
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var40.i = _dest.i;
+    }
+    /* 3: loadw */
+    var37 = ptr5[i];
+    /* 4: loadw */
+    var38 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var41.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var40.i;
+      _dest.x2[1] = var41.i;
+      var42.i = _dest.i;
+    }
+    /* 7: shlw */
+    var39.x4[0] = ((orc_uint16) var42.x4[0]) << 4;
+    var39.x4[1] = ((orc_uint16) var42.x4[1]) << 4;
+    var39.x4[2] = ((orc_uint16) var42.x4[2]) << 4;
+    var39.x4[3] = ((orc_uint16) var42.x4[3]) << 4;
+    /* 8: storeq */
+    ptr0[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_A444_12_trunc (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union64 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union64 var42;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr7[i];
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var40.i = _dest.i;
+    }
+    /* 3: loadw */
+    var37 = ptr5[i];
+    /* 4: loadw */
+    var38 = ptr6[i];
+    /* 5: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var38.i;
+      var41.i = _dest.i;
+    }
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var40.i;
+      _dest.x2[1] = var41.i;
+      var42.i = _dest.i;
+    }
+    /* 7: shlw */
+    var39.x4[0] = ((orc_uint16) var42.x4[0]) << 4;
+    var39.x4[1] = ((orc_uint16) var42.x4[1]) << 4;
+    var39.x4[2] = ((orc_uint16) var42.x4[2]) << 4;
+    var39.x4[3] = ((orc_uint16) var42.x4[3]) << 4;
+    /* 8: storeq */
+    ptr0[i] = var39;
+  }
+
+}
+
+void
+video_orc_unpack_A444_12_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 30, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 65, 52, 52, 52, 95, 49, 50, 95, 116, 114, 117, 110,
+        99, 11, 8, 8, 12, 2, 2, 12, 2, 2, 12, 2, 2, 12, 2, 2,
+        14, 2, 4, 0, 0, 0, 20, 4, 20, 4, 20, 8, 195, 32, 7, 4,
+        195, 33, 5, 6, 194, 34, 32, 33, 21, 2, 93, 0, 34, 16, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_A444_12_trunc);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_A444_12_trunc");
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_A444_12_trunc);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_constant (p, 2, 0x00000004, "c1");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_S3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_C1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_A444_12 */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_A444_12 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, guint16 * ORC_RESTRICT d4,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  orc_union16 *ORC_RESTRICT ptr3;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr1 = (orc_union16 *) d2;
+  ptr2 = (orc_union16 *) d3;
+  ptr3 = (orc_union16 *) d4;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var40.x4[0] = ((orc_uint16) var35.x4[0]) >> 4;
+    var40.x4[1] = ((orc_uint16) var35.x4[1]) >> 4;
+    var40.x4[2] = ((orc_uint16) var35.x4[2]) >> 4;
+    var40.x4[3] = ((orc_uint16) var35.x4[3]) >> 4;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var40.i;
+      var41.i = _src.x2[1];
+      var42.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var42.i;
+      var38.i = _src.x2[1];
+      var39.i = _src.x2[0];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
+    /* 8: storew */
+    ptr3[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_A444_12 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  orc_union16 *ORC_RESTRICT ptr2;
+  orc_union16 *ORC_RESTRICT ptr3;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr1 = (orc_union16 *) ex->arrays[1];
+  ptr2 = (orc_union16 *) ex->arrays[2];
+  ptr3 = (orc_union16 *) ex->arrays[3];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var35 = ptr4[i];
+    /* 1: shruw */
+    var40.x4[0] = ((orc_uint16) var35.x4[0]) >> 4;
+    var40.x4[1] = ((orc_uint16) var35.x4[1]) >> 4;
+    var40.x4[2] = ((orc_uint16) var35.x4[2]) >> 4;
+    var40.x4[3] = ((orc_uint16) var35.x4[3]) >> 4;
+    /* 2: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var40.i;
+      var41.i = _src.x2[1];
+      var42.i = _src.x2[0];
+    }
+    /* 3: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var41.i;
+      var36.i = _src.x2[1];
+      var37.i = _src.x2[0];
+    }
+    /* 4: storew */
+    ptr2[i] = var36;
+    /* 5: storew */
+    ptr1[i] = var37;
+    /* 6: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var42.i;
+      var38.i = _src.x2[1];
+      var39.i = _src.x2[0];
+    }
+    /* 7: storew */
+    ptr0[i] = var38;
+    /* 8: storew */
+    ptr3[i] = var39;
+  }
+
+}
+
+void
+video_orc_pack_A444_12 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    guint16 * ORC_RESTRICT d3, guint16 * ORC_RESTRICT d4,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 65, 52, 52, 52, 95, 49, 50, 11, 2, 2, 11, 2, 2, 11,
+        2, 2, 11, 2, 2, 12, 8, 8, 14, 2, 4, 0, 0, 0, 20, 8,
+        20, 4, 20, 4, 21, 2, 95, 32, 4, 16, 197, 34, 33, 32, 198, 2,
+        1, 34, 198, 0, 3, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_A444_12);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_A444_12");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_A444_12);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_destination (p, 2, "d3");
+      orc_program_add_destination (p, 2, "d4");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x00000004, "c1");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitql", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_D3, ORC_VAR_D2, ORC_VAR_T3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_D1, ORC_VAR_D4, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_D4] = d4;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_I420_10_uv */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_I420_10_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union64 var35;
+  orc_union32 var36;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: loadw */
+    var34 = ptr5[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var33.i;
+      _dest.x2[1] = var34.i;
+      var36.i = _dest.i;
+    }
+    /* 3: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var36.i;
+      var35.i = _dest.i;
+    }
+    /* 4: storeq */
+    ptr0[i] = var35;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_I420_10_uv (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union64 var35;
+  orc_union32 var36;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: loadw */
+    var34 = ptr5[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var33.i;
+      _dest.x2[1] = var34.i;
+      var36.i = _dest.i;
+    }
+    /* 3: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var36.i;
+      var35.i = _dest.i;
+    }
+    /* 4: storeq */
+    ptr0[i] = var35;
+  }
+
+}
+
+void
+video_orc_unpack_I420_10_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 27, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 73, 52, 50, 48, 95, 49, 48, 95, 117, 118, 11, 8,
+        8, 12, 2, 2, 12, 2, 2, 20, 4, 195, 32, 4, 5, 194, 0, 32,
+        32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_I420_10_uv);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_I420_10_uv");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_I420_10_uv);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_S2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_I420_10 */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_I420_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union16 var36;
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+  orc_union64 var40;
+  orc_union64 var41;
+  orc_union64 var42;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union32 *) s2;
+
+  /* 0: loadpw */
+  var35.i = (int) 0x000003ff;   /* 1023 or 5.05429e-321f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var39.i = _dest.i;
+    }
+    /* 3: loadl */
+    var37 = ptr5[i];
+    /* 4: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var39.i;
+      _dest.x2[1] = var37.i;
+      var40.i = _dest.i;
+    }
+    /* 5: shlw */
+    var41.x4[0] = ((orc_uint16) var40.x4[0]) << 6;
+    var41.x4[1] = ((orc_uint16) var40.x4[1]) << 6;
+    var41.x4[2] = ((orc_uint16) var40.x4[2]) << 6;
+    var41.x4[3] = ((orc_uint16) var40.x4[3]) << 6;
+    /* 6: shruw */
+    var42.x4[0] = ((orc_uint16) var41.x4[0]) >> 10;
+    var42.x4[1] = ((orc_uint16) var41.x4[1]) >> 10;
+    var42.x4[2] = ((orc_uint16) var41.x4[2]) >> 10;
+    var42.x4[3] = ((orc_uint16) var41.x4[3]) >> 10;
+    /* 7: orw */
+    var38.x4[0] = var41.x4[0] | var42.x4[0];
+    var38.x4[1] = var41.x4[1] | var42.x4[1];
+    var38.x4[2] = var41.x4[2] | var42.x4[2];
+    var38.x4[3] = var41.x4[3] | var42.x4[3];
+    /* 8: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_I420_10 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union16 var36;
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+  orc_union64 var40;
+  orc_union64 var41;
+  orc_union64 var42;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+
+  /* 0: loadpw */
+  var35.i = (int) 0x000003ff;   /* 1023 or 5.05429e-321f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var39.i = _dest.i;
+    }
+    /* 3: loadl */
+    var37 = ptr5[i];
+    /* 4: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var39.i;
+      _dest.x2[1] = var37.i;
+      var40.i = _dest.i;
+    }
+    /* 5: shlw */
+    var41.x4[0] = ((orc_uint16) var40.x4[0]) << 6;
+    var41.x4[1] = ((orc_uint16) var40.x4[1]) << 6;
+    var41.x4[2] = ((orc_uint16) var40.x4[2]) << 6;
+    var41.x4[3] = ((orc_uint16) var40.x4[3]) << 6;
+    /* 6: shruw */
+    var42.x4[0] = ((orc_uint16) var41.x4[0]) >> 10;
+    var42.x4[1] = ((orc_uint16) var41.x4[1]) >> 10;
+    var42.x4[2] = ((orc_uint16) var41.x4[2]) >> 10;
+    var42.x4[3] = ((orc_uint16) var41.x4[3]) >> 10;
+    /* 7: orw */
+    var38.x4[0] = var41.x4[0] | var42.x4[0];
+    var38.x4[1] = var41.x4[1] | var42.x4[1];
+    var38.x4[2] = var41.x4[2] | var42.x4[2];
+    var38.x4[3] = var41.x4[3] | var42.x4[3];
+    /* 8: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+video_orc_unpack_I420_10 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 73, 52, 50, 48, 95, 49, 48, 11, 8, 8, 12, 2,
+        2, 12, 4, 4, 14, 2, 255, 3, 0, 0, 14, 2, 6, 0, 0, 0,
+        14, 2, 10, 0, 0, 0, 20, 4, 20, 8, 20, 8, 195, 32, 16, 4,
+        194, 33, 32, 5, 21, 2, 93, 33, 33, 17, 21, 2, 95, 34, 33, 18,
+        21, 2, 92, 0, 33, 34, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_I420_10);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_I420_10");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_I420_10);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_constant (p, 2, 0x000003ff, "c1");
+      orc_program_add_constant (p, 2, 0x00000006, "c2");
+      orc_program_add_constant (p, 2, 0x0000000a, "c3");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 8, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_S2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 2, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_I420_10_trunc */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_I420_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union16 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union32 *) s2;
+
+  /* 2: loadpw */
+  var36.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 1: shlw */
+    var39.i = ((orc_uint16) var35.i) << 6;
+    /* 3: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var39.i;
+      var40.i = _dest.i;
+    }
+    /* 4: loadl */
+    var37 = ptr5[i];
+    /* 5: shlw */
+    var41.x2[0] = ((orc_uint16) var37.x2[0]) << 6;
+    var41.x2[1] = ((orc_uint16) var37.x2[1]) << 6;
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var40.i;
+      _dest.x2[1] = var41.i;
+      var38.i = _dest.i;
+    }
+    /* 7: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_I420_10_trunc (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union16 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+
+  /* 2: loadpw */
+  var36.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 1: shlw */
+    var39.i = ((orc_uint16) var35.i) << 6;
+    /* 3: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var36.i;
+      _dest.x2[1] = var39.i;
+      var40.i = _dest.i;
+    }
+    /* 4: loadl */
+    var37 = ptr5[i];
+    /* 5: shlw */
+    var41.x2[0] = ((orc_uint16) var37.x2[0]) << 6;
+    var41.x2[1] = ((orc_uint16) var37.x2[1]) << 6;
+    /* 6: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var40.i;
+      _dest.x2[1] = var41.i;
+      var38.i = _dest.i;
+    }
+    /* 7: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+video_orc_unpack_I420_10_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 30, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 73, 52, 50, 48, 95, 49, 48, 95, 116, 114, 117, 110,
+        99, 11, 8, 8, 12, 2, 2, 12, 4, 4, 14, 2, 255, 255, 0, 0,
+        14, 2, 6, 0, 0, 0, 20, 2, 20, 4, 20, 4, 93, 32, 4, 17,
+        195, 33, 16, 32, 21, 1, 93, 34, 5, 17, 194, 0, 33, 34, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_I420_10_trunc);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_I420_10_trunc");
+      orc_program_set_backup_function (p,
+          _backup_video_orc_unpack_I420_10_trunc);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_constant (p, 2, 0x0000ffff, "c1");
+      orc_program_add_constant (p, 2, 0x00000006, "c2");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T2, ORC_VAR_C1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 1, ORC_VAR_T3, ORC_VAR_S2, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_I420_10_y */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_I420_10_y (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var34;
+  orc_union16 var35;
+  orc_union32 var36;
+  orc_union16 var37;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 1: select0ql */
+    {
+      orc_union64 _src;
+      _src.i = var34.i;
+      var36.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var36.i;
+      var37.i = _src.x2[1];
+    }
+    /* 3: shruw */
+    var35.i = ((orc_uint16) var37.i) >> 6;
+    /* 4: storew */
+    ptr0[i] = var35;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_I420_10_y (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var34;
+  orc_union16 var35;
+  orc_union32 var36;
+  orc_union16 var37;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 1: select0ql */
+    {
+      orc_union64 _src;
+      _src.i = var34.i;
+      var36.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var36.i;
+      var37.i = _src.x2[1];
+    }
+    /* 3: shruw */
+    var35.i = ((orc_uint16) var37.i) >> 6;
+    /* 4: storew */
+    ptr0[i] = var35;
+  }
+
+}
+
+void
+video_orc_pack_I420_10_y (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 73, 52, 50, 48, 95, 49, 48, 95, 121, 11, 2, 2, 12, 8,
+        8, 14, 2, 6, 0, 0, 0, 20, 4, 20, 2, 192, 32, 4, 191, 33,
+        32, 95, 0, 33, 16, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_I420_10_y);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_I420_10_y");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_I420_10_y);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x00000006, "c1");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_T1, ORC_VAR_S1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_I420_10_uv */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_I420_10_uv (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  orc_union32 var32;
+  orc_union16 var33;
+  orc_union32 var34;
+  orc_union16 var35;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr1 = (orc_union16 *) d2;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union32 *) s2;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: select0lw */
+    {
+      orc_union32 _src;
+      _src.i = var32.i;
+      var33.i = _src.x2[0];
+    }
+    /* 2: storew */
+    ptr0[i] = var33;
+    /* 3: loadl */
+    var34 = ptr5[i];
+    /* 4: select0lw */
+    {
+      orc_union32 _src;
+      _src.i = var34.i;
+      var35.i = _src.x2[0];
+    }
+    /* 5: storew */
+    ptr1[i] = var35;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_I420_10_uv (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union16 *ORC_RESTRICT ptr1;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  orc_union32 var32;
+  orc_union16 var33;
+  orc_union32 var34;
+  orc_union16 var35;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr1 = (orc_union16 *) ex->arrays[1];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: select0lw */
+    {
+      orc_union32 _src;
+      _src.i = var32.i;
+      var33.i = _src.x2[0];
+    }
+    /* 2: storew */
+    ptr0[i] = var33;
+    /* 3: loadl */
+    var34 = ptr5[i];
+    /* 4: select0lw */
+    {
+      orc_union32 _src;
+      _src.i = var34.i;
+      var35.i = _src.x2[0];
+    }
+    /* 5: storew */
+    ptr1[i] = var35;
+  }
+
+}
+
+void
+video_orc_pack_I420_10_uv (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 73, 52, 50, 48, 95, 49, 48, 95, 117, 118, 11, 2, 2, 11,
+        2, 2, 12, 4, 4, 12, 4, 4, 190, 0, 4, 190, 1, 5, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_I420_10_uv);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_I420_10_uv");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_I420_10_uv);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_D1, ORC_VAR_S1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_D2, ORC_VAR_S2,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_P010_uv */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_P010_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var32;
+  orc_union64 var33;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var32.i;
+      _dest.x2[1] = var32.i;
+      var33.i = _dest.i;
+    }
+    /* 2: storeq */
+    ptr0[i] = var33;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_P010_uv (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var32;
+  orc_union64 var33;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var32.i;
+      _dest.x2[1] = var32.i;
+      var33.i = _dest.i;
+    }
+    /* 2: storeq */
+    ptr0[i] = var33;
+  }
+
+}
+
+void
+video_orc_unpack_P010_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 80, 48, 49, 48, 95, 117, 118, 11, 8, 8, 12, 4,
+        4, 194, 0, 4, 4, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_P010_uv);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_P010_uv");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_P010_uv);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 4, "s1");
+
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_S1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_P010 */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_P010 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union16 var36;
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+  orc_union64 var40;
+  orc_union64 var41;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union32 *) s2;
+
+  /* 0: loadpw */
+  var35.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var39.i = _dest.i;
+    }
+    /* 3: loadl */
+    var37 = ptr5[i];
+    /* 4: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var39.i;
+      _dest.x2[1] = var37.i;
+      var40.i = _dest.i;
+    }
+    /* 5: shruw */
+    var41.x4[0] = ((orc_uint16) var40.x4[0]) >> 10;
+    var41.x4[1] = ((orc_uint16) var40.x4[1]) >> 10;
+    var41.x4[2] = ((orc_uint16) var40.x4[2]) >> 10;
+    var41.x4[3] = ((orc_uint16) var40.x4[3]) >> 10;
+    /* 6: orw */
+    var38.x4[0] = var40.x4[0] | var41.x4[0];
+    var38.x4[1] = var40.x4[1] | var41.x4[1];
+    var38.x4[2] = var40.x4[2] | var41.x4[2];
+    var38.x4[3] = var40.x4[3] | var41.x4[3];
+    /* 7: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_P010 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union16 var36;
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+  orc_union64 var40;
+  orc_union64 var41;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+
+  /* 0: loadpw */
+  var35.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var36 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var35.i;
+      _dest.x2[1] = var36.i;
+      var39.i = _dest.i;
+    }
+    /* 3: loadl */
+    var37 = ptr5[i];
+    /* 4: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var39.i;
+      _dest.x2[1] = var37.i;
+      var40.i = _dest.i;
+    }
+    /* 5: shruw */
+    var41.x4[0] = ((orc_uint16) var40.x4[0]) >> 10;
+    var41.x4[1] = ((orc_uint16) var40.x4[1]) >> 10;
+    var41.x4[2] = ((orc_uint16) var40.x4[2]) >> 10;
+    var41.x4[3] = ((orc_uint16) var40.x4[3]) >> 10;
+    /* 6: orw */
+    var38.x4[0] = var40.x4[0] | var41.x4[0];
+    var38.x4[1] = var40.x4[1] | var41.x4[1];
+    var38.x4[2] = var40.x4[2] | var41.x4[2];
+    var38.x4[3] = var40.x4[3] | var41.x4[3];
+    /* 7: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+video_orc_unpack_P010 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 21, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 80, 48, 49, 48, 11, 8, 8, 12, 2, 2, 12, 4,
+        4, 14, 2, 255, 255, 0, 0, 14, 2, 10, 0, 0, 0, 20, 4, 20,
+        8, 20, 8, 195, 32, 16, 4, 194, 33, 32, 5, 21, 2, 95, 34, 33,
+        17, 21, 2, 92, 0, 33, 34, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_P010);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_P010");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_P010);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_constant (p, 2, 0x0000ffff, "c1");
+      orc_program_add_constant (p, 2, 0x0000000a, "c2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 8, "t2");
+      orc_program_add_temporary (p, 8, "t3");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_S2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 2, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_P010_trunc */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_P010_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var33;
+#else
+  orc_union16 var33;
+#endif
+  orc_union16 var34;
+  orc_union32 var35;
+  orc_union64 var36;
+  orc_union32 var37;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union32 *) s2;
+
+  /* 0: loadpw */
+  var33.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var34 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var33.i;
+      _dest.x2[1] = var34.i;
+      var37.i = _dest.i;
+    }
+    /* 3: loadl */
+    var35 = ptr5[i];
+    /* 4: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var35.i;
+      var36.i = _dest.i;
+    }
+    /* 5: storeq */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_P010_trunc (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var33;
+#else
+  orc_union16 var33;
+#endif
+  orc_union16 var34;
+  orc_union32 var35;
+  orc_union64 var36;
+  orc_union32 var37;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+
+  /* 0: loadpw */
+  var33.i = (int) 0x0000ffff;   /* 65535 or 3.23786e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadw */
+    var34 = ptr4[i];
+    /* 2: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var33.i;
+      _dest.x2[1] = var34.i;
+      var37.i = _dest.i;
+    }
+    /* 3: loadl */
+    var35 = ptr5[i];
+    /* 4: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var35.i;
+      var36.i = _dest.i;
+    }
+    /* 5: storeq */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+video_orc_unpack_P010_trunc (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 27, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 80, 48, 49, 48, 95, 116, 114, 117, 110, 99, 11, 8,
+        8, 12, 2, 2, 12, 4, 4, 14, 2, 255, 255, 0, 0, 20, 4, 195,
+        32, 16, 4, 194, 0, 32, 5, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_P010_trunc);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_P010_trunc");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_P010_trunc);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_constant (p, 2, 0x0000ffff, "c1");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_S2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_P010 */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_P010 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union32 *ORC_RESTRICT ptr1;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var34;
+  orc_union32 var35;
+  orc_union16 var36;
+  orc_union64 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr1 = (orc_union32 *) d2;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 1: shruw */
+    var37.x4[0] = ((orc_uint16) var34.x4[0]) >> 6;
+    var37.x4[1] = ((orc_uint16) var34.x4[1]) >> 6;
+    var37.x4[2] = ((orc_uint16) var34.x4[2]) >> 6;
+    var37.x4[3] = ((orc_uint16) var34.x4[3]) >> 6;
+    /* 2: shlw */
+    var38.x4[0] = ((orc_uint16) var37.x4[0]) << 6;
+    var38.x4[1] = ((orc_uint16) var37.x4[1]) << 6;
+    var38.x4[2] = ((orc_uint16) var37.x4[2]) << 6;
+    var38.x4[3] = ((orc_uint16) var37.x4[3]) << 6;
+    /* 3: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var38.i;
+      var35.i = _src.x2[1];
+      var39.i = _src.x2[0];
+    }
+    /* 4: storel */
+    ptr1[i] = var35;
+    /* 5: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var39.i;
+      var36.i = _src.x2[1];
+    }
+    /* 6: storew */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_P010 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  orc_union32 *ORC_RESTRICT ptr1;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var34;
+  orc_union32 var35;
+  orc_union16 var36;
+  orc_union64 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr1 = (orc_union32 *) ex->arrays[1];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 1: shruw */
+    var37.x4[0] = ((orc_uint16) var34.x4[0]) >> 6;
+    var37.x4[1] = ((orc_uint16) var34.x4[1]) >> 6;
+    var37.x4[2] = ((orc_uint16) var34.x4[2]) >> 6;
+    var37.x4[3] = ((orc_uint16) var34.x4[3]) >> 6;
+    /* 2: shlw */
+    var38.x4[0] = ((orc_uint16) var37.x4[0]) << 6;
+    var38.x4[1] = ((orc_uint16) var37.x4[1]) << 6;
+    var38.x4[2] = ((orc_uint16) var37.x4[2]) << 6;
+    var38.x4[3] = ((orc_uint16) var37.x4[3]) << 6;
+    /* 3: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var38.i;
+      var35.i = _src.x2[1];
+      var39.i = _src.x2[0];
+    }
+    /* 4: storel */
+    ptr1[i] = var35;
+    /* 5: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var39.i;
+      var36.i = _src.x2[1];
+    }
+    /* 6: storew */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+video_orc_pack_P010 (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 19, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 80, 48, 49, 48, 11, 2, 2, 11, 4, 4, 12, 8, 8, 14,
+        2, 6, 0, 0, 0, 20, 8, 20, 4, 21, 2, 95, 32, 4, 16, 21,
+        2, 93, 32, 32, 16, 197, 1, 33, 32, 191, 0, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_P010);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_P010");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_P010);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 4, "d2");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x00000006, "c1");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+
+      orc_program_append_2 (p, "shruw", 2, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 2, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splitql", 0, ORC_VAR_D2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_P010_y */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_P010_y (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var34;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union16 var36;
+  orc_union32 var37;
+  orc_union16 var38;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union64 *) s1;
+
+  /* 3: loadpw */
+  var35.i = (int) 0x0000ffc0;   /* 65472 or 3.23475e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 1: select0ql */
+    {
+      orc_union64 _src;
+      _src.i = var34.i;
+      var37.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var37.i;
+      var38.i = _src.x2[1];
+    }
+    /* 4: andw */
+    var36.i = var38.i & var35.i;
+    /* 5: storew */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_P010_y (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var34;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union16 var36;
+  orc_union32 var37;
+  orc_union16 var38;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+  /* 3: loadpw */
+  var35.i = (int) 0x0000ffc0;   /* 65472 or 3.23475e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 1: select0ql */
+    {
+      orc_union64 _src;
+      _src.i = var34.i;
+      var37.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+      orc_union32 _src;
+      _src.i = var37.i;
+      var38.i = _src.x2[1];
+    }
+    /* 4: andw */
+    var36.i = var38.i & var35.i;
+    /* 5: storew */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+video_orc_pack_P010_y (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 21, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 80, 48, 49, 48, 95, 121, 11, 2, 2, 12, 8, 8, 14, 2,
+        192, 255, 0, 0, 20, 4, 20, 2, 192, 32, 4, 191, 33, 32, 73, 0,
+        33, 16, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_P010_y);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_P010_y");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_P010_y);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 2, 0x0000ffc0, "c1");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_T1, ORC_VAR_S1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_P010_uv */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_P010_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var32 = ptr4[i];
+    /* 1: select0ql */
+    {
+      orc_union64 _src;
+      _src.i = var32.i;
+      var33.i = _src.x2[0];
+    }
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_P010_uv (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var32 = ptr4[i];
+    /* 1: select0ql */
+    {
+      orc_union64 _src;
+      _src.i = var32.i;
+      var33.i = _src.x2[0];
+    }
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
+
+void
+video_orc_pack_P010_uv (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 80, 48, 49, 48, 95, 117, 118, 11, 4, 4, 12, 8, 8, 192,
+        0, 4, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_P010_uv);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_P010_uv");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_P010_uv);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 8, "s1");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_D1, ORC_VAR_S1,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_GRAY8 */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var33;
+#else
+  orc_int8 var33;
+#endif
+  orc_int8 var34;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union32 var36;
+  orc_union16 var37;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_int8 *) s1;
+
+  /* 0: loadpb */
+  var33 = (int) 0x000000ff;     /* 255 or 1.25987e-321f */
+  /* 3: loadpw */
+  var35.i = (int) 0x00008080;   /* 32896 or 1.62528e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadb */
+    var34 = ptr4[i];
+    /* 2: mergebw */
+    {
+      orc_union16 _dest;
+      _dest.x2[0] = var33;
+      _dest.x2[1] = var34;
+      var37.i = _dest.i;
+    }
+    /* 4: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var35.i;
+      var36.i = _dest.i;
+    }
+    /* 5: storel */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_GRAY8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var33;
+#else
+  orc_int8 var33;
+#endif
+  orc_int8 var34;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var35;
+#else
+  orc_union16 var35;
+#endif
+  orc_union32 var36;
+  orc_union16 var37;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_int8 *) ex->arrays[4];
+
+  /* 0: loadpb */
+  var33 = (int) 0x000000ff;     /* 255 or 1.25987e-321f */
+  /* 3: loadpw */
+  var35.i = (int) 0x00008080;   /* 32896 or 1.62528e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadb */
+    var34 = ptr4[i];
+    /* 2: mergebw */
+    {
+      orc_union16 _dest;
+      _dest.x2[0] = var33;
+      _dest.x2[1] = var34;
+      var37.i = _dest.i;
+    }
+    /* 4: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var37.i;
+      _dest.x2[1] = var35.i;
+      var36.i = _dest.i;
+    }
+    /* 5: storel */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+video_orc_unpack_GRAY8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 22, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 71, 82, 65, 89, 56, 11, 4, 4, 12, 1, 1, 14,
+        1, 255, 0, 0, 0, 14, 2, 128, 128, 0, 0, 20, 2, 196, 32, 16,
+        4, 195, 0, 32, 17, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_GRAY8);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_GRAY8");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_GRAY8);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 1, "s1");
+      orc_program_add_constant (p, 1, 0x000000ff, "c1");
+      orc_program_add_constant (p, 2, 0x00008080, "c2");
+      orc_program_add_temporary (p, 2, "t1");
+
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_GRAY8 */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    int n)
+{
+  int i;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_int8 var34;
+  orc_union16 var35;
+
+  ptr0 = (orc_int8 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+      orc_union32 _src;
+      _src.i = var33.i;
+      var35.i = _src.x2[0];
+    }
+    /* 2: select1wb */
+    {
+      orc_union16 _src;
+      _src.i = var35.i;
+      var34 = _src.x2[1];
+    }
+    /* 3: storeb */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_pack_GRAY8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_int8 var34;
+  orc_union16 var35;
+
+  ptr0 = (orc_int8 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+      orc_union32 _src;
+      _src.i = var33.i;
+      var35.i = _src.x2[0];
+    }
+    /* 2: select1wb */
+    {
+      orc_union16 _src;
+      _src.i = var35.i;
+      var34 = _src.x2[1];
+    }
+    /* 3: storeb */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+video_orc_pack_GRAY8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 20, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 112, 97, 99,
+        107, 95, 71, 82, 65, 89, 56, 11, 1, 1, 12, 4, 4, 20, 2, 190,
+        32, 4, 189, 0, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_pack_GRAY8);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_pack_GRAY8");
+      orc_program_set_backup_function (p, _backup_video_orc_pack_GRAY8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_temporary (p, 2, "t1");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_unpack_BGRA */
+#ifdef DISABLE_ORC
+void
+video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: swapl */
+    var33.i = ORC_SWAP_L (var32.i);
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
+
+#else
+static void
+_backup_video_orc_unpack_BGRA (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: swapl */
+    var33.i = ORC_SWAP_L (var32.i);
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
+
+void
+video_orc_unpack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 21, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 117, 110, 112,
+        97, 99, 107, 95, 66, 71, 82, 65, 11, 4, 4, 12, 4, 4, 184, 0,
+        4, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_BGRA);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_unpack_BGRA");
+      orc_program_set_backup_function (p, _backup_video_orc_unpack_BGRA);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+
+      orc_program_append_2 (p, "swapl", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_pack_BGRA */
+#ifdef DISABLE_ORC
+void
+video_orc_pack_BGRA (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var32 = ptr4[i];
+    /* 1: swapl */
+    var33.i = ORC_SWAP_L (var32.i);
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
 
 #else
 static void
@@ -22921,19 +27387,197 @@ video_orc_convert_I420_ARGB (guint8 * ORC_RESTRICT d1,
     p_inited = TRUE;
     orc_once_mutex_unlock ();
   }
-  ex->arrays[ORC_VAR_A2] = c;
-  ex->program = 0;
-
-  ex->n = n;
-  ex->arrays[ORC_VAR_D1] = d1;
-  ex->arrays[ORC_VAR_S1] = (void *) s1;
-  ex->arrays[ORC_VAR_S2] = (void *) s2;
-  ex->arrays[ORC_VAR_S3] = (void *) s3;
-  ex->params[ORC_VAR_P1] = p1;
-  ex->params[ORC_VAR_P2] = p2;
-  ex->params[ORC_VAR_P3] = p3;
-  ex->params[ORC_VAR_P4] = p4;
-  ex->params[ORC_VAR_P5] = p5;
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+  ex->params[ORC_VAR_P5] = p5;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_orc_matrix8 */
+#ifdef DISABLE_ORC
+void
+video_orc_matrix8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    orc_int64 p1, orc_int64 p2, orc_int64 p3, orc_int64 p4, int n)
+{
+  _custom_video_orc_matrix8 (d1, s1, p1, p2, p3, p4, n);
+}
+
+#else
+static void
+_backup_video_orc_matrix8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  _custom_video_orc_matrix8 (ex->arrays[ORC_VAR_D1], ex->arrays[ORC_VAR_S1],
+      (ex->params[ORC_VAR_P1] & 0xffffffff) |
+      ((orc_uint64) (ex->params[ORC_VAR_T1]) << 32),
+      (ex->params[ORC_VAR_P2] & 0xffffffff) |
+      ((orc_uint64) (ex->params[ORC_VAR_T2]) << 32),
+      (ex->params[ORC_VAR_P3] & 0xffffffff) |
+      ((orc_uint64) (ex->params[ORC_VAR_T3]) << 32),
+      (ex->params[ORC_VAR_P4] & 0xffffffff) |
+      ((orc_uint64) (ex->params[ORC_VAR_T4]) << 32), ex->n);
+}
+
+void
+video_orc_matrix8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
+    orc_int64 p1, orc_int64 p2, orc_int64 p3, orc_int64 p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 17, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 109, 97, 116,
+        114, 105, 120, 56, 11, 4, 4, 12, 4, 4, 14, 1, 128, 0, 0, 0,
+        18, 8, 18, 8, 18, 8, 18, 8, 20, 2, 20, 2, 20, 1, 20, 1,
+        20, 4, 20, 4, 20, 8, 20, 8, 20, 8, 20, 8, 20, 8, 134, 40,
+        24, 134, 41, 25, 134, 42, 26, 21, 2, 65, 36, 4, 16, 190, 32, 36,
+        191, 33, 36, 188, 34, 32, 189, 35, 32, 150, 32, 34, 154, 36, 32, 21,
+        2, 196, 38, 36, 36, 152, 36, 35, 194, 39, 36, 36, 21, 2, 90, 39,
+        39, 40, 21, 2, 70, 38, 38, 39, 188, 34, 33, 152, 36, 34, 194, 39,
+        36, 36, 21, 2, 90, 39, 39, 41, 21, 2, 70, 38, 38, 39, 189, 35,
+        33, 152, 36, 35, 194, 39, 36, 36, 21, 2, 90, 39, 39, 42, 21, 2,
+        70, 38, 38, 39, 21, 2, 159, 37, 38, 21, 2, 33, 0, 37, 16, 2,
+        0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_video_orc_matrix8);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_orc_matrix8");
+      orc_program_set_backup_function (p, _backup_video_orc_matrix8);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_constant (p, 1, 0x00000080, "c1");
+      orc_program_add_parameter_int64 (p, 8, "p1");
+      orc_program_add_parameter_int64 (p, 8, "p2");
+      orc_program_add_parameter_int64 (p, 8, "p3");
+      orc_program_add_parameter_int64 (p, 8, "p4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+      orc_program_add_temporary (p, 1, "t4");
+      orc_program_add_temporary (p, 4, "t5");
+      orc_program_add_temporary (p, 4, "t6");
+      orc_program_add_temporary (p, 8, "t7");
+      orc_program_add_temporary (p, 8, "t8");
+      orc_program_add_temporary (p, 8, "t9");
+      orc_program_add_temporary (p, 8, "t10");
+      orc_program_add_temporary (p, 8, "t11");
+
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T9, ORC_VAR_P1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T10, ORC_VAR_P2, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T11, ORC_VAR_P3, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "subb", 2, ORC_VAR_T5, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_T5,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_T5,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T3, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T4, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T1, ORC_VAR_T3, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T5, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 2, ORC_VAR_T7, ORC_VAR_T5, ORC_VAR_T5,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "splatbl", 0, ORC_VAR_T5, ORC_VAR_T4, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T8, ORC_VAR_T5, ORC_VAR_T5,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulhsw", 2, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T9,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 2, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_T8,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "splatbl", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T8, ORC_VAR_T5, ORC_VAR_T5,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulhsw", 2, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T10,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 2, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_T8,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T4, ORC_VAR_T2,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "splatbl", 0, ORC_VAR_T5, ORC_VAR_T4, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T8, ORC_VAR_T5, ORC_VAR_T5,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulhsw", 2, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T11,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 2, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_T8,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 2, ORC_VAR_T6, ORC_VAR_T7,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addb", 2, ORC_VAR_D1, ORC_VAR_T6, ORC_VAR_C1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  {
+    orc_union64 tmp;
+    tmp.i = p1;
+    ex->params[ORC_VAR_P1] = ((orc_uint64) tmp.i) & 0xffffffff;
+    ex->params[ORC_VAR_T1] = ((orc_uint64) tmp.i) >> 32;
+  }
+  {
+    orc_union64 tmp;
+    tmp.i = p2;
+    ex->params[ORC_VAR_P2] = ((orc_uint64) tmp.i) & 0xffffffff;
+    ex->params[ORC_VAR_T2] = ((orc_uint64) tmp.i) >> 32;
+  }
+  {
+    orc_union64 tmp;
+    tmp.i = p3;
+    ex->params[ORC_VAR_P3] = ((orc_uint64) tmp.i) & 0xffffffff;
+    ex->params[ORC_VAR_T3] = ((orc_uint64) tmp.i) >> 32;
+  }
+  {
+    orc_union64 tmp;
+    tmp.i = p4;
+    ex->params[ORC_VAR_P4] = ((orc_uint64) tmp.i) & 0xffffffff;
+    ex->params[ORC_VAR_T4] = ((orc_uint64) tmp.i) >> 32;
+  }
 
   func = c->exec;
   func (ex);
@@ -22941,33 +27585,424 @@ video_orc_convert_I420_ARGB (guint8 * ORC_RESTRICT d1,
 #endif
 
 
-/* video_orc_matrix8 */
+/* video_orc_matrix16 */
 #ifdef DISABLE_ORC
 void
-video_orc_matrix8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    orc_int64 p1, orc_int64 p2, orc_int64 p3, orc_int64 p4, int n)
+video_orc_matrix16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1,
+    orc_int64 p1, orc_int64 p2, orc_int64 p3, orc_int64 p4, int p5, int p6,
+    int p7, int p8, int n)
 {
-  _custom_video_orc_matrix8 (d1, s1, p1, p2, p3, p4, n);
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union64 var51;
+  orc_union64 var52;
+  orc_union64 var53;
+  orc_union64 var54;
+  orc_union64 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union16 var58;
+  orc_union16 var59;
+  orc_union16 var60;
+  orc_union16 var61;
+  orc_union32 var62;
+  orc_union32 var63;
+  orc_union32 var64;
+  orc_union64 var65;
+  orc_union64 var66;
+  orc_union64 var67;
+  orc_union64 var68;
+  orc_union64 var69;
+  orc_union64 var70;
+  orc_union64 var71;
+  orc_union64 var72;
+  orc_union64 var73;
+  orc_union64 var74;
+  orc_union32 var75;
+  orc_union32 var76;
+  orc_union32 var77;
+  orc_union32 var78;
+  orc_union32 var79;
+  orc_union32 var80;
+  orc_union32 var81;
+  orc_union32 var82;
+  orc_union16 var83;
+  orc_union16 var84;
+  orc_union16 var85;
+  orc_union32 var86;
+  orc_union32 var87;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union64 *) s1;
+
+  /* 0: loadpq */
+  var52.i = p1;
+  /* 1: loadpq */
+  var53.i = p2;
+  /* 2: loadpq */
+  var54.i = p3;
+  /* 3: loadpq */
+  var55.i = p4;
+  /* 22: loadpl */
+  var47.i = p5;
+  /* 24: loadpl */
+  var48.i = p6;
+  /* 27: loadpl */
+  var49.i = p7;
+  /* 30: loadpl */
+  var50.i = p8;
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadq */
+    var46 = ptr4[i];
+    /* 5: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var46.i;
+      var56.i = _src.x2[1];
+      var57.i = _src.x2[0];
+    }
+    /* 6: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var57.i;
+      var58.i = _src.x2[1];
+      var59.i = _src.x2[0];
+    }
+    /* 7: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var56.i;
+      var60.i = _src.x2[1];
+      var61.i = _src.x2[0];
+    }
+    /* 8: convuwl */
+    var62.i = (orc_uint16) var58.i;
+    /* 9: convuwl */
+    var63.i = (orc_uint16) var61.i;
+    /* 10: convuwl */
+    var64.i = (orc_uint16) var60.i;
+    /* 11: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var62.i;
+      _dest.x2[1] = var62.i;
+      var65.i = _dest.i;
+    }
+    /* 12: mulll */
+    var66.x2[0] =
+        (((orc_uint32) var65.x2[0]) * ((orc_uint32) var52.x2[0])) & 0xffffffff;
+    var66.x2[1] =
+        (((orc_uint32) var65.x2[1]) * ((orc_uint32) var52.x2[1])) & 0xffffffff;
+    /* 13: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var63.i;
+      _dest.x2[1] = var63.i;
+      var67.i = _dest.i;
+    }
+    /* 14: mulll */
+    var68.x2[0] =
+        (((orc_uint32) var67.x2[0]) * ((orc_uint32) var53.x2[0])) & 0xffffffff;
+    var68.x2[1] =
+        (((orc_uint32) var67.x2[1]) * ((orc_uint32) var53.x2[1])) & 0xffffffff;
+    /* 15: addl */
+    var69.x2[0] = ((orc_uint32) var66.x2[0]) + ((orc_uint32) var68.x2[0]);
+    var69.x2[1] = ((orc_uint32) var66.x2[1]) + ((orc_uint32) var68.x2[1]);
+    /* 16: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var64.i;
+      _dest.x2[1] = var64.i;
+      var70.i = _dest.i;
+    }
+    /* 17: mulll */
+    var71.x2[0] =
+        (((orc_uint32) var70.x2[0]) * ((orc_uint32) var54.x2[0])) & 0xffffffff;
+    var71.x2[1] =
+        (((orc_uint32) var70.x2[1]) * ((orc_uint32) var54.x2[1])) & 0xffffffff;
+    /* 18: addl */
+    var72.x2[0] = ((orc_uint32) var69.x2[0]) + ((orc_uint32) var71.x2[0]);
+    var72.x2[1] = ((orc_uint32) var69.x2[1]) + ((orc_uint32) var71.x2[1]);
+    /* 19: addl */
+    var73.x2[0] = ((orc_uint32) var72.x2[0]) + ((orc_uint32) var55.x2[0]);
+    var73.x2[1] = ((orc_uint32) var72.x2[1]) + ((orc_uint32) var55.x2[1]);
+    /* 20: shrsl */
+    var74.x2[0] = var73.x2[0] >> 8;
+    var74.x2[1] = var73.x2[1] >> 8;
+    /* 21: convsuslw */
+    var75.x2[0] = ORC_CLAMP_UW (var74.x2[0]);
+    var75.x2[1] = ORC_CLAMP_UW (var74.x2[1]);
+    /* 23: mulll */
+    var76.i = (((orc_uint32) var62.i) * ((orc_uint32) var47.i)) & 0xffffffff;
+    /* 25: mulll */
+    var77.i = (((orc_uint32) var63.i) * ((orc_uint32) var48.i)) & 0xffffffff;
+    /* 26: addl */
+    var78.i = ((orc_uint32) var76.i) + ((orc_uint32) var77.i);
+    /* 28: mulll */
+    var79.i = (((orc_uint32) var64.i) * ((orc_uint32) var49.i)) & 0xffffffff;
+    /* 29: addl */
+    var80.i = ((orc_uint32) var78.i) + ((orc_uint32) var79.i);
+    /* 31: addl */
+    var81.i = ((orc_uint32) var80.i) + ((orc_uint32) var50.i);
+    /* 32: shrsl */
+    var82.i = var81.i >> 8;
+    /* 33: convsuslw */
+    var83.i = ORC_CLAMP_UW (var82.i);
+    /* 34: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var75.i;
+      var84.i = _src.x2[1];
+      var85.i = _src.x2[0];
+    }
+    /* 35: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var59.i;
+      _dest.x2[1] = var85.i;
+      var86.i = _dest.i;
+    }
+    /* 36: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var84.i;
+      _dest.x2[1] = var83.i;
+      var87.i = _dest.i;
+    }
+    /* 37: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var86.i;
+      _dest.x2[1] = var87.i;
+      var51.i = _dest.i;
+    }
+    /* 38: storeq */
+    ptr0[i] = var51;
+  }
+
 }
 
 #else
 static void
-_backup_video_orc_matrix8 (OrcExecutor * ORC_RESTRICT ex)
+_backup_video_orc_matrix16 (OrcExecutor * ORC_RESTRICT ex)
 {
-  _custom_video_orc_matrix8 (ex->arrays[ORC_VAR_D1], ex->arrays[ORC_VAR_S1],
-      (ex->params[ORC_VAR_P1] & 0xffffffff) |
-      ((orc_uint64) (ex->params[ORC_VAR_T1]) << 32),
-      (ex->params[ORC_VAR_P2] & 0xffffffff) |
-      ((orc_uint64) (ex->params[ORC_VAR_T2]) << 32),
-      (ex->params[ORC_VAR_P3] & 0xffffffff) |
-      ((orc_uint64) (ex->params[ORC_VAR_T3]) << 32),
-      (ex->params[ORC_VAR_P4] & 0xffffffff) |
-      ((orc_uint64) (ex->params[ORC_VAR_T4]) << 32), ex->n);
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union64 var51;
+  orc_union64 var52;
+  orc_union64 var53;
+  orc_union64 var54;
+  orc_union64 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union16 var58;
+  orc_union16 var59;
+  orc_union16 var60;
+  orc_union16 var61;
+  orc_union32 var62;
+  orc_union32 var63;
+  orc_union32 var64;
+  orc_union64 var65;
+  orc_union64 var66;
+  orc_union64 var67;
+  orc_union64 var68;
+  orc_union64 var69;
+  orc_union64 var70;
+  orc_union64 var71;
+  orc_union64 var72;
+  orc_union64 var73;
+  orc_union64 var74;
+  orc_union32 var75;
+  orc_union32 var76;
+  orc_union32 var77;
+  orc_union32 var78;
+  orc_union32 var79;
+  orc_union32 var80;
+  orc_union32 var81;
+  orc_union32 var82;
+  orc_union16 var83;
+  orc_union16 var84;
+  orc_union16 var85;
+  orc_union32 var86;
+  orc_union32 var87;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+  /* 0: loadpq */
+  var52.i =
+      (ex->params[24] & 0xffffffff) | ((orc_uint64) (ex->params[24 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 1: loadpq */
+  var53.i =
+      (ex->params[25] & 0xffffffff) | ((orc_uint64) (ex->params[25 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 2: loadpq */
+  var54.i =
+      (ex->params[26] & 0xffffffff) | ((orc_uint64) (ex->params[26 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 3: loadpq */
+  var55.i =
+      (ex->params[27] & 0xffffffff) | ((orc_uint64) (ex->params[27 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 22: loadpl */
+  var47.i = ex->params[28];
+  /* 24: loadpl */
+  var48.i = ex->params[29];
+  /* 27: loadpl */
+  var49.i = ex->params[30];
+  /* 30: loadpl */
+  var50.i = ex->params[31];
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadq */
+    var46 = ptr4[i];
+    /* 5: splitql */
+    {
+      orc_union64 _src;
+      _src.i = var46.i;
+      var56.i = _src.x2[1];
+      var57.i = _src.x2[0];
+    }
+    /* 6: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var57.i;
+      var58.i = _src.x2[1];
+      var59.i = _src.x2[0];
+    }
+    /* 7: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var56.i;
+      var60.i = _src.x2[1];
+      var61.i = _src.x2[0];
+    }
+    /* 8: convuwl */
+    var62.i = (orc_uint16) var58.i;
+    /* 9: convuwl */
+    var63.i = (orc_uint16) var61.i;
+    /* 10: convuwl */
+    var64.i = (orc_uint16) var60.i;
+    /* 11: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var62.i;
+      _dest.x2[1] = var62.i;
+      var65.i = _dest.i;
+    }
+    /* 12: mulll */
+    var66.x2[0] =
+        (((orc_uint32) var65.x2[0]) * ((orc_uint32) var52.x2[0])) & 0xffffffff;
+    var66.x2[1] =
+        (((orc_uint32) var65.x2[1]) * ((orc_uint32) var52.x2[1])) & 0xffffffff;
+    /* 13: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var63.i;
+      _dest.x2[1] = var63.i;
+      var67.i = _dest.i;
+    }
+    /* 14: mulll */
+    var68.x2[0] =
+        (((orc_uint32) var67.x2[0]) * ((orc_uint32) var53.x2[0])) & 0xffffffff;
+    var68.x2[1] =
+        (((orc_uint32) var67.x2[1]) * ((orc_uint32) var53.x2[1])) & 0xffffffff;
+    /* 15: addl */
+    var69.x2[0] = ((orc_uint32) var66.x2[0]) + ((orc_uint32) var68.x2[0]);
+    var69.x2[1] = ((orc_uint32) var66.x2[1]) + ((orc_uint32) var68.x2[1]);
+    /* 16: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var64.i;
+      _dest.x2[1] = var64.i;
+      var70.i = _dest.i;
+    }
+    /* 17: mulll */
+    var71.x2[0] =
+        (((orc_uint32) var70.x2[0]) * ((orc_uint32) var54.x2[0])) & 0xffffffff;
+    var71.x2[1] =
+        (((orc_uint32) var70.x2[1]) * ((orc_uint32) var54.x2[1])) & 0xffffffff;
+    /* 18: addl */
+    var72.x2[0] = ((orc_uint32) var69.x2[0]) + ((orc_uint32) var71.x2[0]);
+    var72.x2[1] = ((orc_uint32) var69.x2[1]) + ((orc_uint32) var71.x2[1]);
+    /* 19: addl */
+    var73.x2[0] = ((orc_uint32) var72.x2[0]) + ((orc_uint32) var55.x2[0]);
+    var73.x2[1] = ((orc_uint32) var72.x2[1]) + ((orc_uint32) var55.x2[1]);
+    /* 20: shrsl */
+    var74.x2[0] = var73.x2[0] >> 8;
+    var74.x2[1] = var73.x2[1] >> 8;
+    /* 21: convsuslw */
+    var75.x2[0] = ORC_CLAMP_UW (var74.x2[0]);
+    var75.x2[1] = ORC_CLAMP_UW (var74.x2[1]);
+    /* 23: mulll */
+    var76.i = (((orc_uint32) var62.i) * ((orc_uint32) var47.i)) & 0xffffffff;
+    /* 25: mulll */
+    var77.i = (((orc_uint32) var63.i) * ((orc_uint32) var48.i)) & 0xffffffff;
+    /* 26: addl */
+    var78.i = ((orc_uint32) var76.i) + ((orc_uint32) var77.i);
+    /* 28: mulll */
+    var79.i = (((orc_uint32) var64.i) * ((orc_uint32) var49.i)) & 0xffffffff;
+    /* 29: addl */
+    var80.i = ((orc_uint32) var78.i) + ((orc_uint32) var79.i);
+    /* 31: addl */
+    var81.i = ((orc_uint32) var80.i) + ((orc_uint32) var50.i);
+    /* 32: shrsl */
+    var82.i = var81.i >> 8;
+    /* 33: convsuslw */
+    var83.i = ORC_CLAMP_UW (var82.i);
+    /* 34: splitlw */
+    {
+      orc_union32 _src;
+      _src.i = var75.i;
+      var84.i = _src.x2[1];
+      var85.i = _src.x2[0];
+    }
+    /* 35: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var59.i;
+      _dest.x2[1] = var85.i;
+      var86.i = _dest.i;
+    }
+    /* 36: mergewl */
+    {
+      orc_union32 _dest;
+      _dest.x2[0] = var84.i;
+      _dest.x2[1] = var83.i;
+      var87.i = _dest.i;
+    }
+    /* 37: mergelq */
+    {
+      orc_union64 _dest;
+      _dest.x2[0] = var86.i;
+      _dest.x2[1] = var87.i;
+      var51.i = _dest.i;
+    }
+    /* 38: storeq */
+    ptr0[i] = var51;
+  }
+
 }
 
 void
-video_orc_matrix8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
-    orc_int64 p1, orc_int64 p2, orc_int64 p3, orc_int64 p4, int n)
+video_orc_matrix16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1,
+    orc_int64 p1, orc_int64 p2, orc_int64 p3, orc_int64 p4, int p5, int p6,
+    int p7, int p8, int n)
 {
   OrcExecutor _ex, *ex = &_ex;
   static volatile int p_inited = 0;
@@ -22981,97 +28016,118 @@ video_orc_matrix8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
 
 #if 1
       static const orc_uint8 bc[] = {
-        1, 9, 17, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 109, 97, 116,
-        114, 105, 120, 56, 11, 4, 4, 12, 4, 4, 14, 1, 128, 0, 0, 0,
-        18, 8, 18, 8, 18, 8, 18, 8, 20, 2, 20, 2, 20, 1, 20, 1,
-        20, 4, 20, 4, 20, 8, 20, 8, 20, 8, 20, 8, 20, 8, 134, 40,
-        24, 134, 41, 25, 134, 42, 26, 21, 2, 65, 36, 4, 16, 190, 32, 36,
-        191, 33, 36, 188, 34, 32, 189, 35, 32, 150, 32, 34, 154, 36, 32, 21,
-        2, 196, 38, 36, 36, 152, 36, 35, 194, 39, 36, 36, 21, 2, 90, 39,
-        39, 40, 21, 2, 70, 38, 38, 39, 188, 34, 33, 152, 36, 34, 194, 39,
-        36, 36, 21, 2, 90, 39, 39, 41, 21, 2, 70, 38, 38, 39, 189, 35,
-        33, 152, 36, 35, 194, 39, 36, 36, 21, 2, 90, 39, 39, 42, 21, 2,
-        70, 38, 38, 39, 21, 2, 159, 37, 38, 21, 2, 33, 0, 37, 16, 2,
-        0,
+        1, 9, 18, 118, 105, 100, 101, 111, 95, 111, 114, 99, 95, 109, 97, 116,
+        114, 105, 120, 49, 54, 11, 8, 8, 12, 8, 8, 14, 4, 8, 0, 0,
+        0, 18, 8, 18, 8, 18, 8, 18, 8, 16, 4, 16, 4, 16, 4, 16,
+        4, 20, 2, 20, 2, 20, 2, 20, 2, 20, 4, 20, 4, 20, 4, 20,
+        4, 20, 8, 20, 8, 20, 8, 20, 8, 20, 8, 20, 8, 134, 42, 24,
+        134, 43, 25, 134, 44, 26, 134, 45, 27, 197, 37, 36, 4, 198, 33, 32,
+        36, 198, 35, 34, 37, 154, 36, 33, 154, 37, 34, 154, 38, 35, 194, 40,
+        36, 36, 21, 1, 120, 40, 40, 42, 194, 41, 37, 37, 21, 1, 120, 41,
+        41, 43, 21, 1, 103, 40, 40, 41, 194, 41, 38, 38, 21, 1, 120, 41,
+        41, 44, 21, 1, 103, 40, 40, 41, 21, 1, 103, 40, 40, 45, 21, 1,
+        125, 40, 40, 16, 21, 1, 166, 39, 40, 120, 36, 36, 28, 120, 37, 37,
+        29, 103, 36, 36, 37, 120, 38, 38, 30, 103, 36, 36, 38, 103, 36, 36,
+        31, 125, 36, 36, 16, 166, 35, 36, 198, 34, 33, 39, 195, 36, 32, 33,
+        195, 37, 34, 35, 194, 0, 36, 37, 2, 0,
       };
       p = orc_program_new_from_static_bytecode (bc);
-      orc_program_set_backup_function (p, _backup_video_orc_matrix8);
+      orc_program_set_backup_function (p, _backup_video_orc_matrix16);
 #else
       p = orc_program_new ();
-      orc_program_set_name (p, "video_orc_matrix8");
-      orc_program_set_backup_function (p, _backup_video_orc_matrix8);
-      orc_program_add_destination (p, 4, "d1");
-      orc_program_add_source (p, 4, "s1");
-      orc_program_add_constant (p, 1, 0x00000080, "c1");
+      orc_program_set_name (p, "video_orc_matrix16");
+      orc_program_set_backup_function (p, _backup_video_orc_matrix16);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 4, 0x00000008, "c1");
       orc_program_add_parameter_int64 (p, 8, "p1");
       orc_program_add_parameter_int64 (p, 8, "p2");
       orc_program_add_parameter_int64 (p, 8, "p3");
       orc_program_add_parameter_int64 (p, 8, "p4");
+      orc_program_add_parameter (p, 4, "p5");
+      orc_program_add_parameter (p, 4, "p6");
+      orc_program_add_parameter (p, 4, "p7");
+      orc_program_add_parameter (p, 4, "p8");
       orc_program_add_temporary (p, 2, "t1");
       orc_program_add_temporary (p, 2, "t2");
-      orc_program_add_temporary (p, 1, "t3");
-      orc_program_add_temporary (p, 1, "t4");
+      orc_program_add_temporary (p, 2, "t3");
+      orc_program_add_temporary (p, 2, "t4");
       orc_program_add_temporary (p, 4, "t5");
       orc_program_add_temporary (p, 4, "t6");
-      orc_program_add_temporary (p, 8, "t7");
-      orc_program_add_temporary (p, 8, "t8");
+      orc_program_add_temporary (p, 4, "t7");
+      orc_program_add_temporary (p, 4, "t8");
       orc_program_add_temporary (p, 8, "t9");
       orc_program_add_temporary (p, 8, "t10");
       orc_program_add_temporary (p, 8, "t11");
+      orc_program_add_temporary (p, 8, "t12");
+      orc_program_add_temporary (p, 8, "t13");
+      orc_program_add_temporary (p, 8, "t14");
 
-      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T9, ORC_VAR_P1, ORC_VAR_D1,
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T11, ORC_VAR_P1, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T10, ORC_VAR_P2, ORC_VAR_D1,
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T12, ORC_VAR_P2, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T11, ORC_VAR_P3, ORC_VAR_D1,
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T13, ORC_VAR_P3, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "subb", 2, ORC_VAR_T5, ORC_VAR_S1, ORC_VAR_C1,
+      orc_program_append_2 (p, "loadpq", 0, ORC_VAR_T14, ORC_VAR_P4, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_T5,
-          ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_T5,
-          ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T3, ORC_VAR_T1,
-          ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T4, ORC_VAR_T1,
-          ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T1, ORC_VAR_T3, ORC_VAR_D1,
+      orc_program_append_2 (p, "splitql", 0, ORC_VAR_T6, ORC_VAR_T5, ORC_VAR_S1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T5, ORC_VAR_T1, ORC_VAR_D1,
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_T5,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mergebw", 2, ORC_VAR_T7, ORC_VAR_T5, ORC_VAR_T5,
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_T6,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "splatbl", 0, ORC_VAR_T5, ORC_VAR_T4, ORC_VAR_D1,
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T5, ORC_VAR_T2, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T8, ORC_VAR_T5, ORC_VAR_T5,
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T6, ORC_VAR_T3, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mulhsw", 2, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T9,
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T7, ORC_VAR_T4, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "addw", 2, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_T8,
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T9, ORC_VAR_T5, ORC_VAR_T5,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T3, ORC_VAR_T2,
-          ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "splatbl", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1,
+      orc_program_append_2 (p, "mulll", 1, ORC_VAR_T9, ORC_VAR_T9, ORC_VAR_T11,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T8, ORC_VAR_T5, ORC_VAR_T5,
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T10, ORC_VAR_T6,
+          ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "mulll", 1, ORC_VAR_T10, ORC_VAR_T10,
+          ORC_VAR_T12, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 1, ORC_VAR_T9, ORC_VAR_T9, ORC_VAR_T10,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mulhsw", 2, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T10,
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T10, ORC_VAR_T7,
+          ORC_VAR_T7, ORC_VAR_D1);
+      orc_program_append_2 (p, "mulll", 1, ORC_VAR_T10, ORC_VAR_T10,
+          ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 1, ORC_VAR_T9, ORC_VAR_T9, ORC_VAR_T10,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "addw", 2, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_T8,
+      orc_program_append_2 (p, "addl", 1, ORC_VAR_T9, ORC_VAR_T9, ORC_VAR_T14,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T4, ORC_VAR_T2,
+      orc_program_append_2 (p, "shrsl", 1, ORC_VAR_T9, ORC_VAR_T9, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsuslw", 1, ORC_VAR_T8, ORC_VAR_T9,
           ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "splatbl", 0, ORC_VAR_T5, ORC_VAR_T4, ORC_VAR_D1,
+      orc_program_append_2 (p, "mulll", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P5,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_T8, ORC_VAR_T5, ORC_VAR_T5,
+      orc_program_append_2 (p, "mulll", 0, ORC_VAR_T6, ORC_VAR_T6, ORC_VAR_P6,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "mulhsw", 2, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T11,
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_T6,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "addw", 2, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_T8,
+      orc_program_append_2 (p, "mulll", 0, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_P7,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "convssswb", 2, ORC_VAR_T6, ORC_VAR_T7,
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_T7,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P8,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsuslw", 0, ORC_VAR_T4, ORC_VAR_T5,
           ORC_VAR_D1, ORC_VAR_D1);
-      orc_program_append_2 (p, "addb", 2, ORC_VAR_D1, ORC_VAR_T6, ORC_VAR_C1,
+      orc_program_append_2 (p, "splitlw", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_T8,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T5, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T6, ORC_VAR_T3, ORC_VAR_T4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T5, ORC_VAR_T6,
           ORC_VAR_D1);
 #endif
 
@@ -23112,6 +28168,10 @@ video_orc_matrix8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1,
     ex->params[ORC_VAR_P4] = ((orc_uint64) tmp.i) & 0xffffffff;
     ex->params[ORC_VAR_T4] = ((orc_uint64) tmp.i) >> 32;
   }
+  ex->params[ORC_VAR_P5] = p5;
+  ex->params[ORC_VAR_P6] = p6;
+  ex->params[ORC_VAR_P7] = p7;
+  ex->params[ORC_VAR_P8] = p8;
 
   func = c->exec;
   func (ex);
@@ -93,6 +93,8 @@ static gboolean gst_audio_convert_transform_meta (GstBaseTransform * trans,
     GstBuffer * outbuf, GstMeta * meta, GstBuffer * inbuf);
 static GstFlowReturn gst_audio_convert_submit_input_buffer (GstBaseTransform *
     base, gboolean is_discont, GstBuffer * input);
+static gboolean gst_audio_convert_propose_allocation (GstBaseTransform * base,
+    GstQuery * decide_query, GstQuery * query);
 static void gst_audio_convert_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_audio_convert_get_property (GObject * object, guint prop_id,
@@ -123,7 +125,7 @@ G_DEFINE_TYPE_WITH_CODE (GstAudioConvert, gst_audio_convert,
 
 #define STATIC_CAPS \
 GST_STATIC_CAPS (GST_AUDIO_CAPS_MAKE (GST_AUDIO_FORMATS_ALL) \
-    ", layout = (string) interleaved")
+    ", layout = (string) { interleaved, non-interleaved }")
 
 static GstStaticPadTemplate gst_audio_convert_src_template =
 GST_STATIC_PAD_TEMPLATE ("src",
@@ -186,6 +188,8 @@ gst_audio_convert_class_init (GstAudioConvertClass * klass)
       GST_DEBUG_FUNCPTR (gst_audio_convert_transform_meta);
   basetransform_class->submit_input_buffer =
       GST_DEBUG_FUNCPTR (gst_audio_convert_submit_input_buffer);
+  basetransform_class->propose_allocation =
+      GST_DEBUG_FUNCPTR (gst_audio_convert_propose_allocation);
 
   basetransform_class->passthrough_on_same_caps = TRUE;
   basetransform_class->transform_ip_on_passthrough = FALSE;
@@ -262,7 +266,7 @@ gst_audio_convert_caps_remove_format_info (GstCaps * caps, gboolean channels)
       continue;
 
     st = gst_structure_copy (st);
-    gst_structure_remove_field (st, "format");
+    gst_structure_remove_fields (st, "format", "layout", NULL);
 
     /* Only remove the channels and channel-mask for non-NONE layouts */
     if (gst_structure_get (st, "channel-mask", GST_TYPE_BITMASK, &channel_mask,
@@ -602,6 +606,7 @@ gst_audio_convert_fixate_caps (GstBaseTransform * base,
 {
   GstStructure *ins, *outs;
   GstCaps *result;
+  const gchar *layout;
 
   GST_DEBUG_OBJECT (base, "trying to fixate othercaps %" GST_PTR_FORMAT
       " based on caps %" GST_PTR_FORMAT, othercaps, caps);
@@ -638,6 +643,10 @@ gst_audio_convert_fixate_caps (GstBaseTransform * base,
   gst_audio_convert_fixate_channels (base, ins, outs);
   gst_audio_convert_fixate_format (base, ins, outs);
 
+  /* keep the input layout so that no reordering is needed */
+  if ((layout = gst_structure_get_string (ins, "layout")))
+    gst_structure_fixate_field_string (outs, "layout", layout);
+
   /* fixate remaining */
   result = gst_caps_fixate (result);
 
@@ -679,6 +688,7 @@ gst_audio_convert_set_caps (GstBaseTransform * base, GstCaps * incaps,
     goto no_converter;
 
   in_place = gst_audio_converter_supports_inplace (this->convert);
+  GST_DEBUG_OBJECT (base, "converting in place: %d", in_place);
   gst_base_transform_set_in_place (base, in_place);
 
   this->in_info = in_info;
@@ -704,6 +714,28 @@ no_converter:
   }
 }
 
+/* points @planes to the channel data in @data. For non-interleaved buffers
+ * the plane offsets are taken from @meta, or else the planes are assumed to
+ * be packed one after the other. */
+static void
+gst_audio_convert_get_planes (GstAudioInfo * info, GstAudioMeta * meta,
+    guint8 * data, gsize samples, gpointer planes[])
+{
+  gint i;
+
+  if (GST_AUDIO_INFO_LAYOUT (info) == GST_AUDIO_LAYOUT_INTERLEAVED) {
+    planes[0] = data;
+    return;
+  }
+
+  for (i = 0; i < GST_AUDIO_INFO_CHANNELS (info); i++) {
+    if (meta && meta->offsets)
+      planes[i] = data + meta->offsets[i];
+    else
+      planes[i] = data + i * samples * GST_AUDIO_INFO_BPS (info);
+  }
+}
+
 /* if called through gst_audio_convert_transform_ip() inbuf == outbuf */
 static GstFlowReturn
 gst_audio_convert_transform (GstBaseTransform * base, GstBuffer * inbuf,
@@ -715,10 +747,16 @@ gst_audio_convert_transform (GstBaseTransform * base, GstBuffer * inbuf,
   gint insize, outsize;
   gboolean inbuf_writable;
   GstAudioConverterFlags flags;
+  GstAudioMeta *inmeta, *outmeta;
   gsize samples;
 
-  /* get amount of samples to convert. */
-  samples = gst_buffer_get_size (inbuf) / this->in_info.bpf;
+  /* get amount of samples to convert. Non-interleaved buffers might have
+   * padding between the planes so use the meta when there is one. */
+  inmeta = gst_buffer_get_audio_meta (inbuf);
+  if (inmeta)
+    samples = inmeta->samples;
+  else
+    samples = gst_buffer_get_size (inbuf) / this->in_info.bpf;
 
   /* get in/output sizes, to see if the buffers we got are of correct
    * sizes */
@@ -728,6 +766,25 @@ gst_audio_convert_transform (GstBaseTransform * base, GstBuffer * inbuf,
   if (insize == 0 || outsize == 0)
     return GST_FLOW_OK;
 
+  /* describe the planes of non-interleaved output for downstream. When
+   * converting in place the samples keep their size and position, so the
+   * offsets of the input meta stay valid but the format changes */
+  outmeta = inmeta;
+  if (inbuf == outbuf) {
+    if (outmeta)
+      outmeta->info = this->out_info;
+  } else {
+    outmeta = gst_buffer_get_audio_meta (outbuf);
+    if (!outmeta && this->out_info.layout == GST_AUDIO_LAYOUT_NON_INTERLEAVED) {
+      if (gst_buffer_get_size (outbuf) > outsize)
+        gst_buffer_set_size (outbuf, outsize);
+      outmeta = gst_buffer_add_audio_meta (outbuf, &this->out_info, samples,
+          NULL);
+      if (!outmeta)
+        goto no_meta;
+    }
+  }
+
   /* get src and dst data */
   if (inbuf != outbuf) {
     inbuf_writable = gst_buffer_is_writable (inbuf)
@@ -757,8 +814,16 @@ gst_audio_convert_transform (GstBaseTransform * base, GstBuffer * inbuf,
     flags |= GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE;
 
   if (!GST_BUFFER_FLAG_IS_SET (inbuf, GST_BUFFER_FLAG_GAP)) {
-    gpointer in[1] = { srcmap.data };
-    gpointer out[1] = { dstmap.data };
+    gpointer *in, *out;
+
+    in = g_newa (gpointer, this->in_info.channels);
+    out = g_newa (gpointer, this->out_info.channels);
+
+    if (inbuf != outbuf)
+      gst_audio_convert_get_planes (&this->in_info, inmeta, srcmap.data,
+          samples, in);
+    gst_audio_convert_get_planes (&this->out_info, outmeta, dstmap.data,
+        samples, out);
 
     if (!gst_audio_converter_samples (this->convert, flags,
             inbuf != outbuf ? in : out, samples, out, samples))
@@ -777,6 +842,13 @@ done:
   return ret;
 
   /* ERRORS */
+no_meta:
+  {
+    GST_ELEMENT_ERROR (this, STREAM, FORMAT,
+        (NULL), ("output buffer can't hold %" G_GSIZE_FORMAT " samples",
+            samples));
+    return GST_FLOW_ERROR;
+  }
 wrong_size:
   {
     GST_ELEMENT_ERROR (this, STREAM, FORMAT,
@@ -839,7 +911,10 @@ gst_audio_convert_submit_input_buffer (GstBaseTransform * base,
 {
   GstAudioConvert *this = GST_AUDIO_CONVERT (base);
 
-  if (base->segment.format == GST_FORMAT_TIME) {
+  /* clipping works on interleaved samples only, it would cut through the
+   * planes of non-interleaved buffers */
+  if (base->segment.format == GST_FORMAT_TIME
+      && this->in_info.layout == GST_AUDIO_LAYOUT_INTERLEAVED) {
     input =
         gst_audio_buffer_clip (input, &base->segment, this->in_info.rate,
         this->in_info.bpf);
@@ -852,6 +927,22 @@ gst_audio_convert_submit_input_buffer (GstBaseTransform * base,
       is_discont, input);
 }
 
+static gboolean
+gst_audio_convert_propose_allocation (GstBaseTransform * base,
+    GstQuery * decide_query, GstQuery * query)
+{
+  if (!GST_BASE_TRANSFORM_CLASS (parent_class)->propose_allocation (base,
+          decide_query, query))
+    return FALSE;
+
+  /* we are not in passthrough and can handle any plane layout upstream
+   * describes with a GstAudioMeta */
+  if (decide_query)
+    gst_query_add_allocation_meta (query, GST_AUDIO_META_API_TYPE, NULL);
+
+  return TRUE;
+}
+
 static void
 gst_audio_convert_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
@@ -125,6 +125,8 @@ static GstFlowReturn gst_audio_resample_submit_input_buffer (GstBaseTransform *
     base, gboolean is_discont, GstBuffer * input);
 static gboolean gst_audio_resample_sink_event (GstBaseTransform * base,
     GstEvent * event);
+static gboolean gst_audio_resample_propose_allocation (GstBaseTransform *
+    base, GstQuery * decide_query, GstQuery * query);
 static gboolean gst_audio_resample_start (GstBaseTransform * base);
 static gboolean gst_audio_resample_stop (GstBaseTransform * base);
 static gboolean gst_audio_resample_query (GstPad * pad, GstObject * parent,
@@ -208,6 +210,8 @@ gst_audio_resample_class_init (GstAudioResampleClass * klass)
       GST_DEBUG_FUNCPTR (gst_audio_resample_transform_meta);
   GST_BASE_TRANSFORM_CLASS (klass)->submit_input_buffer =
       GST_DEBUG_FUNCPTR (gst_audio_resample_submit_input_buffer);
+  GST_BASE_TRANSFORM_CLASS (klass)->propose_allocation =
+      GST_DEBUG_FUNCPTR (gst_audio_resample_propose_allocation);
 
   GST_BASE_TRANSFORM_CLASS (klass)->passthrough_on_same_caps = TRUE;
 }
@@ -521,12 +525,55 @@ invalid_outcaps:
   }
 }
 
+/* points @planes to the channel data in @data. For non-interleaved buffers
+ * the plane offsets are taken from @meta, or else the planes are assumed to
+ * be @stride samples apart. */
+static void
+gst_audio_resample_get_planes (GstAudioInfo * info, GstAudioMeta * meta,
+    guint8 * data, gsize stride, gpointer planes[])
+{
+  gint i;
+
+  if (GST_AUDIO_INFO_LAYOUT (info) == GST_AUDIO_LAYOUT_INTERLEAVED) {
+    planes[0] = data;
+    return;
+  }
+
+  for (i = 0; i < GST_AUDIO_INFO_CHANNELS (info); i++) {
+    if (meta && meta->offsets)
+      planes[i] = data + meta->offsets[i];
+    else
+      planes[i] = data + i * stride * GST_AUDIO_INFO_BPS (info);
+  }
+}
+
+/* describes the @samples long planes of non-interleaved output that are
+ * @stride samples apart */
+static void
+gst_audio_resample_add_meta (GstAudioResample * resample, GstBuffer * outbuf,
+    gsize stride, gsize samples)
+{
+  gsize *offsets;
+  gint i;
+
+  if (resample->out.layout != GST_AUDIO_LAYOUT_NON_INTERLEAVED
+      || gst_buffer_get_audio_meta (outbuf))
+    return;
+
+  offsets = g_newa (gsize, resample->out.channels);
+  for (i = 0; i < resample->out.channels; i++)
+    offsets[i] = i * stride * GST_AUDIO_INFO_BPS (&resample->out);
+
+  gst_buffer_add_audio_meta (outbuf, &resample->out, samples, offsets);
+}
+
 /* Push history_len zeros into the filter, but discard the output. */
 static void
 gst_audio_resample_dump_drain (GstAudioResample * resample, guint history_len)
 {
   gsize out_len, outsize;
-  gpointer out[1];
+  gpointer *out;
+  guint8 *data;
 
   out_len =
       gst_audio_converter_get_out_frames (resample->converter, history_len);
@@ -535,10 +582,12 @@ gst_audio_resample_dump_drain (GstAudioResample * resample, guint history_len)
 
   outsize = out_len * resample->out.bpf;
 
-  out[0] = g_malloc (outsize);
+  data = g_malloc (outsize);
+  out = g_newa (gpointer, resample->out.channels);
+  gst_audio_resample_get_planes (&resample->out, NULL, data, out_len, out);
   gst_audio_converter_samples (resample->converter, 0, NULL, history_len,
       out, out_len);
-  g_free (out[0]);
+  g_free (data);
 }
 
 static void
@@ -549,7 +598,7 @@ gst_audio_resample_push_drain (GstAudioResample * resample, guint history_len)
   gint outsize;
   gsize out_len;
   GstMapInfo map;
-  gpointer out[1];
+  gpointer *out;
 
   g_assert (resample->converter != NULL);
 
@@ -567,12 +616,15 @@ gst_audio_resample_push_drain (GstAudioResample * resample, guint history_len)
 
   gst_buffer_map (outbuf, &map, GST_MAP_WRITE);
 
-  out[0] = map.data;
+  out = g_newa (gpointer, resample->out.channels);
+  gst_audio_resample_get_planes (&resample->out, NULL, map.data, out_len, out);
   gst_audio_converter_samples (resample->converter, 0, NULL, history_len,
       out, out_len);
 
   gst_buffer_unmap (outbuf, &map);
 
+  gst_audio_resample_add_meta (resample, outbuf, out_len, out_len);
+
   /* time */
   if (GST_CLOCK_TIME_IS_VALID (resample->t0)) {
     GST_BUFFER_TIMESTAMP (outbuf) = resample->t0 +
@@ -704,6 +756,7 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
     GstBuffer * outbuf)
 {
   GstMapInfo in_map, out_map;
+  GstAudioMeta *inmeta;
   gsize outsize;
   guint32 in_len;
   guint32 out_len;
@@ -719,7 +772,14 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
       inbuf_writable ? GST_MAP_READWRITE : GST_MAP_READ);
   gst_buffer_map (outbuf, &out_map, GST_MAP_WRITE);
 
-  in_len = in_map.size / resample->in.bpf;
+  /* non-interleaved input might have padding between the planes */
+  inmeta = gst_buffer_get_audio_meta (inbuf);
+  if (inmeta)
+    in_len = inmeta->samples;
+  else
+    in_len = in_map.size / resample->in.bpf;
+  /* the output buffer was sized for the complete input buffer, which is too
+   * much when the input planes are padded */
   out_len = out_map.size / resample->out.bpf;
 
   if (GST_BUFFER_FLAG_IS_SET (inbuf, GST_BUFFER_FLAG_GAP)) {
@@ -771,15 +831,22 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
     }
     {
       /* process */
-      gpointer in[1], out[1];
+      gpointer *in, *out;
       GstAudioConverterFlags flags;
 
       flags = 0;
       if (inbuf_writable)
         flags |= GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE;
 
-      in[0] = in_map.data;
-      out[0] = out_map.data;
+      out_len = MIN (out_len,
+          gst_audio_converter_get_out_frames (resample->converter, in_len));
+
+      in = g_newa (gpointer, resample->in.channels);
+      out = g_newa (gpointer, resample->out.channels);
+      gst_audio_resample_get_planes (&resample->in, inmeta, in_map.data,
+          in_len, in);
+      gst_audio_resample_get_planes (&resample->out, NULL, out_map.data,
+          out_len, out);
       gst_audio_converter_samples (resample->converter, flags, in, in_len,
           out, out_len);
     }
@@ -812,7 +879,12 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
   gst_buffer_unmap (inbuf, &in_map);
   gst_buffer_unmap (outbuf, &out_map);
 
+  /* planes are packed one after the other, drop what we did not fill */
   outsize = out_len * resample->in.bpf;
+  if (outsize < gst_buffer_get_size (outbuf))
+    gst_buffer_set_size (outbuf, outsize);
+
+  gst_audio_resample_add_meta (resample, outbuf, out_len, out_len);
 
   GST_LOG_OBJECT (resample,
       "Converted to buffer of %" G_GUINT32_FORMAT
@@ -849,12 +921,16 @@ gst_audio_resample_transform (GstBaseTransform * base, GstBuffer * inbuf,
   if (G_UNLIKELY (gst_audio_resample_check_discont (resample, inbuf))) {
     gsize size;
     gint bpf = GST_AUDIO_INFO_BPF (&resample->in);
+    GstAudioMeta *meta;
 
     gst_audio_resample_reset_state (resample);
     resample->need_discont = TRUE;
 
     /* need to recalculate the output size */
-    size = gst_buffer_get_size (inbuf) / bpf;
+    if ((meta = gst_buffer_get_audio_meta (inbuf)))
+      size = meta->samples;
+    else
+      size = gst_buffer_get_size (inbuf) / bpf;
     size = gst_audio_converter_get_out_frames (resample->converter, size);
     gst_buffer_set_size (outbuf, size * bpf);
   }
@@ -924,13 +1000,32 @@ gst_audio_resample_transform_meta (GstBaseTransform * trans, GstBuffer * outbuf,
   return FALSE;
 }
 
+static gboolean
+gst_audio_resample_propose_allocation (GstBaseTransform * base,
+    GstQuery * decide_query, GstQuery * query)
+{
+  if (!GST_BASE_TRANSFORM_CLASS (parent_class)->propose_allocation (base,
+          decide_query, query))
+    return FALSE;
+
+  /* we are not in passthrough and can handle any plane layout upstream
+   * describes with a GstAudioMeta */
+  if (decide_query)
+    gst_query_add_allocation_meta (query, GST_AUDIO_META_API_TYPE, NULL);
+
+  return TRUE;
+}
+
 static GstFlowReturn
 gst_audio_resample_submit_input_buffer (GstBaseTransform * base,
     gboolean is_discont, GstBuffer * input)
 {
   GstAudioResample *resample = GST_AUDIO_RESAMPLE (base);
 
-  if (base->segment.format == GST_FORMAT_TIME) {
+  /* clipping works on interleaved samples only, it would cut through the
+   * planes of non-interleaved buffers */
+  if (base->segment.format == GST_FORMAT_TIME
+      && resample->in.layout == GST_AUDIO_LAYOUT_INTERLEAVED) {
     input =
         gst_audio_buffer_clip (input, &base->segment, resample->in.rate,
         resample->in.bpf);
@@ -162,10 +162,6 @@ struct _GstDecodeBin
   GstDecodeChain *decode_chain; /* Top level decode chain */
   guint nbpads;                 /* unique identifier for source pads */
 
-  GMutex factories_lock;
-  guint32 factories_cookie;     /* Cookie from last time when factories was updated */
-  GList *factories;             /* factories we can use for selecting elements */
-
   GMutex subtitle_lock;         /* Protects changes to subtitles and encoding */
   GList *subtitles;             /* List of elements with subtitle-encoding,
                                  * protected by above mutex! */
@@ -187,6 +183,10 @@ struct _GstDecodeBin
   GList *buffering_status;      /* element currently buffering messages */
   GMutex buffering_lock;
   GMutex buffering_post_lock;
+
+  GMutex cache_lock;            /* protects reuse_elements and cached_elements */
+  gboolean reuse_elements;      /* keep the elements of freed chains around */
+  GList *cached_elements;       /* elements for re-use, most recent first */
 };
 
 struct _GstDecodeBinClass
@@ -254,6 +254,10 @@ enum
 #define DEFAULT_POST_STREAM_TOPOLOGY FALSE
 #define DEFAULT_EXPOSE_ALL_STREAMS  TRUE
 #define DEFAULT_CONNECTION_SPEED    0
+#define DEFAULT_REUSE_ELEMENTS      FALSE
+
+/* maximum number of elements kept around for re-use */
+#define MAX_CACHED_ELEMENTS 16
 
 /* Properties */
 enum
@@ -270,7 +274,8 @@ enum
   PROP_MAX_SIZE_TIME,
   PROP_POST_STREAM_TOPOLOGY,
   PROP_EXPOSE_ALL_STREAMS,
-  PROP_CONNECTION_SPEED
+  PROP_CONNECTION_SPEED,
+  PROP_REUSE_ELEMENTS
 };
 
 static GstBinClass *parent_class;
@@ -982,6 +987,21 @@ gst_decode_bin_class_init (GstDecodeBinClass * klass)
           0, G_MAXUINT64 / 1000, DEFAULT_CONNECTION_SPEED,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstDecodeBin2::reuse-elements
+   *
+   * Keep the demuxers, parsers and decoders of a stream around in READY
+   * state after the stream was shut down, and re-use them instead of
+   * creating new elements when the same factories are needed again. This
+   * makes decoding many short streams of the same type cheaper.
+   *
+   * The elements are released when going to the NULL state.
+   */
+  g_object_class_install_property (gobject_klass, PROP_REUSE_ELEMENTS,
+      g_param_spec_boolean ("reuse-elements", "Reuse Elements",
+          "Re-use the elements of previous streams",
+          DEFAULT_REUSE_ELEMENTS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
 
 
   klass->autoplug_continue =
@@ -1015,32 +1035,9 @@ gst_decode_bin_class_init (GstDecodeBinClass * klass)
   g_type_class_ref (GST_TYPE_DECODE_PAD);
 }
 
-/* Must be called with factories lock! */
-static void
-gst_decode_bin_update_factories_list (GstDecodeBin * dbin)
-{
-  guint cookie;
-
-  cookie = gst_registry_get_feature_list_cookie (gst_registry_get ());
-  if (!dbin->factories || dbin->factories_cookie != cookie) {
-    if (dbin->factories)
-      gst_plugin_feature_list_free (dbin->factories);
-    dbin->factories =
-        gst_element_factory_list_get_elements
-        (GST_ELEMENT_FACTORY_TYPE_DECODABLE, GST_RANK_MARGINAL);
-    dbin->factories =
-        g_list_sort (dbin->factories,
-        gst_playback_utils_compare_factories_func);
-    dbin->factories_cookie = cookie;
-  }
-}
-
 static void
 gst_decode_bin_init (GstDecodeBin * decode_bin)
 {
-  /* first filter out the interesting element factories */
-  g_mutex_init (&decode_bin->factories_lock);
-
   /* we create the typefind element only once */
   decode_bin->typefind = gst_element_factory_make ("typefind", "typefind");
   if (!decode_bin->typefind) {
@@ -1095,6 +1092,94 @@ gst_decode_bin_init (GstDecodeBin * decode_bin)
 
   decode_bin->expose_allstreams = DEFAULT_EXPOSE_ALL_STREAMS;
   decode_bin->connection_speed = DEFAULT_CONNECTION_SPEED;
+
+  g_mutex_init (&decode_bin->cache_lock);
+  decode_bin->reuse_elements = DEFAULT_REUSE_ELEMENTS;
+}
+
+/* Returns a new element from @factory, re-using one of a previous stream
+ * if there is one */
+static GstElement *
+gst_decode_bin_create_element (GstDecodeBin * dbin,
+    GstElementFactory * factory)
+{
+  GstElement *element = NULL;
+  GList *l;
+
+  g_mutex_lock (&dbin->cache_lock);
+  for (l = dbin->cached_elements; l; l = l->next) {
+    if (gst_element_get_factory (l->data) == factory) {
+      element = l->data;
+      dbin->cached_elements = g_list_delete_link (dbin->cached_elements, l);
+      break;
+    }
+  }
+  g_mutex_unlock (&dbin->cache_lock);
+
+  if (element) {
+    GST_DEBUG_OBJECT (dbin, "re-using %" GST_PTR_FORMAT, element);
+    return element;
+  }
+
+  return gst_element_factory_create (factory, NULL);
+}
+
+static void
+gst_decode_bin_dispose_element (GstElement * element)
+{
+  /* cached elements are floating */
+  gst_object_ref_sink (element);
+  gst_element_set_state (element, GST_STATE_NULL);
+  gst_object_unref (element);
+}
+
+/* Takes ownership of @element, which is no longer in the bin, and keeps it
+ * around for re-use if enabled */
+static void
+gst_decode_bin_release_element (GstDecodeBin * dbin, GstElement * element)
+{
+  GList *drop = NULL;
+  gboolean reuse;
+
+  g_mutex_lock (&dbin->cache_lock);
+  reuse = dbin->reuse_elements;
+  g_mutex_unlock (&dbin->cache_lock);
+
+  if (!reuse || gst_element_set_state (element,
+          GST_STATE_READY) == GST_STATE_CHANGE_FAILURE) {
+    gst_element_set_state (element, GST_STATE_NULL);
+    gst_object_unref (element);
+    return;
+  }
+
+  /* make it floating again so it can be added like a new element */
+  g_object_force_floating (G_OBJECT (element));
+
+  g_mutex_lock (&dbin->cache_lock);
+  dbin->cached_elements = g_list_prepend (dbin->cached_elements, element);
+  if (g_list_length (dbin->cached_elements) > MAX_CACHED_ELEMENTS) {
+    drop = g_list_last (dbin->cached_elements);
+    dbin->cached_elements = g_list_remove_link (dbin->cached_elements, drop);
+  }
+  g_mutex_unlock (&dbin->cache_lock);
+
+  if (drop) {
+    gst_decode_bin_dispose_element (drop->data);
+    g_list_free (drop);
+  }
+}
+
+static void
+gst_decode_bin_flush_cache (GstDecodeBin * dbin)
+{
+  GList *cached;
+
+  g_mutex_lock (&dbin->cache_lock);
+  cached = dbin->cached_elements;
+  dbin->cached_elements = NULL;
+  g_mutex_unlock (&dbin->cache_lock);
+
+  g_list_free_full (cached, (GDestroyNotify) gst_decode_bin_dispose_element);
 }
 
 static void
@@ -1104,10 +1189,6 @@ gst_decode_bin_dispose (GObject * object)
 
   decode_bin = GST_DECODE_BIN (object);
 
-  if (decode_bin->factories)
-    gst_plugin_feature_list_free (decode_bin->factories);
-  decode_bin->factories = NULL;
-
   if (decode_bin->decode_chain)
     gst_decode_chain_free (decode_bin->decode_chain);
   decode_bin->decode_chain = NULL;
@@ -1122,6 +1203,8 @@ gst_decode_bin_dispose (GObject * object)
   g_list_free (decode_bin->subtitles);
   decode_bin->subtitles = NULL;
 
+  gst_decode_bin_flush_cache (decode_bin);
+
   unblock_pads (decode_bin);
 
   G_OBJECT_CLASS (parent_class)->dispose (object);
@@ -1139,7 +1222,7 @@ gst_decode_bin_finalize (GObject * object)
   g_mutex_clear (&decode_bin->subtitle_lock);
   g_mutex_clear (&decode_bin->buffering_lock);
   g_mutex_clear (&decode_bin->buffering_post_lock);
-  g_mutex_clear (&decode_bin->factories_lock);
+  g_mutex_clear (&decode_bin->cache_lock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -1284,6 +1367,14 @@ gst_decode_bin_set_property (GObject * object, guint prop_id,
       dbin->connection_speed = g_value_get_uint64 (value) * 1000;
       GST_OBJECT_UNLOCK (dbin);
       break;
+    case PROP_REUSE_ELEMENTS:
+      g_mutex_lock (&dbin->cache_lock);
+      dbin->reuse_elements = g_value_get_boolean (value);
+      g_mutex_unlock (&dbin->cache_lock);
+      /* don't keep elements around that will never be used */
+      if (!g_value_get_boolean (value))
+        gst_decode_bin_flush_cache (dbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1336,6 +1427,11 @@ gst_decode_bin_get_property (GObject * object, guint prop_id,
       g_value_set_uint64 (value, dbin->connection_speed / 1000);
       GST_OBJECT_UNLOCK (dbin);
       break;
+    case PROP_REUSE_ELEMENTS:
+      g_mutex_lock (&dbin->cache_lock);
+      g_value_set_boolean (value, dbin->reuse_elements);
+      g_mutex_unlock (&dbin->cache_lock);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1362,17 +1458,13 @@ gst_decode_bin_autoplug_factories (GstElement * element, GstPad * pad,
 {
   GList *list, *tmp;
   GValueArray *result;
-  GstDecodeBin *dbin = GST_DECODE_BIN_CAST (element);
 
   GST_DEBUG_OBJECT (element, "finding factories");
 
   /* return all compatible factories for caps */
-  g_mutex_lock (&dbin->factories_lock);
-  gst_decode_bin_update_factories_list (dbin);
   list =
-      gst_element_factory_list_filter (dbin->factories, caps, GST_PAD_SINK,
-      gst_caps_is_fixed (caps));
-  g_mutex_unlock (&dbin->factories_lock);
+      gst_playback_utils_filter_factories (GST_PLAYBACK_FACTORIES_DECODABLE,
+      caps, gst_caps_is_fixed (caps));
 
   result = g_value_array_new (g_list_length (list));
   for (tmp = list; tmp; tmp = tmp->next) {
@@ -2242,7 +2334,7 @@ connect_pad (GstDecodeBin * dbin, GstElement * src, GstDecodePad * dpad,
     decode_pad_set_target (dpad, NULL);
 
     /* 2.1. Try to create an element */
-    if ((element = gst_element_factory_create (factory, NULL)) == NULL) {
+    if ((element = gst_decode_bin_create_element (dbin, factory)) == NULL) {
       GST_WARNING_OBJECT (dbin, "Could not create an element from %s",
           gst_plugin_feature_get_name (GST_PLUGIN_FEATURE (factory)));
       g_string_append_printf (error_details,
@@ -3324,7 +3416,7 @@ gst_decode_chain_ref (GstDecodeChain * chain)
 static void
 gst_decode_chain_free_internal (GstDecodeChain * chain, gboolean hide)
 {
-  GList *l, *set_to_null = NULL;
+  GList *l, *set_to_null = NULL, *to_release = NULL;
 
   CHAIN_MUTEX_LOCK (chain);
 
@@ -3392,7 +3484,7 @@ gst_decode_chain_free_internal (GstDecodeChain * chain, gboolean hide)
     if (GST_OBJECT_PARENT (element) == GST_OBJECT_CAST (chain->dbin))
       gst_bin_remove (GST_BIN_CAST (chain->dbin), element);
     if (!hide) {
-      set_to_null = g_list_append (set_to_null, gst_object_ref (element));
+      to_release = g_list_append (to_release, gst_object_ref (element));
     }
 
     SUBTITLE_LOCK (chain->dbin);
@@ -3459,6 +3551,12 @@ gst_decode_chain_free_internal (GstDecodeChain * chain, gboolean hide)
     gst_object_unref (element);
   }
 
+  while (to_release) {
+    GstElement *element = to_release->data;
+    to_release = g_list_delete_link (to_release, to_release);
+    gst_decode_bin_release_element (chain->dbin, element);
+  }
+
   if (!hide)
     gst_decode_chain_unref (chain);
 }
@@ -5358,6 +5456,8 @@ gst_decode_bin_change_state (GstElement * element, GstStateChange transition)
       dbin->buffering_status = NULL;
       break;
     case GST_STATE_CHANGE_READY_TO_NULL:
+      gst_decode_bin_flush_cache (dbin);
+      break;
     default:
       break;
   }
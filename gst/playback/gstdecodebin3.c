@@ -33,6 +33,7 @@
 #include "gstplayback.h"
 #include "gstplay-enum.h"
 #include "gstrawcaps.h"
+#include "gstplaybackutils.h"
 
 /**
  * SECTION:element-decodebin3
@@ -1811,18 +1812,15 @@ create_element (GstDecodebin3 * dbin, GstStream * stream,
   GstElement *element = NULL;
   GstCaps *caps;
 
-  g_mutex_lock (&dbin->factories_lock);
-  gst_decode_bin_update_factories_list (dbin);
   caps = gst_stream_get_caps (stream);
   if (ftype == GST_ELEMENT_FACTORY_TYPE_DECODER)
     res =
-        gst_element_factory_list_filter (dbin->decoder_factories,
-        caps, GST_PAD_SINK, TRUE);
+        gst_playback_utils_filter_factories (GST_PLAYBACK_FACTORIES_DECODERS,
+        caps, TRUE);
   else
     res =
-        gst_element_factory_list_filter (dbin->decodable_factories,
-        caps, GST_PAD_SINK, TRUE);
-  g_mutex_unlock (&dbin->factories_lock);
+        gst_playback_utils_filter_factories
+        (GST_PLAYBACK_FACTORIES_NON_DECODERS, caps, TRUE);
 
   if (res) {
     element =
@@ -158,3 +158,175 @@ gst_playback_utils_compare_factories_func (gconstpointer p1, gconstpointer p2)
    * and then by factory name */
   return gst_plugin_feature_rank_compare_func (p1, p2);
 }
+
+/* Process-wide cache of the factories that can handle some caps, shared by
+ * all decodebins and parsebins. Filtering the whole list of decodable
+ * factories is expensive and is done again and again for the same caps when
+ * many streams are played, so the sorted result of the filtering is kept
+ * around until the registry changes or the rank of any decodable factory
+ * is changed. */
+
+#define FACTORIES_CACHE_MAX_ENTRIES 256
+
+static GMutex factories_cache_lock;
+static guint32 factories_cache_cookie;
+/* all decodable factories whatever their rank, and their ranks when the
+ * cache was filled */
+static GList *factories_cache_all;
+static GArray *factories_cache_ranks;
+static GList *factories_cache_lists[GST_PLAYBACK_FACTORIES_LAST];
+static GHashTable *factories_cache[GST_PLAYBACK_FACTORIES_LAST];
+
+/* Must be called with the factories cache lock */
+static void
+factories_cache_flush (void)
+{
+  gint i;
+
+  for (i = 0; i < GST_PLAYBACK_FACTORIES_LAST; i++) {
+    if (factories_cache[i])
+      g_hash_table_remove_all (factories_cache[i]);
+    gst_plugin_feature_list_free (factories_cache_lists[i]);
+    factories_cache_lists[i] = NULL;
+  }
+  gst_plugin_feature_list_free (factories_cache_all);
+  factories_cache_all = NULL;
+  if (factories_cache_ranks)
+    g_array_set_size (factories_cache_ranks, 0);
+}
+
+/* Setting the rank of a feature does not change the registry cookie, so
+ * check if any decodable factory changed its rank since the cache was
+ * filled. This includes the factories of rank NONE, which are not in any
+ * of the lists but appear in them once their rank is raised. Must be called
+ * with the factories cache lock */
+static gboolean
+factories_cache_ranks_changed (void)
+{
+  GList *tmp;
+  guint i;
+
+  for (tmp = factories_cache_all, i = 0; tmp; tmp = tmp->next, i++) {
+    if (gst_plugin_feature_get_rank (tmp->data) !=
+        g_array_index (factories_cache_ranks, guint, i))
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+/* Must be called with the factories cache lock */
+static GList *
+factories_cache_get_all (void)
+{
+  GList *tmp;
+  guint rank;
+
+  if (factories_cache_all)
+    return factories_cache_all;
+
+  factories_cache_all =
+      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_DECODABLE,
+      GST_RANK_NONE);
+
+  if (factories_cache_ranks == NULL)
+    factories_cache_ranks = g_array_new (FALSE, FALSE, sizeof (guint));
+  for (tmp = factories_cache_all; tmp; tmp = tmp->next) {
+    rank = gst_plugin_feature_get_rank (tmp->data);
+    g_array_append_val (factories_cache_ranks, rank);
+  }
+
+  return factories_cache_all;
+}
+
+/* Must be called with the factories cache lock */
+static GList *
+factories_cache_get_list (GstPlaybackFactoryList list)
+{
+  GList *factories = NULL, *tmp, *res = NULL;
+  gboolean decoders;
+
+  if (factories_cache_lists[list])
+    return factories_cache_lists[list];
+
+  /* the factories that are autoplugged */
+  for (tmp = factories_cache_get_all (); tmp; tmp = tmp->next) {
+    if (gst_plugin_feature_get_rank (tmp->data) >= GST_RANK_MARGINAL)
+      factories = g_list_prepend (factories, gst_object_ref (tmp->data));
+  }
+
+  switch (list) {
+    case GST_PLAYBACK_FACTORIES_DECODABLE:
+      res = g_list_sort (factories, gst_playback_utils_compare_factories_func);
+      break;
+    case GST_PLAYBACK_FACTORIES_DECODERS:
+    case GST_PLAYBACK_FACTORIES_NON_DECODERS:
+      decoders = (list == GST_PLAYBACK_FACTORIES_DECODERS);
+      factories = g_list_sort (factories, gst_plugin_feature_rank_compare_func);
+      for (tmp = factories; tmp; tmp = tmp->next) {
+        GstElementFactory *fact = (GstElementFactory *) tmp->data;
+
+        if (gst_element_factory_list_is_type (fact,
+                GST_ELEMENT_FACTORY_TYPE_DECODER) == decoders)
+          res = g_list_prepend (res, gst_object_ref (fact));
+      }
+      res = g_list_reverse (res);
+      gst_plugin_feature_list_free (factories);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  factories_cache_lists[list] = res;
+  return res;
+}
+
+/* Returns the factories of @list that can handle @caps on their sink pads,
+ * like gst_element_factory_list_filter(). Free the result with
+ * gst_plugin_feature_list_free() */
+GList *
+gst_playback_utils_filter_factories (GstPlaybackFactoryList list,
+    GstCaps * caps, gboolean subsetonly)
+{
+  GstRegistry *registry = gst_registry_get ();
+  GList *res;
+  gchar *caps_str, *key;
+  guint32 cookie;
+
+  g_return_val_if_fail (list < GST_PLAYBACK_FACTORIES_LAST, NULL);
+  g_return_val_if_fail (GST_IS_CAPS (caps), NULL);
+
+  caps_str = gst_caps_to_string (caps);
+  key = g_strdup_printf ("%d %s", subsetonly, caps_str);
+  g_free (caps_str);
+
+  g_mutex_lock (&factories_cache_lock);
+  cookie = gst_registry_get_feature_list_cookie (registry);
+  if (factories_cache_cookie != cookie || factories_cache_ranks_changed ()) {
+    factories_cache_flush ();
+    factories_cache_cookie = cookie;
+  }
+
+  if (factories_cache[list] == NULL)
+    factories_cache[list] = g_hash_table_new_full (g_str_hash, g_str_equal,
+        g_free, (GDestroyNotify) gst_plugin_feature_list_free);
+
+  /* an empty result is cached too, as NULL */
+  if (g_hash_table_lookup_extended (factories_cache[list], key, NULL,
+          (gpointer *) & res)) {
+    g_free (key);
+  } else {
+    res = gst_element_factory_list_filter (factories_cache_get_list (list),
+        caps, GST_PAD_SINK, subsetonly);
+
+    if (g_hash_table_size (factories_cache[list]) >=
+        FACTORIES_CACHE_MAX_ENTRIES)
+      g_hash_table_remove_all (factories_cache[list]);
+    g_hash_table_insert (factories_cache[list], key, res);
+  }
+  res = gst_plugin_feature_list_copy (res);
+  g_mutex_unlock (&factories_cache_lock);
+
+  return res;
+}
@@ -36,6 +36,19 @@ gst_playback_utils_get_n_common_capsfeatures (GstElementFactory * fact1,
 G_GNUC_INTERNAL
 gint
 gst_playback_utils_compare_factories_func (gconstpointer p1, gconstpointer p2);
+
+typedef enum {
+  GST_PLAYBACK_FACTORIES_DECODABLE,     /* parsers first, then by rank */
+  GST_PLAYBACK_FACTORIES_DECODERS,      /* decoders only, by rank */
+  GST_PLAYBACK_FACTORIES_NON_DECODERS,  /* all but decoders, by rank */
+  GST_PLAYBACK_FACTORIES_LAST
+} GstPlaybackFactoryList;
+
+G_GNUC_INTERNAL
+GList *
+gst_playback_utils_filter_factories (GstPlaybackFactoryList list,
+                                     GstCaps * caps,
+                                     gboolean subsetonly);
 G_END_DECLS
 
 #endif /* __GST_PLAYBACK_UTILS_H__ */
@@ -178,6 +178,21 @@
  * type. The new location may be a relative or an absolute URI. Examples
  * for such redirects can be found in many quicktime movie trailers.
  *
+ * ## Startup latency
+ *
+ * Once the sinks have prerolled after going from READY to PAUSED, playbin3
+ * posts an element message with a structure named 'playbin3-startup'. It
+ * contains a boolean 'fast-start' field telling whether the
+ * #GstPlayBin3:fast-start property was set, and the following #guint64 fields
+ * with the time in nanoseconds since the start of the state change at which a
+ * step was first reached, or %GST_CLOCK_TIME_NONE if it was not reached:
+ *
+ * * 'source-setup': the source element was created
+ * * 'stream-collection': the first stream collection was received
+ * * 'sinks-ready': the sinks were opened ahead of time, only with fast-start
+ * * 'output-configured': the sinks were configured and linked
+ * * 'first-frame': the sinks prerolled
+ *
  * ## Examples
  * |[
  * gst-launch-1.0 -v playbin3 uri=file:///path/to/somefile.mp4
@@ -243,6 +258,7 @@ typedef struct _GstPlayBin3 GstPlayBin3;
 typedef struct _GstPlayBin3Class GstPlayBin3Class;
 typedef struct _GstSourceGroup GstSourceGroup;
 typedef struct _GstSourceCombine GstSourceCombine;
+typedef struct _GstSourceLookahead GstSourceLookahead;
 
 typedef GstCaps *(*SourceCombineGetMediaCapsFunc) (void);
 
@@ -358,6 +374,16 @@ struct _GstSourceGroup
   GstMessage *pending_buffering_msg;
 };
 
+/* an upcoming uri that is opened in the background, its source pads are
+ * blocked until a group takes it over */
+struct _GstSourceLookahead
+{
+  gchar *uri;
+  GstElement *urisourcebin;
+  GstBus *bus;                  /* private bus, until the group takes over */
+  gint failed;                  /* posted an error while opening */
+};
+
 #define GST_PLAY_BIN3_GET_LOCK(bin) (&((GstPlayBin3*)(bin))->lock)
 #define GST_PLAY_BIN3_LOCK(bin) (g_rec_mutex_lock (GST_PLAY_BIN3_GET_LOCK(bin)))
 #define GST_PLAY_BIN3_UNLOCK(bin) (g_rec_mutex_unlock (GST_PLAY_BIN3_GET_LOCK(bin)))
@@ -489,6 +515,43 @@ struct _GstPlayBin3
 
   /* Active stream collection */
   GstStreamCollection *collection;
+
+  /* fast-start */
+  gboolean fast_start;
+  GMutex preload_lock;          /* protects the preload fields below */
+  GThread *preload_thread;      /* opens the default sinks while the source
+                                 * is being set up */
+  gboolean preload_audio;       /* whether the preload thread should open */
+  gboolean preload_video;       /* the default audio and video sink */
+  GstElement *preload_audio_sink;       /* READY sinks opened by the preload */
+  GstElement *preload_video_sink;       /* thread, not yet handed to playsink */
+  GCond preload_cond;           /* signaled when the preload fields change */
+  gboolean preload_cancel;      /* the preload thread should not open sinks */
+  gboolean preload_have_types;  /* whether preload_types is known */
+  GstStreamType preload_types;  /* stream types of the first collection */
+  GThreadPool *preload_pool;    /* loads decoders of new stream collections */
+
+  /* lookahead of upcoming uris */
+  GMutex lookahead_lock;        /* protects the lookahead fields below */
+  gboolean lookahead_active;    /* TRUE from READY to NULL */
+  gchar **lookahead_uris;       /* uris the application will play next */
+  guint lookahead_depth;        /* how many of them to open in advance */
+  guint lookahead_max_size;     /* buffering budget for all of them (bytes) */
+  GList *lookahead;             /* opened GstSourceLookahead */
+  GThreadPool *lookahead_pool;  /* runs lookahead_update(), from READY to NULL */
+  gboolean lookahead_scheduled; /* an update is queued in lookahead_pool */
+
+  /* startup latency, in absolute gst_util_get_timestamp() values */
+  struct
+  {
+    GstClockTime begin;
+    GstClockTime source_setup;
+    GstClockTime stream_collection;
+    GstClockTime sinks_ready;
+    GstClockTime output_configured;
+    gboolean fast_start;
+    gboolean reported;
+  } startup;
 };
 
 struct _GstPlayBin3Class
@@ -527,6 +590,10 @@ struct _GstPlayBin3Class
 #define DEFAULT_BUFFER_DURATION   -1
 #define DEFAULT_BUFFER_SIZE       -1
 #define DEFAULT_RING_BUFFER_MAX_SIZE 0
+#define DEFAULT_FAST_START        FALSE
+#define DEFAULT_LOOKAHEAD_URIS    NULL
+#define DEFAULT_LOOKAHEAD_DEPTH   1
+#define DEFAULT_LOOKAHEAD_MAX_SIZE 0
 
 enum
 {
@@ -558,7 +625,11 @@ enum
   PROP_AUDIO_FILTER,
   PROP_VIDEO_FILTER,
   PROP_MULTIVIEW_MODE,
-  PROP_MULTIVIEW_FLAGS
+  PROP_MULTIVIEW_FLAGS,
+  PROP_FAST_START,
+  PROP_LOOKAHEAD_URIS,
+  PROP_LOOKAHEAD_DEPTH,
+  PROP_LOOKAHEAD_MAX_SIZE
 };
 
 /* signals */
@@ -611,6 +682,17 @@ static gint select_stream_cb (GstElement * decodebin,
 
 static void do_stream_selection (GstPlayBin3 * playbin);
 
+static void startup_reset (GstPlayBin3 * playbin, GstClockTime begin);
+static void startup_mark (GstPlayBin3 * playbin, GstClockTime * time);
+static void startup_report (GstPlayBin3 * playbin);
+static void preload_start (GstPlayBin3 * playbin);
+static void preload_finish (GstPlayBin3 * playbin, GstSourceGroup * group);
+static void preload_stop (GstPlayBin3 * playbin);
+static void preload_decoders (GstPlayBin3 * playbin,
+    GstStreamCollection * collection);
+static void lookahead_schedule (GstPlayBin3 * playbin);
+static void lookahead_clear (GstPlayBin3 * playbin);
+
 static GstElementClass *parent_class;
 
 static guint gst_play_bin3_signals[LAST_SIGNAL] = { 0 };
@@ -951,6 +1033,76 @@ gst_play_bin3_class_init (GstPlayBin3Class * klass)
           GST_TYPE_VIDEO_MULTIVIEW_FLAGS, GST_VIDEO_MULTIVIEW_FLAGS_NONE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstPlayBin3:fast-start:
+   *
+   * Reduce the time to the first frame by doing work in parallel with
+   * opening the source. When enabled, the converters used by playsink are
+   * loaded from a separate thread while the source is set up, the default
+   * audio and video sinks are opened from that thread as soon as the first
+   * stream collection tells which of them are needed, and the decoders for
+   * the streams of a new stream collection are loaded as soon as the
+   * collection is known.
+   *
+   * This has no effect on custom sinks set with the #GstPlayBin3:audio-sink
+   * and #GstPlayBin3:video-sink properties.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_klass, PROP_FAST_START,
+      g_param_spec_boolean ("fast-start", "Fast start",
+          "Open sinks and load decoders in parallel with the source",
+          DEFAULT_FAST_START, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstPlayBin3:lookahead-uris:
+   *
+   * The uris the application is going to play next, in order. The first
+   * #GstPlayBin3:lookahead-depth of them are opened in the background, so
+   * that the source, typefinding and buffering are done by the time the
+   * application sets the #GstPlayBin3:uri property to one of them.
+   *
+   * The upcoming uris are opened from a separate thread, once the current
+   * uri prerolled. #GstPlayBin3::source-setup is emitted from that thread
+   * when the source of an upcoming uri is created. When a uri from the list starts playing, it and all
+   * uris before it are removed from the list.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_klass, PROP_LOOKAHEAD_URIS,
+      g_param_spec_boxed ("lookahead-uris", "Lookahead URIs",
+          "Upcoming URIs to open in the background", G_TYPE_STRV,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstPlayBin3:lookahead-depth:
+   *
+   * The maximum number of uris from #GstPlayBin3:lookahead-uris that are
+   * opened in advance. 0 disables the lookahead.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_klass, PROP_LOOKAHEAD_DEPTH,
+      g_param_spec_uint ("lookahead-depth", "Lookahead depth",
+          "Maximum number of upcoming URIs to open in advance (0 = disabled)",
+          0, G_MAXUINT, DEFAULT_LOOKAHEAD_DEPTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstPlayBin3:lookahead-max-size:
+   *
+   * The amount of memory in bytes that may be used for buffering all the
+   * uris opened in advance together. 0 uses #GstPlayBin3:buffer-size for
+   * each of them.
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_klass, PROP_LOOKAHEAD_MAX_SIZE,
+      g_param_spec_uint ("lookahead-max-size", "Lookahead max size",
+          "Buffering budget in bytes of the upcoming URIs (0 = buffer-size "
+          "for each)", 0, G_MAXUINT, DEFAULT_LOOKAHEAD_MAX_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstPlayBin3::about-to-finish
    * @playbin: a #GstPlayBin3
@@ -1367,6 +1519,15 @@ gst_play_bin3_init (GstPlayBin3 * playbin)
 
   playbin->multiview_mode = GST_VIDEO_MULTIVIEW_FRAME_PACKING_NONE;
   playbin->multiview_flags = GST_VIDEO_MULTIVIEW_FLAGS_NONE;
+
+  playbin->fast_start = DEFAULT_FAST_START;
+  g_mutex_init (&playbin->preload_lock);
+  g_cond_init (&playbin->preload_cond);
+  startup_reset (playbin, GST_CLOCK_TIME_NONE);
+
+  g_mutex_init (&playbin->lookahead_lock);
+  playbin->lookahead_depth = DEFAULT_LOOKAHEAD_DEPTH;
+  playbin->lookahead_max_size = DEFAULT_LOOKAHEAD_MAX_SIZE;
 }
 
 static void
@@ -1440,6 +1601,14 @@ gst_play_bin3_finalize (GObject * object)
   g_rec_mutex_clear (&playbin->lock);
   g_mutex_clear (&playbin->dyn_lock);
   g_mutex_clear (&playbin->elements_lock);
+  g_mutex_clear (&playbin->preload_lock);
+  g_cond_clear (&playbin->preload_cond);
+
+  if (playbin->lookahead_pool)
+    g_thread_pool_free (playbin->lookahead_pool, TRUE, TRUE);
+  lookahead_clear (playbin);
+  g_strfreev (playbin->lookahead_uris);
+  g_mutex_clear (&playbin->lookahead_lock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -1935,6 +2104,29 @@ gst_play_bin3_set_property (GObject * object, guint prop_id,
       playbin->multiview_flags = g_value_get_flags (value);
       GST_PLAY_BIN3_UNLOCK (playbin);
       break;
+    case PROP_FAST_START:
+      GST_OBJECT_LOCK (playbin);
+      playbin->fast_start = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (playbin);
+      break;
+    case PROP_LOOKAHEAD_URIS:
+      g_mutex_lock (&playbin->lookahead_lock);
+      g_strfreev (playbin->lookahead_uris);
+      playbin->lookahead_uris = g_value_dup_boxed (value);
+      g_mutex_unlock (&playbin->lookahead_lock);
+      lookahead_schedule (playbin);
+      break;
+    case PROP_LOOKAHEAD_DEPTH:
+      g_mutex_lock (&playbin->lookahead_lock);
+      playbin->lookahead_depth = g_value_get_uint (value);
+      g_mutex_unlock (&playbin->lookahead_lock);
+      lookahead_schedule (playbin);
+      break;
+    case PROP_LOOKAHEAD_MAX_SIZE:
+      g_mutex_lock (&playbin->lookahead_lock);
+      playbin->lookahead_max_size = g_value_get_uint (value);
+      g_mutex_unlock (&playbin->lookahead_lock);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2137,6 +2329,26 @@ gst_play_bin3_get_property (GObject * object, guint prop_id, GValue * value,
       g_value_set_flags (value, playbin->multiview_flags);
       GST_OBJECT_UNLOCK (playbin);
       break;
+    case PROP_FAST_START:
+      GST_OBJECT_LOCK (playbin);
+      g_value_set_boolean (value, playbin->fast_start);
+      GST_OBJECT_UNLOCK (playbin);
+      break;
+    case PROP_LOOKAHEAD_URIS:
+      g_mutex_lock (&playbin->lookahead_lock);
+      g_value_set_boxed (value, playbin->lookahead_uris);
+      g_mutex_unlock (&playbin->lookahead_lock);
+      break;
+    case PROP_LOOKAHEAD_DEPTH:
+      g_mutex_lock (&playbin->lookahead_lock);
+      g_value_set_uint (value, playbin->lookahead_depth);
+      g_mutex_unlock (&playbin->lookahead_lock);
+      break;
+    case PROP_LOOKAHEAD_MAX_SIZE:
+      g_mutex_lock (&playbin->lookahead_lock);
+      g_value_set_uint (value, playbin->lookahead_max_size);
+      g_mutex_unlock (&playbin->lookahead_lock);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2562,8 +2774,18 @@ gst_play_bin3_handle_message (GstBin * bin, GstMessage * msg)
         playbin->do_stream_selections = TRUE;
       GST_PLAY_BIN3_UNLOCK (playbin);
 
+      startup_mark (playbin, &playbin->startup.stream_collection);
+      preload_decoders (playbin, collection);
+
       gst_object_unref (collection);
     }
+  } else if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ASYNC_DONE) {
+    /* playsink prerolled, the first frame of the new uri is ready */
+    if (GST_MESSAGE_SRC (msg) == GST_OBJECT_CAST (playbin->playsink)) {
+      startup_report (playbin);
+      /* now that this uri plays, open the upcoming ones */
+      lookahead_schedule (playbin);
+    }
   } else if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_STREAMS_SELECTED) {
     GstStreamCollection *collection = NULL;
     GstObject *src = GST_MESSAGE_SRC (msg);
@@ -3140,6 +3362,9 @@ no_more_pads_cb (GstElement * decodebin, GstPlayBin3 * playbin)
   GST_SOURCE_GROUP_UNLOCK (group);
 
   if (configure) {
+    /* pick up the sinks the fast-start thread opened for us, if any */
+    preload_finish (playbin, group);
+
     /* if we have custom sinks, configure them now */
     GST_SOURCE_GROUP_LOCK (group);
 
@@ -3183,6 +3408,7 @@ no_more_pads_cb (GstElement * decodebin, GstPlayBin3 * playbin)
     }
     GST_PLAY_BIN3_UNLOCK (playbin);
     gst_play_sink_reconfigure (playbin->playsink);
+    startup_mark (playbin, &playbin->startup.output_configured);
   }
 
   GST_PLAY_BIN3_SHUTDOWN_UNLOCK (playbin);
@@ -3814,6 +4040,334 @@ done:
   return ret;
 }
 
+/* fast-start: while the source is being set up, a separate thread loads the
+ * plugins of the converters playsink will plug and, once the first stream
+ * collection is known, opens the sinks playsink would otherwise create when
+ * the output is configured. The sinks are handed to the group when it
+ * configures its output. */
+static GstElement *
+preload_sink (GstPlayBin3 * playbin, const gchar * factory_name)
+{
+  GstElement *sink;
+
+  sink = gst_element_factory_make (factory_name, NULL);
+  if (sink == NULL)
+    return NULL;
+
+  gst_object_ref_sink (sink);
+  if (!activate_sink (playbin, sink, NULL)) {
+    GST_DEBUG_OBJECT (playbin, "failed to preload %s", factory_name);
+    gst_element_set_state (sink, GST_STATE_NULL);
+    gst_object_unref (sink);
+    return NULL;
+  }
+
+  GST_DEBUG_OBJECT (playbin, "preloaded %" GST_PTR_FORMAT, sink);
+
+  return sink;
+}
+
+static void
+preload_feature (GstPlayBin3 * playbin, const gchar * factory_name)
+{
+  GstElementFactory *factory;
+  GstPluginFeature *loaded;
+
+  factory = gst_element_factory_find (factory_name);
+  if (factory == NULL)
+    return;
+
+  loaded = gst_plugin_feature_load (GST_PLUGIN_FEATURE_CAST (factory));
+  if (loaded)
+    gst_object_unref (loaded);
+  gst_object_unref (factory);
+}
+
+static gpointer
+preload_thread_func (GstPlayBin3 * playbin)
+{
+  GstPlayFlags flags;
+  GstElement *audio_sink = NULL, *video_sink = NULL;
+  GstStreamType types = 0;
+
+  flags = gst_play_sink_get_flags (playbin->playsink);
+
+  if (flags & GST_PLAY_FLAG_AUDIO) {
+    preload_feature (playbin, "audioconvert");
+    preload_feature (playbin, "audioresample");
+    if (flags & GST_PLAY_FLAG_SOFT_VOLUME)
+      preload_feature (playbin, "volume");
+  }
+  if (flags & GST_PLAY_FLAG_VIDEO) {
+    preload_feature (playbin, "videoconvert");
+    preload_feature (playbin, "videoscale");
+    if (flags & GST_PLAY_FLAG_DEINTERLACE)
+      preload_feature (playbin, "deinterlace");
+    if (flags & GST_PLAY_FLAG_SOFT_COLORBALANCE)
+      preload_feature (playbin, "videobalance");
+  }
+
+  /* don't open a sink for a stream type the media does not have, opening an
+   * audio device can have side effects */
+  g_mutex_lock (&playbin->preload_lock);
+  while (!playbin->preload_have_types && !playbin->preload_cancel)
+    g_cond_wait (&playbin->preload_cond, &playbin->preload_lock);
+  if (playbin->preload_have_types)
+    types = playbin->preload_types;
+  g_mutex_unlock (&playbin->preload_lock);
+
+  if (playbin->preload_audio && (types & GST_STREAM_TYPE_AUDIO))
+    audio_sink = preload_sink (playbin, "autoaudiosink");
+  if (playbin->preload_video && (types & GST_STREAM_TYPE_VIDEO))
+    video_sink = preload_sink (playbin, "autovideosink");
+
+  /* only read after joining this thread */
+  playbin->preload_audio_sink = audio_sink;
+  playbin->preload_video_sink = video_sink;
+
+  startup_mark (playbin, &playbin->startup.sinks_ready);
+
+  return NULL;
+}
+
+/* loads the best decoder for the caps of a stream and fills the factory
+ * cache decodebin3 uses, so that creating the decoder later is cheap */
+static void
+preload_decoders_func (GstCaps * caps, GstPlayBin3 * playbin)
+{
+  GList *factories;
+
+  factories =
+      gst_playback_utils_filter_factories (GST_PLAYBACK_FACTORIES_DECODERS,
+      caps, TRUE);
+  if (factories) {
+    GstPluginFeature *loaded;
+
+    GST_DEBUG_OBJECT (playbin, "preloading %s for %" GST_PTR_FORMAT,
+        GST_OBJECT_NAME (factories->data), caps);
+    loaded = gst_plugin_feature_load (factories->data);
+    if (loaded)
+      gst_object_unref (loaded);
+    gst_plugin_feature_list_free (factories);
+  }
+
+  gst_caps_unref (caps);
+}
+
+static void
+preload_start (GstPlayBin3 * playbin)
+{
+  GstPlayFlags flags;
+  GstElement *sink;
+  gboolean fast_start;
+
+  GST_OBJECT_LOCK (playbin);
+  fast_start = playbin->fast_start;
+  GST_OBJECT_UNLOCK (playbin);
+
+  if (!fast_start)
+    return;
+
+  flags = gst_play_sink_get_flags (playbin->playsink);
+
+  g_mutex_lock (&playbin->preload_lock);
+  if (playbin->preload_thread == NULL) {
+    /* only open the sinks playsink would create itself */
+    GST_PLAY_BIN3_LOCK (playbin);
+    playbin->preload_audio = (flags & GST_PLAY_FLAG_AUDIO)
+        && playbin->audio_sink == NULL && playbin->preload_audio_sink == NULL;
+    playbin->preload_video = (flags & GST_PLAY_FLAG_VIDEO)
+        && playbin->video_sink == NULL && playbin->preload_video_sink == NULL;
+    GST_PLAY_BIN3_UNLOCK (playbin);
+
+    if ((sink = gst_play_sink_get_sink (playbin->playsink,
+                GST_PLAY_SINK_TYPE_AUDIO))) {
+      playbin->preload_audio = FALSE;
+      gst_object_unref (sink);
+    }
+    if ((sink = gst_play_sink_get_sink (playbin->playsink,
+                GST_PLAY_SINK_TYPE_VIDEO))) {
+      playbin->preload_video = FALSE;
+      gst_object_unref (sink);
+    }
+
+    playbin->preload_cancel = FALSE;
+    playbin->preload_have_types = FALSE;
+    playbin->preload_types = 0;
+
+    GST_DEBUG_OBJECT (playbin, "starting preload, audio %d, video %d",
+        playbin->preload_audio, playbin->preload_video);
+    playbin->preload_thread = g_thread_new ("playbin3-preload",
+        (GThreadFunc) preload_thread_func, playbin);
+  }
+  if (playbin->preload_pool == NULL)
+    playbin->preload_pool =
+        g_thread_pool_new ((GFunc) preload_decoders_func, playbin, 1, FALSE,
+        NULL);
+  g_mutex_unlock (&playbin->preload_lock);
+}
+
+/* waits for the preload thread, without letting it open any more sinks if it
+ * did not get to that yet */
+static void
+preload_join (GstPlayBin3 * playbin)
+{
+  GThread *thread;
+
+  g_mutex_lock (&playbin->preload_lock);
+  thread = playbin->preload_thread;
+  playbin->preload_thread = NULL;
+  playbin->preload_cancel = TRUE;
+  g_cond_signal (&playbin->preload_cond);
+  g_mutex_unlock (&playbin->preload_lock);
+
+  if (thread)
+    g_thread_join (thread);
+}
+
+/* called when @group configures its output */
+static void
+preload_finish (GstPlayBin3 * playbin, GstSourceGroup * group)
+{
+  preload_join (playbin);
+
+  g_mutex_lock (&playbin->preload_lock);
+  GST_SOURCE_GROUP_LOCK (group);
+  if (group->audio_sink == NULL && playbin->preload_audio_sink) {
+    group->audio_sink = playbin->preload_audio_sink;
+    playbin->preload_audio_sink = NULL;
+  }
+  if (group->video_sink == NULL && playbin->preload_video_sink) {
+    group->video_sink = playbin->preload_video_sink;
+    playbin->preload_video_sink = NULL;
+  }
+  GST_SOURCE_GROUP_UNLOCK (group);
+  g_mutex_unlock (&playbin->preload_lock);
+}
+
+static void
+preload_stop (GstPlayBin3 * playbin)
+{
+  GstElement *sinks[2];
+  GThreadPool *pool;
+  guint i;
+
+  preload_join (playbin);
+
+  g_mutex_lock (&playbin->preload_lock);
+  sinks[0] = playbin->preload_audio_sink;
+  sinks[1] = playbin->preload_video_sink;
+  playbin->preload_audio_sink = NULL;
+  playbin->preload_video_sink = NULL;
+  pool = playbin->preload_pool;
+  playbin->preload_pool = NULL;
+  g_mutex_unlock (&playbin->preload_lock);
+
+  if (pool)
+    g_thread_pool_free (pool, FALSE, TRUE);
+
+  /* the output was never configured, drop the sinks we did not use */
+  for (i = 0; i < G_N_ELEMENTS (sinks); i++) {
+    if (sinks[i]) {
+      gst_element_set_state (sinks[i], GST_STATE_NULL);
+      gst_object_unref (sinks[i]);
+    }
+  }
+}
+
+static void
+preload_decoders (GstPlayBin3 * playbin, GstStreamCollection * collection)
+{
+  guint i, len;
+
+  g_mutex_lock (&playbin->preload_lock);
+  if (playbin->preload_pool) {
+    len = gst_stream_collection_get_size (collection);
+    for (i = 0; i < len; i++) {
+      GstStream *stream = gst_stream_collection_get_stream (collection, i);
+      GstCaps *caps = gst_stream_get_caps (stream);
+
+      if (!playbin->preload_have_types)
+        playbin->preload_types |= gst_stream_get_stream_type (stream);
+      if (caps)
+        g_thread_pool_push (playbin->preload_pool, caps, NULL);
+    }
+    /* the first collection tells the preload thread which sinks to open */
+    playbin->preload_have_types = TRUE;
+    g_cond_signal (&playbin->preload_cond);
+  }
+  g_mutex_unlock (&playbin->preload_lock);
+}
+
+/* startup latency, reported in the playbin3-startup message */
+static void
+startup_reset (GstPlayBin3 * playbin, GstClockTime begin)
+{
+  GST_OBJECT_LOCK (playbin);
+  playbin->startup.begin = begin;
+  playbin->startup.source_setup = GST_CLOCK_TIME_NONE;
+  playbin->startup.stream_collection = GST_CLOCK_TIME_NONE;
+  playbin->startup.sinks_ready = GST_CLOCK_TIME_NONE;
+  playbin->startup.output_configured = GST_CLOCK_TIME_NONE;
+  playbin->startup.fast_start = playbin->fast_start;
+  playbin->startup.reported = FALSE;
+  GST_OBJECT_UNLOCK (playbin);
+}
+
+/* records the first time we get to a startup step */
+static void
+startup_mark (GstPlayBin3 * playbin, GstClockTime * time)
+{
+  GST_OBJECT_LOCK (playbin);
+  if (GST_CLOCK_TIME_IS_VALID (playbin->startup.begin)
+      && !playbin->startup.reported && !GST_CLOCK_TIME_IS_VALID (*time))
+    *time = gst_util_get_timestamp ();
+  GST_OBJECT_UNLOCK (playbin);
+}
+
+static inline GstClockTime
+startup_delta (GstPlayBin3 * playbin, GstClockTime time)
+{
+  if (!GST_CLOCK_TIME_IS_VALID (time))
+    return GST_CLOCK_TIME_NONE;
+
+  return time - playbin->startup.begin;
+}
+
+static void
+startup_report (GstPlayBin3 * playbin)
+{
+  GstClockTime first_frame = gst_util_get_timestamp ();
+  GstStructure *s;
+
+  GST_OBJECT_LOCK (playbin);
+  if (!GST_CLOCK_TIME_IS_VALID (playbin->startup.begin)
+      || playbin->startup.reported) {
+    GST_OBJECT_UNLOCK (playbin);
+    return;
+  }
+  playbin->startup.reported = TRUE;
+
+  s = gst_structure_new ("playbin3-startup",
+      "fast-start", G_TYPE_BOOLEAN, playbin->startup.fast_start,
+      "source-setup", G_TYPE_UINT64,
+      startup_delta (playbin, playbin->startup.source_setup),
+      "stream-collection", G_TYPE_UINT64,
+      startup_delta (playbin, playbin->startup.stream_collection),
+      "sinks-ready", G_TYPE_UINT64,
+      startup_delta (playbin, playbin->startup.sinks_ready),
+      "output-configured", G_TYPE_UINT64,
+      startup_delta (playbin, playbin->startup.output_configured),
+      "first-frame", G_TYPE_UINT64, startup_delta (playbin, first_frame),
+      NULL);
+  GST_OBJECT_UNLOCK (playbin);
+
+  GST_INFO_OBJECT (playbin, "startup breakdown %" GST_PTR_FORMAT, s);
+
+  gst_element_post_message (GST_ELEMENT_CAST (playbin),
+      gst_message_new_element (GST_OBJECT_CAST (playbin), s));
+}
+
 /* autoplug-continue decides, if a pad has raw caps that can be exposed
  * directly or if further decoding is necessary. We use this to expose
  * supported subtitles directly */
@@ -4459,6 +5013,7 @@ notify_source_cb (GstElement * urisourcebin, GParamSpec * pspec,
 
   g_signal_emit (playbin, gst_play_bin3_signals[SIGNAL_SOURCE_SETUP],
       0, playbin->source);
+  startup_mark (playbin, &playbin->startup.source_setup);
 }
 
 /* must be called with the group lock */
@@ -4649,12 +5204,377 @@ deactivate_decodebin (GstPlayBin3 * playbin)
   }
 }
 
+/* lookahead: the first lookahead-depth uris of lookahead-uris are opened in
+ * urisourcebins outside of playbin. Their source pads are blocked, so they
+ * only open the source, typefind and fill their buffers. When the uri of a
+ * group is one of them, the group takes over the urisourcebin and links
+ * its pads instead of opening the uri again. */
+static GstBusSyncReply
+lookahead_bus_handler (GstBus * bus, GstMessage * msg,
+    GstSourceLookahead * lookahead)
+{
+  /* errors are posted again when the uri is opened by its group */
+  if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+    GST_DEBUG ("error opening upcoming uri %s: %" GST_PTR_FORMAT,
+        lookahead->uri, msg);
+    g_atomic_int_set (&lookahead->failed, 1);
+  }
+
+  return GST_BUS_DROP;
+}
+
+static GstPadProbeReturn
+lookahead_block_cb (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  return GST_PAD_PROBE_OK;
+}
+
+static void
+lookahead_pad_added_cb (GstElement * urisrcbin, GstPad * pad,
+    GstPlayBin3 * playbin)
+{
+  gulong id;
+
+  GST_DEBUG_OBJECT (playbin, "blocking upcoming pad %" GST_PTR_FORMAT, pad);
+
+  id = gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BLOCK_DOWNSTREAM,
+      lookahead_block_cb, NULL, NULL);
+  g_object_set_data (G_OBJECT (pad), "playbin.lookahead_block_id",
+      ULONG_TO_POINTER (id));
+}
+
+static void
+lookahead_notify_source_cb (GstElement * urisrcbin, GParamSpec * pspec,
+    GstPlayBin3 * playbin)
+{
+  GstElement *source;
+
+  g_object_get (urisrcbin, "source", &source, NULL);
+  if (source == NULL)
+    return;
+
+  /* give the application a chance to configure the source before it is
+   * opened, playbin's source property is updated when the uri plays */
+  g_signal_emit (playbin, gst_play_bin3_signals[SIGNAL_SOURCE_SETUP],
+      0, source);
+  gst_object_unref (source);
+}
+
+static GstSourceLookahead *
+lookahead_open (GstPlayBin3 * playbin, const gchar * uri, gint buffer_size)
+{
+  GstSourceLookahead *lookahead;
+  GstElement *urisrcbin;
+  GstPlayFlags flags;
+
+  urisrcbin = gst_element_factory_make ("urisourcebin", NULL);
+  if (urisrcbin == NULL)
+    return NULL;
+  gst_object_ref_sink (urisrcbin);
+
+  flags = gst_play_sink_get_flags (playbin->playsink);
+
+  g_object_set (urisrcbin,
+      "connection-speed", playbin->connection_speed / 1000,
+      "uri", uri,
+      "download", ((flags & GST_PLAY_FLAG_DOWNLOAD) != 0),
+      "use-buffering", ((flags & GST_PLAY_FLAG_BUFFERING) != 0),
+      "buffer-duration", playbin->buffer_duration,
+      "buffer-size", buffer_size,
+      "ring-buffer-max-size", playbin->ring_buffer_max_size, NULL);
+
+  lookahead = g_slice_new0 (GstSourceLookahead);
+  lookahead->uri = g_strdup (uri);
+  lookahead->urisourcebin = urisrcbin;
+  lookahead->bus = gst_bus_new ();
+  gst_bus_set_sync_handler (lookahead->bus,
+      (GstBusSyncHandler) lookahead_bus_handler, lookahead, NULL);
+  gst_element_set_bus (urisrcbin, lookahead->bus);
+
+  g_signal_connect (urisrcbin, "pad-added",
+      G_CALLBACK (lookahead_pad_added_cb), playbin);
+  g_signal_connect (urisrcbin, "notify::source",
+      G_CALLBACK (lookahead_notify_source_cb), playbin);
+
+  GST_DEBUG_OBJECT (playbin, "opening upcoming uri %s", uri);
+
+  if (gst_element_set_state (urisrcbin,
+          GST_STATE_PAUSED) == GST_STATE_CHANGE_FAILURE)
+    g_atomic_int_set (&lookahead->failed, 1);
+
+  return lookahead;
+}
+
+/* detaches the urisourcebin from @lookahead and frees it. New pads are still
+ * blocked until the group connected its own pad-added handler and called
+ * lookahead_unblock_new_pads() */
+static GstElement *
+lookahead_release (GstPlayBin3 * playbin, GstSourceLookahead * lookahead)
+{
+  GstElement *urisrcbin = lookahead->urisourcebin;
+
+  g_signal_handlers_disconnect_by_func (urisrcbin,
+      lookahead_notify_source_cb, playbin);
+  gst_element_set_bus (urisrcbin, NULL);
+
+  gst_object_unref (lookahead->bus);
+  g_free (lookahead->uri);
+  g_slice_free (GstSourceLookahead, lookahead);
+
+  return urisrcbin;
+}
+
+static void
+lookahead_free (GstSourceLookahead * lookahead)
+{
+  GstElement *urisrcbin = lookahead->urisourcebin;
+
+  gst_element_set_state (urisrcbin, GST_STATE_NULL);
+  gst_element_set_bus (urisrcbin, NULL);
+  gst_object_unref (urisrcbin);
+
+  gst_object_unref (lookahead->bus);
+  g_free (lookahead->uri);
+  g_slice_free (GstSourceLookahead, lookahead);
+}
+
+/* must be called with the lookahead lock */
+static GstSourceLookahead *
+lookahead_find (GstPlayBin3 * playbin, const gchar * uri)
+{
+  GList *l;
+
+  for (l = playbin->lookahead; l; l = l->next) {
+    GstSourceLookahead *lookahead = l->data;
+
+    if (strcmp (lookahead->uri, uri) == 0)
+      return lookahead;
+  }
+  return NULL;
+}
+
+/* must be called with the lookahead lock */
+static gboolean
+lookahead_wanted (GstPlayBin3 * playbin, const gchar * uri)
+{
+  guint i;
+
+  if (!playbin->lookahead_active || playbin->lookahead_uris == NULL)
+    return FALSE;
+
+  for (i = 0; i < playbin->lookahead_depth && playbin->lookahead_uris[i]; i++) {
+    if (strcmp (playbin->lookahead_uris[i], uri) == 0)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* opens the upcoming uris that are not open yet and closes the ones that are
+ * no longer upcoming */
+static void
+lookahead_update (GstPlayBin3 * playbin)
+{
+  GList *l, *drop = NULL;
+  gchar **open = NULL;
+  guint i, n = 0;
+  gint buffer_size;
+
+  g_mutex_lock (&playbin->lookahead_lock);
+  for (l = playbin->lookahead; l;) {
+    GstSourceLookahead *lookahead = l->data;
+    GList *next = l->next;
+
+    if (!lookahead_wanted (playbin, lookahead->uri)) {
+      playbin->lookahead = g_list_delete_link (playbin->lookahead, l);
+      drop = g_list_prepend (drop, lookahead);
+    }
+    l = next;
+  }
+
+  if (playbin->lookahead_active && playbin->lookahead_uris) {
+    n = MIN (playbin->lookahead_depth,
+        g_strv_length (playbin->lookahead_uris));
+    open = g_new0 (gchar *, n + 1);
+    for (i = 0; i < n; i++)
+      open[i] = g_strdup (playbin->lookahead_uris[i]);
+  }
+
+  /* share the budget between all upcoming uris */
+  if (playbin->lookahead_max_size > 0 && n > 0)
+    buffer_size = MIN (playbin->lookahead_max_size / n, G_MAXINT);
+  else
+    buffer_size = playbin->buffer_size;
+  g_mutex_unlock (&playbin->lookahead_lock);
+
+  g_list_free_full (drop, (GDestroyNotify) lookahead_free);
+
+  /* open without the lock, this emits source-setup */
+  for (i = 0; i < n; i++) {
+    GstSourceLookahead *lookahead;
+
+    g_mutex_lock (&playbin->lookahead_lock);
+    lookahead = lookahead_find (playbin, open[i]);
+    g_mutex_unlock (&playbin->lookahead_lock);
+    if (lookahead)
+      continue;
+
+    if (!(lookahead = lookahead_open (playbin, open[i], buffer_size)))
+      break;
+
+    g_mutex_lock (&playbin->lookahead_lock);
+    if (lookahead_wanted (playbin, open[i])
+        && !lookahead_find (playbin, open[i])) {
+      playbin->lookahead = g_list_append (playbin->lookahead, lookahead);
+      lookahead = NULL;
+    }
+    g_mutex_unlock (&playbin->lookahead_lock);
+
+    if (lookahead)
+      lookahead_free (lookahead);
+  }
+  g_strfreev (open);
+}
+
+static void
+lookahead_update_func (GstPlayBin3 * data, GstPlayBin3 * playbin)
+{
+  g_mutex_lock (&playbin->lookahead_lock);
+  playbin->lookahead_scheduled = FALSE;
+  g_mutex_unlock (&playbin->lookahead_lock);
+
+  lookahead_update (playbin);
+}
+
+/* opening the upcoming uris changes the state of their urisourcebins, which
+ * can take a while, so it is done from a separate thread */
+static void
+lookahead_schedule (GstPlayBin3 * playbin)
+{
+  g_mutex_lock (&playbin->lookahead_lock);
+  if (playbin->lookahead_pool && !playbin->lookahead_scheduled) {
+    playbin->lookahead_scheduled = TRUE;
+    g_thread_pool_push (playbin->lookahead_pool, playbin, NULL);
+  }
+  g_mutex_unlock (&playbin->lookahead_lock);
+}
+
+/* takes the opened urisourcebin for @uri, if any, and removes @uri and all
+ * uris before it from the upcoming uris */
+static GstSourceLookahead *
+lookahead_take (GstPlayBin3 * playbin, const gchar * uri)
+{
+  GstSourceLookahead *lookahead;
+  guint i;
+
+  if (uri == NULL)
+    return NULL;
+
+  g_mutex_lock (&playbin->lookahead_lock);
+  if (playbin->lookahead_uris) {
+    for (i = 0; playbin->lookahead_uris[i]; i++) {
+      if (strcmp (playbin->lookahead_uris[i], uri) == 0) {
+        gchar **rest = g_strdupv (&playbin->lookahead_uris[i + 1]);
+
+        g_strfreev (playbin->lookahead_uris);
+        playbin->lookahead_uris = rest;
+        break;
+      }
+    }
+  }
+
+  if ((lookahead = lookahead_find (playbin, uri)))
+    playbin->lookahead = g_list_remove (playbin->lookahead, lookahead);
+  g_mutex_unlock (&playbin->lookahead_lock);
+
+  if (lookahead && g_atomic_int_get (&lookahead->failed)) {
+    GST_DEBUG_OBJECT (playbin, "upcoming uri %s failed, opening again", uri);
+    lookahead_free (lookahead);
+    lookahead = NULL;
+  }
+
+  return lookahead;
+}
+
+static void
+lookahead_clear (GstPlayBin3 * playbin)
+{
+  GList *drop;
+
+  g_mutex_lock (&playbin->lookahead_lock);
+  drop = playbin->lookahead;
+  playbin->lookahead = NULL;
+  g_mutex_unlock (&playbin->lookahead_lock);
+
+  g_list_free_full (drop, (GDestroyNotify) lookahead_free);
+}
+
+static void
+lookahead_unblock_new_pads (GstPlayBin3 * playbin, GstElement * urisrcbin)
+{
+  g_signal_handlers_disconnect_by_func (urisrcbin, lookahead_pad_added_cb,
+      playbin);
+}
+
+/* links the pads a urisourcebin taken from the lookahead exposed while it was
+ * opening and lets the data flow, must be called without the group lock */
+static void
+lookahead_link_pads (GstPlayBin3 * playbin, GstSourceGroup * group)
+{
+  GstElement *urisrcbin = group->urisourcebin;
+  GstElement *source;
+  GstIterator *it;
+  GValue item = { 0, };
+  gboolean done = FALSE;
+
+  g_object_get (urisrcbin, "source", &source, NULL);
+  GST_OBJECT_LOCK (playbin);
+  if (playbin->source)
+    gst_object_unref (playbin->source);
+  playbin->source = source;
+  GST_OBJECT_UNLOCK (playbin);
+  g_object_notify (G_OBJECT (playbin), "source");
+  startup_mark (playbin, &playbin->startup.source_setup);
+
+  it = gst_element_iterate_src_pads (urisrcbin);
+  while (!done) {
+    switch (gst_iterator_next (it, &item)) {
+      case GST_ITERATOR_OK:{
+        GstPad *pad = g_value_get_object (&item);
+        gulong id;
+
+        if (!gst_pad_is_linked (pad))
+          urisrc_pad_added (urisrcbin, pad, group);
+
+        id = POINTER_TO_ULONG (g_object_get_data (G_OBJECT (pad),
+                "playbin.lookahead_block_id"));
+        if (id) {
+          gst_pad_remove_probe (pad, id);
+          g_object_set_data (G_OBJECT (pad), "playbin.lookahead_block_id",
+              NULL);
+        }
+        g_value_reset (&item);
+        break;
+      }
+      case GST_ITERATOR_RESYNC:
+        gst_iterator_resync (it);
+        break;
+      default:
+        done = TRUE;
+        break;
+    }
+  }
+  g_value_unset (&item);
+  gst_iterator_free (it);
+}
+
 /* must be called with PLAY_BIN_LOCK */
 static GstStateChangeReturn
 activate_group (GstPlayBin3 * playbin, GstSourceGroup * group, GstState target)
 {
   GstElement *urisrcbin = NULL;
   GstElement *suburisrcbin = NULL;
+  GstSourceLookahead *lookahead;
+  gboolean from_lookahead = FALSE;
   GstPlayFlags flags;
   gboolean audio_sink_activated = FALSE;
   gboolean video_sink_activated = FALSE;
@@ -4720,8 +5640,20 @@ activate_group (GstPlayBin3 * playbin, GstSourceGroup * group, GstState target)
     }
   }
 
-
-  if (!make_or_reuse_element (playbin, "urisourcebin", &group->urisourcebin))
+  /* take over the urisourcebin if the uri was opened in advance */
+  if ((lookahead = lookahead_take (playbin, group->uri))) {
+    GST_DEBUG_OBJECT (playbin, "using upcoming uri %s", group->uri);
+    if (group->urisourcebin) {
+      gst_element_set_state (group->urisourcebin, GST_STATE_NULL);
+      if (GST_OBJECT_PARENT (group->urisourcebin) == GST_OBJECT_CAST (playbin))
+        gst_bin_remove (GST_BIN_CAST (playbin), group->urisourcebin);
+      gst_object_unref (group->urisourcebin);
+    }
+    group->urisourcebin = lookahead_release (playbin, lookahead);
+    gst_bin_add (GST_BIN_CAST (playbin), group->urisourcebin);
+    from_lookahead = TRUE;
+  } else if (!make_or_reuse_element (playbin, "urisourcebin",
+          &group->urisourcebin))
     goto no_urisrcbin;
   urisrcbin = group->urisourcebin;
 
@@ -4767,6 +5699,11 @@ activate_group (GstPlayBin3 * playbin, GstSourceGroup * group, GstState target)
   group->urisrc_pad_removed_id = g_signal_connect (urisrcbin,
       "pad-removed", G_CALLBACK (urisrc_pad_removed_cb), group);
 
+  /* only now that new pads are linked by the group, stop blocking them. The
+   * pads added before are linked by lookahead_link_pads() */
+  if (from_lookahead)
+    lookahead_unblock_new_pads (playbin, urisrcbin);
+
   if (group->suburi) {
     /* subtitles */
     if (!make_or_reuse_element (playbin, "urisourcebin",
@@ -4830,6 +5767,9 @@ activate_group (GstPlayBin3 * playbin, GstSourceGroup * group, GstState target)
       GST_SOURCE_GROUP_UNLOCK (group);
     }
   }
+  if (from_lookahead)
+    lookahead_link_pads (playbin, group);
+
   if ((state_ret =
           gst_element_set_state (urisrcbin,
               target)) == GST_STATE_CHANGE_FAILURE)
@@ -5138,12 +6078,22 @@ gst_play_bin3_change_state (GstElement * element, GstStateChange transition)
   switch (transition) {
     case GST_STATE_CHANGE_NULL_TO_READY:
       memset (&playbin->duration, 0, sizeof (playbin->duration));
+      g_mutex_lock (&playbin->lookahead_lock);
+      playbin->lookahead_active = TRUE;
+      playbin->lookahead_scheduled = FALSE;
+      if (playbin->lookahead_pool == NULL)
+        playbin->lookahead_pool =
+            g_thread_pool_new ((GFunc) lookahead_update_func, playbin, 1,
+            FALSE, NULL);
+      g_mutex_unlock (&playbin->lookahead_lock);
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
       GST_LOG_OBJECT (playbin, "clearing shutdown flag");
       memset (&playbin->duration, 0, sizeof (playbin->duration));
       g_atomic_int_set (&playbin->shutdown, 0);
       do_async_start (playbin);
+      startup_reset (playbin, gst_util_get_timestamp ());
+      preload_start (playbin);
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
     async_down:
@@ -5197,15 +6147,20 @@ gst_play_bin3_change_state (GstElement * element, GstStateChange transition)
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       save_current_group (playbin);
+      preload_stop (playbin);
+      startup_reset (playbin, GST_CLOCK_TIME_NONE);
       break;
     case GST_STATE_CHANGE_READY_TO_NULL:
     {
+      GThreadPool *pool;
       guint i;
       GList *l;
 
       /* also do missed state change down to READY */
       if (do_save)
         save_current_group (playbin);
+      preload_stop (playbin);
+      startup_reset (playbin, GST_CLOCK_TIME_NONE);
       /* Deactive the groups, set the urisrcbins to NULL
        * and unref them.
        */
@@ -5280,6 +6235,16 @@ gst_play_bin3_change_state (GstElement * element, GstStateChange transition)
       }
 
       GST_OBJECT_UNLOCK (playbin);
+
+      g_mutex_lock (&playbin->lookahead_lock);
+      playbin->lookahead_active = FALSE;
+      pool = playbin->lookahead_pool;
+      playbin->lookahead_pool = NULL;
+      g_mutex_unlock (&playbin->lookahead_lock);
+      /* drop the queued update and wait for the running one */
+      if (pool)
+        g_thread_pool_free (pool, TRUE, TRUE);
+      lookahead_clear (playbin);
       break;
     }
     default:
@@ -5299,6 +6264,9 @@ failure:
     if (transition == GST_STATE_CHANGE_READY_TO_PAUSED) {
       GstSourceGroup *curr_group;
 
+      preload_stop (playbin);
+      startup_reset (playbin, GST_CLOCK_TIME_NONE);
+
       curr_group = playbin->curr_group;
       if (curr_group) {
         if (curr_group->active && curr_group->valid) {
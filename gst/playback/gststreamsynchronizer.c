@@ -43,6 +43,9 @@ GST_DEBUG_CATEGORY_STATIC (stream_synchronizer_debug);
     g_mutex_unlock (&GST_STREAM_SYNCHRONIZER_CAST(obj)->lock);              \
 } G_STMT_END
 
+#define GST_SYNC_STREAM_LOCK(stream) g_mutex_lock (&(stream)->lock)
+#define GST_SYNC_STREAM_UNLOCK(stream) g_mutex_unlock (&(stream)->lock)
+
 static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src_%u",
     GST_PAD_SRC,
     GST_PAD_SOMETIMES,
@@ -60,8 +63,14 @@ typedef struct
 {
   GstStreamSynchronizer *transform;
   guint stream_number;
-  GstPad *srcpad;
+  GstPad *srcpad;               /* holds ref until the stream is freed */
   GstPad *sinkpad;
+
+  /* Protects segment.position while the stream is not EOS. The
+   * streaming thread updates it for every buffer with only this lock
+   * held, everybody else reading it from another thread must take this
+   * lock too. Lock order is element lock first, then stream lock. */
+  GMutex lock;
   GstSegment segment;
 
   gboolean wait;                /* TRUE if waiting/blocking */
@@ -83,6 +92,23 @@ typedef struct
   guint group_id;
 } GstSyncStream;
 
+/* Must be called with lock! */
+static void
+gst_stream_synchronizer_update_eos_pending (GstStreamSynchronizer * self)
+{
+  GList *l;
+  gint eos_pending = 0;
+
+  for (l = self->streams; l; l = l->next) {
+    GstSyncStream *ostream = l->data;
+
+    if (ostream->is_eos && !ostream->eos_sent)
+      eos_pending++;
+  }
+
+  g_atomic_int_set (&self->eos_pending, eos_pending);
+}
+
 /* Must be called with lock! */
 static inline GstPad *
 gst_stream_get_other_pad (GstSyncStream * stream, GstPad * pad)
@@ -310,6 +336,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
         stream->flushing = FALSE;
         stream->stream_start_seqnum = seqnum;
         stream->group_id = group_id;
+        gst_stream_synchronizer_update_eos_pending (self);
 
         if (!have_group_id) {
           /* Check if this belongs to a stream that is already there,
@@ -373,6 +400,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
 
             ostream->wait = FALSE;
 
+            GST_SYNC_STREAM_LOCK (ostream);
             if (ostream->segment.format == GST_FORMAT_TIME) {
               if (ostream->segment.rate > 0)
                 stop_running_time =
@@ -403,6 +431,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
 
               position = MAX (position, position_running_time);
             }
+            GST_SYNC_STREAM_UNLOCK (ostream);
           }
 
           self->group_start_time += position;
@@ -501,6 +530,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
         stream->flushing = FALSE;
         stream->wait = FALSE;
         g_cond_broadcast (&stream->stream_finish_cond);
+        gst_stream_synchronizer_update_eos_pending (self);
       }
 
       for (l = self->streams; l; l = l->next) {
@@ -546,6 +576,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
           stream->eos_sent = FALSE;
           stream->wait = FALSE;
           g_cond_broadcast (&stream->stream_finish_cond);
+          gst_stream_synchronizer_update_eos_pending (self);
         }
         GST_STREAM_SYNCHRONIZER_UNLOCK (self);
       }
@@ -570,6 +601,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
 
       GST_DEBUG_OBJECT (pad, "Have EOS for stream %d", stream->stream_number);
       stream->is_eos = TRUE;
+      gst_stream_synchronizer_update_eos_pending (self);
 
       seen_data = stream->seen_data;
       srcpad = gst_object_ref (stream->srcpad);
@@ -643,6 +675,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
         stream = gst_pad_get_element_private (pad);
         if (stream) {
           stream->eos_sent = TRUE;
+          gst_stream_synchronizer_update_eos_pending (self);
         }
       }
 
@@ -667,7 +700,6 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
     GstBuffer * buffer)
 {
   GstStreamSynchronizer *self = GST_STREAM_SYNCHRONIZER (parent);
-  GstPad *opad;
   GstFlowReturn ret = GST_FLOW_ERROR;
   GstSyncStream *stream;
   GstClockTime duration = GST_CLOCK_TIME_NONE;
@@ -688,37 +720,39 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
       && GST_CLOCK_TIME_IS_VALID (duration))
     timestamp_end = timestamp + duration;
 
-  GST_STREAM_SYNCHRONIZER_LOCK (self);
+  /* The stream can't go away while we're in the chain function: releasing
+   * it deactivates the sinkpad, which waits for us to return, before freeing
+   * it. The srcpad is removed before that, but the stream keeps a reference
+   * to it. Only the per-stream lock is needed for updating our own
+   * position. */
   stream = gst_pad_get_element_private (pad);
-
-  if (stream) {
-    stream->seen_data = TRUE;
-    if (stream->segment.format == GST_FORMAT_TIME
-        && GST_CLOCK_TIME_IS_VALID (timestamp)) {
-      GST_LOG_OBJECT (pad,
-          "Updating position from %" GST_TIME_FORMAT " to %" GST_TIME_FORMAT,
-          GST_TIME_ARGS (stream->segment.position), GST_TIME_ARGS (timestamp));
-      if (stream->segment.rate > 0.0)
-        stream->segment.position = timestamp;
-      else
-        stream->segment.position = timestamp_end;
-    }
+  if (!stream) {
+    GST_WARNING_OBJECT (pad, "Trying to get other pad after releasing");
+    gst_buffer_unref (buffer);
+    return GST_FLOW_ERROR;
   }
-  GST_STREAM_SYNCHRONIZER_UNLOCK (self);
 
-  opad = gst_stream_get_other_pad_from_pad (self, pad);
-  if (opad) {
-    ret = gst_pad_push (opad, buffer);
-    gst_object_unref (opad);
+  stream->seen_data = TRUE;
+  if (stream->segment.format == GST_FORMAT_TIME
+      && GST_CLOCK_TIME_IS_VALID (timestamp)) {
+    GST_LOG_OBJECT (pad,
+        "Updating position from %" GST_TIME_FORMAT " to %" GST_TIME_FORMAT,
+        GST_TIME_ARGS (stream->segment.position), GST_TIME_ARGS (timestamp));
+    GST_SYNC_STREAM_LOCK (stream);
+    if (stream->segment.rate > 0.0)
+      stream->segment.position = timestamp;
+    else
+      stream->segment.position = timestamp_end;
+    GST_SYNC_STREAM_UNLOCK (stream);
   }
 
+  ret = gst_pad_push (stream->srcpad, buffer);
+
   GST_LOG_OBJECT (pad, "Push returned: %s", gst_flow_get_name (ret));
   if (ret == GST_FLOW_OK) {
     GList *l;
 
-    GST_STREAM_SYNCHRONIZER_LOCK (self);
-    stream = gst_pad_get_element_private (pad);
-    if (stream && stream->segment.format == GST_FORMAT_TIME) {
+    if (stream->segment.format == GST_FORMAT_TIME) {
       GstClockTime position;
 
       if (stream->segment.rate > 0.0)
@@ -730,10 +764,17 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
         GST_LOG_OBJECT (pad,
             "Updating position from %" GST_TIME_FORMAT " to %" GST_TIME_FORMAT,
             GST_TIME_ARGS (stream->segment.position), GST_TIME_ARGS (position));
+        GST_SYNC_STREAM_LOCK (stream);
         stream->segment.position = position;
+        GST_SYNC_STREAM_UNLOCK (stream);
       }
     }
 
+    /* Only look at the other streams if any of them is EOS and still
+     * waiting, otherwise there is nothing to advance */
+    if (g_atomic_int_get (&self->eos_pending) == 0)
+      return ret;
+
     /* Advance EOS streams if necessary. For non-EOS
      * streams the demuxers should already do this! */
     if (!GST_CLOCK_TIME_IS_VALID (timestamp_end) &&
@@ -741,6 +782,7 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
       timestamp_end = timestamp + GST_SECOND;
     }
 
+    GST_STREAM_SYNCHRONIZER_LOCK (self);
     for (l = self->streams; l; l = l->next) {
       GstSyncStream *ostream = l->data;
       gint64 position;
@@ -795,6 +837,7 @@ gst_stream_synchronizer_request_new_pad (GstElement * element,
   stream = g_slice_new0 (GstSyncStream);
   stream->transform = self;
   stream->stream_number = self->current_stream_number;
+  g_mutex_init (&stream->lock);
   g_cond_init (&stream->stream_finish_cond);
   stream->stream_start_seqnum = G_MAXUINT32;
   stream->segment_seqnum = G_MAXUINT32;
@@ -817,7 +860,9 @@ gst_stream_synchronizer_request_new_pad (GstElement * element,
   GST_PAD_SET_PROXY_SCHEDULING (stream->sinkpad);
 
   tmp = g_strdup_printf ("src_%u", self->current_stream_number);
-  stream->srcpad = gst_pad_new_from_static_template (&srctemplate, tmp);
+  stream->srcpad =
+      gst_object_ref_sink (gst_pad_new_from_static_template (&srctemplate,
+          tmp));
   g_free (tmp);
   gst_pad_set_element_private (stream->srcpad, stream);
   gst_pad_set_iterate_internal_links_function (stream->srcpad,
@@ -867,6 +912,7 @@ gst_stream_synchronizer_release_stream (GstStreamSynchronizer * self,
     self->have_group_id = TRUE;
     self->group_id = G_MAXUINT;
   }
+  gst_stream_synchronizer_update_eos_pending (self);
 
   /* we can drop the lock, since stream exists now only local.
    * Moreover, we should drop, to prevent deadlock with STREAM_LOCK
@@ -880,7 +926,10 @@ gst_stream_synchronizer_release_stream (GstStreamSynchronizer * self,
   gst_pad_set_active (stream->sinkpad, FALSE);
   gst_element_remove_pad (GST_ELEMENT_CAST (self), stream->sinkpad);
 
+  /* the chain function is done with the stream now */
+  gst_object_unref (stream->srcpad);
   g_cond_clear (&stream->stream_finish_cond);
+  g_mutex_clear (&stream->lock);
   g_slice_free (GstSyncStream, stream);
 
   /* NOTE: In theory we have to check here if all streams
@@ -995,6 +1044,7 @@ gst_stream_synchronizer_change_state (GstElement * element,
         stream->flushing = FALSE;
         stream->send_gap_event = FALSE;
       }
+      g_atomic_int_set (&self->eos_pending, 0);
       GST_STREAM_SYNCHRONIZER_UNLOCK (self);
       break;
     }
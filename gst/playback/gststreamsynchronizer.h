@@ -55,6 +55,10 @@ struct _GstStreamSynchronizer
 
   GstClockTime group_start_time;
 
+  /* number of EOS streams that did not send EOS downstream yet, updated
+   * with the lock and read atomically from the streaming threads */
+  gint eos_pending;
+
   gboolean have_group_id;
   guint group_id;
 };
@@ -111,6 +111,19 @@ struct _OutputSlotInfo
   GstPad *sinkpad;              /* Sink pad of the queue eleemnt */
   GstPad *srcpad;               /* Output ghost pad */
   gboolean is_eos;              /* Did EOS get fed into the buffering element */
+
+  /* adaptive buffering, protected by adaptive_lock */
+  gboolean adaptive;            /* the limits of the queue are adapted */
+  GMutex adaptive_lock;
+  GstClockTime window_start;    /* start of the current measurement window */
+  guint64 in_bytes;             /* bytes that entered the queue in the window */
+  guint64 out_bytes;            /* bytes that left the queue in the window */
+  guint64 avg_in_rate;          /* smoothed download throughput (bytes/s) */
+  guint64 avg_out_rate;         /* smoothed stream bitrate (bytes/s) */
+  guint max_size_bytes;         /* limits currently set on the queue */
+  GstClockTime max_size_time;
+  gint low_percent;
+  gint high_percent;
 };
 
 /**
@@ -124,10 +137,6 @@ struct _GstURISourceBin
 
   GMutex lock;                  /* lock for constructing */
 
-  GMutex factories_lock;
-  guint32 factories_cookie;
-  GList *factories;             /* factories we can use for selecting elements */
-
   gchar *uri;
   guint64 connection_speed;
 
@@ -138,6 +147,8 @@ struct _GstURISourceBin
   guint buffer_size;            /* When buffering, buffer size (bytes) */
   gboolean download;
   gboolean use_buffering;
+  gboolean adaptive_buffering;
+  GstClockID adaptive_clock_id; /* closes the measurement windows */
 
   GstElement *source;
   GList *typefinds;             /* list of typefind element */
@@ -226,6 +237,7 @@ enum
 #define DEFAULT_DOWNLOAD            FALSE
 #define DEFAULT_USE_BUFFERING       TRUE
 #define DEFAULT_RING_BUFFER_MAX_SIZE 0
+#define DEFAULT_ADAPTIVE_BUFFERING  FALSE
 
 #define DEFAULT_CAPS (gst_static_caps_get (&default_raw_caps))
 enum
@@ -238,7 +250,8 @@ enum
   PROP_BUFFER_DURATION,
   PROP_DOWNLOAD,
   PROP_USE_BUFFERING,
-  PROP_RING_BUFFER_MAX_SIZE
+  PROP_RING_BUFFER_MAX_SIZE,
+  PROP_ADAPTIVE_BUFFERING
 };
 
 static void post_missing_plugin_error (GstElement * dec,
@@ -360,42 +373,19 @@ gst_uri_source_bin_autoplug_continue (GstElement * element, GstPad * pad,
   return TRUE;
 }
 
-/* Must be called with factories lock! */
-static void
-gst_uri_source_bin_update_factories_list (GstURISourceBin * dec)
-{
-  guint32 cookie;
-
-  cookie = gst_registry_get_feature_list_cookie (gst_registry_get ());
-  if (!dec->factories || dec->factories_cookie != cookie) {
-    if (dec->factories)
-      gst_plugin_feature_list_free (dec->factories);
-    dec->factories =
-        gst_element_factory_list_get_elements
-        (GST_ELEMENT_FACTORY_TYPE_DECODABLE, GST_RANK_MARGINAL);
-    dec->factories =
-        g_list_sort (dec->factories, gst_playback_utils_compare_factories_func);
-    dec->factories_cookie = cookie;
-  }
-}
-
 static GValueArray *
 gst_uri_source_bin_autoplug_factories (GstElement * element, GstPad * pad,
     GstCaps * caps)
 {
   GList *list, *tmp;
   GValueArray *result;
-  GstURISourceBin *dec = GST_URI_SOURCE_BIN_CAST (element);
 
   GST_DEBUG_OBJECT (element, "finding factories");
 
   /* return all compatible factories for caps */
-  g_mutex_lock (&dec->factories_lock);
-  gst_uri_source_bin_update_factories_list (dec);
   list =
-      gst_element_factory_list_filter (dec->factories, caps, GST_PAD_SINK,
-      gst_caps_is_fixed (caps));
-  g_mutex_unlock (&dec->factories_lock);
+      gst_playback_utils_filter_factories (GST_PLAYBACK_FACTORIES_DECODABLE,
+      caps, gst_caps_is_fixed (caps));
 
   result = g_value_array_new (g_list_length (list));
   for (tmp = list; tmp; tmp = tmp->next) {
@@ -519,6 +509,31 @@ gst_uri_source_bin_class_init (GstURISourceBinClass * klass)
           0, G_MAXUINT, DEFAULT_RING_BUFFER_MAX_SIZE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstURISourceBin::adaptive-buffering:
+   *
+   * Measure the download throughput and the bitrate of each buffered
+   * stream once per second and resize the limits and the watermarks of
+   * its queue accordingly: little is buffered when the download is much
+   * faster than the stream, more when it is barely fast enough or too
+   * slow, in which case buffering also starts again before the queue is
+   * empty. A stalled download is taken into account as well.
+   * #GstURISourceBin:buffer-size and #GstURISourceBin:buffer-duration,
+   * when set, are upper bounds.
+   *
+   * Whenever the limits of a queue change, an element message named
+   * "adaptive-buffering-stats" is posted with the output "pad", the
+   * measured "in-rate" and "out-rate" in bytes per second and the new
+   * "max-size-bytes", "max-size-time", "low-percent" and "high-percent".
+   *
+   * Since: 1.12
+   */
+  g_object_class_install_property (gobject_class, PROP_ADAPTIVE_BUFFERING,
+      g_param_spec_boolean ("adaptive-buffering", "Adaptive buffering",
+          "Resize the buffering queues from the measured throughput",
+          DEFAULT_ADAPTIVE_BUFFERING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstURISourceBin::unknown-type:
    * @bin: The urisourcebin.
@@ -739,9 +754,6 @@ gst_uri_source_bin_class_init (GstURISourceBinClass * klass)
 static void
 gst_uri_source_bin_init (GstURISourceBin * urisrc)
 {
-  /* first filter out the interesting element factories */
-  g_mutex_init (&urisrc->factories_lock);
-
   g_mutex_init (&urisrc->lock);
 
   g_mutex_init (&urisrc->buffering_lock);
@@ -755,6 +767,7 @@ gst_uri_source_bin_init (GstURISourceBin * urisrc)
   urisrc->download = DEFAULT_DOWNLOAD;
   urisrc->use_buffering = DEFAULT_USE_BUFFERING;
   urisrc->ring_buffer_max_size = DEFAULT_RING_BUFFER_MAX_SIZE;
+  urisrc->adaptive_buffering = DEFAULT_ADAPTIVE_BUFFERING;
   urisrc->last_buffering_pct = -1;
 
   GST_OBJECT_FLAG_SET (urisrc, GST_ELEMENT_FLAG_SOURCE);
@@ -768,11 +781,9 @@ gst_uri_source_bin_finalize (GObject * obj)
   GstURISourceBin *urisrc = GST_URI_SOURCE_BIN (obj);
 
   remove_demuxer (urisrc);
+  adaptive_buffering_stop (urisrc);
   g_mutex_clear (&urisrc->lock);
-  g_mutex_clear (&urisrc->factories_lock);
   g_free (urisrc->uri);
-  if (urisrc->factories)
-    gst_plugin_feature_list_free (urisrc->factories);
 
   G_OBJECT_CLASS (parent_class)->finalize (obj);
 }
@@ -810,6 +821,9 @@ gst_uri_source_bin_set_property (GObject * object, guint prop_id,
     case PROP_RING_BUFFER_MAX_SIZE:
       dec->ring_buffer_max_size = g_value_get_uint64 (value);
       break;
+    case PROP_ADAPTIVE_BUFFERING:
+      dec->adaptive_buffering = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -857,6 +871,9 @@ gst_uri_source_bin_get_property (GObject * object, guint prop_id,
     case PROP_RING_BUFFER_MAX_SIZE:
       g_value_set_uint64 (value, dec->ring_buffer_max_size);
       break;
+    case PROP_ADAPTIVE_BUFFERING:
+      g_value_set_boolean (value, dec->adaptive_buffering);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -894,6 +911,277 @@ do_async_done (GstURISourceBin * dbin)
 #define DEFAULT_QUEUE_MIN_THRESHOLD ((DEFAULT_QUEUE_SIZE * 30) / 100)
 #define DEFAULT_QUEUE_THRESHOLD     ((DEFAULT_QUEUE_SIZE * 95) / 100)
 
+/* adaptive buffering: the rates are measured over windows of
+ * ADAPTIVE_INTERVAL, closed by a timer so that a stalled download, which
+ * does not push anything, is measured too. When the download is at least
+ * twice as fast as the stream, ADAPTIVE_MIN_TIME is buffered, playback
+ * starts at ADAPTIVE_MIN_HIGH_PERCENT and buffering starts again below
+ * ADAPTIVE_MIN_LOW_PERCENT. When it is not faster than the stream, up to
+ * ADAPTIVE_MAX_TIME is buffered, playback starts at
+ * ADAPTIVE_MAX_HIGH_PERCENT and buffering starts again below
+ * ADAPTIVE_MAX_LOW_PERCENT. In between, the values are interpolated. */
+#define ADAPTIVE_INTERVAL           GST_SECOND
+#define ADAPTIVE_TICK               (ADAPTIVE_INTERVAL / 4)
+#define ADAPTIVE_MIN_TIME           (2 * GST_SECOND)
+#define ADAPTIVE_MAX_TIME           (20 * GST_SECOND)
+#define ADAPTIVE_MIN_BYTES          (256 * 1024)
+#define ADAPTIVE_MAX_BYTES          (64 * 1024 * 1024)
+#define ADAPTIVE_MIN_HIGH_PERCENT   30
+#define ADAPTIVE_MAX_HIGH_PERCENT   90
+#define ADAPTIVE_MIN_LOW_PERCENT    1
+#define ADAPTIVE_MAX_LOW_PERCENT    10
+
+static GstMessage *
+adaptive_buffering_stats_message (GstURISourceBin * urisrc,
+    OutputSlotInfo * slot)
+{
+  GstStructure *s;
+
+  s = gst_structure_new ("adaptive-buffering-stats",
+      "pad", GST_TYPE_PAD, slot->srcpad,
+      "in-rate", G_TYPE_UINT64, slot->avg_in_rate,
+      "out-rate", G_TYPE_UINT64, slot->avg_out_rate,
+      "max-size-bytes", G_TYPE_UINT, slot->max_size_bytes,
+      "max-size-time", G_TYPE_UINT64, slot->max_size_time,
+      "low-percent", G_TYPE_INT, slot->low_percent,
+      "high-percent", G_TYPE_INT, slot->high_percent, NULL);
+
+  return gst_message_new_element (GST_OBJECT_CAST (urisrc), s);
+}
+
+/* called at the end of each measurement window with the slot's
+ * adaptive_lock, returns the stats message to post if the limits of the
+ * queue were changed */
+static GstMessage *
+adaptive_buffering_update (GstURISourceBin * urisrc, OutputSlotInfo * slot,
+    GstClockTime elapsed)
+{
+  guint64 in_rate, out_rate, ratio, max_bytes;
+  guint cur_bytes, level_bytes, max_size_bytes;
+  guint64 cur_time, level_time;
+  GstClockTime max_size_time;
+  gboolean full;
+  gint low_percent, high_percent;
+
+  in_rate = gst_util_uint64_scale (slot->in_bytes, GST_SECOND, elapsed);
+  out_rate = gst_util_uint64_scale (slot->out_bytes, GST_SECOND, elapsed);
+  slot->in_bytes = slot->out_bytes = 0;
+
+  g_object_get (slot->queue, "current-level-bytes", &level_bytes,
+      "max-size-bytes", &cur_bytes, "current-level-time", &level_time,
+      "max-size-time", &cur_time, NULL);
+  full = (cur_bytes > 0 && level_bytes >= cur_bytes - cur_bytes / 10)
+      || (cur_time > 0 && level_time >= cur_time - cur_time / 10);
+
+  /* while the queue is full the download is throttled to the bitrate of
+   * the stream, it is at least as fast as measured then */
+  if (full)
+    slot->avg_in_rate = MAX (slot->avg_in_rate, in_rate);
+  else if (slot->avg_in_rate == 0)
+    slot->avg_in_rate = in_rate;
+  else
+    slot->avg_in_rate = (3 * slot->avg_in_rate + in_rate) / 4;
+
+  /* nothing is consumed while paused */
+  if (out_rate > 0) {
+    if (slot->avg_out_rate == 0)
+      slot->avg_out_rate = out_rate;
+    else
+      slot->avg_out_rate = (3 * slot->avg_out_rate + out_rate) / 4;
+  }
+
+  if (slot->avg_in_rate == 0 || slot->avg_out_rate == 0)
+    return NULL;
+
+  /* download throughput relative to the bitrate, in percent */
+  ratio = gst_util_uint64_scale (slot->avg_in_rate, 100, slot->avg_out_rate);
+  ratio = CLAMP (ratio, 100, 200) - 100;
+
+  max_size_time = ADAPTIVE_MAX_TIME -
+      gst_util_uint64_scale (ADAPTIVE_MAX_TIME - ADAPTIVE_MIN_TIME, ratio, 100);
+  if (urisrc->buffer_duration != -1)
+    max_size_time = MIN (max_size_time, urisrc->buffer_duration);
+
+  max_bytes = urisrc->buffer_size != -1 ? urisrc->buffer_size :
+      ADAPTIVE_MAX_BYTES;
+  max_size_bytes = CLAMP (gst_util_uint64_scale (slot->avg_out_rate,
+          max_size_time, GST_SECOND), MIN (ADAPTIVE_MIN_BYTES, max_bytes),
+      max_bytes);
+
+  high_percent = ADAPTIVE_MAX_HIGH_PERCENT -
+      (ADAPTIVE_MAX_HIGH_PERCENT - ADAPTIVE_MIN_HIGH_PERCENT) * ratio / 100;
+  low_percent = ADAPTIVE_MAX_LOW_PERCENT -
+      (ADAPTIVE_MAX_LOW_PERCENT - ADAPTIVE_MIN_LOW_PERCENT) * ratio / 100;
+
+  /* only resize the queue on significant changes */
+  if (slot->max_size_bytes != 0
+      && ABS ((gint64) max_size_bytes - (gint64) slot->max_size_bytes) <
+      slot->max_size_bytes / 4
+      && ABS (high_percent - slot->high_percent) < 10
+      && ABS (low_percent - slot->low_percent) < 3)
+    return NULL;
+
+  GST_DEBUG_OBJECT (urisrc, "in %" G_GUINT64_FORMAT " B/s, out %"
+      G_GUINT64_FORMAT " B/s: buffering %u bytes, %" GST_TIME_FORMAT
+      ", low %d%%, high %d%% on %" GST_PTR_FORMAT, slot->avg_in_rate,
+      slot->avg_out_rate, max_size_bytes, GST_TIME_ARGS (max_size_time),
+      low_percent, high_percent, slot->queue);
+
+  slot->max_size_bytes = max_size_bytes;
+  slot->max_size_time = max_size_time;
+  slot->low_percent = low_percent;
+  slot->high_percent = high_percent;
+
+  g_object_set (slot->queue, "max-size-bytes", max_size_bytes,
+      "max-size-time", max_size_time, "low-percent", low_percent,
+      "high-percent", high_percent, NULL);
+
+  return adaptive_buffering_stats_message (urisrc, slot);
+}
+
+static void
+adaptive_buffering_free_ref (GWeakRef * ref)
+{
+  g_weak_ref_clear (ref);
+  g_free (ref);
+}
+
+/* closes the measurement windows of all adaptive slots that are
+ * ADAPTIVE_INTERVAL old, called from the clock thread every ADAPTIVE_TICK */
+static gboolean
+adaptive_buffering_timeout (GstClock * clock, GstClockTime time,
+    GstClockID id, GWeakRef * ref)
+{
+  GstURISourceBin *urisrc;
+  GstClockTime now;
+  GList *msgs = NULL, *l;
+  GSList *cur;
+
+  urisrc = g_weak_ref_get (ref);
+  if (urisrc == NULL)
+    return TRUE;
+
+  now = gst_util_get_timestamp ();
+
+  GST_URI_SOURCE_BIN_LOCK (urisrc);
+  for (cur = urisrc->out_slots; cur; cur = g_slist_next (cur)) {
+    OutputSlotInfo *slot = cur->data;
+    GstMessage *msg = NULL;
+
+    if (!slot->adaptive)
+      continue;
+
+    g_mutex_lock (&slot->adaptive_lock);
+    if (GST_CLOCK_TIME_IS_VALID (slot->window_start)
+        && now - slot->window_start >= ADAPTIVE_INTERVAL) {
+      msg = adaptive_buffering_update (urisrc, slot, now - slot->window_start);
+      slot->window_start = now;
+    }
+    g_mutex_unlock (&slot->adaptive_lock);
+
+    if (msg)
+      msgs = g_list_prepend (msgs, msg);
+  }
+  GST_URI_SOURCE_BIN_UNLOCK (urisrc);
+
+  for (l = msgs; l; l = l->next)
+    gst_element_post_message (GST_ELEMENT_CAST (urisrc), l->data);
+  g_list_free (msgs);
+
+  gst_object_unref (urisrc);
+
+  return TRUE;
+}
+
+/* must be called with GST_URI_SOURCE_BIN_LOCK */
+static void
+adaptive_buffering_start (GstURISourceBin * urisrc)
+{
+  GstClock *clock;
+  GWeakRef *ref;
+
+  if (urisrc->adaptive_clock_id)
+    return;
+
+  clock = gst_system_clock_obtain ();
+  urisrc->adaptive_clock_id = gst_clock_new_periodic_id (clock,
+      gst_clock_get_time (clock) + ADAPTIVE_TICK, ADAPTIVE_TICK);
+  gst_object_unref (clock);
+
+  /* the timer may fire once more after it was stopped */
+  ref = g_new0 (GWeakRef, 1);
+  g_weak_ref_init (ref, urisrc);
+  gst_clock_id_wait_async (urisrc->adaptive_clock_id,
+      (GstClockCallback) adaptive_buffering_timeout, ref,
+      (GDestroyNotify) adaptive_buffering_free_ref);
+}
+
+static void
+adaptive_buffering_stop (GstURISourceBin * urisrc)
+{
+  GstClockID id;
+
+  GST_URI_SOURCE_BIN_LOCK (urisrc);
+  id = urisrc->adaptive_clock_id;
+  urisrc->adaptive_clock_id = NULL;
+  GST_URI_SOURCE_BIN_UNLOCK (urisrc);
+
+  if (id) {
+    gst_clock_id_unschedule (id);
+    gst_clock_id_unref (id);
+  }
+}
+
+static gsize
+adaptive_buffering_probe_size (GstPadProbeInfo * info)
+{
+  if (GST_PAD_PROBE_INFO_TYPE (info) & GST_PAD_PROBE_TYPE_BUFFER_LIST)
+    return gst_buffer_list_calculate_size (GST_PAD_PROBE_INFO_BUFFER_LIST
+        (info));
+
+  return gst_buffer_get_size (GST_PAD_PROBE_INFO_BUFFER (info));
+}
+
+static GstPadProbeReturn
+adaptive_buffering_in_probe (GstPad * pad, GstPadProbeInfo * info,
+    GstURISourceBin * urisrc)
+{
+  OutputSlotInfo *slot;
+  GstClockTime now;
+
+  slot = g_object_get_data (G_OBJECT (GST_PAD_PARENT (pad)),
+      "urisourcebin.slotinfo");
+  if (slot == NULL)
+    return GST_PAD_PROBE_OK;
+
+  now = gst_util_get_timestamp ();
+
+  g_mutex_lock (&slot->adaptive_lock);
+  slot->in_bytes += adaptive_buffering_probe_size (info);
+  if (!GST_CLOCK_TIME_IS_VALID (slot->window_start))
+    slot->window_start = now;
+  g_mutex_unlock (&slot->adaptive_lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+static GstPadProbeReturn
+adaptive_buffering_out_probe (GstPad * pad, GstPadProbeInfo * info,
+    GstURISourceBin * urisrc)
+{
+  OutputSlotInfo *slot;
+
+  slot = g_object_get_data (G_OBJECT (pad), "urisourcebin.slotinfo");
+  if (slot == NULL)
+    return GST_PAD_PROBE_OK;
+
+  g_mutex_lock (&slot->adaptive_lock);
+  slot->out_bytes += adaptive_buffering_probe_size (info);
+  g_mutex_unlock (&slot->adaptive_lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
 static gboolean
 copy_sticky_events (GstPad * pad, GstEvent ** event, gpointer user_data)
 {
@@ -1207,6 +1495,8 @@ get_output_slot (GstURISourceBin * urisrc, gboolean do_download,
 
   slot = g_new0 (OutputSlotInfo, 1);
   slot->queue = queue;
+  g_mutex_init (&slot->adaptive_lock);
+  slot->window_start = GST_CLOCK_TIME_NONE;
 
   /* Set the slot onto the queue (needed in buffering msg handling) */
   g_object_set_data (G_OBJECT (queue), "urisourcebin.slotinfo", slot);
@@ -1279,6 +1569,19 @@ get_output_slot (GstURISourceBin * urisrc, gboolean do_download,
   srcpad = gst_element_get_static_pad (queue, "src");
   g_object_set_data (G_OBJECT (srcpad), "urisourcebin.slotinfo", slot);
 
+  /* the temp file of download buffering is not limited by memory */
+  if (urisrc->adaptive_buffering && !do_download) {
+    GST_DEBUG_OBJECT (urisrc, "adaptive buffering on %" GST_PTR_FORMAT, queue);
+    slot->adaptive = TRUE;
+    gst_pad_add_probe (slot->sinkpad,
+        GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST,
+        (GstPadProbeCallback) adaptive_buffering_in_probe, urisrc, NULL);
+    gst_pad_add_probe (srcpad,
+        GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST,
+        (GstPadProbeCallback) adaptive_buffering_out_probe, urisrc, NULL);
+    adaptive_buffering_start (urisrc);
+  }
+
   slot->srcpad = create_output_pad (urisrc, srcpad);
 
   gst_object_unref (srcpad);
@@ -2115,6 +2418,7 @@ free_output_slot (OutputSlotInfo * slot, GstURISourceBin * urisrc)
   gst_pad_set_active (slot->srcpad, FALSE);
   gst_element_remove_pad (GST_ELEMENT_CAST (urisrc), slot->srcpad);
 
+  g_mutex_clear (&slot->adaptive_lock);
   g_free (slot);
 }
 
@@ -2173,6 +2477,8 @@ remove_source (GstURISourceBin * urisrc)
   urisrc->out_slots = NULL;
   GST_URI_SOURCE_BIN_UNLOCK (urisrc);
 
+  adaptive_buffering_stop (urisrc);
+
   if (urisrc->demuxer) {
     GST_DEBUG_OBJECT (urisrc, "removing old adaptive demux element");
     gst_element_set_state (urisrc->demuxer, GST_STATE_NULL);
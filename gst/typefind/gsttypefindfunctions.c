@@ -118,6 +118,218 @@ data_scan_ctx_memcmp (GstTypeFind * tf, DataScanCtx * c, guint offset,
   return (memcmp (c->data + offset, data, len) == 0);
 }
 
+/* Sync word scanning: the typefinders for headerless streams spend most of
+ * their time looking for a sync byte or an MPEG start code. Instead of
+ * testing every byte in their loops, look for the next candidate with
+ * memchr(), which is vectorised by any libc worth its salt, and only then
+ * check the full header. */
+
+/* Returns the offset of the first @byte in the first @len bytes of @data,
+ * or @len if there is none */
+static inline guint
+scan_for_byte (const guint8 * data, guint len, guint8 byte)
+{
+  const guint8 *p = memchr (data, byte, len);
+
+  return p ? p - data : len;
+}
+
+/* Returns the offset of the first 0x000001 start code that begins in the
+ * first @len bytes of @data, or @len if there is none. @data must be at
+ * least @len + 2 bytes large. */
+static inline guint
+scan_for_start_code (const guint8 * data, guint len)
+{
+  guint i = 0;
+
+  /* look for the 0x01 and check the two zero bytes before it, the zero
+   * bytes themselves are too common in most data */
+  while (i < len) {
+    const guint8 *p = memchr (data + i + 2, 0x01, len - i);
+
+    if (p == NULL)
+      break;
+
+    i = p - data - 2;
+    if (data[i] == 0x00 && data[i + 1] == 0x00)
+      return i;
+    i++;
+  }
+  return len;
+}
+
+/* Advances @c to the next @byte before @max_offset that has at least
+ * @min_len bytes of data available. Returns FALSE if there is none. */
+static inline gboolean
+data_scan_ctx_find_byte (GstTypeFind * tf, DataScanCtx * c, guint8 byte,
+    guint min_len, guint64 max_offset)
+{
+  while (c->offset < max_offset) {
+    guint len, skip;
+
+    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, c, min_len)))
+      return FALSE;
+
+    len = MIN (c->size - min_len + 1, max_offset - c->offset);
+    skip = scan_for_byte (c->data, len, byte);
+    data_scan_ctx_advance (tf, c, skip);
+    if (skip < len)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* Advances @c to the next 0x000001 start code before @max_offset that has at
+ * least @min_len bytes of data available. Returns FALSE if there is none. */
+static inline gboolean
+data_scan_ctx_find_start_code (GstTypeFind * tf, DataScanCtx * c,
+    guint min_len, guint64 max_offset)
+{
+  g_assert (min_len >= 3);
+
+  while (c->offset < max_offset) {
+    guint len, skip;
+
+    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, c, min_len)))
+      return FALSE;
+
+    len = MIN (c->size - min_len + 1, max_offset - c->offset);
+    skip = scan_for_start_code (c->data, len);
+    data_scan_ctx_advance (tf, c, skip);
+    if (skip < len)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* Magic index: registration-time index of the fixed signatures at the start
+ * of the stream that unambiguously identify a container format. The index is
+ * filled from plugin_init() before any typefinding happens and only read
+ * afterwards. The expensive scanning typefinders below look at the head of
+ * the stream once through it and bail out early when another format already
+ * claims the stream, instead of scanning kilobytes of e.g. a PNG or an AVI
+ * file for MPEG start codes or MP3 frame sync. */
+
+#define MAGIC_INDEX_MAX_ENTRIES 64
+#define MAGIC_INDEX_MAX_SIZE 32
+#define MAGIC_INDEX_RIFF_SIZE 12
+
+typedef struct
+{
+  const gchar *name;
+  const guint8 *data;
+  guint size;
+  gint next;
+} MagicIndexEntry;
+
+static MagicIndexEntry magic_index[MAGIC_INDEX_MAX_ENTRIES];
+static guint magic_index_len;
+static guint magic_index_size;
+/* head of the chain of entries per first byte, -1 if there is none, and
+ * the chain of RIFF form types */
+static gint magic_index_buckets[256];
+static gint magic_index_riff;
+
+static void
+magic_index_init (void)
+{
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (magic_index_buckets); i++)
+    magic_index_buckets[i] = -1;
+  magic_index_riff = -1;
+  magic_index_len = 0;
+  magic_index_size = 0;
+}
+
+static void
+magic_index_add (const gchar * name, const guint8 * data, guint size,
+    gboolean riff)
+{
+  MagicIndexEntry *entry;
+  gint *head;
+
+  /* these wrap raw MPEG program streams, which the MPEG typefinders must
+   * still be able to see */
+  if (strcmp (name, "video/x-vcd") == 0 || strcmp (name, "video/x-cdxa") == 0)
+    return;
+
+  if (size == 0 || size > MAGIC_INDEX_MAX_SIZE
+      || magic_index_len == MAGIC_INDEX_MAX_ENTRIES) {
+    GST_WARNING ("not indexing magic of %s", name);
+    return;
+  }
+
+  head = riff ? &magic_index_riff : &magic_index_buckets[data[0]];
+
+  entry = &magic_index[magic_index_len];
+  entry->name = name;
+  entry->data = data;
+  entry->size = size;
+  entry->next = *head;
+  *head = magic_index_len++;
+
+  magic_index_size = MAX (magic_index_size,
+      riff ? MAGIC_INDEX_RIFF_SIZE : size);
+}
+
+static const MagicIndexEntry *
+magic_index_lookup_chain (gint idx, const guint8 * data, guint size)
+{
+  for (; idx != -1; idx = magic_index[idx].next) {
+    const MagicIndexEntry *entry = &magic_index[idx];
+
+    if (entry->size <= size && memcmp (data, entry->data, entry->size) == 0)
+      return entry;
+  }
+  return NULL;
+}
+
+/* Returns the name of the format the first bytes of the stream belong to
+ * according to the magic index, or NULL */
+static const gchar *
+magic_index_lookup (GstTypeFind * tf)
+{
+  const MagicIndexEntry *entry = NULL;
+  const guint8 *data;
+  guint size = magic_index_size;
+
+  if (G_UNLIKELY (size == 0))
+    return NULL;
+
+  /* one peek for all signatures; fall back to the RIFF header size for short
+   * streams, which covers most of the signatures too */
+  data = gst_type_find_peek (tf, 0, size);
+  if (data == NULL && size > MAGIC_INDEX_RIFF_SIZE) {
+    size = MAGIC_INDEX_RIFF_SIZE;
+    data = gst_type_find_peek (tf, 0, size);
+  }
+  if (data == NULL)
+    return NULL;
+
+  if (memcmp (data, "RIFF", 4) == 0 || memcmp (data, "AVF0", 4) == 0)
+    entry = magic_index_lookup_chain (magic_index_riff, data + 8, size - 8);
+
+  if (entry == NULL)
+    entry = magic_index_lookup_chain (magic_index_buckets[data[0]], data, size);
+
+  return entry ? entry->name : NULL;
+}
+
+/* For the typefinders that scan through lots of data: check if the stream
+ * has already been claimed by the signature of another format */
+static gboolean
+magic_index_is_claimed (GstTypeFind * tf)
+{
+  const gchar *name = magic_index_lookup (tf);
+
+  if (name != NULL) {
+    GST_LOG ("start of stream has the signature of %s, skipping", name);
+    return TRUE;
+  }
+  return FALSE;
+}
+
 /*** text/plain ***/
 static gboolean xml_check_first_element (GstTypeFind * tf,
     const gchar * element, guint elen, gboolean strict);
@@ -1098,6 +1310,9 @@ aac_type_find (GstTypeFind * tf, gpointer unused)
   GstCaps *best_caps = NULL;
   guint best_count = 0;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (c.offset < AAC_AMOUNT) {
     guint snc, len, offset, i;
 
@@ -1415,7 +1630,7 @@ mp3_type_find_at_offset (GstTypeFind * tf, guint64 start_off,
 {
   const guint8 *data = NULL;
   const guint8 *data_end = NULL;
-  guint size;
+  guint size, skip;
   guint64 skipped;
   gint last_free_offset = -1;
   gint last_free_framelen = -1;
@@ -1437,6 +1652,17 @@ mp3_type_find_at_offset (GstTypeFind * tf, guint64 start_off,
         break;
       data_end = data + size;
     }
+
+    /* skip to the next possible frame sync */
+    skip = scan_for_byte (data, MIN (size,
+            GST_MP3_TYPEFIND_TRY_SYNC - skipped), 0xFF);
+    if (skip > 0) {
+      data += skip;
+      skipped += skip;
+      size -= skip;
+      continue;
+    }
+
     if (*data == 0xFF) {
       const guint8 *head_data = NULL;
       guint layer = 0, bitrate, samplerate, channels;
@@ -1560,6 +1786,9 @@ mp3_type_find (GstTypeFind * tf, gpointer unused)
   guint layer, mid_layer;
   guint64 length;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   mp3_type_find_at_offset (tf, 0, &layer, &prob);
   length = gst_type_find_get_length (tf);
 
@@ -1711,12 +1940,15 @@ ac3_type_find (GstTypeFind * tf, gpointer unused)
 {
   DataScanCtx c = { 0, NULL, 0 };
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   /* Search for an ac3 frame; not necessarily right at the start, but give it
    * a lower probability if not found right at the start. Check that the
    * frame is followed by a second frame at the expected offset.
    * We could also check the two ac3 CRCs, but we don't do that right now */
   while (c.offset < 1024) {
-    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, &c, 5)))
+    if (!data_scan_ctx_find_byte (tf, &c, 0x0b, 5, 1024))
       break;
 
     if (c.data[0] == 0x0b && c.data[1] == 0x77) {
@@ -1878,6 +2110,9 @@ dts_type_find (GstTypeFind * tf, gpointer unused)
 {
   DataScanCtx c = { 0, NULL, 0 };
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   /* Search for an dts frame; not necessarily right at the start, but give it
    * a lower probability if not found right at the start. Check that the
    * frame is followed by a second frame at the expected offset. */
@@ -2274,6 +2509,9 @@ mpeg_sys_type_find (GstTypeFind * tf, gpointer unused)
   guint32 sync_word = 0xffffffff;
   guint potential_headers = 0;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   G_STMT_START {
     gint len;
 
@@ -2453,9 +2691,12 @@ mpeg_ts_type_find (GstTypeFind * tf, gpointer unused)
    * FEC with 16 or 20 byte codes packet size. */
   const gint pack_sizes[] = { 188, 192, 204, 208 };
   const guint8 *data = NULL;
-  guint size = 0;
+  guint size = 0, skip;
   guint64 skipped = 0;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (skipped < GST_MPEGTS_TYPEFIND_SCAN_LENGTH) {
     if (size < MPEGTS_HDR_SIZE) {
       data = gst_type_find_peek (tf, skipped, GST_MPEGTS_TYPEFIND_SYNC_SIZE);
@@ -2464,7 +2705,17 @@ mpeg_ts_type_find (GstTypeFind * tf, gpointer unused)
       size = GST_MPEGTS_TYPEFIND_SYNC_SIZE;
     }
 
-    /* Have at least MPEGTS_HDR_SIZE bytes at this point */
+    /* Have at least MPEGTS_HDR_SIZE bytes at this point, skip to the next
+     * possible sync byte */
+    skip = scan_for_byte (data, MIN (size - MPEGTS_HDR_SIZE + 1,
+            GST_MPEGTS_TYPEFIND_SCAN_LENGTH - skipped), 0x47);
+    if (skip > 0) {
+      data += skip;
+      skipped += skip;
+      size -= skip;
+      continue;
+    }
+
     if (IS_MPEGTS_HEADER (data)) {
       gint p;
 
@@ -2507,18 +2758,12 @@ static gboolean
 mpeg_find_next_header (GstTypeFind * tf, DataScanCtx * c,
     guint64 max_extra_offset)
 {
-  guint64 extra_offset;
+  if (!data_scan_ctx_find_start_code (tf, c, 4,
+          c->offset + max_extra_offset + 1))
+    return FALSE;
 
-  for (extra_offset = 0; extra_offset <= max_extra_offset; ++extra_offset) {
-    if (!data_scan_ctx_ensure_data (tf, c, 4))
-      return FALSE;
-    if (IS_MPEG_HEADER (c->data)) {
-      data_scan_ctx_advance (tf, c, 3);
-      return TRUE;
-    }
-    data_scan_ctx_advance (tf, c, 1);
-  }
-  return FALSE;
+  data_scan_ctx_advance (tf, c, 3);
+  return TRUE;
 }
 
 /*** video/mpeg MPEG-4 elementary video stream ***/
@@ -2545,6 +2790,9 @@ mpeg4_video_type_find (GstTypeFind * tf, gpointer unused)
   guint num_vop_headers = 0;
   guint8 sc;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (c.offset < GST_MPEGVID_TYPEFIND_TRY_SYNC) {
     if (num_vop_headers >= GST_MPEGVID_TYPEFIND_TRY_PICTURES)
       break;
@@ -2666,6 +2914,9 @@ h263_video_type_find (GstTypeFind * tf, gpointer unused)
   guint bad = 0;
   guint pc_type, pb_mode;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (c.offset < H263_MAX_PROBE_LENGTH) {
     if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, &c, 4)))
       break;
@@ -2731,8 +2982,11 @@ h264_video_type_find (GstTypeFind * tf, gpointer unused)
   int good = 0;
   int bad = 0;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (c.offset < H264_MAX_PROBE_LENGTH) {
-    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, &c, 4)))
+    if (!data_scan_ctx_find_start_code (tf, &c, 4, H264_MAX_PROBE_LENGTH))
       break;
 
     if (IS_MPEG_HEADER (c.data)) {
@@ -2828,8 +3082,11 @@ h265_video_type_find (GstTypeFind * tf, gpointer unused)
   int good = 0;
   int bad = 0;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (c.offset < H265_MAX_PROBE_LENGTH) {
-    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, &c, 5)))
+    if (!data_scan_ctx_find_start_code (tf, &c, 5, H265_MAX_PROBE_LENGTH))
       break;
 
     if (IS_MPEG_HEADER (c.data)) {
@@ -2922,16 +3179,17 @@ mpeg_video_stream_type_find (GstTypeFind * tf, gpointer unused)
   guint num_pic_headers = 0;
   gint found = 0;
 
+  if (magic_index_is_claimed (tf))
+    return;
+
   while (c.offset < GST_MPEGVID_TYPEFIND_TRY_SYNC) {
     if (found >= GST_MPEGVID_TYPEFIND_TRY_PICTURES)
       break;
 
-    if (!data_scan_ctx_ensure_data (tf, &c, 5))
+    if (!data_scan_ctx_find_start_code (tf, &c, 5,
+            GST_MPEGVID_TYPEFIND_TRY_SYNC))
       break;
 
-    if (!IS_MPEG_HEADER (c.data))
-      goto next;
-
     /* a pack header indicates that this isn't an elementary stream */
     if (c.data[3] == 0xBA && mpeg_sys_is_valid_pack (tf, c.data, c.size, NULL))
       return;
@@ -2969,8 +3227,6 @@ mpeg_video_stream_type_find (GstTypeFind * tf, gpointer unused)
       continue;
     }
 
-  next:
-
     data_scan_ctx_advance (tf, &c, 1);
   }
 
@@ -5596,6 +5852,8 @@ G_BEGIN_DECLS{                                                          \
                      ext, sw_data->caps, sw_data,                       \
                      (GDestroyNotify) (sw_data_destroy))) {             \
     sw_data_destroy (sw_data);                                          \
+  } else if (_probability == GST_TYPE_FIND_MAXIMUM) {                   \
+    magic_index_add (name, (const guint8 *)_data, _size, FALSE);        \
   }                                                                     \
 }G_END_DECLS
 
@@ -5625,6 +5883,8 @@ G_BEGIN_DECLS{                                                          \
                       ext, sw_data->caps, sw_data,                      \
                       (GDestroyNotify) (sw_data_destroy))) {            \
     sw_data_destroy (sw_data);                                          \
+  } else {                                                              \
+    magic_index_add (name, (const guint8 *)_data, 4, TRUE);             \
   }                                                                     \
 }G_END_DECLS
 
@@ -5646,6 +5906,8 @@ plugin_init (GstPlugin * plugin)
   GST_DEBUG_CATEGORY_INIT (type_find_debug, "typefindfunctions",
       GST_DEBUG_FG_GREEN | GST_DEBUG_BG_RED, "generic type find functions");
 
+  magic_index_init ();
+
   /* note: asx/wax/wmx are XML files, asf doesn't handle them */
   /* must use strings, macros don't accept initializers */
   TYPE_FIND_REGISTER_START_WITH (plugin, "video/x-ms-asf", GST_RANK_SECONDARY,
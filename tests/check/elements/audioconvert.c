@@ -24,6 +24,7 @@
 #include <unistd.h>
 
 #include <gst/check/gstcheck.h>
+#include <gst/check/gstharness.h>
 #include <gst/audio/audio.h>
 
 /* For ease of programming we use globals to keep refs for our floating
@@ -1620,6 +1621,73 @@ GST_START_TEST (test_gap_buffers)
 
 GST_END_TEST;
 
+#define PLANAR_SAMPLES 480
+#define PLANAR_STRIDE 512
+
+GST_START_TEST (test_planar_in_place_meta)
+{
+  GstHarness *h;
+  GstBuffer *buffer;
+  GstAudioMeta *meta;
+  GstAudioInfo info;
+  GstMapInfo map;
+  gsize offsets[2] = { 0, PLANAR_STRIDE * sizeof (gint32) };
+  gint32 *in;
+  gfloat *planes[2];
+  guint i;
+
+  h = gst_harness_new ("audioconvert");
+  gst_harness_set_caps_str (h,
+      "audio/x-raw, format = (string) " GST_AUDIO_NE (S32)
+      ", layout = (string) non-interleaved, channels = (int) 2, "
+      "rate = (int) 48000",
+      "audio/x-raw, format = (string) " GST_AUDIO_NE (F32)
+      ", layout = (string) non-interleaved, channels = (int) 2, "
+      "rate = (int) 48000");
+
+  /* two planes with padding in between, S32 and F32 have the same size so
+   * this is converted in place */
+  in = g_new (gint32, 2 * PLANAR_STRIDE);
+  for (i = 0; i < PLANAR_STRIDE; i++) {
+    in[i] = i < PLANAR_SAMPLES ? 0x40000000 : G_MAXINT32;
+    in[PLANAR_STRIDE + i] = i < PLANAR_SAMPLES ? -0x40000000 : G_MAXINT32;
+  }
+  buffer = gst_buffer_new_wrapped (in, 2 * PLANAR_STRIDE * sizeof (gint32));
+  gst_audio_info_set_format (&info, GST_AUDIO_FORMAT_S32, 48000, 2, NULL);
+  info.layout = GST_AUDIO_LAYOUT_NON_INTERLEAVED;
+  fail_unless (gst_buffer_add_audio_meta (buffer, &info, PLANAR_SAMPLES,
+          offsets) != NULL);
+
+  fail_unless_equals_int (gst_harness_push (h, buffer), GST_FLOW_OK);
+  buffer = gst_harness_pull (h);
+
+  /* the meta describes the output format with the planes where they were */
+  meta = gst_buffer_get_audio_meta (buffer);
+  fail_unless (meta != NULL);
+  fail_unless_equals_int (GST_AUDIO_INFO_FORMAT (&meta->info),
+      GST_AUDIO_FORMAT_F32);
+  fail_unless_equals_int (GST_AUDIO_INFO_LAYOUT (&meta->info),
+      GST_AUDIO_LAYOUT_NON_INTERLEAVED);
+  fail_unless_equals_int (GST_AUDIO_INFO_CHANNELS (&meta->info), 2);
+  fail_unless_equals_int (meta->samples, PLANAR_SAMPLES);
+  fail_unless_equals_int (meta->offsets[0], 0);
+  fail_unless_equals_int (meta->offsets[1], PLANAR_STRIDE * sizeof (gfloat));
+
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  planes[0] = (gfloat *) (map.data + meta->offsets[0]);
+  planes[1] = (gfloat *) (map.data + meta->offsets[1]);
+  for (i = 0; i < PLANAR_SAMPLES; i++) {
+    fail_unless (planes[0][i] == 0.5);
+    fail_unless (planes[1][i] == -0.5);
+  }
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 
 static Suite *
 audioconvert_suite (void)
@@ -1639,6 +1707,7 @@ audioconvert_suite (void)
   tcase_add_test (tc_chain, test_convert_undefined_multichannel);
   tcase_add_test (tc_chain, test_preserve_width);
   tcase_add_test (tc_chain, test_gap_buffers);
+  tcase_add_test (tc_chain, test_planar_in_place_meta);
 
   return s;
 }
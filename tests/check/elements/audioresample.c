@@ -24,6 +24,7 @@
 #include <unistd.h>
 
 #include <gst/check/gstcheck.h>
+#include <gst/check/gstharness.h>
 
 #include <gst/audio/audio.h>
 
@@ -1086,6 +1087,103 @@ GST_START_TEST (test_fft)
 
 GST_END_TEST;
 
+#define PLANAR_CAPS_FORMAT "audio/x-raw, format = (string) " \
+    GST_AUDIO_NE (F32) ", layout = (string) non-interleaved, " \
+    "channels = (int) 2, rate = (int) %d"
+
+#define PLANAR_SAMPLES 480
+#define PLANAR_STRIDE 512
+
+/* two planes of @PLANAR_SAMPLES that are @PLANAR_STRIDE samples apart, the
+ * padding in between is filled with values out of the signal range */
+static GstBuffer *
+create_padded_planar_buffer (guint64 num)
+{
+  GstBuffer *buffer;
+  GstAudioInfo info;
+  gsize offsets[2] = { 0, PLANAR_STRIDE * sizeof (gfloat) };
+  gfloat *data;
+  gint i;
+
+  data = g_new (gfloat, 2 * PLANAR_STRIDE);
+  for (i = 0; i < PLANAR_STRIDE; i++) {
+    data[i] = i < PLANAR_SAMPLES ? 0.5 : 1000.0;
+    data[PLANAR_STRIDE + i] = i < PLANAR_SAMPLES ? -0.5 : 1000.0;
+  }
+  buffer = gst_buffer_new_wrapped (data, 2 * PLANAR_STRIDE * sizeof (gfloat));
+
+  gst_audio_info_set_format (&info, GST_AUDIO_FORMAT_F32, 48000, 2, NULL);
+  info.layout = GST_AUDIO_LAYOUT_NON_INTERLEAVED;
+  fail_unless (gst_buffer_add_audio_meta (buffer, &info, PLANAR_SAMPLES,
+          offsets) != NULL);
+
+  GST_BUFFER_PTS (buffer) =
+      gst_util_uint64_scale_int (num * PLANAR_SAMPLES, GST_SECOND, 48000);
+  GST_BUFFER_DURATION (buffer) =
+      gst_util_uint64_scale_int (PLANAR_SAMPLES, GST_SECOND, 48000);
+  GST_BUFFER_OFFSET (buffer) = num * PLANAR_SAMPLES;
+  GST_BUFFER_OFFSET_END (buffer) = (num + 1) * PLANAR_SAMPLES;
+
+  return buffer;
+}
+
+GST_START_TEST (test_planar_padded_input)
+{
+  GstHarness *h;
+  GstBuffer *buffer;
+  GstAudioMeta *meta;
+  GstMapInfo map;
+  gfloat *planes[2];
+  gchar *in_caps, *out_caps;
+  guint i, j;
+
+  h = gst_harness_new ("audioresample");
+  in_caps = g_strdup_printf (PLANAR_CAPS_FORMAT, 48000);
+  out_caps = g_strdup_printf (PLANAR_CAPS_FORMAT, 24000);
+  gst_harness_set_caps_str (h, in_caps, out_caps);
+  g_free (in_caps);
+  g_free (out_caps);
+
+  for (i = 0; i < 4; i++) {
+    fail_unless_equals_int (gst_harness_push (h,
+            create_padded_planar_buffer (i)), GST_FLOW_OK);
+    buffer = gst_harness_pull (h);
+
+    /* the output covers the samples of the input, not its padding */
+    meta = gst_buffer_get_audio_meta (buffer);
+    fail_unless (meta != NULL);
+    fail_unless (meta->samples > 0);
+    fail_unless (meta->samples <= PLANAR_SAMPLES / 2);
+    fail_unless_equals_int (gst_buffer_get_size (buffer),
+        meta->samples * 2 * sizeof (gfloat));
+    fail_unless_equals_int (meta->offsets[0], 0);
+    fail_unless_equals_int (meta->offsets[1], meta->samples * sizeof (gfloat));
+    fail_unless_equals_uint64 (GST_BUFFER_OFFSET_END (buffer) -
+        GST_BUFFER_OFFSET (buffer), meta->samples);
+
+    gst_buffer_map (buffer, &map, GST_MAP_READ);
+    planes[0] = (gfloat *) (map.data + meta->offsets[0]);
+    planes[1] = (gfloat *) (map.data + meta->offsets[1]);
+
+    /* the padding never makes it into the filter */
+    for (j = 0; j < meta->samples; j++) {
+      fail_unless (ABS (planes[0][j]) <= 1.0);
+      fail_unless (ABS (planes[1][j]) <= 1.0);
+    }
+    /* and once the filter settled the channels keep their value */
+    if (i > 0) {
+      fail_unless (ABS (planes[0][meta->samples - 1] - 0.5) < 0.05);
+      fail_unless (ABS (planes[1][meta->samples - 1] + 0.5) < 0.05);
+    }
+    gst_buffer_unmap (buffer, &map);
+    gst_buffer_unref (buffer);
+  }
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 static Suite *
 audioresample_suite (void)
 {
@@ -1100,6 +1198,7 @@ audioresample_suite (void)
   tcase_add_test (tc_chain, test_live_switch);
   tcase_add_test (tc_chain, test_timestamp_drift);
   tcase_add_test (tc_chain, test_fft);
+  tcase_add_test (tc_chain, test_planar_padded_input);
 
 #ifndef GST_DISABLE_PARSE
   tcase_set_timeout (tc_chain, 360);
@@ -19,6 +19,9 @@
  * Boston, MA 02110-1301, USA.
  */
 
+/* suppress warnings for deprecated API such as GValueArray */
+#define GLIB_DISABLE_DEPRECATION_WARNINGS
+
 #ifdef HAVE_CONFIG_H
 # include <config.h>
 #endif
@@ -353,6 +356,72 @@ GST_START_TEST (test_mp3_parser_loop)
 
 GST_END_TEST;
 
+static gboolean
+factories_contain (GValueArray * factories, const gchar * name)
+{
+  guint i;
+
+  for (i = 0; i < factories->n_values; i++) {
+    GstPluginFeature *feature =
+        g_value_get_object (g_value_array_get_nth (factories, i));
+
+    if (strcmp (gst_plugin_feature_get_name (feature), name) == 0)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+GST_START_TEST (test_autoplug_factories_cache)
+{
+  GstPluginFeature *feature;
+  GValueArray *factories;
+  GstElement *dec1, *dec2;
+  GstCaps *caps;
+
+  gst_plugin_register_static (GST_VERSION_MAJOR, GST_VERSION_MINOR,
+      "fakemp3parse", "fakemp3parse", plugin_init, VERSION, "LGPL",
+      "gst-plugins-base", GST_PACKAGE_NAME, GST_PACKAGE_ORIGIN);
+
+  feature = gst_registry_find_feature (gst_registry_get (),
+      "testmpegaudioparse", GST_TYPE_ELEMENT_FACTORY);
+
+  caps = gst_caps_from_string ("audio/mpeg, mpegversion=(int)1");
+  dec1 = gst_element_factory_make ("decodebin", NULL);
+  dec2 = gst_element_factory_make ("decodebin", NULL);
+
+  /* not autoplugged with rank NONE */
+  g_signal_emit_by_name (dec1, "autoplug-factories", NULL, caps, &factories);
+  fail_unless (factories != NULL);
+  fail_if (factories_contain (factories, "testmpegaudioparse"));
+  g_value_array_free (factories);
+
+  /* the factories are shared by all decodebins, but changing the rank must
+   * still be picked up */
+  gst_plugin_feature_set_rank (feature, GST_RANK_PRIMARY + 100);
+  g_signal_emit_by_name (dec2, "autoplug-factories", NULL, caps, &factories);
+  fail_unless (factories != NULL);
+  fail_unless (factories->n_values > 0);
+  fail_unless_equals_string (gst_plugin_feature_get_name (g_value_get_object
+          (g_value_array_get_nth (factories, 0))), "testmpegaudioparse");
+  g_value_array_free (factories);
+
+  g_signal_emit_by_name (dec1, "autoplug-factories", NULL, caps, &factories);
+  fail_unless (factories_contain (factories, "testmpegaudioparse"));
+  g_value_array_free (factories);
+
+  gst_plugin_feature_set_rank (feature, GST_RANK_NONE);
+  g_signal_emit_by_name (dec1, "autoplug-factories", NULL, caps, &factories);
+  fail_if (factories_contain (factories, "testmpegaudioparse"));
+  g_value_array_free (factories);
+
+  gst_caps_unref (caps);
+  gst_object_unref (dec1);
+  gst_object_unref (dec2);
+  gst_object_unref (feature);
+}
+
+GST_END_TEST;
+
 /* Fake parser/decoder for parser_negotiation test */
 static GType gst_fake_h264_parser_get_type (void);
 static GType gst_fake_h264_decoder_get_type (void);
@@ -720,6 +789,7 @@ decodebin_suite (void)
   tcase_add_test (tc_chain, test_text_plain_streams);
   tcase_add_test (tc_chain, test_reuse_without_decoders);
   tcase_add_test (tc_chain, test_mp3_parser_loop);
+  tcase_add_test (tc_chain, test_autoplug_factories_cache);
   tcase_add_test (tc_chain, test_parser_negotiation);
   tcase_add_test (tc_chain, test_buffering_aggregation);
 
@@ -28,12 +28,18 @@
 
 #include <gst/check/gstcheck.h>
 #include <gst/base/gstpushsrc.h>
+#include <gst/base/gstbasesink.h>
 #include <unistd.h>
 
 #ifndef GST_DISABLE_REGISTRY
 
 static GType gst_red_video_src_get_type (void);
 static GType gst_codec_src_get_type (void);
+static GType gst_test_audio_sink_get_type (void);
+static GType gst_test_video_sink_get_type (void);
+
+static gint n_test_audio_sinks;
+static gint n_test_video_sinks;
 
 GST_START_TEST (test_uri)
 {
@@ -606,6 +612,211 @@ GST_START_TEST (test_element_setup)
 
 GST_END_TEST;
 
+/* runs playbin3 to PAUSED and returns its playbin3-startup message */
+static GstStructure *
+run_playbin3_startup (gboolean fast_start)
+{
+  GstElement *playbin;
+  GstStructure *s = NULL;
+  GstMessage *msg;
+  GstBus *bus;
+
+  playbin = gst_element_factory_make ("playbin3", NULL);
+  fail_unless (playbin != NULL, "Failed to create playbin3 element");
+  g_object_set (playbin, "uri", "redvideo://", "fast-start", fast_start,
+      NULL);
+
+  fail_unless_equals_int (gst_element_set_state (playbin, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_ASYNC);
+  fail_unless_equals_int (gst_element_get_state (playbin, NULL, NULL,
+          GST_CLOCK_TIME_NONE), GST_STATE_CHANGE_SUCCESS);
+
+  bus = gst_element_get_bus (playbin);
+  while (s == NULL
+      && (msg = gst_bus_pop_filtered (bus, GST_MESSAGE_ELEMENT)) != NULL) {
+    if (gst_message_has_name (msg, "playbin3-startup"))
+      s = gst_structure_copy (gst_message_get_structure (msg));
+    gst_message_unref (msg);
+  }
+  gst_object_unref (bus);
+  fail_unless (s != NULL, "no playbin3-startup message");
+
+  fail_unless_equals_int (gst_element_set_state (playbin, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+  gst_object_unref (playbin);
+
+  return s;
+}
+
+static GstClockTime
+startup_step (const GstStructure * s, const gchar * step)
+{
+  guint64 time = GST_CLOCK_TIME_NONE;
+
+  fail_unless (gst_structure_get_uint64 (s, step, &time));
+
+  return time;
+}
+
+GST_START_TEST (test_playbin3_fast_start)
+{
+  GstStructure *s;
+  gboolean fast_start;
+  GstClockTime first_frame;
+
+  fail_unless (gst_element_register (NULL, "redvideosrc", GST_RANK_PRIMARY,
+          gst_red_video_src_get_type ()));
+  /* replace the default sinks, so that we can count them */
+  fail_unless (gst_element_register (NULL, "autoaudiosink", GST_RANK_NONE,
+          gst_test_audio_sink_get_type ()));
+  fail_unless (gst_element_register (NULL, "autovideosink", GST_RANK_NONE,
+          gst_test_video_sink_get_type ()));
+
+  /* without fast-start, playsink opens the video sink itself */
+  s = run_playbin3_startup (FALSE);
+  fail_unless (gst_structure_get_boolean (s, "fast-start", &fast_start));
+  fail_if (fast_start);
+  fail_if (GST_CLOCK_TIME_IS_VALID (startup_step (s, "sinks-ready")));
+  first_frame = startup_step (s, "first-frame");
+  fail_unless (GST_CLOCK_TIME_IS_VALID (first_frame));
+  fail_unless (startup_step (s, "source-setup") <= first_frame);
+  fail_unless (startup_step (s, "stream-collection") <= first_frame);
+  fail_unless (startup_step (s, "output-configured") <= first_frame);
+  gst_structure_free (s);
+
+  fail_unless_equals_int (g_atomic_int_get (&n_test_video_sinks), 1);
+  fail_unless_equals_int (g_atomic_int_get (&n_test_audio_sinks), 0);
+
+  /* with fast-start, the video sink is opened ahead of time and used by
+   * playsink, and no audio sink is opened for this video-only stream */
+  s = run_playbin3_startup (TRUE);
+  fail_unless (gst_structure_get_boolean (s, "fast-start", &fast_start));
+  fail_unless (fast_start);
+  first_frame = startup_step (s, "first-frame");
+  fail_unless (GST_CLOCK_TIME_IS_VALID (first_frame));
+  fail_unless (startup_step (s, "stream-collection") <=
+      startup_step (s, "sinks-ready"));
+  fail_unless (startup_step (s, "sinks-ready") <=
+      startup_step (s, "output-configured"));
+  fail_unless (startup_step (s, "output-configured") <= first_frame);
+  gst_structure_free (s);
+
+  fail_unless_equals_int (g_atomic_int_get (&n_test_video_sinks), 2);
+  fail_unless_equals_int (g_atomic_int_get (&n_test_audio_sinks), 0);
+}
+
+GST_END_TEST;
+
+typedef struct
+{
+  GMutex lock;
+  GCond cond;
+  const gchar *uri;
+  GstElement *source;
+  gint n_setups;
+} LookaheadData;
+
+static void
+lookahead_source_setup (GstElement * playbin, GstElement * source,
+    LookaheadData * data)
+{
+  gchar *uri;
+
+  if (!GST_IS_URI_HANDLER (source))
+    return;
+
+  uri = gst_uri_handler_get_uri (GST_URI_HANDLER (source));
+  if (g_strcmp0 (uri, data->uri) == 0) {
+    g_mutex_lock (&data->lock);
+    if (data->source == NULL)
+      data->source = gst_object_ref (source);
+    data->n_setups++;
+    g_cond_signal (&data->cond);
+    g_mutex_unlock (&data->lock);
+  }
+  g_free (uri);
+}
+
+GST_START_TEST (test_playbin3_lookahead)
+{
+  GstElement *playbin, *source;
+  LookaheadData data = { {0,}, };
+  const gchar *lookahead_uris[] = { NULL, NULL };
+  gchar **uris;
+  gchar *path, *uri;
+  gint64 end_time;
+
+  if (!gst_registry_check_feature_version (gst_registry_get (), "redvideosrc",
+          GST_VERSION_MAJOR, GST_VERSION_MINOR, 0)) {
+    fail_unless (gst_element_register (NULL, "redvideosrc", GST_RANK_PRIMARY,
+            gst_red_video_src_get_type ()));
+  }
+
+  path = g_build_filename (GST_TEST_FILES_PATH, "theora-vorbis.ogg", NULL);
+  uri = gst_filename_to_uri (path, NULL);
+  g_free (path);
+
+  g_mutex_init (&data.lock);
+  g_cond_init (&data.cond);
+  data.uri = uri;
+
+  playbin = gst_element_factory_make ("playbin3", NULL);
+  fail_unless (playbin != NULL, "Failed to create playbin3 element");
+  lookahead_uris[0] = uri;
+  g_object_set (playbin, "uri", "redvideo://",
+      "audio-sink", gst_element_factory_make ("fakesink", NULL),
+      "video-sink", gst_element_factory_make ("fakesink", NULL),
+      "lookahead-uris", lookahead_uris, NULL);
+  g_signal_connect (playbin, "source-setup",
+      G_CALLBACK (lookahead_source_setup), &data);
+
+  fail_unless_equals_int (gst_element_set_state (playbin, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_ASYNC);
+  fail_unless_equals_int (gst_element_get_state (playbin, NULL, NULL,
+          GST_CLOCK_TIME_NONE), GST_STATE_CHANGE_SUCCESS);
+
+  /* the upcoming uri is opened in the background once redvideo prerolled */
+  end_time = g_get_monotonic_time () + 10 * G_TIME_SPAN_SECOND;
+  g_mutex_lock (&data.lock);
+  while (data.source == NULL)
+    fail_unless (g_cond_wait_until (&data.cond, &data.lock, end_time),
+        "upcoming uri was not opened");
+  g_mutex_unlock (&data.lock);
+
+  /* playing it takes over the urisourcebin that opened it */
+  fail_unless_equals_int (gst_element_set_state (playbin, GST_STATE_READY),
+      GST_STATE_CHANGE_SUCCESS);
+  g_object_set (playbin, "uri", uri, NULL);
+  fail_unless_equals_int (gst_element_set_state (playbin, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_ASYNC);
+  fail_unless_equals_int (gst_element_get_state (playbin, NULL, NULL,
+          GST_CLOCK_TIME_NONE), GST_STATE_CHANGE_SUCCESS);
+
+  g_mutex_lock (&data.lock);
+  fail_unless_equals_int (data.n_setups, 1);
+  g_mutex_unlock (&data.lock);
+
+  g_object_get (playbin, "source", &source, NULL);
+  fail_unless (source == data.source);
+  gst_object_unref (source);
+
+  /* and consumes it from the upcoming uris */
+  g_object_get (playbin, "lookahead-uris", &uris, NULL);
+  fail_unless (uris == NULL || uris[0] == NULL);
+  g_strfreev (uris);
+
+  fail_unless_equals_int (gst_element_set_state (playbin, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+  gst_object_unref (playbin);
+
+  gst_object_unref (data.source);
+  g_mutex_clear (&data.lock);
+  g_cond_clear (&data.cond);
+  g_free (uri);
+}
+
+GST_END_TEST;
+
 /*** redvideo:// source ***/
 
 static GstURIType
@@ -816,6 +1027,53 @@ gst_codec_src_init (GstCodecSrc * src)
 {
 }
 
+/*** counting sinks ***/
+
+static GstStaticPadTemplate test_sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+
+typedef GstBaseSink GstTestAudioSink;
+typedef GstBaseSinkClass GstTestAudioSinkClass;
+
+G_DEFINE_TYPE (GstTestAudioSink, gst_test_audio_sink, GST_TYPE_BASE_SINK);
+
+static void
+gst_test_audio_sink_class_init (GstTestAudioSinkClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class, &test_sink_templ);
+  gst_element_class_set_metadata (element_class,
+      "Test Audio Sink", "Sink/Audio", "yep", "me");
+}
+
+static void
+gst_test_audio_sink_init (GstTestAudioSink * sink)
+{
+  g_atomic_int_inc (&n_test_audio_sinks);
+}
+
+typedef GstBaseSink GstTestVideoSink;
+typedef GstBaseSinkClass GstTestVideoSinkClass;
+
+G_DEFINE_TYPE (GstTestVideoSink, gst_test_video_sink, GST_TYPE_BASE_SINK);
+
+static void
+gst_test_video_sink_class_init (GstTestVideoSinkClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class, &test_sink_templ);
+  gst_element_class_set_metadata (element_class,
+      "Test Video Sink", "Sink/Video", "yep", "me");
+}
+
+static void
+gst_test_video_sink_init (GstTestVideoSink * sink)
+{
+  g_atomic_int_inc (&n_test_video_sinks);
+}
+
 #if 0
 GST_START_TEST (test_appsink_twice)
 {
@@ -903,6 +1161,17 @@ playbin_suite (void)
   tcase_add_test (tc_chain, test_refcount);
   tcase_add_test (tc_chain, test_source_setup);
   tcase_add_test (tc_chain, test_element_setup);
+  tcase_add_test (tc_chain, test_playbin3_fast_start);
+
+  {
+    GstRegistry *reg = gst_registry_get ();
+
+    if (gst_registry_check_feature_version (reg, "oggdemux", 1, 0, 0) &&
+        gst_registry_check_feature_version (reg, "theoradec", 1, 0, 0) &&
+        gst_registry_check_feature_version (reg, "vorbisdec", 1, 0, 0)) {
+      tcase_add_test (tc_chain, test_playbin3_lookahead);
+    }
+  }
 
 #if 0
   {
@@ -291,6 +291,298 @@ GST_START_TEST (test_basic)
 
 GST_END_TEST;
 
+#define CONTENTION_N_STREAMS 16
+#define CONTENTION_N_BUFFERS 10000
+#define CONTENTION_DURATION (10 * GST_MSECOND)
+
+typedef struct
+{
+  GstPad *mysrcpad;
+  GstPad *mysinkpad;
+  GstPad *sinkpad;
+  GstPad *srcpad;
+  GThread *thread;
+  gboolean early_eos;           /* EOS after half of the buffers */
+
+  /* only touched by the streaming thread of the stream */
+  gint received;
+  gint n_eos;
+  gint n_gaps;
+  GstClockTime last_gap;
+} MyContentionStream;
+
+/* the streams with a late EOS only push their second half of buffers once
+ * all the streams with an early EOS are about to push it */
+static gint contention_early_eos_pending;
+static GMutex contention_lock;
+static GCond contention_cond;
+
+static GstFlowReturn
+contention_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
+{
+  MyContentionStream *stream = GST_PAD_ELEMENT_PRIVATE (pad);
+
+  /* buffers come out unchanged and in order */
+  fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (buf),
+      stream->received * CONTENTION_DURATION);
+  stream->received++;
+  gst_buffer_unref (buf);
+
+  return GST_FLOW_OK;
+}
+
+static gboolean
+contention_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
+{
+  MyContentionStream *stream = GST_PAD_ELEMENT_PRIVATE (pad);
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_EOS:
+      stream->n_eos++;
+      break;
+    case GST_EVENT_GAP:{
+      GstClockTime timestamp;
+
+      gst_event_parse_gap (event, &timestamp, NULL);
+      fail_unless (!GST_CLOCK_TIME_IS_VALID (stream->last_gap)
+          || timestamp >= stream->last_gap);
+      stream->last_gap = timestamp;
+      stream->n_gaps++;
+      break;
+    }
+    default:
+      break;
+  }
+  gst_event_unref (event);
+  return TRUE;
+}
+
+static gpointer
+contention_push_thread (MyContentionStream * stream)
+{
+  GstSegment segment;
+  GstEvent *event;
+  gchar *stream_id;
+  guint i, n_buffers;
+
+  stream_id = g_strdup_printf ("stream-%p", stream);
+  event = gst_event_new_stream_start (stream_id);
+  gst_event_set_group_id (event, 1);
+  gst_pad_push_event (stream->mysrcpad, event);
+  g_free (stream_id);
+
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  gst_pad_push_event (stream->mysrcpad, gst_event_new_segment (&segment));
+
+  n_buffers = stream->early_eos ? CONTENTION_N_BUFFERS / 2 :
+      CONTENTION_N_BUFFERS;
+  for (i = 0; i < n_buffers; i++) {
+    GstBuffer *buf = gst_buffer_new ();
+
+    if (!stream->early_eos && i == CONTENTION_N_BUFFERS / 2) {
+      g_mutex_lock (&contention_lock);
+      while (contention_early_eos_pending > 0)
+        g_cond_wait (&contention_cond, &contention_lock);
+      g_mutex_unlock (&contention_lock);
+    }
+
+    GST_BUFFER_TIMESTAMP (buf) = i * CONTENTION_DURATION;
+    GST_BUFFER_DURATION (buf) = CONTENTION_DURATION;
+    fail_unless_equals_int (gst_pad_push (stream->mysrcpad, buf),
+        GST_FLOW_OK);
+  }
+
+  if (stream->early_eos) {
+    g_mutex_lock (&contention_lock);
+    contention_early_eos_pending--;
+    g_cond_broadcast (&contention_cond);
+    g_mutex_unlock (&contention_lock);
+  }
+
+  /* waits until all streams are EOS */
+  fail_unless (gst_pad_push_event (stream->mysrcpad, gst_event_new_eos ()));
+
+  return NULL;
+}
+
+/* pushes buffers on many streams from as many threads at the same time,
+ * half of the streams going EOS early, and checks that the buffers go
+ * through unchanged and that the EOS streams are advanced with gap events
+ * by the others. Also logs how long that took per buffer */
+GST_START_TEST (test_contention)
+{
+  MyContentionStream streams[CONTENTION_N_STREAMS];
+  GstElement *synchr;
+  gint64 start, elapsed;
+  guint i, n_buffers = 0;
+
+  synchr = gst_element_factory_make ("streamsynchronizer", NULL);
+
+  contention_early_eos_pending = 0;
+  for (i = 0; i < CONTENTION_N_STREAMS; i++) {
+    MyContentionStream *stream = &streams[i];
+
+    stream->early_eos = (i % 2 == 0);
+    if (stream->early_eos)
+      contention_early_eos_pending++;
+    stream->received = 0;
+    stream->n_eos = 0;
+    stream->n_gaps = 0;
+    stream->last_gap = GST_CLOCK_TIME_NONE;
+    stream->sinkpad = gst_element_get_request_pad (synchr, "sink_%u");
+    fail_unless (stream->sinkpad != NULL);
+    stream->srcpad = get_other_pad (stream->sinkpad);
+    fail_unless (stream->srcpad != NULL);
+
+    stream->mysrcpad =
+        gst_pad_new_from_static_template (&mysrctemplate, "src");
+    fail_unless (gst_pad_link (stream->mysrcpad,
+            stream->sinkpad) == GST_PAD_LINK_OK);
+
+    stream->mysinkpad =
+        gst_pad_new_from_static_template (&mysinktemplate, "sink");
+    gst_pad_set_chain_function (stream->mysinkpad, contention_sink_chain);
+    gst_pad_set_event_function (stream->mysinkpad, contention_sink_event);
+    GST_PAD_ELEMENT_PRIVATE (stream->mysinkpad) = stream;
+    fail_unless (gst_pad_link (stream->srcpad,
+            stream->mysinkpad) == GST_PAD_LINK_OK);
+  }
+
+  gst_element_set_state (synchr, GST_STATE_PLAYING);
+
+  for (i = 0; i < CONTENTION_N_STREAMS; i++) {
+    fail_unless (gst_pad_set_active (streams[i].mysrcpad, TRUE));
+    fail_unless (gst_pad_set_active (streams[i].mysinkpad, TRUE));
+  }
+
+  start = g_get_monotonic_time ();
+  for (i = 0; i < CONTENTION_N_STREAMS; i++) {
+    streams[i].thread = g_thread_new ("pushthread",
+        (GThreadFunc) contention_push_thread, &streams[i]);
+  }
+  for (i = 0; i < CONTENTION_N_STREAMS; i++)
+    g_thread_join (streams[i].thread);
+  elapsed = g_get_monotonic_time () - start;
+
+  for (i = 0; i < CONTENTION_N_STREAMS; i++) {
+    MyContentionStream *stream = &streams[i];
+
+    n_buffers += stream->received;
+    fail_unless_equals_int (stream->n_eos, 1);
+    if (stream->early_eos) {
+      fail_unless_equals_int (stream->received, CONTENTION_N_BUFFERS / 2);
+      /* the other streams went on for more than a second after our EOS */
+      fail_unless (stream->n_gaps > 0);
+      fail_unless (stream->last_gap >
+          CONTENTION_N_BUFFERS / 2 * CONTENTION_DURATION);
+    } else {
+      fail_unless_equals_int (stream->received, CONTENTION_N_BUFFERS);
+      fail_unless_equals_int (stream->n_gaps, 0);
+    }
+  }
+
+  /* keep an eye on lock contention in the buffer path */
+  GST_INFO ("%u streams, %u buffers took %" G_GINT64_FORMAT " us, "
+      "%.1f ns per buffer", CONTENTION_N_STREAMS, n_buffers, elapsed,
+      elapsed * 1000.0 / n_buffers);
+
+  gst_element_set_state (synchr, GST_STATE_NULL);
+
+  for (i = 0; i < CONTENTION_N_STREAMS; i++) {
+    MyContentionStream *stream = &streams[i];
+
+    gst_element_release_request_pad (synchr, stream->sinkpad);
+    gst_object_unref (stream->srcpad);
+    gst_object_unref (stream->sinkpad);
+    gst_object_unref (stream->mysinkpad);
+    gst_object_unref (stream->mysrcpad);
+  }
+  gst_object_unref (synchr);
+}
+
+GST_END_TEST;
+
+static GstFlowReturn
+release_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
+{
+  gint *received = GST_PAD_ELEMENT_PRIVATE (pad);
+
+  g_atomic_int_inc (received);
+  gst_buffer_unref (buf);
+
+  return GST_FLOW_OK;
+}
+
+static gpointer
+release_push_thread (GstPad * mysrcpad)
+{
+  GstSegment segment;
+  GstFlowReturn ret;
+  guint i = 0;
+
+  gst_pad_push_event (mysrcpad, gst_event_new_stream_start ("stream"));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  gst_pad_push_event (mysrcpad, gst_event_new_segment (&segment));
+
+  do {
+    GstBuffer *buf = gst_buffer_new ();
+
+    GST_BUFFER_TIMESTAMP (buf) = i++ * CONTENTION_DURATION;
+    GST_BUFFER_DURATION (buf) = CONTENTION_DURATION;
+    ret = gst_pad_push (mysrcpad, buf);
+  } while (ret == GST_FLOW_OK);
+
+  return GINT_TO_POINTER (ret);
+}
+
+/* releases a stream while buffers flow through it, nothing but the element
+ * holds a reference to its srcpad */
+GST_START_TEST (test_release_while_pushing)
+{
+  GstElement *synchr;
+  GstPad *sinkpad, *srcpad, *mysrcpad, *mysinkpad;
+  GstFlowReturn ret;
+  GThread *thread;
+  gint received = 0;
+
+  synchr = gst_element_factory_make ("streamsynchronizer", NULL);
+  sinkpad = gst_element_get_request_pad (synchr, "sink_%u");
+  fail_unless (sinkpad != NULL);
+  srcpad = get_other_pad (sinkpad);
+  fail_unless (srcpad != NULL);
+
+  mysrcpad = gst_pad_new_from_static_template (&mysrctemplate, "src");
+  fail_unless (gst_pad_link (mysrcpad, sinkpad) == GST_PAD_LINK_OK);
+  mysinkpad = gst_pad_new_from_static_template (&mysinktemplate, "sink");
+  gst_pad_set_chain_function (mysinkpad, release_sink_chain);
+  GST_PAD_ELEMENT_PRIVATE (mysinkpad) = &received;
+  fail_unless (gst_pad_link (srcpad, mysinkpad) == GST_PAD_LINK_OK);
+  gst_object_unref (srcpad);
+
+  gst_element_set_state (synchr, GST_STATE_PLAYING);
+  fail_unless (gst_pad_set_active (mysrcpad, TRUE));
+  fail_unless (gst_pad_set_active (mysinkpad, TRUE));
+
+  thread = g_thread_new ("pushthread", (GThreadFunc) release_push_thread,
+      mysrcpad);
+  while (g_atomic_int_get (&received) < 1000)
+    g_thread_yield ();
+
+  gst_element_release_request_pad (synchr, sinkpad);
+  ret = GPOINTER_TO_INT (g_thread_join (thread));
+  fail_unless (ret == GST_FLOW_FLUSHING || ret == GST_FLOW_NOT_LINKED
+      || ret == GST_FLOW_ERROR, "unexpected flow return %s",
+      gst_flow_get_name (ret));
+
+  gst_element_set_state (synchr, GST_STATE_NULL);
+  gst_object_unref (sinkpad);
+  gst_object_unref (mysinkpad);
+  gst_object_unref (mysrcpad);
+  gst_object_unref (synchr);
+}
+
+GST_END_TEST;
+
 static Suite *
 streamsynchronizer_suite (void)
 {
@@ -299,6 +591,8 @@ streamsynchronizer_suite (void)
 
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_basic);
+  tcase_add_test (tc_chain, test_contention);
+  tcase_add_test (tc_chain, test_release_while_pushing);
 
   return s;
 }
@@ -0,0 +1,364 @@
+/* GStreamer unit tests for urisourcebin
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <gst/check/gstcheck.h>
+#include <gst/base/gstpushsrc.h>
+
+#ifndef GST_DISABLE_REGISTRY
+
+static GType gst_rate_src_get_type (void);
+
+/* the rate source pushes RATE_BUFFER_SIZE bytes of RATE_BUFFER_DURATION of
+ * stream every RATE_BUFFER_INTERVAL, so the download is ten times as fast as
+ * the stream, until it is stalled */
+#define RATE_BUFFER_SIZE      10000
+#define RATE_BUFFER_DURATION  (100 * GST_MSECOND)
+#define RATE_BUFFER_INTERVAL  (10 * G_TIME_SPAN_MILLISECOND)
+#define RATE_STREAM_BITRATE   (RATE_BUFFER_SIZE * GST_SECOND / \
+    RATE_BUFFER_DURATION)
+
+static GMutex rate_lock;
+static GCond rate_cond;
+static gboolean rate_stalled;
+static gboolean rate_flushing;
+static guint rate_pushed;
+
+static void
+pad_added_cb (GstElement * urisrcbin, GstPad * pad, GstElement * sink)
+{
+  GstPad *sinkpad = gst_element_get_static_pad (sink, "sink");
+
+  fail_unless_equals_int (gst_pad_link (pad, sinkpad), GST_PAD_LINK_OK);
+  gst_object_unref (sinkpad);
+}
+
+static GstStructure *
+pop_adaptive_stats (GstBus * bus)
+{
+  GstStructure *s = NULL;
+  GstMessage *msg;
+
+  while (s == NULL) {
+    msg = gst_bus_timed_pop_filtered (bus, 10 * GST_SECOND,
+        GST_MESSAGE_ELEMENT | GST_MESSAGE_ERROR);
+    fail_unless (msg != NULL, "no adaptive-buffering-stats message");
+    fail_if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR);
+    if (gst_message_has_name (msg, "adaptive-buffering-stats"))
+      s = gst_structure_copy (gst_message_get_structure (msg));
+    gst_message_unref (msg);
+  }
+
+  return s;
+}
+
+/* checks that the limits of the message are the ones set on the queue
+ * behind the pad of the message */
+static void
+check_queue_limits (GstElement * urisrcbin, const GstStructure * s)
+{
+  GstPad *pad, *target;
+  GstElement *queue;
+  guint max_size_bytes, s_max_size_bytes;
+  guint64 max_size_time, s_max_size_time;
+  gint low_percent, s_low_percent, high_percent, s_high_percent;
+
+  fail_unless (gst_structure_get (s, "pad", GST_TYPE_PAD, &pad,
+          "max-size-bytes", G_TYPE_UINT, &s_max_size_bytes,
+          "max-size-time", G_TYPE_UINT64, &s_max_size_time,
+          "low-percent", G_TYPE_INT, &s_low_percent,
+          "high-percent", G_TYPE_INT, &s_high_percent, NULL));
+  fail_unless (GST_OBJECT_PARENT (pad) == GST_OBJECT_CAST (urisrcbin));
+
+  target = gst_ghost_pad_get_target (GST_GHOST_PAD (pad));
+  queue = gst_pad_get_parent_element (target);
+  g_object_get (queue, "max-size-bytes", &max_size_bytes,
+      "max-size-time", &max_size_time, "low-percent", &low_percent,
+      "high-percent", &high_percent, NULL);
+  fail_unless_equals_int (max_size_bytes, s_max_size_bytes);
+  fail_unless_equals_uint64 (max_size_time, s_max_size_time);
+  fail_unless_equals_int (low_percent, s_low_percent);
+  fail_unless_equals_int (high_percent, s_high_percent);
+
+  gst_object_unref (queue);
+  gst_object_unref (target);
+  gst_object_unref (pad);
+}
+
+GST_START_TEST (test_adaptive_buffering)
+{
+  GstElement *pipeline, *urisrcbin, *sink;
+  GstStructure *fast, *stalled;
+  gboolean adaptive;
+  guint64 in_rate, out_rate;
+  GstClockTime fast_time, stalled_time;
+  gint fast_low, fast_high, stalled_low, stalled_high;
+  GstBus *bus;
+
+  fail_unless (gst_element_register (NULL, "ratesrc", GST_RANK_PRIMARY,
+          gst_rate_src_get_type ()));
+
+  pipeline = gst_pipeline_new (NULL);
+  urisrcbin = gst_element_factory_make ("urisourcebin", NULL);
+  fail_unless (urisrcbin != NULL, "Failed to create urisourcebin element");
+  sink = gst_element_factory_make ("fakesink", NULL);
+  g_object_set (sink, "sync", TRUE, NULL);
+  gst_bin_add_many (GST_BIN (pipeline), urisrcbin, sink, NULL);
+
+  g_object_get (urisrcbin, "adaptive-buffering", &adaptive, NULL);
+  fail_if (adaptive);
+  g_object_set (urisrcbin, "uri", "ratetest://", "adaptive-buffering", TRUE,
+      NULL);
+  g_object_get (urisrcbin, "adaptive-buffering", &adaptive, NULL);
+  fail_unless (adaptive);
+
+  g_signal_connect (urisrcbin, "pad-added", G_CALLBACK (pad_added_cb), sink);
+
+  bus = gst_element_get_bus (pipeline);
+  fail_if (gst_element_set_state (pipeline, GST_STATE_PLAYING) ==
+      GST_STATE_CHANGE_FAILURE);
+
+  /* the download is much faster than the stream, so little is buffered and
+   * playback starts early */
+  fast = pop_adaptive_stats (bus);
+  check_queue_limits (urisrcbin, fast);
+  fail_unless (gst_structure_get (fast, "in-rate", G_TYPE_UINT64, &in_rate,
+          "out-rate", G_TYPE_UINT64, &out_rate,
+          "max-size-time", G_TYPE_UINT64, &fast_time,
+          "low-percent", G_TYPE_INT, &fast_low,
+          "high-percent", G_TYPE_INT, &fast_high, NULL));
+  GST_DEBUG ("fast: %" GST_PTR_FORMAT, fast);
+  fail_unless (out_rate > RATE_STREAM_BITRATE / 2);
+  fail_unless (out_rate < RATE_STREAM_BITRATE * 2);
+  fail_unless (in_rate >= 2 * out_rate);
+  fail_unless (fast_time < 5 * GST_SECOND);
+  fail_unless (fast_low < 5);
+  fail_unless (fast_high < 50);
+
+  /* stall the download, the limits are adapted although nothing arrives */
+  g_mutex_lock (&rate_lock);
+  rate_stalled = TRUE;
+  rate_pushed = 0;
+  g_mutex_unlock (&rate_lock);
+
+  stalled = pop_adaptive_stats (bus);
+  check_queue_limits (urisrcbin, stalled);
+  fail_unless (gst_structure_get (stalled,
+          "max-size-time", G_TYPE_UINT64, &stalled_time,
+          "low-percent", G_TYPE_INT, &stalled_low,
+          "high-percent", G_TYPE_INT, &stalled_high, NULL));
+  GST_DEBUG ("stalled: %" GST_PTR_FORMAT, stalled);
+  g_mutex_lock (&rate_lock);
+  fail_unless_equals_int (rate_pushed, 0);
+  g_mutex_unlock (&rate_lock);
+  fail_unless (stalled_time > fast_time);
+  fail_unless (stalled_low > fast_low);
+  fail_unless (stalled_high > fast_high);
+
+  gst_structure_free (fast);
+  gst_structure_free (stalled);
+
+  fail_unless_equals_int (gst_element_set_state (pipeline, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+  gst_object_unref (bus);
+  gst_object_unref (pipeline);
+}
+
+GST_END_TEST;
+
+/*** ratetest:// source ***/
+
+static GstURIType
+gst_rate_src_uri_get_type (GType type)
+{
+  return GST_URI_SRC;
+}
+
+static const gchar *const *
+gst_rate_src_uri_get_protocols (GType type)
+{
+  static const gchar *protocols[] = { "ratetest", NULL };
+
+  return protocols;
+}
+
+static gchar *
+gst_rate_src_uri_get_uri (GstURIHandler * handler)
+{
+  return g_strdup ("ratetest://");
+}
+
+static gboolean
+gst_rate_src_uri_set_uri (GstURIHandler * handler, const gchar * uri,
+    GError ** error)
+{
+  return (uri != NULL && g_str_has_prefix (uri, "ratetest:"));
+}
+
+static void
+gst_rate_src_uri_handler_init (gpointer g_iface, gpointer iface_data)
+{
+  GstURIHandlerInterface *iface = (GstURIHandlerInterface *) g_iface;
+
+  iface->get_type = gst_rate_src_uri_get_type;
+  iface->get_protocols = gst_rate_src_uri_get_protocols;
+  iface->get_uri = gst_rate_src_uri_get_uri;
+  iface->set_uri = gst_rate_src_uri_set_uri;
+}
+
+static void
+gst_rate_src_init_type (GType type)
+{
+  static const GInterfaceInfo uri_hdlr_info = {
+    gst_rate_src_uri_handler_init, NULL, NULL
+  };
+
+  g_type_add_interface_static (type, GST_TYPE_URI_HANDLER, &uri_hdlr_info);
+}
+
+typedef struct
+{
+  GstPushSrc parent;
+  guint64 n_buffers;
+} GstRateSrc;
+
+typedef GstPushSrcClass GstRateSrcClass;
+
+G_DEFINE_TYPE_WITH_CODE (GstRateSrc, gst_rate_src,
+    GST_TYPE_PUSH_SRC, gst_rate_src_init_type (g_define_type_id));
+
+static GstFlowReturn
+gst_rate_src_create (GstPushSrc * psrc, GstBuffer ** p_buf)
+{
+  GstRateSrc *src = (GstRateSrc *) psrc;
+  GstBuffer *buf;
+  gint64 end_time;
+
+  end_time = g_get_monotonic_time () + RATE_BUFFER_INTERVAL;
+  g_mutex_lock (&rate_lock);
+  while (!rate_flushing && (rate_stalled
+          || g_get_monotonic_time () < end_time))
+    g_cond_wait_until (&rate_cond, &rate_lock,
+        rate_stalled ? G_MAXINT64 : end_time);
+  if (rate_flushing) {
+    g_mutex_unlock (&rate_lock);
+    return GST_FLOW_FLUSHING;
+  }
+  rate_pushed++;
+  g_mutex_unlock (&rate_lock);
+
+  buf = gst_buffer_new_allocate (NULL, RATE_BUFFER_SIZE, NULL);
+  gst_buffer_memset (buf, 0, 0, RATE_BUFFER_SIZE);
+  GST_BUFFER_PTS (buf) = src->n_buffers * RATE_BUFFER_DURATION;
+  GST_BUFFER_DURATION (buf) = RATE_BUFFER_DURATION;
+  src->n_buffers++;
+
+  *p_buf = buf;
+  return GST_FLOW_OK;
+}
+
+static gboolean
+gst_rate_src_unlock (GstBaseSrc * bsrc)
+{
+  g_mutex_lock (&rate_lock);
+  rate_flushing = TRUE;
+  g_cond_broadcast (&rate_cond);
+  g_mutex_unlock (&rate_lock);
+
+  return TRUE;
+}
+
+static gboolean
+gst_rate_src_unlock_stop (GstBaseSrc * bsrc)
+{
+  g_mutex_lock (&rate_lock);
+  rate_flushing = FALSE;
+  g_mutex_unlock (&rate_lock);
+
+  return TRUE;
+}
+
+/* make urisourcebin buffer us like a network source */
+static gboolean
+gst_rate_src_query (GstBaseSrc * bsrc, GstQuery * query)
+{
+  if (GST_QUERY_TYPE (query) == GST_QUERY_SCHEDULING) {
+    gst_query_set_scheduling (query, GST_SCHEDULING_FLAG_BANDWIDTH_LIMITED,
+        1, -1, 0);
+    gst_query_add_scheduling_mode (query, GST_PAD_MODE_PUSH);
+    return TRUE;
+  }
+
+  return GST_BASE_SRC_CLASS (gst_rate_src_parent_class)->query (bsrc, query);
+}
+
+static GstCaps *
+gst_rate_src_get_caps (GstBaseSrc * src, GstCaps * filter)
+{
+  return gst_caps_new_empty_simple ("application/x-rate-test");
+}
+
+static void
+gst_rate_src_class_init (GstRateSrcClass * klass)
+{
+  GstPushSrcClass *pushsrc_class = GST_PUSH_SRC_CLASS (klass);
+  GstBaseSrcClass *basesrc_class = GST_BASE_SRC_CLASS (klass);
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("application/x-rate-test")
+      );
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class, &src_templ);
+  gst_element_class_set_metadata (element_class,
+      "Rate Src", "Source", "yep", "me");
+
+  pushsrc_class->create = gst_rate_src_create;
+  basesrc_class->unlock = gst_rate_src_unlock;
+  basesrc_class->unlock_stop = gst_rate_src_unlock_stop;
+  basesrc_class->query = gst_rate_src_query;
+  basesrc_class->get_caps = gst_rate_src_get_caps;
+}
+
+static void
+gst_rate_src_init (GstRateSrc * src)
+{
+  gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
+}
+
+#endif /* GST_DISABLE_REGISTRY */
+
+static Suite *
+urisourcebin_suite (void)
+{
+  Suite *s = suite_create ("urisourcebin");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+
+#ifndef GST_DISABLE_REGISTRY
+  tcase_add_test (tc_chain, test_adaptive_buffering);
+#endif
+
+  return s;
+}
+
+GST_CHECK_MAIN (urisourcebin);
@@ -47,6 +47,92 @@ typefind_data (const guint8 * data, gsize data_size,
   return caps;
 }
 
+typedef struct
+{
+  const guint8 *data;
+  gsize size;
+  GList *copies;
+  guint64 peek_end;
+  GstTypeFindProbability prob;
+  GstCaps *caps;
+} SingleTypeFind;
+
+/* every peek gets its own copy of exactly the requested size, so reading
+ * beyond what was peeked shows up in valgrind */
+static const guint8 *
+single_type_find_peek (gpointer data, gint64 offset, guint size)
+{
+  SingleTypeFind *stf = data;
+  guint8 *copy;
+
+  if (offset < 0)
+    offset += stf->size;
+  if (offset < 0 || size == 0 || offset + size > stf->size)
+    return NULL;
+
+  stf->peek_end = MAX (stf->peek_end, offset + size);
+  copy = g_memdup (stf->data + offset, size);
+  stf->copies = g_list_prepend (stf->copies, copy);
+
+  return copy;
+}
+
+static void
+single_type_find_suggest (gpointer data, guint probability, GstCaps * caps)
+{
+  SingleTypeFind *stf = data;
+
+  if (probability > stf->prob) {
+    gst_caps_replace (&stf->caps, caps);
+    stf->prob = probability;
+  }
+}
+
+static guint64
+single_type_find_get_length (gpointer data)
+{
+  SingleTypeFind *stf = data;
+
+  return stf->size;
+}
+
+/* runs only the typefinder registered as @name on @data, and returns in
+ * @peek_end how far into @data it looked */
+static GstCaps *
+typefind_single (const gchar * name, const guint8 * data, gsize data_size,
+    GstTypeFindProbability * prob, guint64 * peek_end)
+{
+  GstPluginFeature *factory;
+  SingleTypeFind stf = { NULL, };
+  GstTypeFind tf = { NULL, };
+
+  stf.data = data;
+  stf.size = data_size;
+  stf.prob = GST_TYPE_FIND_NONE;
+
+  tf.peek = single_type_find_peek;
+  tf.suggest = single_type_find_suggest;
+  tf.data = &stf;
+  tf.get_length = single_type_find_get_length;
+
+  factory = gst_registry_find_feature (gst_registry_get (), name,
+      GST_TYPE_TYPE_FIND_FACTORY);
+  fail_unless (factory != NULL);
+  gst_type_find_factory_call_function (GST_TYPE_FIND_FACTORY (factory), &tf);
+  gst_object_unref (factory);
+
+  g_list_free_full (stf.copies, g_free);
+
+  GST_INFO ("%s: caps %" GST_PTR_FORMAT ", probability=%u, peeked %"
+      G_GUINT64_FORMAT " bytes", name, stf.caps, stf.prob, stf.peek_end);
+  if (prob)
+    *prob = stf.prob;
+  if (peek_end)
+    *peek_end = stf.peek_end;
+
+  return stf.caps;
+}
+
 GST_START_TEST (test_quicktime_mpeg4video)
 {
   /* quicktime redirect file which starts with what could also be interpreted
@@ -206,6 +292,178 @@ GST_START_TEST (test_mpegts)
 
 GST_END_TEST;
 
+GST_START_TEST (test_sync_scan)
+{
+  const struct
+  {
+    const gchar *filename;
+    const gchar *type;
+  } files[] = {
+    {
+    "623663.mts", "video/mpegts"}, {
+    "test.mp3", "audio/mpeg"}
+  };
+  GTimer *timer;
+  GstCaps *caps;
+  gint i, j;
+
+  /* headerless streams, the typefinders have to scan for the sync words */
+  timer = g_timer_new ();
+  for (i = 0; i < G_N_ELEMENTS (files); i++) {
+    g_timer_start (timer);
+    for (j = 0; j < 20; j++) {
+      caps = typefind_test_file (files[i].filename);
+      fail_unless_equals_string (gst_structure_get_name
+          (gst_caps_get_structure (caps, 0)), files[i].type);
+      gst_caps_unref (caps);
+    }
+    GST_INFO ("typefinding %s 20 times took %.3fms", files[i].filename,
+        g_timer_elapsed (timer, NULL) * 1000.0);
+  }
+  g_timer_destroy (timer);
+}
+
+GST_END_TEST;
+
+/* @n MPEG-TS packet headers, 188 bytes apart from @offset on, in data without
+ * any other sync byte */
+static void
+make_mpegts_packets (guint8 * data, gsize size, gsize offset, guint n)
+{
+  guint i;
+
+  memset (data, 0xff, size);
+  for (i = 0; i < n; i++) {
+    guint8 *p = data + offset + i * 188;
+
+    fail_unless (offset + i * 188 + 4 <= size);
+    p[0] = 0x47;
+    p[1] = 0x00;
+    p[2] = 0x00;
+    p[3] = 0x10;
+  }
+}
+
+static void
+check_mpegts_packets (const guint8 * data, gsize size, gboolean found)
+{
+  GstTypeFindProbability prob;
+  GstCaps *caps;
+  gint packetsize = -1;
+
+  caps = typefind_single ("video/mpegts", data, size, &prob, NULL);
+  if (!found) {
+    fail_unless (caps == NULL);
+    return;
+  }
+
+  fail_unless (caps != NULL);
+  fail_unless (gst_structure_has_name (gst_caps_get_structure (caps, 0),
+          "video/mpegts"));
+  fail_unless (gst_structure_get_int (gst_caps_get_structure (caps, 0),
+          "packetsize", &packetsize));
+  fail_unless_equals_int (packetsize, 188);
+  /* 10% per packet found */
+  fail_unless_equals_int (prob, 40);
+  gst_caps_unref (caps);
+}
+
+GST_START_TEST (test_mpegts_sync_boundaries)
+{
+  guint8 *data;
+  gsize size = 4096, offset;
+
+  data = g_malloc (size);
+
+  /* the scanner peeks 832 bytes at a time and needs the 4 header bytes, so
+   * a sync byte at 829 is the first one that is not in the first window */
+  for (offset = 824; offset <= 836; offset++) {
+    make_mpegts_packets (data, size, offset, 4);
+    check_mpegts_packets (data, size, TRUE);
+  }
+
+  /* the last sync byte that still has a full window after it */
+  for (offset = 0; offset <= 1000; offset += 200) {
+    make_mpegts_packets (data, size, offset, 4);
+    check_mpegts_packets (data, offset + 832, TRUE);
+  }
+
+  /* the header of the fourth packet has to be complete */
+  make_mpegts_packets (data, size, 2000, 4);
+  check_mpegts_packets (data, 2000 + 3 * 188 + 4, TRUE);
+  check_mpegts_packets (data, 2000 + 3 * 188 + 3, FALSE);
+
+  g_free (data);
+}
+
+GST_END_TEST;
+
+/* an H.264 NAL start code and header byte at @offset, cut off at @size */
+static void
+put_h264_nal (guint8 * data, gsize size, gsize offset, guint8 nal)
+{
+  const guint8 start_code[3] = { 0x00, 0x00, 0x01 };
+  guint i;
+
+  for (i = 0; i < 4 && offset + i < size; i++)
+    data[offset + i] = i < 3 ? start_code[i] : nal;
+}
+
+/* an SPS at 16 and a PPS at @pps_offset, in data without any other zero
+ * bytes. Two good NALs are just enough for the typefinder to suggest H.264
+ * when it reaches the end of the data */
+static void
+check_h264_nals (gsize size, gsize pps_offset, gboolean found)
+{
+  GstTypeFindProbability prob;
+  guint8 *data;
+  GstCaps *caps;
+
+  data = g_malloc (size);
+  memset (data, 0xaa, size);
+  put_h264_nal (data, size, 16, 0x67);
+  put_h264_nal (data, size, pps_offset, 0x68);
+
+  caps = typefind_single ("video/x-h264", data, size, &prob, NULL);
+  if (found) {
+    fail_unless (caps != NULL, "no H.264 with PPS at %" G_GSIZE_FORMAT
+        " of %" G_GSIZE_FORMAT, pps_offset, size);
+    fail_unless (gst_structure_has_name (gst_caps_get_structure (caps, 0),
+            "video/x-h264"));
+    fail_unless_equals_int (prob, GST_TYPE_FIND_POSSIBLE);
+    gst_caps_unref (caps);
+  } else {
+    fail_unless (caps == NULL, "H.264 with PPS at %" G_GSIZE_FORMAT
+        " of %" G_GSIZE_FORMAT, pps_offset, size);
+  }
+
+  g_free (data);
+}
+
+GST_START_TEST (test_h264_start_code_boundaries)
+{
+  gsize offset;
+
+  /* the scanner reads 4096 bytes at a time and needs the 3 start code
+   * bytes and the NAL header, so start codes from 4093 on straddle the
+   * first window */
+  for (offset = 4088; offset <= 4100; offset++)
+    check_h264_nals (8192, offset, TRUE);
+
+  /* a NAL header in the very last byte */
+  check_h264_nals (8192, 8192 - 4, TRUE);
+  check_h264_nals (5000, 5000 - 4, TRUE);
+  check_h264_nals (100, 100 - 4, TRUE);
+
+  /* a start code without NAL header, or only part of one, at the end */
+  check_h264_nals (8192, 8192 - 3, FALSE);
+  check_h264_nals (8192, 8192 - 2, FALSE);
+  check_h264_nals (5000, 5000 - 3, FALSE);
+  check_h264_nals (100, 100 - 3, FALSE);
+}
+
+GST_END_TEST;
+
 struct ac3_frmsize
 {
   unsigned frmsizecod;
@@ -349,6 +607,112 @@ GST_START_TEST (test_eac3)
 
 GST_END_TEST;
 
+static void
+check_ac3_frames (const guint8 * data, gsize size, gsize offset,
+    gboolean found)
+{
+  GstTypeFindProbability prob;
+  GstCaps *caps;
+
+  caps = typefind_single ("audio/x-ac3", data, size, &prob, NULL);
+  if (found) {
+    fail_unless (caps != NULL, "no AC-3 at %" G_GSIZE_FORMAT " of %"
+        G_GSIZE_FORMAT, offset, size);
+    fail_unless (gst_structure_has_name (gst_caps_get_structure (caps, 0),
+            "audio/x-ac3"));
+    fail_unless_equals_int (prob, offset == 0 ? GST_TYPE_FIND_MAXIMUM :
+        GST_TYPE_FIND_NEARLY_CERTAIN);
+    gst_caps_unref (caps);
+  } else {
+    fail_unless (caps == NULL, "AC-3 at %" G_GSIZE_FORMAT " of %"
+        G_GSIZE_FORMAT, offset, size);
+  }
+}
+
+GST_START_TEST (test_ac3_sync_boundaries)
+{
+  gsize size = 4096, offset;
+  guint8 *data;
+
+  data = g_malloc (size);
+
+  /* the first frame is looked for in the first 1024 bytes only */
+  for (offset = 1016; offset <= 1030; offset++) {
+    memset (data, 0, size);
+    make_ac3_packet (data + offset, 256 * 2, 8);
+    make_ac3_packet (data + offset + 256 * 2, 256 * 2, 8);
+    check_ac3_frames (data, size, offset, offset < 1024);
+  }
+
+  /* the header of the second frame has to be complete, 5 bytes are
+   * checked */
+  for (offset = 0; offset <= 1023; offset += 1023) {
+    memset (data, 0, size);
+    make_ac3_packet (data + offset, 256 * 2, 8);
+    make_ac3_packet (data + offset + 256 * 2, 256 * 2, 8);
+    check_ac3_frames (data, offset + 256 * 2 + 5, offset, TRUE);
+    check_ac3_frames (data, offset + 256 * 2 + 4, offset, FALSE);
+  }
+
+  g_free (data);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_magic_index)
+{
+  GstTypeFindProbability prob;
+  guint64 peek_end;
+  GstCaps *caps;
+  GTimer *timer;
+  guint8 *data;
+  gsize size = 64 * 1024;
+  guint i;
+
+  /* a WAVE header followed by AC-3 frames, the AC-3 and MPEG scanners should
+   * not claim this nor scan through it */
+  data = g_malloc0 (size);
+  for (i = 256; i + 512 <= size; i += 512)
+    make_ac3_packet (data + i, 512, 8);
+
+  /* without a known signature at the start the AC-3 typefinder alone finds
+   * the frames after scanning to them */
+  memset (data, 0xaa, 16);
+  caps = typefind_single ("audio/x-ac3", data, size, &prob, &peek_end);
+  fail_unless (caps != NULL);
+  fail_unless_equals_string (gst_structure_get_name (gst_caps_get_structure
+          (caps, 0)), "audio/x-ac3");
+  fail_unless_equals_int (prob, GST_TYPE_FIND_NEARLY_CERTAIN);
+  fail_unless (peek_end > 256);
+  gst_caps_unref (caps);
+
+  /* but with the WAVE header it bails out after the one peek that checks
+   * all signatures of the magic index */
+  memcpy (data, "RIFF\377\377\000\000WAVEfmt ", 16);
+  caps = typefind_single ("audio/x-ac3", data, size, &prob, &peek_end);
+  fail_unless (caps == NULL);
+  fail_unless_equals_int (prob, GST_TYPE_FIND_NONE);
+  fail_unless (peek_end > 0);
+  fail_unless (peek_end <= 32);
+
+  timer = g_timer_new ();
+  for (i = 0; i < 100; i++) {
+    caps = typefind_data (data, size, &prob);
+    fail_unless (caps != NULL);
+    fail_unless_equals_string (gst_structure_get_name (gst_caps_get_structure
+            (caps, 0)), "audio/x-wav");
+    fail_unless_equals_int (prob, GST_TYPE_FIND_MAXIMUM);
+    gst_caps_unref (caps);
+  }
+  GST_INFO ("typefinding 100 WAVE headers took %.3fms",
+      g_timer_elapsed (timer, NULL) * 1000.0);
+
+  g_timer_destroy (timer);
+  g_free (data);
+}
+
+GST_END_TEST;
+
 #define TEST_RANDOM_DATA_SIZE (4*1024)
 
 /* typefind random data, to make sure all typefinders are called */
@@ -489,8 +853,13 @@ typefindfunctions_suite (void)
   tcase_add_test (tc_chain, test_broken_flac_in_ogg);
   tcase_add_test (tc_chain, test_jpeg_not_ac3);
   tcase_add_test (tc_chain, test_mpegts);
+  tcase_add_test (tc_chain, test_sync_scan);
+  tcase_add_test (tc_chain, test_mpegts_sync_boundaries);
+  tcase_add_test (tc_chain, test_h264_start_code_boundaries);
   tcase_add_test (tc_chain, test_ac3);
   tcase_add_test (tc_chain, test_eac3);
+  tcase_add_test (tc_chain, test_ac3_sync_boundaries);
+  tcase_add_test (tc_chain, test_magic_index);
   tcase_add_test (tc_chain, test_random_data);
   tcase_add_test (tc_chain, test_hls_m3u8);
   tcase_add_test (tc_chain, test_manifest_typefinding);
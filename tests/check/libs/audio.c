@@ -26,6 +26,7 @@
 #endif
 
 #include <gst/check/gstcheck.h>
+#include <gst/check/gstharness.h>
 
 #include <gst/audio/audio.h>
 #include <string.h>
@@ -705,6 +706,1404 @@ GST_START_TEST (test_fill_silence)
 
 GST_END_TEST;
 
+#define MIX_SAMPLES 4096
+#define TIME 0.01
+#define SQRT1_2 0.70710678118654752440
+
+/* expected mixing weights before normalization, [in][out], for the
+ * fallback channel layouts */
+static const gdouble mix_1_2[] = {
+  /* MONO */ 1.0, 1.0
+};
+
+static const gdouble mix_6_2[] = {
+  /* FL */ 1.0, 0.0,
+  /* FR */ 0.0, 1.0,
+  /* FC */ SQRT1_2, SQRT1_2,
+  /* LFE */ 1.0, 1.0,
+  /* RL */ 0.5, 0.0,
+  /* RR */ 0.0, 0.5
+};
+
+static const gdouble mix_8_6[] = {
+  /* FL */ 1.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+  /* FR */ 0.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+  /* FC */ 0.0, 0.0, 1.0, 0.0, 0.0, 0.0,
+  /* LFE */ 0.0, 0.0, 0.0, 1.0, 0.0, 0.0,
+  /* RL */ 0.0, 0.0, 0.0, 0.0, 1.0, 0.0,
+  /* RR */ 0.0, 0.0, 0.0, 0.0, 0.0, 1.0,
+  /* SL */ 0.5 * SQRT1_2, 0.0, 0.0, 0.0, 0.5 * SQRT1_2, 0.0,
+  /* SR */ 0.0, 0.5 * SQRT1_2, 0.0, 0.0, 0.0, 0.5 * SQRT1_2
+};
+
+static const gdouble mix_8_2[] = {
+  /* FL */ 1.0, 0.0,
+  /* FR */ 0.0, 1.0,
+  /* FC */ SQRT1_2, SQRT1_2,
+  /* LFE */ 1.0, 1.0,
+  /* RL */ 0.5, 0.0,
+  /* RR */ 0.0, 0.5,
+  /* SL */ SQRT1_2, 0.0,
+  /* SR */ 0.0, SQRT1_2
+};
+
+/* straightforward dense mix over the full matrix, normalized like the
+ * mixer does so that the loudest output channel has a gain of 1 */
+static void
+mix_dense_reference (const gdouble * weights, gint in_channels,
+    gint out_channels, const gfloat * in, gdouble * out, gint samples)
+{
+  gdouble top = 0.0;
+  gint i, o, n;
+
+  for (o = 0; o < out_channels; o++) {
+    gdouble sum = 0.0;
+
+    for (i = 0; i < in_channels; i++)
+      sum += ABS (weights[i * out_channels + o]);
+    top = MAX (top, sum);
+  }
+
+  for (n = 0; n < samples; n++) {
+    for (o = 0; o < out_channels; o++) {
+      gdouble res = 0.0;
+
+      for (i = 0; i < in_channels; i++)
+        res += in[n * in_channels + i] * weights[i * out_channels + o];
+      out[n * out_channels + o] = res / top;
+    }
+  }
+}
+
+static void
+run_channel_mixer (gint in_channels, gint out_channels,
+    const gdouble * weights)
+{
+  GstAudioChannelPosition in_pos[8], out_pos[8];
+  GstAudioChannelMixer *mix_s16, *mix_f32;
+  gint16 *in_s16, *out_s16;
+  gfloat *in_f32, *out_f32;
+  gdouble *out_ref;
+  gint i;
+
+  fail_unless (gst_audio_channel_positions_from_mask (in_channels,
+          gst_audio_channel_get_fallback_mask (in_channels), in_pos));
+  fail_unless (gst_audio_channel_positions_from_mask (out_channels,
+          gst_audio_channel_get_fallback_mask (out_channels), out_pos));
+
+  mix_s16 = gst_audio_channel_mixer_new (0, GST_AUDIO_FORMAT_S16,
+      in_channels, in_pos, out_channels, out_pos);
+  mix_f32 = gst_audio_channel_mixer_new (0, GST_AUDIO_FORMAT_F32,
+      in_channels, in_pos, out_channels, out_pos);
+  fail_unless (mix_s16 != NULL && mix_f32 != NULL);
+
+  in_s16 = g_new (gint16, MIX_SAMPLES * in_channels);
+  in_f32 = g_new (gfloat, MIX_SAMPLES * in_channels);
+  out_s16 = g_new (gint16, MIX_SAMPLES * out_channels);
+  out_f32 = g_new (gfloat, MIX_SAMPLES * out_channels);
+
+  for (i = 0; i < MIX_SAMPLES * in_channels; i++) {
+    in_s16[i] = ((i * 7919) % 8192) - 4096;
+    in_f32[i] = in_s16[i] / 32768.0;
+  }
+
+  gst_audio_channel_mixer_samples (mix_s16, (gpointer *) & in_s16,
+      (gpointer *) & out_s16, MIX_SAMPLES);
+  gst_audio_channel_mixer_samples (mix_f32, (gpointer *) & in_f32,
+      (gpointer *) & out_f32, MIX_SAMPLES);
+
+  /* both paths must match a dense mix with the expected matrix */
+  out_ref = g_new (gdouble, MIX_SAMPLES * out_channels);
+  mix_dense_reference (weights, in_channels, out_channels, in_f32, out_ref,
+      MIX_SAMPLES);
+  for (i = 0; i < MIX_SAMPLES * out_channels; i++) {
+    fail_unless (ABS (out_f32[i] - out_ref[i]) < 1e-5,
+        "%d->%d sample %d: %f != %f", in_channels, out_channels, i,
+        out_f32[i], out_ref[i]);
+    fail_unless (ABS (out_s16[i] - out_ref[i] * 32768.0) <= 40,
+        "%d->%d sample %d: %d != %f", in_channels, out_channels, i,
+        out_s16[i], out_ref[i] * 32768.0);
+  }
+  g_free (out_ref);
+
+  /* non-interleaved input and output give the same result */
+  {
+    GstAudioChannelMixer *mix_planar;
+    gfloat *in_pl, *out_pl;
+    gpointer in[8], out[8];
+    gint c;
+
+    mix_planar = gst_audio_channel_mixer_new
+        (GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_IN |
+        GST_AUDIO_CHANNEL_MIXER_FLAGS_NON_INTERLEAVED_OUT,
+        GST_AUDIO_FORMAT_F32, in_channels, in_pos, out_channels, out_pos);
+    in_pl = g_new (gfloat, MIX_SAMPLES * in_channels);
+    out_pl = g_new (gfloat, MIX_SAMPLES * out_channels);
+
+    for (c = 0; c < in_channels; c++) {
+      in[c] = in_pl + c * MIX_SAMPLES;
+      for (i = 0; i < MIX_SAMPLES; i++)
+        in_pl[c * MIX_SAMPLES + i] = in_f32[i * in_channels + c];
+    }
+    for (c = 0; c < out_channels; c++)
+      out[c] = out_pl + c * MIX_SAMPLES;
+
+    gst_audio_channel_mixer_samples (mix_planar, in, out, MIX_SAMPLES);
+
+    for (c = 0; c < out_channels; c++)
+      for (i = 0; i < MIX_SAMPLES; i++)
+        fail_unless (ABS (out_pl[c * MIX_SAMPLES + i] -
+                out_f32[i * out_channels + c]) < 1e-6);
+
+    g_free (in_pl);
+    g_free (out_pl);
+    gst_audio_channel_mixer_free (mix_planar);
+  }
+
+  g_free (in_s16);
+  g_free (in_f32);
+  g_free (out_s16);
+  g_free (out_f32);
+  gst_audio_channel_mixer_free (mix_s16);
+  gst_audio_channel_mixer_free (mix_f32);
+}
+
+GST_START_TEST (test_channel_mixer)
+{
+  GstAudioChannelPosition in_pos[2] = { GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT
+  };
+  GstAudioChannelPosition out_pos[2] = {
+    GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT
+  };
+  GstAudioChannelMixer *mix;
+  gint16 in[4] = { 1, -2, 3, -4 }, out[4];
+  gpointer inp[1] = { in }, outp[1] = { out };
+
+  /* reordering only copies samples */
+  mix = gst_audio_channel_mixer_new (0, GST_AUDIO_FORMAT_S16, 2, in_pos, 2,
+      out_pos);
+  gst_audio_channel_mixer_samples (mix, inp, outp, 2);
+  fail_unless_equals_int (out[0], -2);
+  fail_unless_equals_int (out[1], 1);
+  fail_unless_equals_int (out[2], -4);
+  fail_unless_equals_int (out[3], 3);
+  gst_audio_channel_mixer_free (mix);
+
+  run_channel_mixer (1, 2, mix_1_2);
+  run_channel_mixer (6, 2, mix_6_2);
+  run_channel_mixer (8, 6, mix_8_6);
+  run_channel_mixer (8, 2, mix_8_2);
+}
+
+GST_END_TEST;
+
+#define CONVERT_FRAMES 4096
+
+static GstAudioConverter *
+make_converter (gint channels, GstAudioFormat in_format, gint in_rate,
+    GstAudioLayout in_layout, GstAudioFormat out_format, gint out_rate,
+    GstAudioLayout out_layout)
+{
+  GstAudioInfo in_info, out_info;
+
+  gst_audio_info_set_format (&in_info, in_format, in_rate, channels, NULL);
+  in_info.layout = in_layout;
+  gst_audio_info_set_format (&out_info, out_format, out_rate, channels, NULL);
+  out_info.layout = out_layout;
+
+  return gst_audio_converter_new (0, &in_info, &out_info, NULL);
+}
+
+/* point @planes at the channels of a non-interleaved block */
+static void
+setup_planes (gpointer planes[], gpointer data, gint channels, gsize frames,
+    gint bps)
+{
+  gint c;
+
+  for (c = 0; c < channels; c++)
+    planes[c] = (guint8 *) data + c * frames * bps;
+}
+
+static void
+run_converter_layouts (gint channels)
+{
+  GstAudioConverter *ref, *planar;
+  gint16 *in_il, *in_pl;
+  gfloat *out_il, *out_pl;
+  gpointer in[32], out[32];
+  gsize in_frames = CONVERT_FRAMES, out_frames, max_frames;
+  gint c, i, count;
+  GTimer *timer;
+  gdouble elapsed;
+
+  in_il = g_new (gint16, in_frames * channels);
+  in_pl = g_new (gint16, in_frames * channels);
+  for (i = 0; i < in_frames; i++) {
+    for (c = 0; c < channels; c++) {
+      gint16 v = ((i * 31 + c * 1021) % 4096) - 2048;
+
+      in_il[i * channels + c] = v;
+      in_pl[c * in_frames + i] = v;
+    }
+  }
+
+  /* interleaved reference against non-interleaved input and output, with
+   * and without resampling */
+  for (i = 0; i < 2; i++) {
+    gint out_rate = i ? 48000 : 44100;
+
+    ref = make_converter (channels, GST_AUDIO_FORMAT_S16, 44100,
+        GST_AUDIO_LAYOUT_INTERLEAVED, GST_AUDIO_FORMAT_F32, out_rate,
+        GST_AUDIO_LAYOUT_INTERLEAVED);
+    planar = make_converter (channels, GST_AUDIO_FORMAT_S16, 44100,
+        GST_AUDIO_LAYOUT_NON_INTERLEAVED, GST_AUDIO_FORMAT_F32, out_rate,
+        GST_AUDIO_LAYOUT_NON_INTERLEAVED);
+    fail_unless (ref != NULL && planar != NULL);
+
+    out_frames = gst_audio_converter_get_out_frames (ref, in_frames);
+    fail_unless_equals_int (out_frames,
+        gst_audio_converter_get_out_frames (planar, in_frames));
+    out_il = g_new0 (gfloat, out_frames * channels);
+    out_pl = g_new0 (gfloat, out_frames * channels);
+
+    in[0] = in_il;
+    out[0] = out_il;
+    fail_unless (gst_audio_converter_samples (ref, 0, in, in_frames, out,
+            out_frames));
+    setup_planes (in, in_pl, channels, in_frames, sizeof (gint16));
+    setup_planes (out, out_pl, channels, out_frames, sizeof (gfloat));
+    fail_unless (gst_audio_converter_samples (planar, 0, in, in_frames, out,
+            out_frames));
+
+    for (c = 0; c < channels; c++) {
+      gsize j;
+
+      for (j = 0; j < out_frames; j++)
+        fail_unless (out_il[j * channels + c] == out_pl[c * out_frames + j],
+            "%d channels, rate %d: channel %d frame %" G_GSIZE_FORMAT
+            " differs", channels, out_rate, c, j);
+    }
+
+    gst_audio_converter_free (ref);
+    gst_audio_converter_free (planar);
+    g_free (out_il);
+    g_free (out_pl);
+  }
+
+  /* resampling throughput for both layouts */
+  timer = g_timer_new ();
+  for (i = 0; i < 2; i++) {
+    GstAudioLayout layout = i ? GST_AUDIO_LAYOUT_NON_INTERLEAVED :
+        GST_AUDIO_LAYOUT_INTERLEAVED;
+    GstAudioConverter *convert;
+
+    convert = make_converter (channels, GST_AUDIO_FORMAT_S16, 44100, layout,
+        GST_AUDIO_FORMAT_F32, 48000, layout);
+    /* leave room for the rounding of the output size */
+    max_frames = gst_audio_converter_get_out_frames (convert, in_frames) + 16;
+    out_il = g_new0 (gfloat, max_frames * channels);
+
+    if (i) {
+      setup_planes (in, in_pl, channels, in_frames, sizeof (gint16));
+      setup_planes (out, out_il, channels, max_frames, sizeof (gfloat));
+    } else {
+      in[0] = in_il;
+      out[0] = out_il;
+    }
+
+    count = 0;
+    g_timer_start (timer);
+    while (TRUE) {
+      out_frames = gst_audio_converter_get_out_frames (convert, in_frames);
+      gst_audio_converter_samples (convert, 0, in, in_frames, out, out_frames);
+
+      count++;
+      elapsed = g_timer_elapsed (timer, NULL);
+      if (elapsed >= TIME)
+        break;
+    }
+    GST_DEBUG ("%f frames/sec, %d channels, %s", count * in_frames / elapsed,
+        channels, i ? "non-interleaved" : "interleaved");
+
+    gst_audio_converter_free (convert);
+    g_free (out_il);
+  }
+  g_timer_destroy (timer);
+
+  g_free (in_il);
+  g_free (in_pl);
+}
+
+GST_START_TEST (test_converter_layouts)
+{
+  run_converter_layouts (2);
+  run_converter_layouts (8);
+  run_converter_layouts (32);
+}
+
+GST_END_TEST;
+
+/* convert @in_info to @out_info in place and into a separate output and
+ * check that both give the same result */
+static void
+run_converter_inplace (GstAudioInfo * in_info, GstAudioInfo * out_info)
+{
+  GstAudioConverter *convert;
+  guint8 *in_data, *out_data, *ip_data;
+  gpointer in[1], out[1];
+  gsize i, size = CONVERT_FRAMES * GST_AUDIO_INFO_BPF (in_info);
+  gint count;
+  GTimer *timer;
+  gdouble elapsed;
+
+  convert = gst_audio_converter_new (0, in_info, out_info, NULL);
+  fail_unless (convert != NULL);
+  fail_unless (gst_audio_converter_supports_inplace (convert));
+
+  in_data = g_malloc (size);
+  if (GST_AUDIO_INFO_IS_FLOAT (in_info)) {
+    for (i = 0; i < size / sizeof (gfloat); i++)
+      ((gfloat *) in_data)[i] = (((i * 7919) % 8192) - 4096) / 8192.0;
+  } else {
+    for (i = 0; i < size; i++)
+      in_data[i] = (i * 7919) >> 3;
+  }
+  ip_data = g_memdup (in_data, size);
+  out_data = g_malloc (size);
+
+  in[0] = in_data;
+  out[0] = out_data;
+  fail_unless (gst_audio_converter_samples (convert, 0, in, CONVERT_FRAMES,
+          out, CONVERT_FRAMES));
+  gst_audio_converter_reset (convert);
+  in[0] = ip_data;
+  fail_unless (gst_audio_converter_samples (convert,
+          GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE, in, CONVERT_FRAMES, in,
+          CONVERT_FRAMES));
+  fail_unless (memcmp (out_data, ip_data, size) == 0, "%s -> %s differs",
+      GST_AUDIO_INFO_NAME (in_info), GST_AUDIO_INFO_NAME (out_info));
+
+  timer = g_timer_new ();
+  for (i = 0; i < 2; i++) {
+    in[0] = i ? ip_data : in_data;
+    out[0] = i ? ip_data : out_data;
+
+    count = 0;
+    g_timer_start (timer);
+    while (TRUE) {
+      gst_audio_converter_samples (convert,
+          GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE, in, CONVERT_FRAMES, out,
+          CONVERT_FRAMES);
+
+      count++;
+      elapsed = g_timer_elapsed (timer, NULL);
+      if (elapsed >= TIME)
+        break;
+    }
+    GST_DEBUG ("%f frames/sec %s -> %s, %s", count * CONVERT_FRAMES / elapsed,
+        GST_AUDIO_INFO_NAME (in_info), GST_AUDIO_INFO_NAME (out_info),
+        i ? "in place" : "separate output");
+  }
+  g_timer_destroy (timer);
+
+  g_free (in_data);
+  g_free (ip_data);
+  g_free (out_data);
+  gst_audio_converter_free (convert);
+}
+
+GST_START_TEST (test_converter_inplace)
+{
+  GstAudioInfo in_info, out_info;
+  GstAudioChannelPosition pos[6], rpos[6];
+  GstAudioConverter *convert;
+  gint i;
+
+  fail_unless (gst_audio_channel_positions_from_mask (6,
+          gst_audio_channel_get_fallback_mask (6), pos));
+  for (i = 0; i < 6; i++)
+    rpos[i] = pos[5 - i];
+
+  /* quantize only */
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_S32, 44100, 2, NULL);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_S24_32, 44100, 2,
+      NULL);
+  run_converter_inplace (&in_info, &out_info);
+
+  /* unpack and pack of the same width */
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_S16, 44100, 2, NULL);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_U16, 44100, 2, NULL);
+  run_converter_inplace (&in_info, &out_info);
+
+  /* channel mixing */
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_F32, 44100, 6, pos);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_F32, 44100, 6, rpos);
+  run_converter_inplace (&in_info, &out_info);
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_S16, 44100, 6, pos);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_S16, 44100, 6, rpos);
+  run_converter_inplace (&in_info, &out_info);
+
+  /* the sample size changes */
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_S16, 44100, 2, NULL);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_F32, 44100, 2, NULL);
+  convert = gst_audio_converter_new (0, &in_info, &out_info, NULL);
+  fail_if (gst_audio_converter_supports_inplace (convert));
+  gst_audio_converter_free (convert);
+
+  /* resampling */
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_U16, 48000, 2, NULL);
+  convert = gst_audio_converter_new (0, &in_info, &out_info, NULL);
+  fail_if (gst_audio_converter_supports_inplace (convert));
+  gst_audio_converter_free (convert);
+
+  /* mixing non-interleaved channels */
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_F32, 44100, 6, pos);
+  in_info.layout = GST_AUDIO_LAYOUT_NON_INTERLEAVED;
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_F32, 44100, 6, rpos);
+  out_info.layout = GST_AUDIO_LAYOUT_NON_INTERLEAVED;
+  convert = gst_audio_converter_new (0, &in_info, &out_info, NULL);
+  fail_if (gst_audio_converter_supports_inplace (convert));
+  gst_audio_converter_free (convert);
+}
+
+GST_END_TEST;
+
+#define PACK_SAMPLES 4099
+
+static guint32
+read_raw_sample (const GstAudioFormatInfo * finfo, const guint8 * p)
+{
+  guint32 raw = 0;
+  gint i, bytes = finfo->width / 8;
+
+  for (i = 0; i < bytes; i++) {
+    if (GST_AUDIO_FORMAT_INFO_IS_LITTLE_ENDIAN (finfo))
+      raw |= (guint32) p[i] << (8 * i);
+    else
+      raw = (raw << 8) | p[i];
+  }
+  return raw;
+}
+
+static gdouble
+read_float_sample (const GstAudioFormatInfo * finfo, const guint8 * p)
+{
+  if (finfo->width == 32) {
+    if (GST_AUDIO_FORMAT_INFO_IS_LITTLE_ENDIAN (finfo))
+      return GST_READ_FLOAT_LE (p);
+    else
+      return GST_READ_FLOAT_BE (p);
+  } else {
+    if (GST_AUDIO_FORMAT_INFO_IS_LITTLE_ENDIAN (finfo))
+      return GST_READ_DOUBLE_LE (p);
+    else
+      return GST_READ_DOUBLE_BE (p);
+  }
+}
+
+static void
+run_pack_unpack (const GstAudioFormatInfo * finfo, gint len, GRand * rand)
+{
+  gint i, bps = finfo->width / 8;
+  guint8 *packed;
+  guint32 *in, *out;
+  gdouble *in_f, *out_f;
+
+  packed = g_malloc (len * bps + 1);
+  in = g_new (guint32, len + 1);
+  out = g_new (guint32, len + 1);
+  in_f = g_new (gdouble, len + 1);
+  out_f = g_new (gdouble, len + 1);
+
+  if (GST_AUDIO_FORMAT_INFO_IS_INTEGER (finfo)) {
+    guint32 sign = GST_AUDIO_FORMAT_INFO_IS_SIGNED (finfo) ? 0 : 0x80000000;
+    guint32 mask = (guint32) (0xffffffff00000000ULL >> finfo->depth);
+
+    /* unpack matches the plain per-sample computation */
+    for (i = 0; i < len * bps; i++)
+      packed[i] = g_rand_int (rand);
+    finfo->unpack_func (finfo, GST_AUDIO_PACK_FLAG_TRUNCATE_RANGE, out,
+        packed, len);
+    for (i = 0; i < len; i++) {
+      guint32 expected =
+          (read_raw_sample (finfo, packed + i * bps) << (32 - finfo->depth))
+          ^ sign;
+
+      fail_unless (out[i] == expected, "%s: sample %d of %d: %08x != %08x",
+          finfo->name, i, len, out[i], expected);
+    }
+
+    /* pack keeps the most significant bits */
+    for (i = 0; i < len; i++)
+      in[i] = g_rand_int (rand);
+    finfo->pack_func (finfo, 0, in, packed, len);
+    finfo->unpack_func (finfo, GST_AUDIO_PACK_FLAG_TRUNCATE_RANGE, out,
+        packed, len);
+    for (i = 0; i < len; i++)
+      fail_unless (out[i] == (in[i] & mask),
+          "%s: sample %d of %d: %08x != %08x", finfo->name, i, len, out[i],
+          in[i] & mask);
+  } else {
+    for (i = 0; i < len; i++)
+      in_f[i] = g_rand_double_range (rand, -1.0, 1.0);
+    finfo->pack_func (finfo, 0, in_f, packed, len);
+    finfo->unpack_func (finfo, 0, out_f, packed, len);
+    for (i = 0; i < len; i++) {
+      gdouble expected = read_float_sample (finfo, packed + i * bps);
+
+      fail_unless (out_f[i] == expected, "%s: sample %d of %d: %f != %f",
+          finfo->name, i, len, out_f[i], expected);
+      if (finfo->width == 32)
+        fail_unless (out_f[i] == (gfloat) in_f[i]);
+      else
+        fail_unless (out_f[i] == in_f[i]);
+    }
+  }
+
+  g_free (packed);
+  g_free (in);
+  g_free (out);
+  g_free (in_f);
+  g_free (out_f);
+}
+
+GST_START_TEST (test_pack_unpack)
+{
+  GstAudioFormat fmt;
+  GRand *rand;
+  GTimer *timer;
+  gdouble elapsed;
+  gpointer packed, unpacked;
+  gint len, count;
+
+  rand = g_rand_new_with_seed (0x5eed);
+  timer = g_timer_new ();
+  packed = g_malloc0 (PACK_SAMPLES * 8);
+  unpacked = g_malloc0 (PACK_SAMPLES * 8);
+
+  for (fmt = GST_AUDIO_FORMAT_S8; fmt <= GST_AUDIO_FORMAT_F64BE; fmt++) {
+    const GstAudioFormatInfo *finfo = gst_audio_format_get_info (fmt);
+
+    /* short lengths to cover the leftovers of block-wise processing */
+    for (len = 0; len < 16; len++)
+      run_pack_unpack (finfo, len, rand);
+    run_pack_unpack (finfo, PACK_SAMPLES, rand);
+
+    count = 0;
+    g_timer_start (timer);
+    while (TRUE) {
+      finfo->unpack_func (finfo, 0, unpacked, packed, PACK_SAMPLES);
+
+      count++;
+      elapsed = g_timer_elapsed (timer, NULL);
+      if (elapsed >= TIME)
+        break;
+    }
+    GST_DEBUG ("%f samples/sec unpack %s", count * PACK_SAMPLES / elapsed,
+        finfo->name);
+
+    count = 0;
+    g_timer_start (timer);
+    while (TRUE) {
+      finfo->pack_func (finfo, 0, unpacked, packed, PACK_SAMPLES);
+
+      count++;
+      elapsed = g_timer_elapsed (timer, NULL);
+      if (elapsed >= TIME)
+        break;
+    }
+    GST_DEBUG ("%f samples/sec pack %s", count * PACK_SAMPLES / elapsed,
+        finfo->name);
+  }
+
+  g_free (packed);
+  g_free (unpacked);
+  g_timer_destroy (timer);
+  g_rand_free (rand);
+}
+
+GST_END_TEST;
+
+#define QUANTIZE_FRAMES 16384
+
+static void
+run_quantize (GstAudioDitherMethod dither, GstAudioNoiseShapingMethod ns,
+    gint channels)
+{
+  GstAudioQuantize *quant;
+  gint32 *in, *out;
+  gpointer inp[1], outp[1];
+  gint i, len = QUANTIZE_FRAMES * channels, count;
+  gdouble q = 65536.0, err, prev, mean, var, corr, expected;
+  GTimer *timer;
+  gdouble elapsed;
+
+  quant = gst_audio_quantize_new (dither, ns, 0, GST_AUDIO_FORMAT_S32,
+      channels, 1 << 16);
+  fail_unless (quant != NULL);
+
+  in = g_new (gint32, len);
+  out = g_new (gint32, len);
+  for (i = 0; i < len; i++)
+    in[i] = (gint32) ((i * 2654435761u) >> 2) - (1 << 29);
+
+  inp[0] = in;
+  outp[0] = out;
+  gst_audio_quantize_samples (quant, inp, outp, QUANTIZE_FRAMES);
+
+  mean = var = corr = 0.0;
+  for (i = 0; i < len; i++) {
+    fail_unless ((out[i] & 0xffff) == 0);
+
+    err = (gdouble) out[i] - in[i];
+    mean += err;
+    var += err * err;
+    if (i >= channels) {
+      prev = (gdouble) out[i - channels] - in[i - channels];
+      corr += err * prev;
+    }
+  }
+  mean /= len;
+  var = var / len - mean * mean;
+  corr = (corr / (len - channels) - mean * mean) / var;
+
+  GST_DEBUG ("dither %d, ns %d: mean %f, variance %f, correlation %f",
+      dither, ns, mean / q, var / (q * q), corr);
+
+  /* the error of plain dithering is white with a known variance */
+  if (ns == GST_AUDIO_NOISE_SHAPING_NONE) {
+    switch (dither) {
+      case GST_AUDIO_DITHER_NONE:
+        expected = q * q / 12.0;
+        break;
+      case GST_AUDIO_DITHER_RPDF:
+        expected = q * q / 3.0 + q * q / 12.0;
+        break;
+      default:
+        expected = q * q / 6.0 + q * q / 12.0;
+        break;
+    }
+    fail_unless (ABS (mean) < 0.02 * q, "mean %f", mean / q);
+    fail_unless (ABS (var / expected - 1.0) < 0.05, "variance %f",
+        var / (q * q));
+    if (dither == GST_AUDIO_DITHER_RPDF || dither == GST_AUDIO_DITHER_TPDF)
+      fail_unless (ABS (corr) < 0.05, "correlation %f", corr);
+  }
+
+  timer = g_timer_new ();
+  count = 0;
+  while (TRUE) {
+    gst_audio_quantize_samples (quant, inp, outp, QUANTIZE_FRAMES);
+
+    count++;
+    elapsed = g_timer_elapsed (timer, NULL);
+    if (elapsed >= TIME)
+      break;
+  }
+  GST_DEBUG ("%f frames/sec, dither %d, ns %d, %d channels",
+      count * QUANTIZE_FRAMES / elapsed, dither, ns, channels);
+  g_timer_destroy (timer);
+
+  g_free (in);
+  g_free (out);
+  gst_audio_quantize_free (quant);
+}
+
+GST_START_TEST (test_quantize)
+{
+  gint dither, ns;
+
+  for (dither = GST_AUDIO_DITHER_NONE; dither <= GST_AUDIO_DITHER_TPDF_HF;
+      dither++) {
+    for (ns = GST_AUDIO_NOISE_SHAPING_NONE; ns <= GST_AUDIO_NOISE_SHAPING_HIGH;
+        ns++) {
+      run_quantize (dither, ns, 1);
+      run_quantize (dither, ns, 2);
+      run_quantize (dither, ns, 6);
+    }
+  }
+}
+
+GST_END_TEST;
+
+/* the error history of every channel must stay with that channel, whether
+ * the channels are interleaved or not */
+static void
+run_quantize_layouts (GstAudioNoiseShapingMethod ns, gint channels)
+{
+  GstAudioQuantize *quant_il, *quant_pl;
+  gint32 *in_il, *in_pl, *out_il, *out_pl;
+  gpointer in[8], out[8];
+  static const gint chunks[] = { 1000, 3, 4096 - 1003 };
+  gint c, i, j, offset;
+
+  quant_il = gst_audio_quantize_new (GST_AUDIO_DITHER_NONE, ns, 0,
+      GST_AUDIO_FORMAT_S32, channels, 1 << 16);
+  quant_pl = gst_audio_quantize_new (GST_AUDIO_DITHER_NONE, ns,
+      GST_AUDIO_QUANTIZE_FLAG_NON_INTERLEAVED, GST_AUDIO_FORMAT_S32, channels,
+      1 << 16);
+
+  in_il = g_new (gint32, 4096 * channels);
+  in_pl = g_new (gint32, 4096 * channels);
+  out_il = g_new0 (gint32, 4096 * channels);
+  out_pl = g_new0 (gint32, 4096 * channels);
+
+  /* a different signal on every channel */
+  for (i = 0; i < 4096; i++) {
+    for (c = 0; c < channels; c++) {
+      gint32 v = (gint32) (((i * (c + 1)) * 2654435761u) >> 2) - (1 << 29);
+
+      in_il[i * channels + c] = v;
+      in_pl[c * 4096 + i] = v;
+    }
+  }
+
+  /* in a few calls, so that the history is carried over between them */
+  for (j = 0, offset = 0; j < G_N_ELEMENTS (chunks); offset += chunks[j++]) {
+    in[0] = in_il + offset * channels;
+    out[0] = out_il + offset * channels;
+    gst_audio_quantize_samples (quant_il, in, out, chunks[j]);
+
+    for (c = 0; c < channels; c++) {
+      in[c] = in_pl + c * 4096 + offset;
+      out[c] = out_pl + c * 4096 + offset;
+    }
+    gst_audio_quantize_samples (quant_pl, in, out, chunks[j]);
+  }
+
+  for (i = 0; i < 4096; i++) {
+    for (c = 0; c < channels; c++) {
+      fail_unless (out_il[i * channels + c] == out_pl[c * 4096 + i],
+          "ns %d, %d channels: sample %d channel %d: %d != %d", ns, channels,
+          i, c, out_il[i * channels + c], out_pl[c * 4096 + i]);
+    }
+  }
+
+  g_free (in_il);
+  g_free (in_pl);
+  g_free (out_il);
+  g_free (out_pl);
+  gst_audio_quantize_free (quant_il);
+  gst_audio_quantize_free (quant_pl);
+}
+
+GST_START_TEST (test_quantize_layouts)
+{
+  gint ns;
+
+  for (ns = GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK;
+      ns <= GST_AUDIO_NOISE_SHAPING_HIGH; ns++) {
+    run_quantize_layouts (ns, 2);
+    run_quantize_layouts (ns, 6);
+  }
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_audio_meta)
+{
+  GstBuffer *buf, *copy;
+  GstAudioInfo info;
+  GstAudioMeta *meta;
+  gsize offsets[2] = { 4096, 0 };
+
+  gst_audio_info_set_format (&info, GST_AUDIO_FORMAT_S16, 44100, 2, NULL);
+  info.layout = GST_AUDIO_LAYOUT_NON_INTERLEAVED;
+
+  /* planes packed one after the other */
+  buf = gst_buffer_new_and_alloc (8192);
+  meta = gst_buffer_add_audio_meta (buf, &info, 2048, NULL);
+  fail_unless (meta != NULL);
+  fail_unless_equals_int (meta->samples, 2048);
+  fail_unless_equals_int (meta->offsets[0], 0);
+  fail_unless_equals_int (meta->offsets[1], 4096);
+  fail_unless (gst_buffer_get_audio_meta (buf) == meta);
+
+  /* a copy of the complete buffer keeps the layout */
+  copy = gst_buffer_copy (buf);
+  meta = gst_buffer_get_audio_meta (copy);
+  fail_unless (meta != NULL);
+  fail_unless_equals_int (meta->samples, 2048);
+  fail_unless_equals_int (meta->offsets[1], 4096);
+  gst_buffer_unref (copy);
+
+  /* but a part of it doesn't */
+  copy = gst_buffer_copy_region (buf, GST_BUFFER_COPY_ALL, 0, 4096);
+  fail_unless (gst_buffer_get_audio_meta (copy) == NULL);
+  gst_buffer_unref (copy);
+  gst_buffer_unref (buf);
+
+  /* swapped planes with padding in between */
+  buf = gst_buffer_new_and_alloc (8192);
+  meta = gst_buffer_add_audio_meta (buf, &info, 1024, offsets);
+  fail_unless (meta != NULL);
+  fail_unless_equals_int (meta->offsets[0], 4096);
+  fail_unless_equals_int (meta->offsets[1], 0);
+  gst_buffer_unref (buf);
+
+  /* overlapping planes */
+  buf = gst_buffer_new_and_alloc (8192);
+  offsets[0] = 1024;
+  ASSERT_CRITICAL (meta = gst_buffer_add_audio_meta (buf, &info, 1024,
+          offsets));
+  fail_unless (meta == NULL);
+  fail_unless (gst_buffer_get_audio_meta (buf) == NULL);
+  gst_buffer_unref (buf);
+
+  /* too many samples */
+  buf = gst_buffer_new_and_alloc (8192);
+  ASSERT_CRITICAL (meta = gst_buffer_add_audio_meta (buf, &info, 4096, NULL));
+  fail_unless (meta == NULL);
+  gst_buffer_unref (buf);
+
+  /* interleaved buffers have no offsets */
+  info.layout = GST_AUDIO_LAYOUT_INTERLEAVED;
+  buf = gst_buffer_new_and_alloc (8192);
+  meta = gst_buffer_add_audio_meta (buf, &info, 2048, NULL);
+  fail_unless (meta != NULL);
+  fail_unless (meta->offsets == NULL);
+  gst_buffer_unref (buf);
+}
+
+GST_END_TEST;
+
+/* a ringbuffer without a device, the test advances it */
+typedef GstAudioRingBuffer TestRingBuffer;
+typedef GstAudioRingBufferClass TestRingBufferClass;
+
+static GType test_ring_buffer_get_type (void);
+
+G_DEFINE_TYPE (TestRingBuffer, test_ring_buffer, GST_TYPE_AUDIO_RING_BUFFER);
+
+static gboolean
+test_ring_buffer_open_device (GstAudioRingBuffer * buf)
+{
+  return TRUE;
+}
+
+static gboolean
+test_ring_buffer_close_device (GstAudioRingBuffer * buf)
+{
+  return TRUE;
+}
+
+static gboolean
+test_ring_buffer_acquire (GstAudioRingBuffer * buf,
+    GstAudioRingBufferSpec * spec)
+{
+  buf->size = spec->segtotal * spec->segsize;
+  buf->memory = g_malloc0 (buf->size);
+
+  return TRUE;
+}
+
+static gboolean
+test_ring_buffer_release (GstAudioRingBuffer * buf)
+{
+  g_free (buf->memory);
+  buf->memory = NULL;
+
+  return TRUE;
+}
+
+static gboolean
+test_ring_buffer_start (GstAudioRingBuffer * buf)
+{
+  return TRUE;
+}
+
+static gboolean
+test_ring_buffer_stop (GstAudioRingBuffer * buf)
+{
+  return TRUE;
+}
+
+static void
+test_ring_buffer_class_init (TestRingBufferClass * klass)
+{
+  klass->open_device = test_ring_buffer_open_device;
+  klass->close_device = test_ring_buffer_close_device;
+  klass->acquire = test_ring_buffer_acquire;
+  klass->release = test_ring_buffer_release;
+  klass->start = test_ring_buffer_start;
+  klass->pause = test_ring_buffer_stop;
+  klass->stop = test_ring_buffer_stop;
+}
+
+static void
+test_ring_buffer_init (TestRingBuffer * buf)
+{
+}
+
+static volatile gint device_running;
+/* microseconds between the segments consumed by the device */
+static gint device_period;
+
+/* consume one segment every device_period like an audio device would */
+static gpointer
+device_thread (gpointer data)
+{
+  GstAudioRingBuffer *buf = data;
+
+  while (g_atomic_int_get (&device_running)) {
+    g_usleep (device_period);
+    gst_audio_ring_buffer_advance (buf, 1);
+  }
+  return NULL;
+}
+
+static void
+run_ring_buffer_waits (gboolean lock_free, gint period)
+{
+  GstAudioRingBuffer *buf;
+  GstStructure *stats;
+  GThread *thread;
+  guint64 waits, spin_waits, wait_time, max_wait_time, sample;
+  guint8 data[160] = { 0, };
+  gint i, accum;
+
+  buf = g_object_new (test_ring_buffer_get_type (), NULL);
+  gst_object_ref_sink (buf);
+
+  fail_if (gst_audio_ring_buffer_get_lock_free (buf));
+  gst_audio_ring_buffer_set_lock_free (buf, lock_free);
+  fail_unless_equals_int (gst_audio_ring_buffer_get_lock_free (buf),
+      lock_free);
+
+  /* nothing waited yet */
+  stats = gst_audio_ring_buffer_get_stats (buf);
+  fail_unless (gst_structure_get_uint64 (stats, "waits", &waits));
+  fail_unless (gst_structure_get_uint64 (stats, "spin-waits", &spin_waits));
+  fail_unless (gst_structure_get_uint64 (stats, "wait-time", &wait_time));
+  fail_unless (gst_structure_get_uint64 (stats, "max-wait-time",
+          &max_wait_time));
+  fail_unless_equals_uint64 (waits, 0);
+  fail_unless_equals_uint64 (spin_waits, 0);
+  fail_unless_equals_uint64 (wait_time, 0);
+  fail_unless_equals_uint64 (max_wait_time, 0);
+  gst_structure_free (stats);
+
+  /* 4 segments of 80 mono S16 samples */
+  gst_audio_info_set_format (&buf->spec.info, GST_AUDIO_FORMAT_S16, 8000, 1,
+      NULL);
+  buf->spec.type = GST_AUDIO_RING_BUFFER_FORMAT_TYPE_RAW;
+  buf->spec.segsize = sizeof (data);
+  buf->spec.segtotal = 4;
+  buf->spec.seglatency = -1;
+
+  fail_unless (gst_audio_ring_buffer_open_device (buf));
+  fail_unless (gst_audio_ring_buffer_acquire (buf, &buf->spec));
+  gst_audio_ring_buffer_may_start (buf, TRUE);
+
+  device_period = period;
+  g_atomic_int_set (&device_running, 1);
+  thread = g_thread_new ("device", device_thread, buf);
+
+  /* writing much faster than the device consumes, so the writer has to wait
+   * for a free segment after filling the ringbuffer */
+  for (i = 0, sample = 0; i < 32; i++) {
+    gint todo = 80;
+
+    /* commit advances sample itself */
+    accum = 0;
+    while (todo > 0) {
+      guint written;
+
+      written = gst_audio_ring_buffer_commit (buf, &sample,
+          data + (80 - todo) * 2, todo, todo, &accum);
+      fail_if (written == 0);
+      todo -= written;
+    }
+  }
+
+  g_atomic_int_set (&device_running, 0);
+  g_thread_join (thread);
+
+  stats = gst_audio_ring_buffer_get_stats (buf);
+  fail_unless (gst_structure_get_uint64 (stats, "waits", &waits));
+  fail_unless (gst_structure_get_uint64 (stats, "spin-waits", &spin_waits));
+  fail_unless (gst_structure_get_uint64 (stats, "wait-time", &wait_time));
+  fail_unless (gst_structure_get_uint64 (stats, "max-wait-time",
+          &max_wait_time));
+  gst_structure_free (stats);
+
+  GST_DEBUG ("lock free %d: %" G_GUINT64_FORMAT " waits, %" G_GUINT64_FORMAT
+      " spun, max %" GST_TIME_FORMAT, lock_free, waits, spin_waits,
+      GST_TIME_ARGS (max_wait_time));
+
+  fail_unless (waits > 0);
+  fail_unless (spin_waits <= waits);
+  /* a device that frees segments within the segment time of 10ms hands
+   * them over while the writer spins, a slower one makes it sleep */
+  if (!lock_free)
+    fail_unless_equals_uint64 (spin_waits, 0);
+  else if (period < 10000)
+    fail_unless (spin_waits > 0);
+  else
+    fail_unless (spin_waits < waits);
+  fail_unless (max_wait_time > 0);
+  fail_unless (max_wait_time <= wait_time);
+
+  fail_unless (gst_audio_ring_buffer_stop (buf));
+  fail_unless (gst_audio_ring_buffer_release (buf));
+  fail_unless (gst_audio_ring_buffer_close_device (buf));
+  gst_object_unref (buf);
+}
+
+GST_START_TEST (test_ring_buffer_lock_free)
+{
+  /* both modes must keep passing segments, the lock-free mode sleeps
+   * between polls when the device is slower than a segment */
+  run_ring_buffer_waits (FALSE, 1000);
+  run_ring_buffer_waits (TRUE, 1000);
+  run_ring_buffer_waits (TRUE, 25000);
+}
+
+GST_END_TEST;
+
+#define TEST_AUDIO_CAPS "audio/x-raw, format = (string) S16LE, " \
+    "layout = (string) interleaved, rate = (int) 8000, channels = (int) 1"
+
+static GstStaticPadTemplate test_audio_src_template =
+GST_STATIC_PAD_TEMPLATE ("src", GST_PAD_SRC, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (TEST_AUDIO_CAPS));
+
+static GstStaticPadTemplate test_audio_sink_template =
+GST_STATIC_PAD_TEMPLATE ("sink", GST_PAD_SINK, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (TEST_AUDIO_CAPS));
+
+/* an audio source capturing silence in real time */
+typedef GstAudioSrc TestAudioSrc;
+typedef GstAudioSrcClass TestAudioSrcClass;
+
+static GType test_audio_src_get_type (void);
+
+G_DEFINE_TYPE (TestAudioSrc, test_audio_src, GST_TYPE_AUDIO_SRC);
+
+static gboolean
+test_audio_src_open (GstAudioSrc * src)
+{
+  return TRUE;
+}
+
+static gboolean
+test_audio_src_prepare (GstAudioSrc * src, GstAudioRingBufferSpec * spec)
+{
+  return TRUE;
+}
+
+static guint
+test_audio_src_read (GstAudioSrc * src, gpointer data, guint length,
+    GstClockTime * timestamp)
+{
+  GstAudioRingBuffer *buf = GST_AUDIO_BASE_SRC (src)->ringbuffer;
+
+  g_usleep (gst_util_uint64_scale_int (length / buf->spec.info.bpf,
+          G_USEC_PER_SEC, buf->spec.info.rate));
+  memset (data, 0, length);
+
+  return length;
+}
+
+static guint
+test_audio_src_delay (GstAudioSrc * src)
+{
+  return 0;
+}
+
+static void
+test_audio_src_class_init (TestAudioSrcClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class,
+      &test_audio_src_template);
+  gst_element_class_set_static_metadata (element_class, "Test audio source",
+      "Source/Audio", "Captures silence", "Test");
+
+  klass->open = test_audio_src_open;
+  klass->close = test_audio_src_open;
+  klass->prepare = test_audio_src_prepare;
+  klass->unprepare = test_audio_src_open;
+  klass->read = test_audio_src_read;
+  klass->delay = test_audio_src_delay;
+}
+
+static void
+test_audio_src_init (TestAudioSrc * src)
+{
+}
+
+/* an audio sink that discards the samples in real time */
+typedef GstAudioSink TestAudioSink;
+typedef GstAudioSinkClass TestAudioSinkClass;
+
+static GType test_audio_sink_get_type (void);
+
+G_DEFINE_TYPE (TestAudioSink, test_audio_sink, GST_TYPE_AUDIO_SINK);
+
+static gboolean
+test_audio_sink_open (GstAudioSink * sink)
+{
+  return TRUE;
+}
+
+static gboolean
+test_audio_sink_prepare (GstAudioSink * sink, GstAudioRingBufferSpec * spec)
+{
+  return TRUE;
+}
+
+static gint
+test_audio_sink_write (GstAudioSink * sink, gpointer data, guint length)
+{
+  GstAudioRingBuffer *buf = GST_AUDIO_BASE_SINK (sink)->ringbuffer;
+
+  g_usleep (gst_util_uint64_scale_int (length / buf->spec.info.bpf,
+          G_USEC_PER_SEC, buf->spec.info.rate));
+
+  return length;
+}
+
+static guint
+test_audio_sink_delay (GstAudioSink * sink)
+{
+  return 0;
+}
+
+static void
+test_audio_sink_class_init (TestAudioSinkClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gst_element_class_add_static_pad_template (element_class,
+      &test_audio_sink_template);
+  gst_element_class_set_static_metadata (element_class, "Test audio sink",
+      "Sink/Audio", "Discards audio", "Test");
+
+  klass->open = test_audio_sink_open;
+  klass->close = test_audio_sink_open;
+  klass->prepare = test_audio_sink_prepare;
+  klass->unprepare = test_audio_sink_open;
+  klass->write = test_audio_sink_write;
+  klass->delay = test_audio_sink_delay;
+}
+
+static void
+test_audio_sink_init (TestAudioSink * sink)
+{
+}
+
+static void
+check_ring_buffer_stats (const GstStructure * s)
+{
+  const GValue *hist;
+  guint64 val;
+  gint fill;
+
+  fail_unless (gst_structure_get_uint64 (s, "waits", &val));
+  fail_unless (gst_structure_get_uint64 (s, "spin-waits", &val));
+  fail_unless (gst_structure_get_uint64 (s, "wait-time", &val));
+  fail_unless (gst_structure_get_uint64 (s, "max-wait-time", &val));
+  fail_unless (gst_structure_get_uint64 (s, "xruns", &val));
+  fail_unless (gst_structure_get_int (s, "fill", &fill));
+
+  hist = gst_structure_get_value (s, "fill-level");
+  fail_unless (hist != NULL);
+  fail_unless (GST_VALUE_HOLDS_ARRAY (hist));
+  fail_unless_equals_int (gst_value_array_get_size (hist), 8);
+}
+
+static guint64
+fill_level_total (const GstStructure * s)
+{
+  const GValue *hist = gst_structure_get_value (s, "fill-level");
+  guint64 total = 0;
+  guint i;
+
+  for (i = 0; i < gst_value_array_get_size (hist); i++)
+    total += g_value_get_uint64 (gst_value_array_get_value (hist, i));
+
+  return total;
+}
+
+GST_START_TEST (test_audio_base_sink_stats)
+{
+  GstElement *sink;
+  GstStructure *s;
+  guint64 val;
+
+  sink = g_object_new (test_audio_sink_get_type (), NULL);
+  gst_object_ref_sink (sink);
+
+  /* without a ringbuffer only the counters of the sink are there */
+  g_object_get (sink, "stats", &s, NULL);
+  fail_unless (s != NULL);
+  fail_unless (gst_structure_has_name (s, "GstAudioBaseSinkStats"));
+  fail_unless (gst_structure_get_uint64 (s, "resyncs", &val));
+  fail_unless_equals_uint64 (val, 0);
+  fail_unless (gst_structure_get_uint64 (s, "skew-corrections", &val));
+  fail_unless_equals_uint64 (val, 0);
+  fail_unless (gst_structure_get_uint64 (s, "latency", &val));
+  fail_unless_equals_uint64 (val, 0);
+  fail_if (gst_structure_has_field (s, "waits"));
+  gst_structure_free (s);
+
+  /* the ringbuffer statistics are added once it exists */
+  fail_unless_equals_int (gst_element_set_state (sink, GST_STATE_READY),
+      GST_STATE_CHANGE_SUCCESS);
+  g_object_get (sink, "stats", &s, NULL);
+  check_ring_buffer_stats (s);
+  fail_unless (gst_structure_get_uint64 (s, "xruns", &val));
+  fail_unless_equals_uint64 (val, 0);
+  fail_unless_equals_uint64 (fill_level_total (s), 0);
+  gst_structure_free (s);
+
+  gst_element_set_state (sink, GST_STATE_NULL);
+  gst_object_unref (sink);
+}
+
+GST_END_TEST;
+
+static guint64
+get_resyncs (GstElement * sink)
+{
+  GstStructure *s;
+  guint64 val;
+
+  g_object_get (sink, "stats", &s, NULL);
+  fail_unless (gst_structure_get_uint64 (s, "resyncs", &val));
+  gst_structure_free (s);
+
+  return val;
+}
+
+/* pushes 10ms of silence */
+static void
+push_silence (GstHarness * h, GstClockTime pts, gboolean discont)
+{
+  GstBuffer *buf;
+
+  buf = gst_buffer_new_and_alloc (160);
+  gst_buffer_memset (buf, 0, 0, 160);
+  GST_BUFFER_PTS (buf) = pts;
+  GST_BUFFER_DURATION (buf) = 10 * GST_MSECOND;
+  if (discont)
+    GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DISCONT);
+  fail_unless_equals_int (gst_harness_push (h, buf), GST_FLOW_OK);
+}
+
+GST_START_TEST (test_audio_base_sink_resyncs)
+{
+  GstHarness *h;
+  GstElement *sink;
+  GstSegment segment;
+  gint i;
+
+  sink = g_object_new (test_audio_sink_get_type (), "slave-method",
+      GST_AUDIO_BASE_SINK_SLAVE_NONE, NULL);
+  h = gst_harness_new_with_element (sink, "sink", NULL);
+  gst_harness_set_src_caps_str (h, TEST_AUDIO_CAPS);
+
+  /* the first buffer of the stream is expected to resync */
+  for (i = 0; i < 3; i++)
+    push_silence (h, i * 10 * GST_MSECOND, i == 0);
+  fail_unless_equals_uint64 (get_resyncs (sink), 0);
+
+  /* and so is the first one after a flush */
+  fail_unless (gst_harness_push_event (h, gst_event_new_flush_start ()));
+  fail_unless (gst_harness_push_event (h, gst_event_new_flush_stop (TRUE)));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_harness_push_event (h, gst_event_new_segment (&segment)));
+  push_silence (h, 0, TRUE);
+  push_silence (h, 10 * GST_MSECOND, FALSE);
+  fail_unless_equals_uint64 (get_resyncs (sink), 0);
+
+  /* a new segment */
+  segment.base = 20 * GST_MSECOND;
+  fail_unless (gst_harness_push_event (h, gst_event_new_segment (&segment)));
+  push_silence (h, 0, TRUE);
+  fail_unless_equals_uint64 (get_resyncs (sink), 0);
+
+  /* a new stream */
+  fail_unless (gst_harness_push_event (h,
+          gst_event_new_stream_start ("other")));
+  segment.base = 30 * GST_MSECOND;
+  fail_unless (gst_harness_push_event (h, gst_event_new_segment (&segment)));
+  push_silence (h, 0, TRUE);
+  push_silence (h, 10 * GST_MSECOND, FALSE);
+  fail_unless_equals_uint64 (get_resyncs (sink), 0);
+
+  /* a discont in the middle of the stream is counted */
+  push_silence (h, 20 * GST_MSECOND, TRUE);
+  fail_unless_equals_uint64 (get_resyncs (sink), 1);
+
+  gst_harness_teardown (h);
+  gst_object_unref (sink);
+}
+
+GST_END_TEST;
+
+static GstPadProbeReturn
+stall_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  gint *count = user_data;
+
+  /* block the streaming thread on the second buffer for longer than the
+   * ringbuffer can hold, the device keeps capturing meanwhile */
+  if (++(*count) == 2)
+    g_usleep (G_USEC_PER_SEC / 2);
+
+  return GST_PAD_PROBE_OK;
+}
+
+GST_START_TEST (test_audio_base_src_stats)
+{
+  GstHarness *h;
+  GstElement *src;
+  GstStructure *s;
+  guint64 val;
+  gint i, count = 0;
+  GstPad *pad;
+
+  src = g_object_new (test_audio_src_get_type (), "slave-method",
+      GST_AUDIO_BASE_SRC_SLAVE_NONE, NULL);
+  h = gst_harness_new_with_element (src, NULL, "src");
+
+  pad = gst_element_get_static_pad (src, "src");
+  gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER, stall_probe, &count,
+      NULL);
+  gst_object_unref (pad);
+
+  gst_harness_play (h);
+
+  for (i = 0; i < 5; i++)
+    gst_buffer_unref (gst_harness_pull (h));
+
+  g_object_get (src, "stats", &s, NULL);
+  fail_unless (gst_structure_has_name (s, "GstAudioBaseSrcStats"));
+  check_ring_buffer_stats (s);
+
+  /* the samples captured during the stall were dropped */
+  fail_unless (gst_structure_get_uint64 (s, "discontinuities", &val));
+  fail_unless (val >= 1);
+  fail_unless (gst_structure_get_uint64 (s, "resyncs", &val));
+  fail_unless_equals_uint64 (val, 0);
+  fail_unless (gst_structure_get_uint64 (s, "latency", &val));
+
+  /* every segment that was read was accounted */
+  fail_unless (fill_level_total (s) >= 5);
+  gst_structure_free (s);
+
+  gst_harness_teardown (h);
+  gst_object_unref (src);
+}
+
+GST_END_TEST;
+
 static Suite *
 audio_suite (void)
 {
@@ -732,6 +2131,17 @@ audio_suite (void)
   tcase_add_test (tc_chain, test_audio_format_s8);
   tcase_add_test (tc_chain, test_audio_format_u8);
   tcase_add_test (tc_chain, test_fill_silence);
+  tcase_add_test (tc_chain, test_pack_unpack);
+  tcase_add_test (tc_chain, test_channel_mixer);
+  tcase_add_test (tc_chain, test_converter_layouts);
+  tcase_add_test (tc_chain, test_converter_inplace);
+  tcase_add_test (tc_chain, test_quantize);
+  tcase_add_test (tc_chain, test_quantize_layouts);
+  tcase_add_test (tc_chain, test_audio_meta);
+  tcase_add_test (tc_chain, test_ring_buffer_lock_free);
+  tcase_add_test (tc_chain, test_audio_base_sink_stats);
+  tcase_add_test (tc_chain, test_audio_base_sink_resyncs);
+  tcase_add_test (tc_chain, test_audio_base_src_stats);
 
   return s;
 }
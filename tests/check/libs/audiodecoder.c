@@ -28,6 +28,8 @@
 #include <gst/audio/audio.h>
 #include <gst/app/app.h>
 
+#include "nonliveharness.h"
+
 #define TEST_MSECS_PER_SAMPLE 44100
 
 #define RESTRICTED_CAPS_RATE 44100
@@ -198,6 +200,24 @@ gst_audio_decoder_tester_handle_frame (GstAudioDecoder * dec,
   return ret;
 }
 
+static GstFlowReturn
+gst_audio_decoder_tester_handle_frames (GstAudioDecoder * dec,
+    GstBuffer ** buffers, guint n_buffers)
+{
+  GstBuffer *output_buffer;
+  guint64 *data;
+  guint i;
+
+  /* the output is one SE32LE stereo sample per frame */
+  data = g_new0 (guint64, n_buffers);
+  for (i = 0; i < n_buffers; i++)
+    gst_buffer_extract (buffers[i], 0, &data[i], sizeof (guint64));
+
+  output_buffer = gst_buffer_new_wrapped (data, n_buffers * sizeof (guint64));
+
+  return gst_audio_decoder_finish_frame (dec, output_buffer, n_buffers);
+}
+
 static void
 gst_audio_decoder_tester_class_init (GstAudioDecoderTesterClass * klass)
 {
@@ -222,6 +242,7 @@ gst_audio_decoder_tester_class_init (GstAudioDecoderTesterClass * klass)
   audiosink_class->stop = gst_audio_decoder_tester_stop;
   audiosink_class->flush = gst_audio_decoder_tester_flush;
   audiosink_class->handle_frame = gst_audio_decoder_tester_handle_frame;
+  audiosink_class->handle_frames = gst_audio_decoder_tester_handle_frames;
   audiosink_class->set_format = gst_audio_decoder_tester_set_format;
 }
 
@@ -700,6 +721,136 @@ GST_START_TEST (audiodecoder_output_too_many_frames)
 
 GST_END_TEST;
 
+#define BATCH_SIZE 4
+
+GST_START_TEST (audiodecoder_batch)
+{
+  GstBuffer *buffer;
+  GstMapInfo map;
+  guint64 i, j, n;
+
+  GstHarness *h = setup_audiodecodertester (NULL, NULL);
+
+  /* batching only happens in non-live pipelines */
+  harness_set_non_live (h);
+  gst_audio_decoder_set_max_batch (GST_AUDIO_DECODER (h->element), BATCH_SIZE);
+  fail_unless_equals_int (gst_audio_decoder_get_max_batch (GST_AUDIO_DECODER
+          (h->element)), BATCH_SIZE);
+
+  for (i = 0; i < NUM_BUFFERS; i++) {
+    fail_unless (gst_harness_push (h, create_test_buffer (i)) == GST_FLOW_OK);
+
+    /* nothing comes out until a batch is complete */
+    if ((i + 1) % BATCH_SIZE)
+      fail_unless_equals_int (0, gst_harness_buffers_in_queue (h));
+    else
+      fail_unless_equals_int (1, gst_harness_buffers_in_queue (h));
+  }
+
+  /* EOS drains the incomplete batch */
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+  fail_unless_equals_int ((NUM_BUFFERS + BATCH_SIZE - 1) / BATCH_SIZE,
+      gst_harness_buffers_in_queue (h));
+
+  for (i = 0; i < NUM_BUFFERS; i += n) {
+    n = MIN (BATCH_SIZE, NUM_BUFFERS - i);
+    buffer = gst_harness_pull (h);
+
+    /* one output buffer for all frames with the timestamp of the first */
+    fail_unless_equals_uint64 (GST_BUFFER_PTS (buffer),
+        gst_util_uint64_scale_round (i, GST_SECOND, TEST_MSECS_PER_SAMPLE));
+
+    gst_buffer_map (buffer, &map, GST_MAP_READ);
+    fail_unless_equals_int (map.size, n * sizeof (guint64));
+    for (j = 0; j < n; j++)
+      fail_unless_equals_uint64 (((guint64 *) map.data)[j], i + j);
+    gst_buffer_unmap (buffer, &map);
+
+    gst_buffer_unref (buffer);
+  }
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+static GstPadProbeReturn
+record_output_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  GString *seq = user_data;
+
+  if (GST_PAD_PROBE_INFO_TYPE (info) & GST_PAD_PROBE_TYPE_BUFFER) {
+    g_string_append_c (seq, 'B');
+  } else {
+    switch (GST_EVENT_TYPE (GST_PAD_PROBE_INFO_EVENT (info))) {
+      case GST_EVENT_SEGMENT:
+        g_string_append_c (seq, 'S');
+        break;
+      case GST_EVENT_GAP:
+        g_string_append_c (seq, 'G');
+        break;
+      default:
+        break;
+    }
+  }
+  return GST_PAD_PROBE_OK;
+}
+
+GST_START_TEST (audiodecoder_batch_serialized_events)
+{
+  GstSegment segment;
+  GstCaps *caps;
+  GString *seq;
+  GstPad *pad;
+
+  GstHarness *h = setup_audiodecodertester (NULL, NULL);
+
+  harness_set_non_live (h);
+  gst_audio_decoder_set_max_batch (GST_AUDIO_DECODER (h->element), BATCH_SIZE);
+
+  seq = g_string_new (NULL);
+  pad = gst_element_get_static_pad (h->element, "src");
+  gst_pad_add_probe (pad,
+      GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+      record_output_probe, seq, NULL);
+  gst_object_unref (pad);
+
+  /* an incomplete batch is decoded before a gap */
+  fail_unless (gst_harness_push (h, create_test_buffer (0)) == GST_FLOW_OK);
+  fail_unless (gst_harness_push (h, create_test_buffer (1)) == GST_FLOW_OK);
+  fail_unless_equals_int (0, gst_harness_buffers_in_queue (h));
+  fail_unless (gst_harness_push_event (h,
+          gst_event_new_gap (gst_util_uint64_scale_round (2, GST_SECOND,
+                  TEST_MSECS_PER_SAMPLE), GST_CLOCK_TIME_NONE)));
+  fail_unless_equals_int (1, gst_harness_buffers_in_queue (h));
+
+  /* before a new segment */
+  fail_unless (gst_harness_push (h, create_test_buffer (2)) == GST_FLOW_OK);
+  fail_unless (gst_harness_push (h, create_test_buffer (3)) == GST_FLOW_OK);
+  fail_unless_equals_int (1, gst_harness_buffers_in_queue (h));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_harness_push_event (h, gst_event_new_segment (&segment)));
+  fail_unless_equals_int (2, gst_harness_buffers_in_queue (h));
+
+  /* and before new caps */
+  fail_unless (gst_harness_push (h, create_test_buffer (4)) == GST_FLOW_OK);
+  fail_unless (gst_harness_push (h, create_test_buffer (5)) == GST_FLOW_OK);
+  fail_unless_equals_int (2, gst_harness_buffers_in_queue (h));
+  caps = gst_caps_new_simple ("audio/x-test-custom",
+      "channels", G_TYPE_INT, 2, "rate", G_TYPE_INT, 48000, NULL);
+  fail_unless (gst_harness_push_event (h, gst_event_new_caps (caps)));
+  gst_caps_unref (caps);
+  fail_unless_equals_int (3, gst_harness_buffers_in_queue (h));
+
+  /* each event comes after the frames that were sent before it */
+  fail_unless_equals_string (seq->str, "SBGBSB");
+
+  g_string_free (seq, TRUE);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (audiodecoder_query_caps_with_fixed_caps_peer)
 {
   GstCaps *caps;
@@ -1134,6 +1285,59 @@ GST_START_TEST (audiodecoder_plc_on_gap_event_with_delay)
 
 GST_END_TEST;
 
+GST_START_TEST (audiodecoder_plc_with_batch)
+{
+  GstClockTime dur =
+      gst_util_uint64_scale_round (1, GST_SECOND, TEST_MSECS_PER_SAMPLE);
+  GstBuffer *buf;
+  GstMapInfo map;
+  GstHarness *h = setup_audiodecodertester (NULL, NULL);
+
+  harness_set_non_live (h);
+  gst_audio_decoder_set_max_batch (GST_AUDIO_DECODER (h->element), BATCH_SIZE);
+  gst_audio_decoder_set_plc_aware (GST_AUDIO_DECODER (h->element), TRUE);
+  gst_audio_decoder_set_plc (GST_AUDIO_DECODER (h->element), TRUE);
+
+  fail_unless (gst_harness_push (h, create_test_buffer (0)) == GST_FLOW_OK);
+  fail_unless (gst_harness_push (h, create_test_buffer (1)) == GST_FLOW_OK);
+  fail_unless_equals_int (0, gst_harness_buffers_in_queue (h));
+
+  /* the gap decodes the pending batch and conceals right away */
+  fail_unless (gst_harness_push_event (h,
+          gst_event_new_gap (gst_util_uint64_scale_round (2, GST_SECOND,
+                  TEST_MSECS_PER_SAMPLE), dur)));
+  fail_unless_equals_int (2, gst_harness_buffers_in_queue (h));
+
+  buf = gst_harness_pull (h);
+  fail_unless_equals_uint64 (GST_BUFFER_PTS (buf), 0);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 2 * sizeof (guint64));
+  gst_buffer_unref (buf);
+
+  /* the concealment frame was decoded on its own */
+  buf = gst_harness_pull (h);
+  fail_unless_equals_uint64 (GST_BUFFER_PTS (buf),
+      gst_util_uint64_scale_round (2, GST_SECOND, TEST_MSECS_PER_SAMPLE));
+  fail_unless_equals_uint64 (GST_BUFFER_DURATION (buf), dur);
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+  fail_unless_equals_int (map.size, sizeof (guint64));
+  fail_unless_equals_uint64 (*(guint64 *) map.data, 0);
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+
+  /* and batching continues after it */
+  fail_unless (gst_harness_push (h, create_test_buffer (3)) == GST_FLOW_OK);
+  fail_unless_equals_int (0, gst_harness_buffers_in_queue (h));
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+  buf = gst_harness_pull (h);
+  fail_unless_equals_uint64 (GST_BUFFER_PTS (buf),
+      gst_util_uint64_scale_round (3, GST_SECOND, TEST_MSECS_PER_SAMPLE));
+  gst_buffer_unref (buf);
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 static Suite *
 gst_audiodecoder_suite (void)
 {
@@ -1154,6 +1358,8 @@ gst_audiodecoder_suite (void)
   tcase_add_test (tc, audiodecoder_eos_events_no_buffers);
   tcase_add_test (tc, audiodecoder_buffer_after_segment);
   tcase_add_test (tc, audiodecoder_output_too_many_frames);
+  tcase_add_test (tc, audiodecoder_batch);
+  tcase_add_test (tc, audiodecoder_batch_serialized_events);
 
   tcase_add_test (tc, audiodecoder_query_caps_with_fixed_caps_peer);
   tcase_add_test (tc, audiodecoder_query_caps_with_range_caps_peer);
@@ -1163,6 +1369,7 @@ gst_audiodecoder_suite (void)
 
   tcase_add_test (tc, audiodecoder_plc_on_gap_event);
   tcase_add_test (tc, audiodecoder_plc_on_gap_event_with_delay);
+  tcase_add_test (tc, audiodecoder_plc_with_batch);
 
   return s;
 }
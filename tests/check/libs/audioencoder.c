@@ -28,6 +28,8 @@
 #include <gst/audio/audio.h>
 #include <gst/app/app.h>
 
+#include "nonliveharness.h"
+
 #define TEST_AUDIO_RATE 44100
 #define TEST_AUDIO_CHANNELS 2
 #define TEST_AUDIO_FORMAT "S16LE"
@@ -102,6 +104,20 @@ gst_audio_encoder_tester_handle_frame (GstAudioEncoder * enc,
   return gst_audio_encoder_finish_frame (enc, output_buffer, TEST_AUDIO_RATE);
 }
 
+static GstFlowReturn
+gst_audio_encoder_tester_encode_frame (GstAudioEncoder * enc,
+    GstBuffer * buffer, GstBuffer ** outbuf)
+{
+  guint64 *data;
+
+  data = g_new (guint64, 1);
+  gst_buffer_extract (buffer, 0, data, sizeof (guint64));
+
+  *outbuf = gst_buffer_new_wrapped (data, sizeof (guint64));
+
+  return GST_FLOW_OK;
+}
+
 static void
 gst_audio_encoder_tester_class_init (GstAudioEncoderTesterClass * klass)
 {
@@ -125,6 +141,7 @@ gst_audio_encoder_tester_class_init (GstAudioEncoderTesterClass * klass)
   audioencoder_class->start = gst_audio_encoder_tester_start;
   audioencoder_class->stop = gst_audio_encoder_tester_stop;
   audioencoder_class->handle_frame = gst_audio_encoder_tester_handle_frame;
+  audioencoder_class->encode_frame = gst_audio_encoder_tester_encode_frame;
   audioencoder_class->set_format = gst_audio_encoder_tester_set_format;
 }
 
@@ -228,6 +245,45 @@ GST_START_TEST (audioencoder_playback)
 
 GST_END_TEST;
 
+GST_START_TEST (audioencoder_parallel)
+{
+  GstBuffer *buffer;
+  guint64 i;
+
+  GstHarness *h = setup_audioencodertester ();
+
+  /* parallel encoding only happens in non-live pipelines */
+  harness_set_non_live (h);
+  gst_audio_encoder_set_max_threads (GST_AUDIO_ENCODER (h->element), 4);
+  fail_unless_equals_int (gst_audio_encoder_get_max_threads (GST_AUDIO_ENCODER
+          (h->element)), 4);
+
+  for (i = 0; i < NUM_BUFFERS; i++) {
+    fail_unless (gst_harness_push (h, create_test_buffer (i)) == GST_FLOW_OK);
+  }
+
+  /* EOS waits for all pending jobs */
+  fail_unless (gst_harness_push_event (h, gst_event_new_eos ()));
+  fail_unless_equals_int (NUM_BUFFERS, gst_harness_buffers_in_queue (h));
+
+  /* output comes in input order and is timestamped as usual */
+  for (i = 0; i < NUM_BUFFERS; i++) {
+    guint64 num;
+
+    buffer = gst_harness_pull (h);
+
+    gst_buffer_extract (buffer, 0, &num, sizeof (guint64));
+    fail_unless_equals_uint64 (num, i);
+    fail_unless_equals_uint64 (GST_BUFFER_PTS (buffer), i * GST_SECOND);
+    fail_unless_equals_uint64 (GST_BUFFER_DURATION (buffer), GST_SECOND);
+
+    gst_buffer_unref (buffer);
+  }
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
 
 GST_START_TEST (audioencoder_flush_events)
 {
@@ -403,6 +459,7 @@ gst_audioencoder_suite (void)
 
   suite_add_tcase (s, tc);
   tcase_add_test (tc, audioencoder_playback);
+  tcase_add_test (tc, audioencoder_parallel);
 
   tcase_add_test (tc, audioencoder_tags_before_eos);
   tcase_add_test (tc, audioencoder_events_before_eos);
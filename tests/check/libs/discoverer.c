@@ -28,6 +28,11 @@
 #include <stdio.h>
 #include <glib/gstdio.h>
 #include <glib/gprintf.h>
+#ifdef G_OS_WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
 
 static gboolean have_theora, have_ogg;
 
@@ -243,6 +248,445 @@ GST_START_TEST (test_disco_missing_plugins)
 
 GST_END_TEST;
 
+/* removes the discovery cache files below @cachedir */
+static void
+remove_cache_dir (const gchar * cachedir)
+{
+  gchar *subdir, *path;
+  const gchar *name;
+  GDir *dir;
+
+  subdir = g_build_filename (cachedir, "gstreamer-1.0", "discoverer", NULL);
+  dir = g_dir_open (subdir, 0, NULL);
+  if (dir) {
+    while ((name = g_dir_read_name (dir))) {
+      path = g_build_filename (subdir, name, NULL);
+      g_unlink (path);
+      g_free (path);
+    }
+    g_dir_close (dir);
+  }
+  g_rmdir (subdir);
+  g_free (subdir);
+
+  subdir = g_build_filename (cachedir, "gstreamer-1.0", NULL);
+  g_rmdir (subdir);
+  g_free (subdir);
+}
+
+GST_START_TEST (test_disco_cache)
+{
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GstDiscovererInfo *info, *cached;
+  GList *audio_streams;
+  gchar *uri, *subdir, *path, *cachefile = NULL;
+  gchar *contents, *data, *old[2];
+  gsize len, size;
+  GVariant *variant, *stored, *inner;
+  struct utimbuf times;
+  const gchar *name;
+  GDir *dir;
+  gint i, n = 0;
+
+  if (!have_theora || !have_ogg)
+    return;
+
+  /* the discoverer stores its results where GLib says, main() points that
+   * to a private directory before anything asked GLib for it */
+  remove_cache_dir (g_get_user_cache_dir ());
+  subdir = g_build_filename (g_get_user_cache_dir (), "gstreamer-1.0",
+      "discoverer", NULL);
+
+  dc = gst_discoverer_new (5 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "use-cache", TRUE, NULL);
+
+  path = g_build_filename (GST_TEST_FILES_PATH, "theora-vorbis.ogg", NULL);
+  uri = gst_filename_to_uri (path, &err);
+  g_free (path);
+  fail_unless (err == NULL);
+
+  info = gst_discoverer_discover_uri (dc, uri, &err);
+  fail_unless (info != NULL);
+  fail_unless (err == NULL);
+  fail_unless_equals_int (gst_discoverer_info_get_result (info),
+      GST_DISCOVERER_OK);
+
+  /* the result was stored */
+  dir = g_dir_open (subdir, 0, NULL);
+  fail_unless (dir != NULL);
+  while ((name = g_dir_read_name (dir))) {
+    fail_unless (g_str_has_suffix (name, ".gstdiscoverer"));
+    cachefile = g_build_filename (subdir, name, NULL);
+    n++;
+  }
+  g_dir_close (dir);
+  fail_unless_equals_int (n, 1);
+  fail_unless (g_file_get_contents (cachefile, &contents, &len, NULL));
+
+  /* and is used the next time */
+  cached = gst_discoverer_discover_uri (dc, uri, &err);
+  fail_unless (cached != NULL);
+  fail_unless (err == NULL);
+  fail_unless (cached != info);
+  fail_unless_equals_int (gst_discoverer_info_get_result (cached),
+      GST_DISCOVERER_OK);
+  fail_unless_equals_string (gst_discoverer_info_get_uri (cached), uri);
+  fail_unless_equals_uint64 (gst_discoverer_info_get_duration (cached),
+      gst_discoverer_info_get_duration (info));
+  audio_streams = gst_discoverer_info_get_audio_streams (cached);
+  fail_unless_equals_int (g_list_length (audio_streams), 1);
+  gst_discoverer_stream_info_list_free (audio_streams);
+  gst_discoverer_info_unref (cached);
+
+  /* a truncated cache file and one holding some other variant are removed
+   * and the file is discovered again */
+  variant = g_variant_ref_sink (g_variant_new_variant (g_variant_new_string
+          (uri)));
+  for (i = 0; i < 2; i++) {
+    if (i == 0)
+      fail_unless (g_file_set_contents (cachefile, contents, len / 2, NULL));
+    else
+      fail_unless (g_file_set_contents (cachefile,
+              g_variant_get_data (variant), g_variant_get_size (variant),
+              NULL));
+
+    cached = gst_discoverer_discover_uri (dc, uri, &err);
+    fail_unless (cached != NULL);
+    fail_unless (err == NULL);
+    fail_unless_equals_int (gst_discoverer_info_get_result (cached),
+        GST_DISCOVERER_OK);
+    fail_unless_equals_uint64 (gst_discoverer_info_get_duration (cached),
+        gst_discoverer_info_get_duration (info));
+    gst_discoverer_info_unref (cached);
+
+    /* and the new result replaced the broken file */
+    fail_unless (g_file_get_contents (cachefile, &data, &size, NULL));
+    stored = g_variant_new_from_data (G_VARIANT_TYPE_VARIANT, data, size,
+        FALSE, g_free, data);
+    g_variant_ref_sink (stored);
+    fail_unless (g_variant_is_normal_form (stored));
+    inner = g_variant_get_variant (stored);
+    fail_unless (g_variant_is_of_type (inner, G_VARIANT_TYPE ("(vv)")));
+    g_variant_unref (inner);
+    g_variant_unref (stored);
+  }
+  g_variant_unref (variant);
+
+  /* the least recently used files are pruned once the cache grows too big,
+   * make room for the result by filling the cache with two old files */
+  data = g_malloc0 (5 * 1024 * 1024);
+  for (i = 0; i < 2; i++) {
+    old[i] = g_strdup_printf ("%s" G_DIR_SEPARATOR_S "old-%d.gstdiscoverer",
+        subdir, i);
+    fail_unless (g_file_set_contents (old[i], data, 5 * 1024 * 1024, NULL));
+    times.actime = times.modtime = 1000 + i;
+    fail_unless (g_utime (old[i], &times) == 0);
+  }
+  g_free (data);
+
+  g_unlink (cachefile);
+  cached = gst_discoverer_discover_uri (dc, uri, &err);
+  fail_unless (cached != NULL);
+  fail_unless (err == NULL);
+  gst_discoverer_info_unref (cached);
+
+  fail_unless (g_file_test (cachefile, G_FILE_TEST_EXISTS));
+  fail_if (g_file_test (old[0], G_FILE_TEST_EXISTS));
+  fail_unless (g_file_test (old[1], G_FILE_TEST_EXISTS));
+  g_free (old[0]);
+  g_free (old[1]);
+
+  gst_discoverer_info_unref (info);
+  g_object_unref (dc);
+  g_free (contents);
+  g_free (cachefile);
+  g_free (uri);
+  g_free (subdir);
+
+  remove_cache_dir (g_get_user_cache_dir ());
+}
+
+GST_END_TEST;
+
+typedef struct
+{
+  GMutex lock;
+  gboolean connected;
+  /* distinct instances that were plugged, per factory name */
+  GHashTable *instances;
+} ReuseData;
+
+static void
+disco_reuse_element_added_cb (GstBin * bin, GstBin * sub_bin,
+    GstElement * element, ReuseData * data)
+{
+  GstElementFactory *factory = gst_element_get_factory (element);
+  const gchar *name;
+  GHashTable *set;
+
+  if (factory == NULL)
+    return;
+  name = GST_OBJECT_NAME (factory);
+
+  g_mutex_lock (&data->lock);
+  set = g_hash_table_lookup (data->instances, name);
+  if (set == NULL) {
+    set = g_hash_table_new (NULL, NULL);
+    g_hash_table_insert (data->instances, g_strdup (name), set);
+  }
+  g_hash_table_add (set, element);
+  g_mutex_unlock (&data->lock);
+}
+
+static void
+disco_reuse_source_setup_cb (GstDiscoverer * dc, GstElement * source,
+    ReuseData * data)
+{
+  GstObject *uridecodebin, *pipeline;
+
+  /* the source lives in the uridecodebin of the discoverer pipeline, which
+   * is kept for all URIs */
+  g_mutex_lock (&data->lock);
+  if (!data->connected) {
+    uridecodebin = gst_object_get_parent (GST_OBJECT (source));
+    fail_unless (uridecodebin != NULL);
+    pipeline = gst_object_get_parent (uridecodebin);
+    fail_unless (GST_IS_PIPELINE (pipeline));
+    g_signal_connect (pipeline, "deep-element-added",
+        G_CALLBACK (disco_reuse_element_added_cb), data);
+    gst_object_unref (pipeline);
+    gst_object_unref (uridecodebin);
+    data->connected = TRUE;
+  }
+  g_mutex_unlock (&data->lock);
+}
+
+static guint
+disco_reuse_instances (ReuseData * data, const gchar * factory)
+{
+  GHashTable *set = g_hash_table_lookup (data->instances, factory);
+
+  return set ? g_hash_table_size (set) : 0;
+}
+
+#define REUSE_NUM 5
+
+GST_START_TEST (test_disco_reuse_elements)
+{
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GstDiscovererInfo *info;
+  GList *audio_streams;
+  gchar *uri, *path;
+  gboolean reuse;
+  ReuseData data;
+  guint i;
+
+  if (!have_theora || !have_ogg)
+    return;
+
+  path = g_build_filename (GST_TEST_FILES_PATH, "theora-vorbis.ogg", NULL);
+  uri = gst_filename_to_uri (path, &err);
+  g_free (path);
+  fail_unless (err == NULL);
+
+  g_mutex_init (&data.lock);
+  data.connected = FALSE;
+  data.instances = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      (GDestroyNotify) g_hash_table_unref);
+
+  dc = gst_discoverer_new (5 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "reuse-elements", TRUE, NULL);
+  g_object_get (dc, "reuse-elements", &reuse, NULL);
+  fail_unless (reuse);
+  g_signal_connect (dc, "source-setup",
+      G_CALLBACK (disco_reuse_source_setup_cb), &data);
+
+  /* same results as without re-use */
+  for (i = 0; i < REUSE_NUM; i++) {
+    info = gst_discoverer_discover_uri (dc, uri, &err);
+    fail_unless (info != NULL);
+    fail_unless (err == NULL);
+    fail_unless_equals_int (gst_discoverer_info_get_result (info),
+        GST_DISCOVERER_OK);
+    audio_streams = gst_discoverer_info_get_audio_streams (info);
+    fail_unless_equals_int (g_list_length (audio_streams), 1);
+    gst_discoverer_stream_info_list_free (audio_streams);
+    gst_discoverer_info_unref (info);
+  }
+  g_object_unref (dc);
+
+  /* but the demuxer and the decoder were only created once */
+  fail_unless (data.connected);
+  fail_unless_equals_int (disco_reuse_instances (&data, "oggdemux"), 1);
+  fail_unless_equals_int (disco_reuse_instances (&data, "theoradec"), 1);
+
+  g_hash_table_unref (data.instances);
+  g_mutex_clear (&data.lock);
+  g_free (uri);
+}
+
+GST_END_TEST;
+
+/* discovers all of @uris @num times and returns how long that took in
+ * microseconds */
+static gint64
+disco_reuse_time_uris (gchar ** uris, gboolean reuse_elements, guint num)
+{
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GstDiscovererInfo *info;
+  GList *audio_streams;
+  gint64 start, elapsed;
+  guint i, j;
+
+  dc = gst_discoverer_new (5 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "reuse-elements", reuse_elements, NULL);
+
+  start = g_get_monotonic_time ();
+  for (i = 0; i < num; i++) {
+    for (j = 0; uris[j]; j++) {
+      info = gst_discoverer_discover_uri (dc, uris[j], &err);
+      fail_unless (info != NULL);
+      fail_unless (err == NULL);
+      fail_unless_equals_int (gst_discoverer_info_get_result (info),
+          GST_DISCOVERER_OK);
+      fail_unless_equals_string (gst_discoverer_info_get_uri (info), uris[j]);
+      audio_streams = gst_discoverer_info_get_audio_streams (info);
+      fail_unless_equals_int (g_list_length (audio_streams), 1);
+      gst_discoverer_stream_info_list_free (audio_streams);
+      gst_discoverer_info_unref (info);
+    }
+  }
+  elapsed = g_get_monotonic_time () - start;
+
+  g_object_unref (dc);
+
+  return elapsed;
+}
+
+#define REUSE_TIMING_URIS 4
+#define REUSE_TIMING_NUM 5
+
+GST_START_TEST (test_disco_reuse_elements_timing)
+{
+  GError *err = NULL;
+  gchar *uris[REUSE_TIMING_URIS + 1] = { NULL, };
+  gchar *tmpdir, *path, *name, *contents;
+  gint64 fresh, reused;
+  gsize len;
+  guint i, n;
+
+  if (!have_theora || !have_ogg)
+    return;
+
+  /* copies of the same file under different URIs, so that every discovery
+   * is of a new URI but can use the same elements */
+  path = g_build_filename (GST_TEST_FILES_PATH, "theora-vorbis.ogg", NULL);
+  fail_unless (g_file_get_contents (path, &contents, &len, NULL));
+  g_free (path);
+
+  tmpdir = g_dir_make_tmp ("gst-discoverer-reuse-XXXXXX", NULL);
+  fail_unless (tmpdir != NULL);
+  for (i = 0; i < REUSE_TIMING_URIS; i++) {
+    name = g_strdup_printf ("file-%u.ogg", i);
+    path = g_build_filename (tmpdir, name, NULL);
+    fail_unless (g_file_set_contents (path, contents, len, NULL));
+    uris[i] = gst_filename_to_uri (path, &err);
+    fail_unless (err == NULL);
+    g_free (path);
+    g_free (name);
+  }
+  g_free (contents);
+
+  n = REUSE_TIMING_URIS * REUSE_TIMING_NUM;
+  fresh = disco_reuse_time_uris (uris, FALSE, REUSE_TIMING_NUM);
+  reused = disco_reuse_time_uris (uris, TRUE, REUSE_TIMING_NUM);
+
+  GST_DEBUG ("%u discoveries: %.3f ms per URI, %.3f ms per URI re-using "
+      "elements (%.1f%% saved)", n, fresh / 1000.0 / n, reused / 1000.0 / n,
+      fresh > 0 ? 100.0 * (fresh - reused) / fresh : 0.0);
+
+  for (i = 0; i < REUSE_TIMING_URIS; i++) {
+    path = g_filename_from_uri (uris[i], NULL, NULL);
+    g_unlink (path);
+    g_free (path);
+    g_free (uris[i]);
+  }
+  g_rmdir (tmpdir);
+  g_free (tmpdir);
+}
+
+GST_END_TEST;
+
+static void
+disco_async_discovered_cb (GstDiscoverer * dc, GstDiscovererInfo * info,
+    const GError * err, GList ** uris)
+{
+  const gchar *uri = gst_discoverer_info_get_uri (info);
+
+  GST_INFO ("discovered uri '%s'", uri);
+  fail_unless (*uris != NULL);
+  fail_unless_equals_string (uri, (*uris)->data);
+
+  g_free ((*uris)->data);
+  *uris = g_list_delete_link (*uris, *uris);
+}
+
+GST_START_TEST (test_disco_async_concurrent)
+{
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GMainLoop *loop;
+  GList *uris = NULL, *l;
+  gchar *uri, *missing;
+  gint i;
+
+  dc = gst_discoverer_new (5 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "max-concurrency", 4, NULL);
+
+  /* GST_TEST_FILE comes from makefile CFLAGS */
+  uri = g_filename_to_uri (GST_TEST_FILE, NULL, &err);
+  fail_unless (err == NULL);
+  missing = g_strconcat (uri, ".missing", NULL);
+
+  /* the missing files fail right away and overtake the real ones, results
+   * must still be emitted in order */
+  for (i = 0; i < 10; i++)
+    uris = g_list_append (uris, g_strdup (i % 2 ? missing : uri));
+
+  loop = g_main_loop_new (NULL, FALSE);
+  g_signal_connect (dc, "discovered", G_CALLBACK (disco_async_discovered_cb),
+      &uris);
+  g_signal_connect_swapped (dc, "finished", G_CALLBACK (g_main_loop_quit),
+      loop);
+
+  gst_discoverer_start (dc);
+  for (l = uris; l; l = l->next)
+    fail_unless (gst_discoverer_discover_uri_async (dc, l->data));
+  g_main_loop_run (loop);
+  gst_discoverer_stop (dc);
+
+  /* every URI was discovered */
+  fail_unless (uris == NULL);
+
+  g_main_loop_unref (loop);
+  g_free (missing);
+  g_free (uri);
+  g_object_unref (dc);
+}
+
+GST_END_TEST;
+
 static Suite *
 discoverer_suite (void)
 {
@@ -262,7 +706,34 @@ discoverer_suite (void)
   tcase_add_test (tc_chain, test_disco_sync_reuse_timeout);
   tcase_add_test (tc_chain, test_disco_missing_plugins);
   tcase_add_test (tc_chain, test_disco_serializing);
+  tcase_add_test (tc_chain, test_disco_async_concurrent);
+  tcase_add_test (tc_chain, test_disco_cache);
+  tcase_add_test (tc_chain, test_disco_reuse_elements);
+  tcase_add_test (tc_chain, test_disco_reuse_elements_timing);
   return s;
 }
 
-GST_CHECK_MAIN (discoverer);
+int
+main (int argc, char **argv)
+{
+  gchar *cachedir;
+  int ret;
+  Suite *s;
+
+  /* keep the discovery cache out of the user's cache directory. This has to
+   * happen before GLib looks up the cache directory for the first time, as
+   * it never checks the environment again afterwards. */
+  cachedir = g_dir_make_tmp ("gst-discoverer-cache-XXXXXX", NULL);
+  g_assert (cachedir != NULL);
+  g_setenv ("XDG_CACHE_HOME", cachedir, TRUE);
+
+  gst_check_init (&argc, &argv);
+  s = discoverer_suite ();
+  ret = gst_check_run_suite (s, "discoverer", __FILE__);
+
+  remove_cache_dir (cachedir);
+  g_rmdir (cachedir);
+  g_free (cachedir);
+
+  return ret;
+}
@@ -0,0 +1,47 @@
+/* GStreamer
+ *
+ * Helper to make a GstHarness look like a non-live upstream
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __NON_LIVE_HARNESS_H__
+#define __NON_LIVE_HARNESS_H__
+
+#include <gst/check/gstharness.h>
+
+static GstPadQueryFunction harness_src_query;
+
+static gboolean
+non_live_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  if (GST_QUERY_TYPE (query) == GST_QUERY_LATENCY) {
+    gst_query_set_latency (query, FALSE, 0, GST_CLOCK_TIME_NONE);
+    return TRUE;
+  }
+  return harness_src_query (pad, parent, query);
+}
+
+/* answer latency queries on the source pad of @h as a non-live source, the
+ * audio base classes only batch or parallelize work in non-live pipelines */
+static void
+harness_set_non_live (GstHarness * h)
+{
+  harness_src_query = GST_PAD_QUERYFUNC (h->srcpad);
+  gst_pad_set_query_function (h->srcpad, non_live_src_query);
+}
+
+#endif /* __NON_LIVE_HARNESS_H__ */
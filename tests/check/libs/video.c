@@ -37,6 +37,7 @@
 #include <gst/video/gstvideometa.h>
 #include <gst/video/video-overlay-composition.h>
 #include <string.h>
+#include <math.h>
 
 /* These are from the current/old videotestsrc; we check our new public API
  * in libgstvideo against the old one to make sure the sizes and offsets
@@ -483,6 +484,260 @@ GST_END_TEST;
 #undef WIDTH
 #undef HEIGHT
 
+/* checks the (possibly vectorized) pack/unpack functions of the planar
+ * high bit depth 4:4:4 formats against a straightforward reference */
+#define WIDTH 77
+GST_START_TEST (test_video_formats_pack_unpack_16bit)
+{
+  guint n, num_formats;
+
+  num_formats = get_num_formats ();
+
+  for (n = GST_VIDEO_FORMAT_ENCODED + 1; n < num_formats; ++n) {
+    const GstVideoFormatInfo *vfinfo;
+    GstVideoFormat fmt = n;
+    gpointer data[GST_VIDEO_MAX_PLANES];
+    gint stride[GST_VIDEO_MAX_PLANES];
+    guint16 *planes[4], *unpack_data, *expect;
+    guint i, c, depth, n_comps, x;
+    gboolean is_le;
+
+    vfinfo = gst_video_format_get_info (fmt);
+    n_comps = GST_VIDEO_FORMAT_INFO_N_COMPONENTS (vfinfo);
+    depth = GST_VIDEO_FORMAT_INFO_DEPTH (vfinfo, 0);
+
+    if (GST_VIDEO_FORMAT_INFO_N_PLANES (vfinfo) != n_comps ||
+        (depth != 10 && depth != 12))
+      continue;
+
+    for (c = 0; c < n_comps; c++) {
+      if (GST_VIDEO_FORMAT_INFO_PSTRIDE (vfinfo, c) != 2 ||
+          GST_VIDEO_FORMAT_INFO_W_SUB (vfinfo, c) != 0 ||
+          GST_VIDEO_FORMAT_INFO_DEPTH (vfinfo, c) != depth)
+        break;
+    }
+    if (c != n_comps)
+      continue;
+
+    GST_INFO ("testing %s", gst_video_format_to_string (fmt));
+
+    is_le = GST_VIDEO_FORMAT_INFO_IS_LE (vfinfo);
+    unpack_data = g_new (guint16, WIDTH * 4);
+    expect = g_new (guint16, WIDTH * 4);
+
+    for (c = 0; c < n_comps; c++) {
+      planes[c] = g_new (guint16, WIDTH);
+      for (i = 0; i < WIDTH; i++)
+        planes[c][i] = g_random_int_range (0, 65536);
+      data[GST_VIDEO_FORMAT_INFO_PLANE (vfinfo, c)] = planes[c];
+      stride[GST_VIDEO_FORMAT_INFO_PLANE (vfinfo, c)] = WIDTH * 2;
+    }
+
+    /* unpack at an offset so that the tail handling is exercised too */
+    for (x = 0; x < 4; x++) {
+      guint width = WIDTH - x;
+
+      for (i = 0; i < width; i++) {
+        for (c = 0; c < 4; c++) {
+          guint16 v;
+
+          if (c == 3 && n_comps == 3) {
+            v = 0xffff;
+          } else {
+            v = is_le ? GST_READ_UINT16_LE (planes[c] + x + i) :
+                GST_READ_UINT16_BE (planes[c] + x + i);
+            v <<= 16 - depth;
+            v |= v >> depth;
+          }
+          /* A is the first component of AYUV64/ARGB64 */
+          expect[i * 4 + ((c + 1) & 3)] = v;
+        }
+      }
+      vfinfo->unpack_func (vfinfo, GST_VIDEO_PACK_FLAG_NONE, unpack_data,
+          data, stride, x, 0, width);
+      fail_unless (memcmp (unpack_data, expect, width * 8) == 0);
+    }
+
+    /* pack it again, this must only drop the unused high bits */
+    vfinfo->unpack_func (vfinfo, GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE,
+        unpack_data, data, stride, 0, 0, WIDTH);
+    vfinfo->pack_func (vfinfo, GST_VIDEO_PACK_FLAG_NONE, unpack_data,
+        WIDTH * 8, data, stride, GST_VIDEO_CHROMA_SITE_UNKNOWN, 0, WIDTH);
+
+    for (c = 0; c < n_comps; c++) {
+      for (i = 0; i < WIDTH; i++) {
+        guint16 v = is_le ? GST_READ_UINT16_LE (planes[c] + i) :
+            GST_READ_UINT16_BE (planes[c] + i);
+
+        fail_unless_equals_int (v, unpack_data[i * 4 + ((c + 1) & 3)] >>
+            (16 - depth));
+      }
+      g_free (planes[c]);
+    }
+    g_free (unpack_data);
+    g_free (expect);
+  }
+}
+
+GST_END_TEST;
+#undef WIDTH
+
+/* straightforward unpacking of a line of the 10 bit 4:2:2 and 4:2:0 formats
+ * to AYUV64, as a reference for their vectorized pack/unpack functions */
+static guint16
+v210_sample (const guint8 * group, gint k)
+{
+  return (GST_READ_UINT32_LE (group + (k / 3) * 4) >> ((k % 3) * 10)) & 0x3ff;
+}
+
+static void
+unpack_10bit_reference (const GstVideoInfo * vinfo, const guint8 * vdata,
+    gint x, gint y, gint width, guint16 * d)
+{
+  /* positions of the samples of the 6 pixels in a v210 group */
+  static const gint ypos[] = { 1, 3, 5, 7, 9, 11 };
+  static const gint upos[] = { 0, 0, 4, 4, 8, 8 };
+  static const gint vpos[] = { 2, 2, 6, 6, 10, 10 };
+  gboolean le = GST_VIDEO_FORMAT_INFO_IS_LE (vinfo->finfo);
+  const guint8 *p[3];
+  gint i;
+
+  for (i = 0; i < GST_VIDEO_INFO_N_PLANES (vinfo); i++)
+    p[i] = vdata + GST_VIDEO_INFO_PLANE_OFFSET (vinfo, i) +
+        GST_VIDEO_INFO_PLANE_STRIDE (vinfo, i) * (i == 0 ? y : y / 2);
+
+  for (i = 0; i < width; i++) {
+    gint px = x + i;
+    guint16 Y, U, V;
+
+#define READ_SAMPLE(ptr) (le ? GST_READ_UINT16_LE (ptr) : GST_READ_UINT16_BE (ptr))
+    switch (GST_VIDEO_INFO_FORMAT (vinfo)) {
+      case GST_VIDEO_FORMAT_v210:
+        Y = v210_sample (p[0] + (px / 6) * 16, ypos[px % 6]);
+        U = v210_sample (p[0] + (px / 6) * 16, upos[px % 6]);
+        V = v210_sample (p[0] + (px / 6) * 16, vpos[px % 6]);
+        break;
+      case GST_VIDEO_FORMAT_I420_10LE:
+      case GST_VIDEO_FORMAT_I420_10BE:
+        Y = READ_SAMPLE (p[0] + px * 2);
+        U = READ_SAMPLE (p[1] + (px / 2) * 2);
+        V = READ_SAMPLE (p[2] + (px / 2) * 2);
+        break;
+      case GST_VIDEO_FORMAT_P010_10LE:
+      case GST_VIDEO_FORMAT_P010_10BE:
+        Y = READ_SAMPLE (p[0] + px * 2) >> 6;
+        U = READ_SAMPLE (p[1] + (px / 2) * 4) >> 6;
+        V = READ_SAMPLE (p[1] + (px / 2) * 4 + 2) >> 6;
+        break;
+      default:
+        g_assert_not_reached ();
+    }
+#undef READ_SAMPLE
+
+    d[i * 4 + 0] = 0xffff;
+    d[i * 4 + 1] = (Y << 6) | (Y >> 4);
+    d[i * 4 + 2] = (U << 6) | (U >> 4);
+    d[i * 4 + 3] = (V << 6) | (V >> 4);
+  }
+}
+
+/* checks the vectorized unpack functions of v210, I420_10 and P010 against
+ * the reference and round-trips the lines through their pack functions,
+ * over more than one chunk of pixels and with a partial last chunk */
+#define WIDTH 606
+#define HEIGHT 2
+GST_START_TEST (test_video_formats_pack_unpack_10bit)
+{
+  static const GstVideoFormat formats[] = {
+    GST_VIDEO_FORMAT_v210,
+    GST_VIDEO_FORMAT_I420_10LE, GST_VIDEO_FORMAT_I420_10BE,
+    GST_VIDEO_FORMAT_P010_10LE, GST_VIDEO_FORMAT_P010_10BE
+  };
+  guint n;
+
+  for (n = 0; n < G_N_ELEMENTS (formats); n++) {
+    const GstVideoFormatInfo *vfinfo;
+    GstVideoInfo vinfo;
+    gpointer data[GST_VIDEO_MAX_PLANES], packed[GST_VIDEO_MAX_PLANES];
+    gint stride[GST_VIDEO_MAX_PLANES];
+    guint8 *vdata, *vpacked;
+    guint16 *unpack_data, *expect;
+    gboolean le;
+    gsize i, size;
+    guint p;
+    gint x, y;
+
+    GST_INFO ("testing %s", gst_video_format_to_string (formats[n]));
+
+    vfinfo = gst_video_format_get_info (formats[n]);
+    fail_unless (vfinfo != NULL);
+    fail_unless (vfinfo->unpack_format == GST_VIDEO_FORMAT_AYUV64);
+    le = GST_VIDEO_FORMAT_INFO_IS_LE (vfinfo);
+
+    gst_video_info_init (&vinfo);
+    gst_video_info_set_format (&vinfo, formats[n], WIDTH, HEIGHT);
+    size = GST_VIDEO_INFO_SIZE (&vinfo);
+    vdata = g_malloc (size);
+    vpacked = g_malloc0 (size);
+
+    /* random samples with the unused bits cleared */
+    if (formats[n] == GST_VIDEO_FORMAT_v210) {
+      for (i = 0; i + 4 <= size; i += 4)
+        GST_WRITE_UINT32_LE (vdata + i, g_random_int () & 0x3fffffff);
+    } else {
+      guint16 mask = GST_VIDEO_FORMAT_INFO_SHIFT (vfinfo, 0) ? 0xffc0 : 0x03ff;
+
+      for (i = 0; i + 2 <= size; i += 2) {
+        guint16 v = g_random_int () & mask;
+
+        if (le)
+          GST_WRITE_UINT16_LE (vdata + i, v);
+        else
+          GST_WRITE_UINT16_BE (vdata + i, v);
+      }
+    }
+
+    for (p = 0; p < GST_VIDEO_INFO_N_PLANES (&vinfo); ++p) {
+      data[p] = vdata + GST_VIDEO_INFO_PLANE_OFFSET (&vinfo, p);
+      packed[p] = vpacked + GST_VIDEO_INFO_PLANE_OFFSET (&vinfo, p);
+      stride[p] = GST_VIDEO_INFO_PLANE_STRIDE (&vinfo, p);
+    }
+
+    unpack_data = g_new (guint16, WIDTH * 4);
+    expect = g_new (guint16, WIDTH * 4);
+
+    for (y = 0; y < HEIGHT; y++) {
+      /* v210 can only be unpacked from the start of a line, start at an odd
+       * pixel with the others */
+      for (x = formats[n] == GST_VIDEO_FORMAT_v210 ? 0 : 1; x >= 0; x--) {
+        unpack_10bit_reference (&vinfo, vdata, x, y, WIDTH - x, expect);
+        vfinfo->unpack_func (vfinfo, GST_VIDEO_PACK_FLAG_NONE, unpack_data,
+            data, stride, x, y, WIDTH - x);
+        fail_unless (memcmp (unpack_data, expect, (WIDTH - x) * 8) == 0);
+      }
+
+      vfinfo->pack_func (vfinfo, GST_VIDEO_PACK_FLAG_NONE, unpack_data,
+          WIDTH * 8, packed, stride, GST_VIDEO_CHROMA_SITE_UNKNOWN, y, WIDTH);
+    }
+
+    /* the chroma of the second line was packed with the first */
+    for (y = 0; y < HEIGHT; y++) {
+      unpack_10bit_reference (&vinfo, vdata, 0, y, WIDTH, expect);
+      unpack_10bit_reference (&vinfo, vpacked, 0, y, WIDTH, unpack_data);
+      fail_unless (memcmp (unpack_data, expect, WIDTH * 8) == 0);
+    }
+
+    g_free (unpack_data);
+    g_free (expect);
+    g_free (vpacked);
+    g_free (vdata);
+  }
+}
+
+GST_END_TEST;
+#undef WIDTH
+#undef HEIGHT
+
 GST_START_TEST (test_video_formats)
 {
   guint i;
@@ -1177,6 +1432,162 @@ GST_START_TEST (test_convert_frame_async)
 
 GST_END_TEST;
 
+GST_START_TEST (test_convert_frame_raw)
+{
+  GstVideoInfo vinfo, out_info;
+  GstCaps *from_caps, *to_caps;
+  GstBuffer *from_buffer;
+  GstSample *from_sample, *to_sample, *to_sample2;
+  GstVideoFrame frame;
+  GError *error = NULL;
+  GstMapInfo map, map2;
+
+  gst_video_info_set_format (&vinfo, GST_VIDEO_FORMAT_RGB, 64, 48);
+  from_caps = gst_video_info_to_caps (&vinfo);
+  from_buffer = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&vinfo));
+  gst_buffer_memset (from_buffer, 0, 0xff, GST_VIDEO_INFO_SIZE (&vinfo));
+  from_sample = gst_sample_new (from_buffer, from_caps, NULL, NULL);
+  gst_buffer_unref (from_buffer);
+  gst_caps_unref (from_caps);
+
+  /* missing height is derived from the display aspect ratio */
+  to_caps = gst_caps_from_string ("video/x-raw, format=I420, width=32");
+  to_sample = gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  fail_unless (error == NULL);
+  fail_unless (gst_video_info_from_caps (&out_info,
+          gst_sample_get_caps (to_sample)));
+  fail_unless_equals_int (GST_VIDEO_INFO_FORMAT (&out_info),
+      GST_VIDEO_FORMAT_I420);
+  fail_unless_equals_int (GST_VIDEO_INFO_WIDTH (&out_info), 32);
+  fail_unless_equals_int (GST_VIDEO_INFO_HEIGHT (&out_info), 24);
+  fail_unless_equals_int (GST_VIDEO_INFO_PAR_N (&out_info), 1);
+  fail_unless_equals_int (GST_VIDEO_INFO_PAR_D (&out_info), 1);
+
+  /* the second conversion reuses the converter and gives the same result */
+  to_sample2 = gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample2 != NULL);
+  gst_buffer_map (gst_sample_get_buffer (to_sample), &map, GST_MAP_READ);
+  gst_buffer_map (gst_sample_get_buffer (to_sample2), &map2, GST_MAP_READ);
+  fail_unless_equals_int (map.size, map2.size);
+  fail_unless (memcmp (map.data, map2.data, map.size) == 0);
+  gst_buffer_unmap (gst_sample_get_buffer (to_sample2), &map2);
+  gst_buffer_unmap (gst_sample_get_buffer (to_sample), &map);
+  gst_sample_unref (to_sample2);
+  gst_sample_unref (to_sample);
+  gst_caps_unref (to_caps);
+
+  /* a square output with square pixels gets borders at the top and bottom */
+  to_caps = gst_caps_from_string ("video/x-raw, format=I420, width=32, "
+      "height=32, pixel-aspect-ratio=1/1");
+  to_sample = gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  fail_unless (gst_video_info_from_caps (&out_info,
+          gst_sample_get_caps (to_sample)));
+  fail_unless (gst_video_frame_map (&frame, &out_info,
+          gst_sample_get_buffer (to_sample), GST_MAP_READ));
+  fail_unless (GST_VIDEO_FRAME_COMP_DATA (&frame, 0)[0] < 32);
+  fail_unless (GST_VIDEO_FRAME_COMP_DATA (&frame, 0)[16 *
+          GST_VIDEO_FRAME_COMP_STRIDE (&frame, 0) + 16] > 224);
+  gst_video_frame_unmap (&frame);
+  gst_sample_unref (to_sample);
+  gst_caps_unref (to_caps);
+
+  gst_sample_unref (from_sample);
+}
+
+GST_END_TEST;
+
+#ifndef GST_DISABLE_GST_DEBUG
+static gint convert_cache_created, convert_cache_reused;
+
+static void
+convert_cache_log_func (GstDebugCategory * category, GstDebugLevel level,
+    const gchar * file, const gchar * function, gint line, GObject * object,
+    GstDebugMessage * message, gpointer user_data)
+{
+  const gchar *msg;
+
+  if (g_strcmp0 (function, "convert_frame_cache_acquire") != 0)
+    return;
+
+  msg = gst_debug_message_get (message);
+  if (g_str_has_prefix (msg, "created converter"))
+    g_atomic_int_inc (&convert_cache_created);
+  else if (g_str_has_prefix (msg, "reusing converter"))
+    g_atomic_int_inc (&convert_cache_reused);
+}
+
+GST_START_TEST (test_convert_frame_raw_cache)
+{
+  GstVideoInfo vinfo;
+  GstCaps *from_caps, *to_caps, *other_caps;
+  GstBuffer *from_buffer;
+  GstSample *from_sample, *to_sample;
+  GError *error = NULL;
+
+  gst_debug_set_active (TRUE);
+  gst_debug_set_threshold_for_name ("default", GST_LEVEL_DEBUG);
+  gst_debug_add_log_function (convert_cache_log_func, NULL, NULL);
+
+  gst_video_info_set_format (&vinfo, GST_VIDEO_FORMAT_BGRx, 80, 60);
+  from_caps = gst_video_info_to_caps (&vinfo);
+  from_buffer = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&vinfo));
+  gst_buffer_memset (from_buffer, 0, 0x80, GST_VIDEO_INFO_SIZE (&vinfo));
+  from_sample = gst_sample_new (from_buffer, from_caps, NULL, NULL);
+  gst_buffer_unref (from_buffer);
+  gst_caps_unref (from_caps);
+
+  to_caps = gst_caps_from_string ("video/x-raw, format=NV12, width=40, "
+      "height=30");
+  other_caps = gst_caps_from_string ("video/x-raw, format=Y444, width=40, "
+      "height=30");
+
+  /* the first conversion sets up a converter */
+  to_sample = gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  fail_unless (error == NULL);
+  gst_sample_unref (to_sample);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_created), 1);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_reused), 0);
+
+  /* the same caps again take it from the cache */
+  to_sample = gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  gst_sample_unref (to_sample);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_created), 1);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_reused), 1);
+
+  /* other caps need their own converter, the first one stays cached */
+  to_sample = gst_video_convert_sample (from_sample, other_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  gst_sample_unref (to_sample);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_created), 2);
+
+  to_sample = gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  gst_sample_unref (to_sample);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_created), 2);
+  fail_unless_equals_int (g_atomic_int_get (&convert_cache_reused), 2);
+
+  gst_debug_remove_log_function (convert_cache_log_func);
+  gst_debug_unset_threshold_for_name ("default");
+
+  gst_caps_unref (other_caps);
+  gst_caps_unref (to_caps);
+  gst_sample_unref (from_sample);
+}
+
+GST_END_TEST;
+#endif
+
 GST_START_TEST (test_video_size_from_caps)
 {
   GstVideoInfo vinfo;
@@ -2366,6 +2777,331 @@ GST_START_TEST (test_video_color_convert)
   g_timer_destroy (timer);
 }
 
+GST_END_TEST;
+
+/* fills each component of a little endian 16-bit planar frame */
+static void
+fill_frame_u16le (GstVideoFrame * frame, const guint16 * values)
+{
+  gint c, x, y;
+
+  for (c = 0; c < GST_VIDEO_FRAME_N_COMPONENTS (frame); c++) {
+    guint8 *data = GST_VIDEO_FRAME_COMP_DATA (frame, c);
+    gint stride = GST_VIDEO_FRAME_COMP_STRIDE (frame, c);
+
+    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (frame, c); y++) {
+      guint8 *line = data + y * stride;
+
+      for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (frame, c); x++)
+        GST_WRITE_UINT16_LE (line + x * 2, values[c]);
+    }
+  }
+}
+
+/* runs the 16-bit matrix and gamma stages of the converter through the
+ * BT.709 <-> BT.2020 conversions of 10 and 12 bit content */
+GST_START_TEST (test_video_color_convert_16bit)
+{
+  static const GstVideoFormat formats[] = {
+    GST_VIDEO_FORMAT_I420_10LE, GST_VIDEO_FORMAT_I420_12LE,
+    GST_VIDEO_FORMAT_Y444_10LE, GST_VIDEO_FORMAT_Y444_12LE
+  };
+  static const gchar *colorimetry[][2] = {
+    {GST_VIDEO_COLORIMETRY_BT709, GST_VIDEO_COLORIMETRY_BT2020},
+    {GST_VIDEO_COLORIMETRY_BT2020, GST_VIDEO_COLORIMETRY_BT709}
+  };
+  GTimer *timer;
+  gint i, j, k, l;
+  GArray *array;
+
+  array = g_array_new (FALSE, FALSE, sizeof (ConvertResult));
+
+  timer = g_timer_new ();
+
+  for (i = 0; i < G_N_ELEMENTS (colorimetry); i++) {
+    for (j = 0; j < G_N_ELEMENTS (formats); j++) {
+      GstVideoInfo ininfo;
+      GstVideoFrame inframe;
+      GstBuffer *inbuffer;
+      guint16 values[3];
+      gint depth;
+
+      gst_video_info_set_format (&ininfo, formats[j], WIDTH, HEIGHT);
+      fail_unless (gst_video_colorimetry_from_string (&ininfo.colorimetry,
+              colorimetry[i][0]));
+      inbuffer = gst_buffer_new_and_alloc (ininfo.size);
+      gst_video_frame_map (&inframe, &ininfo, inbuffer, GST_MAP_WRITE);
+
+      /* a dark grey, the chroma must stay neutral in all conversions */
+      depth = GST_VIDEO_INFO_COMP_DEPTH (&ininfo, 0);
+      values[0] = 1 << (depth - 2);
+      values[1] = values[2] = 1 << (depth - 1);
+      fill_frame_u16le (&inframe, values);
+
+      for (k = 0; k < G_N_ELEMENTS (formats); k++) {
+        GstVideoInfo outinfo;
+        GstVideoFrame outframe;
+        GstBuffer *outbuffer;
+        GstVideoConverter *convert;
+        gdouble elapsed;
+        gint count, tolerance;
+        ConvertResult res;
+
+        gst_video_info_set_format (&outinfo, formats[k], WIDTH, HEIGHT);
+        fail_unless (gst_video_colorimetry_from_string (&outinfo.colorimetry,
+                colorimetry[i][1]));
+        outbuffer = gst_buffer_new_and_alloc (outinfo.size);
+        gst_video_frame_map (&outframe, &outinfo, outbuffer, GST_MAP_WRITE);
+
+        convert = gst_video_converter_new (&ininfo, &outinfo,
+            gst_structure_new ("options",
+                GST_VIDEO_CONVERTER_OPT_GAMMA_MODE,
+                GST_TYPE_VIDEO_GAMMA_MODE, GST_VIDEO_GAMMA_MODE_REMAP,
+                GST_VIDEO_CONVERTER_OPT_PRIMARIES_MODE,
+                GST_TYPE_VIDEO_PRIMARIES_MODE, GST_VIDEO_PRIMARIES_MODE_FAST,
+                NULL));
+        /* warmup */
+        gst_video_converter_frame (convert, &inframe, &outframe);
+
+        depth = GST_VIDEO_INFO_COMP_DEPTH (&outinfo, 0);
+        tolerance = 1 << (depth - 5);
+        for (l = 0; l < 3; l++) {
+          guint8 *p = GST_VIDEO_FRAME_COMP_DATA (&outframe, l);
+          gint v = GST_READ_UINT16_LE (p);
+          gint expected = l == 0 ? 1 << (depth - 2) : 1 << (depth - 1);
+
+          fail_unless (ABS (v - expected) <= tolerance,
+              "%s->%s component %d: %d, expected %d",
+              gst_video_format_to_string (formats[j]),
+              gst_video_format_to_string (formats[k]), l, v, expected);
+        }
+
+        count = 0;
+        g_timer_start (timer);
+        while (TRUE) {
+          gst_video_converter_frame (convert, &inframe, &outframe);
+
+          count++;
+          elapsed = g_timer_elapsed (timer, NULL);
+          if (elapsed >= TIME)
+            break;
+        }
+
+        res.infmt = formats[j];
+        res.outfmt = formats[k];
+        res.convert_sec = count / elapsed;
+
+        GST_DEBUG ("%f conversions/sec %s->%s %s->%s, %d/%f",
+            res.convert_sec, gst_video_format_to_string (formats[j]),
+            gst_video_format_to_string (formats[k]), colorimetry[i][0],
+            colorimetry[i][1], count, elapsed);
+
+        g_array_append_val (array, res);
+
+        gst_video_converter_free (convert);
+
+        gst_video_frame_unmap (&outframe);
+        gst_buffer_unref (outbuffer);
+      }
+      gst_video_frame_unmap (&inframe);
+      gst_buffer_unref (inbuffer);
+    }
+  }
+
+  g_array_sort (array, compare_result);
+
+  for (i = 0; i < array->len; i++) {
+    ConvertResult *res = &g_array_index (array, ConvertResult, i);
+
+    GST_DEBUG ("%f conversions/sec %s->%s", res->convert_sec,
+        gst_video_format_to_string (res->infmt),
+        gst_video_format_to_string (res->outfmt));
+  }
+
+  g_array_free (array, TRUE);
+
+  g_timer_destroy (timer);
+}
+
+GST_END_TEST;
+#undef WIDTH
+#undef HEIGHT
+
+/* the 4x4 matrix helpers below follow the steps video-converter.c takes to
+ * build its integer YCbCr -> RGB matrix, in the same order, so that the
+ * coefficients come out identical */
+static void
+matrix_multiply (gdouble dst[4][4], gdouble a[4][4], gdouble b[4][4])
+{
+  gdouble tmp[4][4];
+  gint i, j, k;
+
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 4; j++) {
+      gdouble x = 0;
+      for (k = 0; k < 4; k++)
+        x += a[i][k] * b[k][j];
+      tmp[i][j] = x;
+    }
+  }
+  memcpy (dst, tmp, sizeof (tmp));
+}
+
+static void
+matrix_set_identity (gdouble m[4][4])
+{
+  gint i, j;
+
+  for (i = 0; i < 4; i++)
+    for (j = 0; j < 4; j++)
+      m[i][j] = (i == j);
+}
+
+static void
+matrix_offset (gdouble m[4][4], gdouble a1, gdouble a2, gdouble a3)
+{
+  gdouble a[4][4];
+
+  matrix_set_identity (a);
+  a[0][3] = a1;
+  a[1][3] = a2;
+  a[2][3] = a3;
+  matrix_multiply (m, a, m);
+}
+
+static void
+matrix_scale (gdouble m[4][4], gdouble a1, gdouble a2, gdouble a3)
+{
+  gdouble a[4][4];
+
+  matrix_set_identity (a);
+  a[0][0] = a1;
+  a[1][1] = a2;
+  a[2][2] = a3;
+  matrix_multiply (m, a, m);
+}
+
+static void
+matrix16_YUV_to_RGB (const GstVideoInfo * ininfo,
+    const GstVideoInfo * outinfo, gint im[4][4])
+{
+  gdouble m[4][4], Kr = 0, Kb = 0, Kg;
+  gint offset[4], scale[4], i, j;
+
+  matrix_set_identity (m);
+
+  gst_video_color_range_offsets (ininfo->colorimetry.range, ininfo->finfo,
+      offset, scale);
+  matrix_offset (m, -offset[0], -offset[1], -offset[2]);
+  matrix_scale (m, 1 / ((float) scale[0]), 1 / ((float) scale[1]),
+      1 / ((float) scale[2]));
+
+  fail_unless (gst_video_color_matrix_get_Kr_Kb (ininfo->colorimetry.matrix,
+          &Kr, &Kb));
+  Kg = 1.0 - Kr - Kb;
+  {
+    gdouble k[4][4] = {
+      {1., 0., 2 * (1 - Kr), 0.},
+      {1., -2 * Kb * (1 - Kb) / Kg, -2 * Kr * (1 - Kr) / Kg, 0.},
+      {1., 2 * (1 - Kb), 0., 0.},
+      {0., 0., 0., 1.},
+    };
+    matrix_multiply (m, k, m);
+  }
+
+  gst_video_color_range_offsets (outinfo->colorimetry.range, outinfo->finfo,
+      offset, scale);
+  matrix_scale (m, (float) scale[0], (float) scale[1], (float) scale[2]);
+  matrix_offset (m, offset[0], offset[1], offset[2]);
+
+  matrix_scale (m, 256.0f, 256.0f, 256.0f);
+  for (i = 0; i < 4; i++)
+    for (j = 0; j < 4; j++)
+      im[i][j] = rint (m[i][j]);
+}
+
+#define WIDTH 333
+#define HEIGHT 7
+
+/* compares the 16-bit matrix stage against the scalar arithmetic it
+ * replaces, over random AYUV64 -> ARGB64 frames that also hit the clamping */
+GST_START_TEST (test_video_color_convert_matrix16)
+{
+  static const gchar *colorimetry[] = {
+    GST_VIDEO_COLORIMETRY_BT601, GST_VIDEO_COLORIMETRY_BT709,
+    GST_VIDEO_COLORIMETRY_BT2020
+  };
+  gint i, j, x, y, c;
+
+  for (i = 0; i < G_N_ELEMENTS (colorimetry); i++) {
+    GstVideoInfo ininfo, outinfo;
+    GstVideoFrame inframe, outframe;
+    GstBuffer *inbuffer, *outbuffer;
+    GstVideoConverter *convert;
+    gint im[4][4];
+
+    gst_video_info_set_format (&ininfo, GST_VIDEO_FORMAT_AYUV64, WIDTH,
+        HEIGHT);
+    fail_unless (gst_video_colorimetry_from_string (&ininfo.colorimetry,
+            colorimetry[i]));
+    gst_video_info_set_format (&outinfo, GST_VIDEO_FORMAT_ARGB64, WIDTH,
+        HEIGHT);
+
+    matrix16_YUV_to_RGB (&ininfo, &outinfo, im);
+
+    inbuffer = gst_buffer_new_and_alloc (ininfo.size);
+    outbuffer = gst_buffer_new_and_alloc (outinfo.size);
+    convert = gst_video_converter_new (&ininfo, &outinfo, NULL);
+
+    for (j = 0; j < 4; j++) {
+      gst_video_frame_map (&inframe, &ininfo, inbuffer, GST_MAP_WRITE);
+      for (y = 0; y < HEIGHT; y++) {
+        guint16 *p = (guint16 *) ((guint8 *)
+            GST_VIDEO_FRAME_PLANE_DATA (&inframe, 0) +
+            y * GST_VIDEO_FRAME_PLANE_STRIDE (&inframe, 0));
+
+        for (x = 0; x < WIDTH * 4; x++)
+          p[x] = g_random_int_range (0, 65536);
+      }
+      gst_video_frame_unmap (&inframe);
+
+      gst_video_frame_map (&inframe, &ininfo, inbuffer, GST_MAP_READ);
+      gst_video_frame_map (&outframe, &outinfo, outbuffer, GST_MAP_WRITE);
+      gst_video_converter_frame (convert, &inframe, &outframe);
+
+      for (y = 0; y < HEIGHT; y++) {
+        const guint16 *s = (const guint16 *) ((guint8 *)
+            GST_VIDEO_FRAME_PLANE_DATA (&inframe, 0) +
+            y * GST_VIDEO_FRAME_PLANE_STRIDE (&inframe, 0));
+        const guint16 *d = (const guint16 *) ((guint8 *)
+            GST_VIDEO_FRAME_PLANE_DATA (&outframe, 0) +
+            y * GST_VIDEO_FRAME_PLANE_STRIDE (&outframe, 0));
+
+        for (x = 0; x < WIDTH; x++) {
+          gint Y = s[x * 4 + 1], U = s[x * 4 + 2], V = s[x * 4 + 3];
+
+          fail_unless_equals_int (d[x * 4 + 0], s[x * 4 + 0]);
+          for (c = 0; c < 3; c++) {
+            gint v = (im[c][0] * Y + im[c][1] * U + im[c][2] * V +
+                im[c][3]) >> 8;
+
+            fail_unless (d[x * 4 + 1 + c] == CLAMP (v, 0, 65535),
+                "%s pixel %d,%d component %d: %d, expected %d",
+                colorimetry[i], x, y, c, d[x * 4 + 1 + c],
+                CLAMP (v, 0, 65535));
+          }
+        }
+      }
+      gst_video_frame_unmap (&outframe);
+      gst_video_frame_unmap (&inframe);
+    }
+
+    gst_video_converter_free (convert);
+    gst_buffer_unref (outbuffer);
+    gst_buffer_unref (inbuffer);
+  }
+}
+
 GST_END_TEST;
 #undef WIDTH
 #undef HEIGHT
@@ -2829,6 +3565,260 @@ GST_START_TEST (test_overlay_composition_over_transparency)
 GST_END_TEST;
 
 
+static void
+fill_frame_pattern (GstVideoFrame * frame)
+{
+  guint p, x, y;
+
+  for (p = 0; p < GST_VIDEO_FRAME_N_PLANES (frame); p++) {
+    guint8 *data = GST_VIDEO_FRAME_PLANE_DATA (frame, p);
+    gint stride = GST_VIDEO_FRAME_PLANE_STRIDE (frame, p);
+
+    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (frame, p); y++)
+      for (x = 0; x < stride; x++)
+        data[y * stride + x] = (x * 7 + y * 13 + p) & 0xff;
+  }
+}
+
+static gboolean
+compare_frame_planes (GstVideoFrame * a, GstVideoFrame * b)
+{
+  guint p, y;
+
+  for (p = 0; p < GST_VIDEO_FRAME_N_PLANES (a); p++) {
+    guint w = GST_VIDEO_FRAME_COMP_WIDTH (a, p) *
+        GST_VIDEO_FRAME_COMP_PSTRIDE (a, p);
+
+    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (a, p); y++) {
+      if (memcmp ((guint8 *) GST_VIDEO_FRAME_PLANE_DATA (a, p) +
+              y * GST_VIDEO_FRAME_PLANE_STRIDE (a, p),
+              (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (b, p) +
+              y * GST_VIDEO_FRAME_PLANE_STRIDE (b, p), w) != 0)
+        return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/* checks that the bytes between the end of the lines and the stride
+ * all have @value */
+static gboolean
+check_frame_padding (const GstVideoFrame * frame, guint8 value)
+{
+  guint p, y, x;
+
+  for (p = 0; p < GST_VIDEO_FRAME_N_PLANES (frame); p++) {
+    guint w = GST_VIDEO_FRAME_COMP_WIDTH (frame, p) *
+        GST_VIDEO_FRAME_COMP_PSTRIDE (frame, p);
+    guint stride = GST_VIDEO_FRAME_PLANE_STRIDE (frame, p);
+
+    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (frame, p); y++) {
+      const guint8 *line = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (frame, p) +
+          y * stride;
+
+      for (x = w; x < stride; x++) {
+        if (line[x] != value)
+          return FALSE;
+      }
+    }
+  }
+  return TRUE;
+}
+
+GST_START_TEST (test_video_frame_copy)
+{
+  GstVideoInfo sinfo, dinfo;
+  GstVideoAlignment align;
+  GstVideoFrame src, dest;
+  GstBuffer *sbuf, *dbuf;
+  gint threaded;
+
+  gst_video_info_set_format (&sinfo, GST_VIDEO_FORMAT_I420, 1920, 1080);
+  sbuf = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&sinfo));
+  fail_unless (gst_video_frame_map (&src, &sinfo, sbuf, GST_MAP_READWRITE));
+  fill_frame_pattern (&src);
+
+  /* same layout, copied as whole planes */
+  for (threaded = 0; threaded < 2; threaded++) {
+    dbuf = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&sinfo));
+    gst_buffer_memset (dbuf, 0, 0, GST_VIDEO_INFO_SIZE (&sinfo));
+    fail_unless (gst_video_frame_map (&dest, &sinfo, dbuf, GST_MAP_WRITE));
+    if (threaded)
+      fail_unless (gst_video_frame_copy_threaded (&dest, &src, 4));
+    else
+      fail_unless (gst_video_frame_copy (&dest, &src));
+    fail_unless (compare_frame_planes (&dest, &src));
+    gst_video_frame_unmap (&dest);
+    gst_buffer_unref (dbuf);
+  }
+
+  /* padded destination, copied line by line */
+  dinfo = sinfo;
+  gst_video_alignment_reset (&align);
+  align.padding_right = 64;
+  fail_unless (gst_video_info_align (&dinfo, &align));
+
+  for (threaded = 0; threaded < 2; threaded++) {
+    dbuf = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&dinfo));
+    gst_buffer_memset (dbuf, 0, 0, GST_VIDEO_INFO_SIZE (&dinfo));
+    fail_unless (gst_video_frame_map (&dest, &dinfo, dbuf, GST_MAP_WRITE));
+    if (threaded)
+      fail_unless (gst_video_frame_copy_threaded (&dest, &src, 0));
+    else
+      fail_unless (gst_video_frame_copy (&dest, &src));
+    fail_unless (compare_frame_planes (&dest, &src));
+    gst_video_frame_unmap (&dest);
+    gst_buffer_unref (dbuf);
+  }
+
+  /* padded source and destination with the same stride, the padding of
+   * the destination must be left alone */
+  gst_video_frame_unmap (&src);
+  gst_buffer_unref (sbuf);
+  sbuf = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&dinfo));
+  fail_unless (gst_video_frame_map (&src, &dinfo, sbuf, GST_MAP_READWRITE));
+  fill_frame_pattern (&src);
+
+  for (threaded = 0; threaded < 2; threaded++) {
+    dbuf = gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (&dinfo));
+    gst_buffer_memset (dbuf, 0, 0xaa, GST_VIDEO_INFO_SIZE (&dinfo));
+    fail_unless (gst_video_frame_map (&dest, &dinfo, dbuf, GST_MAP_WRITE));
+    if (threaded)
+      fail_unless (gst_video_frame_copy_threaded (&dest, &src, 0));
+    else
+      fail_unless (gst_video_frame_copy (&dest, &src));
+    fail_unless (compare_frame_planes (&dest, &src));
+    fail_unless (check_frame_padding (&dest, 0xaa));
+    gst_video_frame_unmap (&dest);
+    gst_buffer_unref (dbuf);
+  }
+
+  gst_video_frame_unmap (&src);
+  gst_buffer_unref (sbuf);
+}
+
+GST_END_TEST;
+
+/* acquires a few buffers from a video pool with the given option and checks
+ * that they are sized and aligned as configured, whatever memory backs them */
+static void
+check_video_pool_option (const gchar * option, gint width, gint height,
+    gsize align)
+{
+  GstBufferPool *pool;
+  GstStructure *config;
+  GstVideoAlignment valign;
+  GstAllocationParams params;
+  GstVideoInfo info;
+  GstBuffer *buffers[3];
+  GstCaps *caps;
+  gint i;
+
+  gst_video_info_set_format (&info, GST_VIDEO_FORMAT_I420, width, height);
+  caps = gst_video_info_to_caps (&info);
+
+  gst_allocation_params_init (&params);
+  params.align = align;
+
+  pool = gst_video_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, caps, info.size, 0, 0);
+  gst_buffer_pool_config_set_allocator (config, NULL, &params);
+  gst_buffer_pool_config_add_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_META);
+  gst_buffer_pool_config_add_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT);
+  gst_video_alignment_reset (&valign);
+  valign.padding_right = 16;
+  valign.padding_bottom = 2;
+  for (i = 0; i < GST_VIDEO_MAX_PLANES; i++)
+    valign.stride_align[i] = 31;
+  gst_buffer_pool_config_set_video_alignment (config, &valign);
+  /* the pool raises the stride alignment to the memory alignment */
+  for (i = 0; i < GST_VIDEO_MAX_PLANES; i++)
+    valign.stride_align[i] |= align;
+  /* options the pool does not implement on this platform are ignored */
+  if (option)
+    gst_buffer_pool_config_add_option (config, option);
+  fail_unless (gst_buffer_pool_set_config (pool, config));
+
+  /* the size of the config includes the padding */
+  fail_unless (gst_video_info_align (&info, &valign));
+
+  fail_unless (gst_buffer_pool_set_active (pool, TRUE));
+  for (i = 0; i < G_N_ELEMENTS (buffers); i++) {
+    GstVideoMeta *meta;
+    GstMapInfo map;
+    gint p;
+
+    fail_unless (gst_buffer_pool_acquire_buffer (pool, &buffers[i],
+            NULL) == GST_FLOW_OK);
+    fail_unless (gst_buffer_get_size (buffers[i]) >= info.size,
+        "%s: buffer of %" G_GSIZE_FORMAT " bytes, expected %" G_GSIZE_FORMAT,
+        GST_STR_NULL (option), gst_buffer_get_size (buffers[i]), info.size);
+
+    meta = gst_buffer_get_video_meta (buffers[i]);
+    fail_unless (meta != NULL);
+    fail_unless_equals_int (meta->n_planes, GST_VIDEO_INFO_N_PLANES (&info));
+    for (p = 0; p < meta->n_planes; p++) {
+      fail_unless_equals_int (meta->stride[p],
+          GST_VIDEO_INFO_PLANE_STRIDE (&info, p));
+      fail_unless_equals_int (meta->stride[p] & 31, 0);
+    }
+
+    fail_unless (gst_buffer_map (buffers[i], &map, GST_MAP_WRITE));
+    fail_unless (((guintptr) map.data & align) == 0,
+        "%s: data %p not aligned to %" G_GSIZE_FORMAT,
+        GST_STR_NULL (option), map.data, align + 1);
+    /* all of it must be writable */
+    memset (map.data, i, map.size);
+    gst_buffer_unmap (buffers[i], &map);
+  }
+  for (i = 0; i < G_N_ELEMENTS (buffers); i++)
+    gst_buffer_unref (buffers[i]);
+
+  /* the buffers go back to the pool and come out intact */
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buffers[0],
+          NULL) == GST_FLOW_OK);
+  fail_unless (gst_buffer_get_size (buffers[0]) >= info.size);
+  gst_buffer_unref (buffers[0]);
+
+  fail_unless (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+  gst_caps_unref (caps);
+}
+
+GST_START_TEST (test_video_pool_page_options)
+{
+  static const gchar *options[] = {
+    NULL,
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGEPAGES,
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGETLB,
+    GST_BUFFER_POOL_OPTION_VIDEO_NUMA_LOCAL
+  };
+  GstBufferPool *pool;
+  gint i;
+
+  pool = gst_video_buffer_pool_new ();
+  for (i = 1; i < G_N_ELEMENTS (options); i++)
+    GST_INFO ("%s supported: %d", options[i],
+        gst_buffer_pool_has_option (pool, options[i]));
+  gst_object_unref (pool);
+
+  for (i = 0; i < G_N_ELEMENTS (options); i++) {
+    /* large enough for huge pages */
+    check_video_pool_option (options[i], 1920, 1088, 63);
+    /* falls back to the allocator for frames below the huge page size */
+    check_video_pool_option (options[i], 320, 240, 63);
+    /* a page aligned mapping still satisfies this one */
+    check_video_pool_option (options[i], 1920, 1088, 4095);
+    /* falls back to the allocator for alignments beyond the page size */
+    check_video_pool_option (options[i], 1920, 1088, 8191);
+  }
+}
+
+GST_END_TEST;
+
 static Suite *
 video_suite (void)
 {
@@ -2844,6 +3834,8 @@ video_suite (void)
   tcase_add_test (tc_chain, test_video_formats_rgba_large_dimension);
   tcase_add_test (tc_chain, test_video_formats_all);
   tcase_add_test (tc_chain, test_video_formats_pack_unpack);
+  tcase_add_test (tc_chain, test_video_formats_pack_unpack_16bit);
+  tcase_add_test (tc_chain, test_video_formats_pack_unpack_10bit);
   tcase_add_test (tc_chain, test_guess_framerate);
   tcase_add_test (tc_chain, test_dar_calc);
   tcase_add_test (tc_chain, test_parse_caps_rgb);
@@ -2852,6 +3844,10 @@ video_suite (void)
   tcase_add_test (tc_chain, test_events);
   tcase_add_test (tc_chain, test_convert_frame);
   tcase_add_test (tc_chain, test_convert_frame_async);
+  tcase_add_test (tc_chain, test_convert_frame_raw);
+#ifndef GST_DISABLE_GST_DEBUG
+  tcase_add_test (tc_chain, test_convert_frame_raw_cache);
+#endif
   tcase_add_test (tc_chain, test_video_size_from_caps);
   tcase_add_test (tc_chain, test_overlay_composition);
   tcase_add_test (tc_chain, test_overlay_composition_premultiplied_alpha);
@@ -2860,12 +3856,16 @@ video_suite (void)
   tcase_add_test (tc_chain, test_video_chroma);
   tcase_add_test (tc_chain, test_video_scaler);
   tcase_add_test (tc_chain, test_video_color_convert);
+  tcase_add_test (tc_chain, test_video_color_convert_16bit);
+  tcase_add_test (tc_chain, test_video_color_convert_matrix16);
   tcase_add_test (tc_chain, test_video_size_convert);
   tcase_add_test (tc_chain, test_video_convert);
   tcase_add_test (tc_chain, test_video_transfer);
   tcase_add_test (tc_chain, test_overlay_blend);
   tcase_add_test (tc_chain, test_video_center_rect);
   tcase_add_test (tc_chain, test_overlay_composition_over_transparency);
+  tcase_add_test (tc_chain, test_video_frame_copy);
+  tcase_add_test (tc_chain, test_video_pool_page_options);
 
   return s;
 }